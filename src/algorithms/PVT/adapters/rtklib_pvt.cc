@@ -97,6 +97,8 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.flag_rtcm_server = configuration->property(role + ".flag_rtcm_server", false);
     pvt_output_parameters.rtcm_tcp_port = configuration->property(role + ".rtcm_tcp_port", 2101);
     pvt_output_parameters.rtcm_station_id = configuration->property(role + ".rtcm_station_id", 1234);
+    pvt_output_parameters.rtcm_mountpoints = configuration->property(role + ".rtcm_mountpoints", std::string(""));
+    pvt_output_parameters.rtcm_client_queue_size = configuration->property(role + ".rtcm_client_queue_size", 64);
     // RTCM message rates: least common multiple with output_rate_ms
     const int rtcm_MT1019_rate_ms = bc::lcm(configuration->property(role + ".rtcm_MT1019_rate_ms", 5000), pvt_output_parameters.output_rate_ms);
     const int rtcm_MT1020_rate_ms = bc::lcm(configuration->property(role + ".rtcm_MT1020_rate_ms", 5000), pvt_output_parameters.output_rate_ms);
@@ -619,6 +621,10 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
 
     const int earth_tide = configuration->property(role + ".earth_tide", 0);
 
+    /* Set whether satellite positions and clocks are interpolated from a cache of broadcast orbit nodes instead of
+    being propagated from the ephemeris for every observation. Useful at high PVT output rates. */
+    const int sat_ephemeris = configuration->property(role + ".sat_position_cache", false) ? EPHOPT_BRDCCACHE : EPHOPT_BRDC;
+
     int nsys = 0;
     if ((gps_1C_count > 0) || (gps_2S_count > 0) || (gps_L5_count > 0))
         {
@@ -754,7 +760,7 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         navigation_system,                                                                 /* navigation system  */
         elevation_mask * D2R,                                                              /* elevation mask angle (degrees) */
         snrmask,                                                                           /* snrmask_t snrmask    SNR mask */
-        0,                                                                                 /* satellite ephemeris/clock (EPHOPT_XXX) */
+        sat_ephemeris,                                                                     /* satellite ephemeris/clock (EPHOPT_XXX) */
         integer_ambiguity_resolution_gps,                                                  /* AR mode (0:off,1:continuous,2:instantaneous,3:fix and hold,4:ppp-ar) */
         integer_ambiguity_resolution_glo,                                                  /* GLONASS AR mode (0:off,1:on,2:auto cal,3:ext cal) */
         integer_ambiguity_resolution_bds,                                                  /* BeiDou AR mode (0:off,1:on) */
@@ -829,6 +835,20 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     pvt_output_parameters.nmea_output_file_path = configuration->property(role + ".nmea_output_file_path", default_output_path);
     pvt_output_parameters.rtcm_output_file_path = configuration->property(role + ".rtcm_output_file_path", default_output_path);
 
+    // Write the KML, GPX, GeoJSON, NMEA and AN outputs from background threads
+    pvt_output_parameters.async_output = configuration->property(role + ".async_output", pvt_output_parameters.async_output);
+    pvt_output_parameters.output_queue_size = configuration->property(role + ".output_queue_size", pvt_output_parameters.output_queue_size);
+    pvt_output_parameters.output_queue_policy = configuration->property(role + ".output_queue_policy", pvt_output_parameters.output_queue_policy);
+    if (pvt_output_parameters.output_queue_policy != "block" && pvt_output_parameters.output_queue_policy != "drop")
+        {
+            std::cerr << "Unknown PVT.output_queue_policy " << pvt_output_parameters.output_queue_policy << ", using block\n";
+            pvt_output_parameters.output_queue_policy = std::string("block");
+        }
+    if (pvt_output_parameters.output_queue_size < 1)
+        {
+            pvt_output_parameters.output_queue_size = 1;
+        }
+
     // Read PVT MONITOR Configuration
     pvt_output_parameters.monitor_enabled = configuration->property(role + ".enable_monitor", false);
     pvt_output_parameters.udp_addresses = configuration->property(role + ".monitor_client_addresses", std::string("127.0.0.1"));
@@ -838,12 +858,17 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
         {
             pvt_output_parameters.protobuf_enabled = true;
         }
+    // Fixed-layout records, see monitor_fixed_format.h. Takes precedence over protobuf.
+    pvt_output_parameters.monitor_fixed_format_enabled = configuration->property(role + ".enable_fixed_format", false);
 
     // Read EPHEMERIS MONITOR Configuration
     pvt_output_parameters.monitor_ephemeris_enabled = configuration->property(role + ".enable_monitor_ephemeris", false);
     pvt_output_parameters.udp_eph_addresses = configuration->property(role + ".monitor_ephemeris_client_addresses", std::string("127.0.0.1"));
     pvt_output_parameters.udp_eph_port = configuration->property(role + ".monitor_ephemeris_udp_port", 1234);
 
+    // Send the monitoring datagrams from a dedicated thread
+    pvt_output_parameters.monitor_udp_sender_thread = configuration->property(role + ".monitor_udp_sender_thread", pvt_output_parameters.monitor_udp_sender_thread);
+
     // Show time in local zone
     pvt_output_parameters.show_local_time_zone = configuration->property(role + ".show_local_time_zone", false);
 
@@ -52,6 +52,8 @@
 #include "monitor_pvt_udp_sink.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_output_writer.h"
+#include "pvt_snapshot.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
 #include "rtklib_rtkcmn.h"
@@ -309,7 +311,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     const std::string rtcm_dump_filename = d_dump_filename;
     if (conf_.flag_rtcm_server || conf_.flag_rtcm_tty_port || conf_.rtcm_output_file_enabled)
         {
-            d_rtcm_printer = std::make_unique<Rtcm_Printer>(rtcm_dump_filename, conf_.rtcm_output_file_enabled, conf_.flag_rtcm_server, conf_.flag_rtcm_tty_port, conf_.rtcm_tcp_port, conf_.rtcm_station_id, conf_.rtcm_dump_devname, true, conf_.rtcm_output_file_path);
+            d_rtcm_printer = std::make_unique<Rtcm_Printer>(rtcm_dump_filename, conf_.rtcm_output_file_enabled, conf_.flag_rtcm_server, conf_.flag_rtcm_tty_port, conf_.rtcm_tcp_port, conf_.rtcm_station_id, conf_.rtcm_dump_devname, true, conf_.rtcm_output_file_path, conf_.rtcm_mountpoints, conf_.rtcm_client_queue_size);
             std::map<int, int> rtcm_msg_rate_ms = conf_.rtcm_msg_rate_ms;
             if (rtcm_msg_rate_ms.find(1019) != rtcm_msg_rate_ms.end())
                 {
@@ -444,6 +446,37 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_an_printer = nullptr;
         }
 
+    // Move the KML, GPX, GeoJSON, NMEA and AN printers out of the signal processing thread
+    d_kml_sink = -1;
+    d_gpx_sink = -1;
+    d_geojson_sink = -1;
+    d_nmea_sink = -1;
+    d_an_sink = -1;
+    if (conf_.async_output)
+        {
+            d_output_writer = std::make_unique<Pvt_Output_Writer>(conf_.output_queue_size, Pvt_Output_Writer::policy_from_string(conf_.output_queue_policy));
+            if (d_kml_output_enabled)
+                {
+                    d_kml_sink = d_output_writer->add_sink("KML");
+                }
+            if (d_gpx_output_enabled)
+                {
+                    d_gpx_sink = d_output_writer->add_sink("GPX");
+                }
+            if (d_geojson_output_enabled)
+                {
+                    d_geojson_sink = d_output_writer->add_sink("GeoJSON");
+                }
+            if (d_nmea_output_file_enabled)
+                {
+                    d_nmea_sink = d_output_writer->add_sink("NMEA");
+                }
+            if (d_an_printer_enabled)
+                {
+                    d_an_sink = d_output_writer->add_sink("AN");
+                }
+        }
+
     // PVT MONITOR
     if (d_flag_monitor_pvt_enabled)
         {
@@ -452,7 +485,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled);
+            d_udp_sink_ptr = std::make_unique<Monitor_Pvt_Udp_Sink>(udp_addr_vec, conf_.udp_port, conf_.protobuf_enabled, conf_.monitor_udp_sender_thread, conf_.monitor_fixed_format_enabled);
         }
     else
         {
@@ -467,7 +500,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
 
-            d_eph_udp_sink_ptr = std::make_unique<Monitor_Ephemeris_Udp_Sink>(udp_addr_vec, conf_.udp_eph_port, conf_.protobuf_enabled);
+            d_eph_udp_sink_ptr = std::make_unique<Monitor_Ephemeris_Udp_Sink>(udp_addr_vec, conf_.udp_eph_port, conf_.protobuf_enabled, conf_.monitor_udp_sender_thread);
         }
     else
         {
@@ -534,6 +567,7 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_internal_pvt_solver = std::make_shared<Rtklib_Solver>(internal_rtk, dump_ls_pvt_filename, false, false);
             d_internal_pvt_solver->set_averaging_depth(1);
             d_internal_pvt_solver->set_pre_2009_file(conf_.pre_2009_file);
+            d_internal_pvt_solver->set_clock_offset_only(true);  // only its clock offset is used
         }
     else
         {
@@ -582,6 +616,8 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    // write the pending outputs before the printers go away
+    d_output_writer.reset();
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -1726,6 +1762,17 @@ bool rtklib_pvt_gs::load_gnss_synchro_map_xml(const std::string& file_name)
 }
 
 
+std::shared_ptr<const Pvt_Snapshot> rtklib_pvt_gs::get_pvt_snapshot(std::shared_ptr<const Pvt_Snapshot>& snapshot) const
+{
+    // taken once per epoch, at the first output that needs it
+    if (!snapshot)
+        {
+            snapshot = std::make_shared<const Pvt_Snapshot>(*d_user_pvt_solver, d_nmea_sink != -1);
+        }
+    return snapshot;
+}
+
+
 std::vector<std::string> rtklib_pvt_gs::split_string(const std::string& s, char delim) const
 {
     std::vector<std::string> v;
@@ -1985,6 +2032,7 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
             bool flag_write_RTCM_1045_output = false;
             bool flag_write_RTCM_MSM_output = false;
             bool flag_write_RINEX_obs_output = false;
+            std::shared_ptr<const Pvt_Snapshot> pvt_snapshot;  // shared by the output writer threads
             d_local_counter_ms += static_cast<uint64_t>(d_observable_interval_ms);
 
             d_gnss_observables_map.clear();
@@ -1994,56 +2042,81 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 {
                     if (in[i][epoch].Flag_valid_pseudorange)
                         {
-                            const auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_bds_dnav = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(in[i][epoch].PRN);
-
+                            // Only the ephemeris map of the channel's system is searched.
+                            // The ephemerides found are kept for the RTCM lock time.
+                            const uint32_t prn = in[i][epoch].PRN;
+                            const std::string sig(in[i][epoch].Signal);
                             bool store_valid_observable = false;
-
-                            if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gps->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (std::string(in[i][epoch].Signal) == std::string("1C")) && (tmp_eph_iter_gps->second.SV_health == 0))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gal->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) &&
-                                        (((std::string(in[i][epoch].Signal) == std::string("1B")) && (tmp_eph_iter_gal->second.E1B_DVS == false) && (tmp_eph_iter_gal->second.E1B_HS == 0)) ||
-                                            ((std::string(in[i][epoch].Signal) == std::string("5X")) && (tmp_eph_iter_gal->second.E5a_DVS == false) && (tmp_eph_iter_gal->second.E5a_HS == 0)) ||
-                                            ((std::string(in[i][epoch].Signal) == std::string("7X")) && (tmp_eph_iter_gal->second.E5b_DVS == false) && (tmp_eph_iter_gal->second.E5b_HS == 0))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_cnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal) == std::string("2S")) || (std::string(in[i][epoch].Signal) == std::string("L5")))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_glo_gnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && ((std::string(in[i][epoch].Signal) == std::string("1G")) || (std::string(in[i][epoch].Signal) == std::string("2G"))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_bds_dnav != d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_bds_dnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal) == std::string("B1")) || (std::string(in[i][epoch].Signal) == std::string("B3"))) && (tmp_eph_iter_bds_dnav->second.SV_health == 0)))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                            const Gps_Ephemeris* gps_eph = nullptr;
+                            const Gps_CNAV_Ephemeris* gps_cnav_eph = nullptr;
+                            const Galileo_Ephemeris* gal_eph = nullptr;
+                            const Glonass_Gnav_Ephemeris* glo_gnav_eph = nullptr;
+                            switch (in[i][epoch].System)
+                                {
+                                case 'G':
+                                    {
+                                        const auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(prn);
+                                        if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
+                                            {
+                                                if ((sig == "1C") && (tmp_eph_iter_gps->second.SV_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                                gps_eph = &tmp_eph_iter_gps->second;
+                                            }
+                                        const auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(prn);
+                                        if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
+                                            {
+                                                if ((sig == "2S") || (sig == "L5"))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                                gps_cnav_eph = &tmp_eph_iter_cnav->second;
+                                            }
+                                        break;
+                                    }
+                                case 'E':
+                                    {
+                                        const auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(prn);
+                                        if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
+                                            {
+                                                if (((sig == "1B") && (tmp_eph_iter_gal->second.E1B_DVS == false) && (tmp_eph_iter_gal->second.E1B_HS == 0)) ||
+                                                    ((sig == "5X") && (tmp_eph_iter_gal->second.E5a_DVS == false) && (tmp_eph_iter_gal->second.E5a_HS == 0)) ||
+                                                    ((sig == "7X") && (tmp_eph_iter_gal->second.E5b_DVS == false) && (tmp_eph_iter_gal->second.E5b_HS == 0)))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                                gal_eph = &tmp_eph_iter_gal->second;
+                                            }
+                                        break;
+                                    }
+                                case 'R':
+                                    {
+                                        const auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(prn);
+                                        if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                            {
+                                                if ((sig == "1G") || (sig == "2G"))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                                glo_gnav_eph = &tmp_eph_iter_glo_gnav->second;
+                                            }
+                                        break;
+                                    }
+                                case 'C':
+                                    {
+                                        const auto tmp_eph_iter_bds_dnav = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(prn);
+                                        if (tmp_eph_iter_bds_dnav != d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                                            {
+                                                if (((sig == "B1") || (sig == "B3")) && (tmp_eph_iter_bds_dnav->second.SV_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                default:
+                                    break;
                                 }
 
                             if (store_valid_observable)
@@ -2056,33 +2129,21 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                 {
                                     try
                                         {
-                                            if (d_internal_pvt_solver->gps_ephemeris_map.empty() == false)
+                                            if (gps_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gps_eph, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->galileo_ephemeris_map.empty() == false)
+                                            if (gal_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gal_eph, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.empty() == false)
+                                            if (gps_cnav_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gps_cnav_eph, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
                                                 }
-                                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.empty() == false)
+                                            if (glo_gnav_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*glo_gnav_eph, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
                                                 }
                                         }
                                     catch (const boost::exception& ex)
@@ -2331,28 +2392,64 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                         {
                                             if (current_RX_time_ms % d_kml_rate_ms == 0)
                                                 {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get(), false);
+                                                    if (d_output_writer)
+                                                        {
+                                                            d_output_writer->publish(d_kml_sink, [printer = d_kml_dump.get(), snapshot = get_pvt_snapshot(pvt_snapshot)]() {
+                                                                printer->print_position(snapshot.get(), false);
+                                                            });
+                                                        }
+                                                    else
+                                                        {
+                                                            d_kml_dump->print_position(d_user_pvt_solver.get(), false);
+                                                        }
                                                 }
                                         }
                                     if (d_gpx_output_enabled)
                                         {
                                             if (current_RX_time_ms % d_gpx_rate_ms == 0)
                                                 {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get(), false);
+                                                    if (d_output_writer)
+                                                        {
+                                                            d_output_writer->publish(d_gpx_sink, [printer = d_gpx_dump.get(), snapshot = get_pvt_snapshot(pvt_snapshot)]() {
+                                                                printer->print_position(snapshot.get(), false);
+                                                            });
+                                                        }
+                                                    else
+                                                        {
+                                                            d_gpx_dump->print_position(d_user_pvt_solver.get(), false);
+                                                        }
                                                 }
                                         }
                                     if (d_geojson_output_enabled)
                                         {
                                             if (current_RX_time_ms % d_geojson_rate_ms == 0)
                                                 {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get(), false);
+                                                    if (d_output_writer)
+                                                        {
+                                                            d_output_writer->publish(d_geojson_sink, [printer = d_geojson_printer.get(), snapshot = get_pvt_snapshot(pvt_snapshot)]() {
+                                                                printer->print_position(snapshot.get(), false);
+                                                            });
+                                                        }
+                                                    else
+                                                        {
+                                                            d_geojson_printer->print_position(d_user_pvt_solver.get(), false);
+                                                        }
                                                 }
                                         }
                                     if (d_nmea_output_file_enabled)
                                         {
                                             if (current_RX_time_ms % d_nmea_rate_ms == 0)
                                                 {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get(), false);
+                                                    if (d_output_writer)
+                                                        {
+                                                            d_output_writer->publish(d_nmea_sink, [printer = d_nmea_printer.get(), snapshot = get_pvt_snapshot(pvt_snapshot)]() {
+                                                                printer->Print_Nmea_Line(snapshot.get(), false);
+                                                            });
+                                                        }
+                                                    else
+                                                        {
+                                                            d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get(), false);
+                                                        }
                                                 }
                                         }
                                     if (d_rinex_output_enabled)
@@ -2448,7 +2545,7 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                 }
                             if (d_flag_monitor_pvt_enabled)
                                 {
-                                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                                    d_udp_sink_ptr->queue_monitor_pvt(monitor_pvt.get());
                                 }
                         }
                 }
@@ -2456,10 +2553,25 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 {
                     if (d_local_counter_ms % static_cast<uint64_t>(d_an_rate_ms) == 0)
                         {
-                            d_an_printer->print_packet(d_user_pvt_solver.get(), d_gnss_observables_map);
+                            if (d_output_writer)
+                                {
+                                    d_output_writer->publish(d_an_sink, [printer = d_an_printer.get(), snapshot = get_pvt_snapshot(pvt_snapshot), observables = d_gnss_observables_map]() {
+                                        printer->print_packet(snapshot.get(), observables);
+                                    });
+                                }
+                            else
+                                {
+                                    d_an_printer->print_packet(d_user_pvt_solver.get(), d_gnss_observables_map);
+                                }
                         }
                 }
         }
 
+    if (d_flag_monitor_pvt_enabled)
+        {
+            // send the epochs of this call in a single batch
+            d_udp_sink_ptr->flush();
+        }
+
     return noutput_items;
 }
@@ -58,6 +58,8 @@ class Monitor_Pvt_Udp_Sink;
 class Monitor_Ephemeris_Udp_Sink;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Output_Writer;
+class Pvt_Snapshot;
 class Rinex_Printer;
 class Rtcm_Printer;
 class An_Packet_Printer;
@@ -168,6 +170,8 @@ private:
     bool save_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
     bool load_gnss_synchro_map_xml(const std::string& file_name);  // debug helper function
 
+    std::shared_ptr<const Pvt_Snapshot> get_pvt_snapshot(std::shared_ptr<const Pvt_Snapshot>& snapshot) const;
+
     std::fstream d_log_timetag_file;
 
     std::shared_ptr<Rtklib_Solver> d_internal_pvt_solver;
@@ -183,6 +187,7 @@ private:
     std::unique_ptr<Monitor_Ephemeris_Udp_Sink> d_eph_udp_sink_ptr;
     std::unique_ptr<Has_Simple_Printer> d_has_simple_printer;
     std::unique_ptr<An_Packet_Printer> d_an_printer;
+    std::unique_ptr<Pvt_Output_Writer> d_output_writer;
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
@@ -247,6 +252,12 @@ private:
     key_t d_sysv_msg_key;
     int d_sysv_msqid;
 
+    int d_kml_sink;
+    int d_gpx_sink;
+    int d_geojson_sink;
+    int d_nmea_sink;
+    int d_an_sink;
+
     int32_t d_rinexobs_rate_ms;
     int32_t d_rtcm_MT1045_rate_ms;  // Galileo Broadcast Ephemeris
     int32_t d_rtcm_MT1019_rate_ms;  // GPS Broadcast Ephemeris (orbits)
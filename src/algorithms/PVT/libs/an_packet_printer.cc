@@ -19,7 +19,7 @@
 
 
 #include "an_packet_printer.h"
-#include "rtklib_solver.h"  // for Rtklib_Solver
+#include "pvt_solution.h"    // for Pvt_Solution
 #include <glog/logging.h>   // for DLOG
 #include <cmath>            // for M_PI
 #include <cstring>          // for memcpy
@@ -55,7 +55,7 @@ An_Packet_Printer::~An_Packet_Printer()
 }
 
 
-bool An_Packet_Printer::print_packet(const Rtklib_Solver* const pvt_data, const std::map<int, Gnss_Synchro>& gnss_observables_map)
+bool An_Packet_Printer::print_packet(const Pvt_Solution* const pvt_data, const std::map<int, Gnss_Synchro>& gnss_observables_map)
 {
     an_packet_t an_packet{};
     sdr_gnss_packet_t sdr_gnss_packet{};
@@ -91,7 +91,7 @@ void An_Packet_Printer::close_serial() const
  * @param  NavData_t* pointer to input packet with all the information
  * @reval  None
  */
-void An_Packet_Printer::update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Rtklib_Solver* const pvt, const std::map<int, Gnss_Synchro>& gnss_observables_map) const
+void An_Packet_Printer::update_sdr_gnss_packet(sdr_gnss_packet_t* _packet, const Pvt_Solution* const pvt, const std::map<int, Gnss_Synchro>& gnss_observables_map) const
 {
     std::chrono::time_point<std::chrono::system_clock> this_epoch;
     std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
@@ -22,7 +22,7 @@
 #include "gps_ephemeris.h"
 #include "serdes_galileo_eph.h"
 #include "serdes_gps_eph.h"
-#include <boost/asio.hpp>
+#include "udp_datagram_sender.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,26 +33,17 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Monitor_Ephemeris_Udp_Sink
 {
 public:
-    Monitor_Ephemeris_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled);
+    Monitor_Ephemeris_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled, bool sender_thread = false);
     bool write_gps_ephemeris(const std::shared_ptr<Gps_Ephemeris>& monitor_gps_eph);
     bool write_galileo_ephemeris(const std::shared_ptr<Galileo_Ephemeris>& monitor_gal_eph);
 
 private:
     Serdes_Galileo_Eph serdes_gal;
     Serdes_Gps_Eph serdes_gps;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
     bool use_protobuf;
 };
 
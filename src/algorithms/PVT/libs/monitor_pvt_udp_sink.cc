@@ -17,59 +17,110 @@
 
 #include "monitor_pvt_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
-#include <sstream>
 
 
 Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool protobuf_enabled) : socket{io_context},
-                             use_protobuf(protobuf_enabled)
+    bool protobuf_enabled,
+    bool sender_thread,
+    bool fixed_format_enabled) : sender(addresses, port, sender_thread),
+                                 fixed_writer(FIXED_FORMAT_MONITOR_PVT),
+                                 use_protobuf(protobuf_enabled),
+                                 use_fixed_format(fixed_format_enabled)
 {
-    for (const auto& address : addresses)
+}
+
+
+void Monitor_Pvt_Udp_Sink::serialize(const Monitor_Pvt* const monitor_pvt)
+{
+    if (use_protobuf == false)
+        {
+            boost::archive::binary_oarchive oa{sender.stream()};
+            oa << *monitor_pvt;
+        }
+    else
         {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
+            serdes.appendProtobuffer(monitor_pvt, sender.buffer());
         }
+}
+
 
-    if (use_protobuf)
+bool Monitor_Pvt_Udp_Sink::append_fixed_record(const Monitor_Pvt* const monitor_pvt)
+{
+    if (!fixed_writer.is_open())
+        {
+            fixed_writer.begin(sender.buffer());
+        }
+    Monitor_Pvt_Record r{};
+    r.TOW_at_current_symbol_ms = monitor_pvt->TOW_at_current_symbol_ms;
+    r.week = monitor_pvt->week;
+    r.RX_time = monitor_pvt->RX_time;
+    r.user_clk_offset = monitor_pvt->user_clk_offset;
+    r.pos_x = monitor_pvt->pos_x;
+    r.pos_y = monitor_pvt->pos_y;
+    r.pos_z = monitor_pvt->pos_z;
+    r.vel_x = monitor_pvt->vel_x;
+    r.vel_y = monitor_pvt->vel_y;
+    r.vel_z = monitor_pvt->vel_z;
+    r.cov_xx = monitor_pvt->cov_xx;
+    r.cov_yy = monitor_pvt->cov_yy;
+    r.cov_zz = monitor_pvt->cov_zz;
+    r.cov_xy = monitor_pvt->cov_xy;
+    r.cov_yz = monitor_pvt->cov_yz;
+    r.cov_zx = monitor_pvt->cov_zx;
+    r.latitude = monitor_pvt->latitude;
+    r.longitude = monitor_pvt->longitude;
+    r.height = monitor_pvt->height;
+    r.valid_sats = monitor_pvt->valid_sats;
+    r.solution_status = monitor_pvt->solution_status;
+    r.solution_type = monitor_pvt->solution_type;
+    r.AR_ratio_factor = monitor_pvt->AR_ratio_factor;
+    r.AR_ratio_threshold = monitor_pvt->AR_ratio_threshold;
+    r.gdop = monitor_pvt->gdop;
+    r.pdop = monitor_pvt->pdop;
+    r.hdop = monitor_pvt->hdop;
+    r.vdop = monitor_pvt->vdop;
+    r.user_clk_drift_ppm = monitor_pvt->user_clk_drift_ppm;
+    fixed_writer.append(r);
+    if (fixed_writer.full())
         {
-            serdes = Serdes_Monitor_Pvt();
+            fixed_writer.end();
+            return sender.queue();
         }
+    return true;
 }
 
 
 bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* const monitor_pvt)
 {
-    std::string outbound_data;
-    if (use_protobuf == false)
+    if (use_fixed_format)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
-            oa << *monitor_pvt;
-            outbound_data = archive_stream.str();
+            const bool queued = append_fixed_record(monitor_pvt);
+            return flush() && queued;
         }
-    else
+    serialize(monitor_pvt);
+    return sender.send();
+}
+
+
+bool Monitor_Pvt_Udp_Sink::queue_monitor_pvt(const Monitor_Pvt* const monitor_pvt)
+{
+    if (use_fixed_format)
         {
-            outbound_data = serdes.createProtobuffer(monitor_pvt);
+            return append_fixed_record(monitor_pvt);
         }
+    serialize(monitor_pvt);
+    return sender.queue();
+}
 
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
 
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            return false;
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
+bool Monitor_Pvt_Udp_Sink::flush()
+{
+    bool queued = true;
+    if (fixed_writer.is_open())
+        {
+            fixed_writer.end();
+            queued = sender.queue();
         }
-    return true;
+    return sender.flush() && queued;
 }
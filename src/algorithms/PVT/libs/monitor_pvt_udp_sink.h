@@ -18,9 +18,10 @@
 #ifndef GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 #define GNSS_SDR_MONITOR_PVT_UDP_SINK_H
 
+#include "monitor_fixed_format.h"
 #include "monitor_pvt.h"
 #include "serdes_monitor_pvt.h"
-#include <boost/asio.hpp>
+#include "udp_datagram_sender.h"
 #include <memory>
 #include <string>
 #include <vector>
@@ -31,25 +32,22 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Monitor_Pvt_Udp_Sink
 {
 public:
-    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled);
-    bool write_monitor_pvt(const Monitor_Pvt* const monitor_pvt);
+    Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled, bool sender_thread = false, bool fixed_format_enabled = false);
+    bool write_monitor_pvt(const Monitor_Pvt* const monitor_pvt);  //!< Sends right away
+    bool queue_monitor_pvt(const Monitor_Pvt* const monitor_pvt);  //!< Sent at the next flush()
+    bool flush();
 
 private:
+    void serialize(const Monitor_Pvt* const monitor_pvt);
+    bool append_fixed_record(const Monitor_Pvt* const monitor_pvt);
     Serdes_Monitor_Pvt serdes;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
+    Fixed_Format_Writer<Monitor_Pvt_Record> fixed_writer;
     bool use_protobuf;
+    bool use_fixed_format;
 };
 
 
@@ -22,6 +22,7 @@
 #include "nmea_printer.h"
 #include "gnss_sdr_filesystem.h"
 #include "rtklib_solution.h"
+#include "pvt_snapshot.h"
 #include "rtklib_solver.h"
 #include <glog/logging.h>
 #include <array>
@@ -101,7 +102,8 @@ Nmea_Printer::Nmea_Printer(const std::string& filename,
             nmea_dev_descriptor = -1;
         }
     print_avg_pos = false;
-    d_PVT_data = nullptr;
+    d_sol = nullptr;
+    d_ssat = nullptr;
 }
 
 
@@ -193,9 +195,29 @@ void Nmea_Printer::close_serial() const
 bool Nmea_Printer::Print_Nmea_Line(const Rtklib_Solver* const pvt_data, bool print_average_values)
 {
     // set the new PVT data
-    d_PVT_data = pvt_data;
+    d_sol = &pvt_data->pvt_sol;
+    d_ssat = pvt_data->pvt_ssat.data();
     print_avg_pos = print_average_values;
+    return print_nmea_sentences();
+}
+
+
+bool Nmea_Printer::Print_Nmea_Line(const Pvt_Snapshot* const pvt_data, bool print_average_values)
+{
+    if (pvt_data->pvt_ssat.size() != MAXSAT)
+        {
+            DLOG(INFO) << "NMEA printer needs a PVT snapshot with satellite status";
+            return false;
+        }
+    d_sol = &pvt_data->pvt_sol;
+    d_ssat = pvt_data->pvt_ssat.data();
+    print_avg_pos = print_average_values;
+    return print_nmea_sentences();
+}
 
+
+bool Nmea_Printer::print_nmea_sentences()
+{
     // generate the NMEA sentences
 
     // GPRMC
@@ -396,7 +418,7 @@ std::string Nmea_Printer::get_GPRMC() const
     // Sample -> $GPRMC,161229.487,A,3723.2475,N,12158.3416,W,0.13,309.62,120598,*10
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_rmc(buff.data(), &d_PVT_data->pvt_sol);
+    outnmea_rmc(buff.data(), d_sol);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -408,7 +430,7 @@ std::string Nmea_Printer::get_GPGSA() const
     // GSA-GNSS DOP and Active Satellites
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsa(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsa(buff.data(), d_sol, d_ssat);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -421,7 +443,7 @@ std::string Nmea_Printer::get_GPGSV() const
     // Notice that NMEA 2.1 only supports 12 channels
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gsv(buff.data(), &d_PVT_data->pvt_sol, d_PVT_data->pvt_ssat.data());
+    outnmea_gsv(buff.data(), d_sol, d_ssat);
     sentence_str << buff.data();
     return sentence_str.str();
 }
@@ -431,7 +453,7 @@ std::string Nmea_Printer::get_GPGGA() const
 {
     std::stringstream sentence_str;
     std::array<unsigned char, 1024> buff{};
-    outnmea_gga(buff.data(), &d_PVT_data->pvt_sol);
+    outnmea_gga(buff.data(), d_sol);
     sentence_str << buff.data();
     return sentence_str.str();
     // $GPGGA,104427.591,5920.7009,N,01803.2938,E,1,05,3.3,78.2,M,23.2,M,0.0,0000*4A
@@ -22,6 +22,7 @@
 #ifndef GNSS_SDR_NMEA_PRINTER_H
 #define GNSS_SDR_NMEA_PRINTER_H
 
+#include "rtklib.h"
 #include <boost/date_time/posix_time/ptime.hpp>  // for ptime
 #include <fstream>                               // for ofstream
 #include <memory>                                // for shared_ptr
@@ -33,6 +34,7 @@
  * \{ */
 
 
+class Pvt_Snapshot;
 class Rtklib_Solver;
 
 /*!
@@ -59,7 +61,13 @@ public:
      */
     bool Print_Nmea_Line(const Rtklib_Solver* const pvt_data, bool print_average_values);
 
+    /*!
+     * \brief Print NMEA PVT and satellite info from a snapshot taken with its satellite status
+     */
+    bool Print_Nmea_Line(const Pvt_Snapshot* const pvt_data, bool print_average_values);
+
 private:
+    bool print_nmea_sentences();
     int init_serial(const std::string& serial_device);  // serial port control
     void close_serial() const;
     std::string get_GPGGA() const;  // fix data
@@ -71,7 +79,8 @@ private:
     std::string latitude_to_hm(double lat) const;
     char checkSum(const std::string& sentence) const;
 
-    const Rtklib_Solver* d_PVT_data;
+    const sol_t* d_sol;
+    const ssat_t* d_ssat;
 
     std::ofstream nmea_file_descriptor;  // Output file stream for NMEA log file
 
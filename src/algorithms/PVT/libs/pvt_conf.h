@@ -37,6 +37,7 @@ public:
     std::string nmea_dump_filename;
     std::string nmea_dump_devname;
     std::string rtcm_dump_devname;
+    std::string rtcm_mountpoints;
     std::string an_dump_devname;
     std::string output_path = std::string(".");
     std::string rinex_output_path = std::string(".");
@@ -48,6 +49,7 @@ public:
     std::string rtcm_output_file_path = std::string(".");
     std::string udp_addresses;
     std::string udp_eph_addresses;
+    std::string output_queue_policy = std::string("block");
 
     uint32_t type_of_receiver = 0;
     uint32_t observable_interval_ms = 20;
@@ -65,6 +67,8 @@ public:
     int udp_port = 0;
     int udp_eph_port = 0;
     int rtk_trace_level = 0;
+    int output_queue_size = 64;
+    int rtcm_client_queue_size = 64;
 
     uint16_t rtcm_tcp_port = 0;
     uint16_t rtcm_station_id = 0;
@@ -81,9 +85,12 @@ public:
     bool kml_output_enabled = true;
     bool xml_output_enabled = true;
     bool rtcm_output_file_enabled = true;
+    bool async_output = false;
     bool monitor_enabled = false;
     bool monitor_ephemeris_enabled = false;
+    bool monitor_udp_sender_thread = false;
     bool protobuf_enabled = true;
+    bool monitor_fixed_format_enabled = false;
     bool enable_rx_clock_correction = true;
     bool show_local_time_zone = false;
     bool pre_2009_file = false;
@@ -0,0 +1,277 @@
+/*!
+ * \file pvt_output_writer.cc
+ * \brief Implementation of a class that runs the PVT output printers in
+ * background threads, fed through bounded lock-free queues
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_writer.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+
+class Pvt_Output_Writer::Sink
+{
+public:
+    Sink(std::string name, size_t capacity)
+        : d_name(std::move(name)),
+          d_ring(capacity),
+          d_mask(capacity - 1)
+    {
+        d_thread = std::thread([this]() { run(); });
+    }
+
+    ~Sink()
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_stop.store(true);
+        }
+        d_cv.notify_one();
+        if (d_thread.joinable())
+            {
+                d_thread.join();
+            }
+    }
+
+    bool push(Job&& job, Policy policy)
+    {
+        const size_t tail = d_tail.load(std::memory_order_relaxed);
+        size_t backlog = tail - d_head.load(std::memory_order_acquire);
+        while (backlog > d_mask)
+            {
+                if (policy == Policy::drop)
+                    {
+                        d_dropped.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                wake();
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+                backlog = tail - d_head.load(std::memory_order_acquire);
+            }
+        Slot& slot = d_ring[tail & d_mask];
+        slot.job = std::move(job);
+        slot.timestamp = std::chrono::steady_clock::now();
+        d_tail.store(tail + 1, std::memory_order_seq_cst);
+        d_published.fetch_add(1, std::memory_order_relaxed);
+        if (backlog + 1 > d_max_backlog.load(std::memory_order_relaxed))
+            {
+                d_max_backlog.store(backlog + 1, std::memory_order_relaxed);
+            }
+        if (d_sleeping.load(std::memory_order_seq_cst))
+            {
+                wake();
+            }
+        return true;
+    }
+
+    void wait_empty() const
+    {
+        while (d_head.load(std::memory_order_acquire) != d_tail.load(std::memory_order_acquire))
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(200));
+            }
+    }
+
+    Pvt_Output_Stats stats() const
+    {
+        Pvt_Output_Stats s;
+        s.name = d_name;
+        s.published = d_published.load(std::memory_order_relaxed);
+        s.written = d_written.load(std::memory_order_relaxed);
+        s.dropped = d_dropped.load(std::memory_order_relaxed);
+        s.backlog = d_tail.load(std::memory_order_acquire) - d_head.load(std::memory_order_acquire);
+        s.max_backlog = d_max_backlog.load(std::memory_order_relaxed);
+        if (s.written > 0)
+            {
+                s.mean_latency_us = static_cast<double>(d_latency_sum_ns.load(std::memory_order_relaxed)) / static_cast<double>(s.written) / 1e3;
+            }
+        s.max_latency_us = static_cast<double>(d_latency_max_ns.load(std::memory_order_relaxed)) / 1e3;
+        return s;
+    }
+
+private:
+    struct Slot
+    {
+        Job job;
+        std::chrono::steady_clock::time_point timestamp;
+    };
+
+    void wake()
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_cv.notify_one();
+    }
+
+    void run()
+    {
+        while (true)
+            {
+                const size_t head = d_head.load(std::memory_order_relaxed);
+                if (head == d_tail.load(std::memory_order_seq_cst))
+                    {
+                        if (d_stop.load())
+                            {
+                                return;
+                            }
+                        std::unique_lock<std::mutex> lock(d_mutex);
+                        d_sleeping.store(true, std::memory_order_seq_cst);
+                        // the timeout only guards against a missed notification
+                        d_cv.wait_for(lock, std::chrono::milliseconds(100), [this, head]() {
+                            return d_stop.load() || head != d_tail.load(std::memory_order_seq_cst);
+                        });
+                        d_sleeping.store(false, std::memory_order_relaxed);
+                        continue;
+                    }
+
+                Slot& slot = d_ring[head & d_mask];
+                try
+                    {
+                        slot.job();
+                    }
+                catch (const std::exception& e)
+                    {
+                        LOG(WARNING) << "Exception in PVT output sink " << d_name << ": " << e.what();
+                    }
+                const auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - slot.timestamp).count();
+                slot.job = nullptr;  // release the snapshot before handing the slot back
+                d_written.fetch_add(1, std::memory_order_relaxed);
+                d_latency_sum_ns.fetch_add(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+                if (static_cast<uint64_t>(latency) > d_latency_max_ns.load(std::memory_order_relaxed))
+                    {
+                        d_latency_max_ns.store(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+                    }
+                d_head.store(head + 1, std::memory_order_release);
+            }
+    }
+
+    std::string d_name;
+    std::vector<Slot> d_ring;
+    size_t d_mask;
+
+    alignas(64) std::atomic<size_t> d_head{0};  // written by the writer thread only
+    alignas(64) std::atomic<size_t> d_tail{0};  // written by the publisher only
+
+    std::atomic<uint64_t> d_published{0};
+    std::atomic<uint64_t> d_written{0};
+    std::atomic<uint64_t> d_dropped{0};
+    std::atomic<size_t> d_max_backlog{0};
+    std::atomic<uint64_t> d_latency_sum_ns{0};
+    std::atomic<uint64_t> d_latency_max_ns{0};
+
+    std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::atomic<bool> d_sleeping{false};
+    std::atomic<bool> d_stop{false};
+    std::thread d_thread;
+};
+
+
+Pvt_Output_Writer::Pvt_Output_Writer(size_t queue_size, Policy policy)
+    : d_queue_size(1),
+      d_policy(policy)
+{
+    while (d_queue_size < std::max<size_t>(queue_size, 2))
+        {
+            d_queue_size <<= 1;
+        }
+}
+
+
+Pvt_Output_Writer::~Pvt_Output_Writer()
+{
+    // Execute the pending jobs first, so that the counters are final
+    flush();
+    for (const auto& s : get_stats())
+        {
+            if (s.dropped > 0)
+                {
+                    LOG(WARNING) << "PVT output sink " << s.name << ": " << s.written << " written, "
+                                 << s.dropped << " dropped because its queue was full, max backlog "
+                                 << s.max_backlog << ", mean latency " << s.mean_latency_us
+                                 << " us, max latency " << s.max_latency_us << " us";
+                }
+            else
+                {
+                    LOG(INFO) << "PVT output sink " << s.name << ": " << s.written << " written, "
+                              << "none dropped, max backlog " << s.max_backlog
+                              << ", mean latency " << s.mean_latency_us << " us, max latency "
+                              << s.max_latency_us << " us";
+                }
+        }
+    d_sinks.clear();
+}
+
+
+int Pvt_Output_Writer::add_sink(const std::string& name)
+{
+    d_sinks.push_back(std::make_unique<Sink>(name, d_queue_size));
+    return static_cast<int>(d_sinks.size()) - 1;
+}
+
+
+bool Pvt_Output_Writer::publish(int sink, Job job)
+{
+    if (sink < 0 || sink >= static_cast<int>(d_sinks.size()))
+        {
+            return false;
+        }
+    return d_sinks[sink]->push(std::move(job), d_policy);
+}
+
+
+void Pvt_Output_Writer::flush()
+{
+    for (const auto& sink : d_sinks)
+        {
+            sink->wait_empty();
+        }
+}
+
+
+Pvt_Output_Stats Pvt_Output_Writer::get_stats(int sink) const
+{
+    if (sink < 0 || sink >= static_cast<int>(d_sinks.size()))
+        {
+            return {};
+        }
+    return d_sinks[sink]->stats();
+}
+
+
+std::vector<Pvt_Output_Stats> Pvt_Output_Writer::get_stats() const
+{
+    std::vector<Pvt_Output_Stats> stats;
+    stats.reserve(d_sinks.size());
+    for (const auto& sink : d_sinks)
+        {
+            stats.push_back(sink->stats());
+        }
+    return stats;
+}
+
+
+Pvt_Output_Writer::Policy Pvt_Output_Writer::policy_from_string(const std::string& policy)
+{
+    if (policy == "drop")
+        {
+            return Policy::drop;
+        }
+    return Policy::block;
+}
@@ -0,0 +1,113 @@
+/*!
+ * \file pvt_output_writer.h
+ * \brief Interface of a class that runs the PVT output printers in
+ * background threads, fed through bounded lock-free queues
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_WRITER_H
+#define GNSS_SDR_PVT_OUTPUT_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Counters of a Pvt_Output_Writer sink
+ */
+struct Pvt_Output_Stats
+{
+    std::string name;
+    uint64_t published{};       //!< Jobs accepted into the queue
+    uint64_t written{};         //!< Jobs executed by the writer thread
+    uint64_t dropped{};         //!< Jobs rejected because the queue was full
+    size_t backlog{};           //!< Jobs currently waiting in the queue
+    size_t max_backlog{};       //!< Highest backlog seen when publishing
+    double mean_latency_us{};   //!< Mean time from publish() to job completion
+    double max_latency_us{};    //!< Max time from publish() to job completion
+};
+
+
+/*!
+ * \brief Runs output jobs (typically, a printer call on an immutable
+ * snapshot of the PVT solution) out of the signal processing thread.
+ *
+ * Each sink owns a single-producer, single-consumer ring buffer and a writer
+ * thread, so the jobs of a given sink are executed in publishing order. When
+ * a queue is full, publish() either waits for room (Policy::block) or
+ * discards the job (Policy::drop). publish() must always be called from the
+ * same thread.
+ */
+class Pvt_Output_Writer
+{
+public:
+    enum class Policy
+    {
+        block,
+        drop
+    };
+
+    using Job = std::function<void()>;
+
+    /*!
+     * \brief Constructor. The queue size is rounded up to a power of two.
+     */
+    Pvt_Output_Writer(size_t queue_size, Policy policy);
+
+    /*!
+     * \brief Destructor. Executes all the pending jobs and stops the threads.
+     */
+    ~Pvt_Output_Writer();
+
+    Pvt_Output_Writer(const Pvt_Output_Writer&) = delete;
+    Pvt_Output_Writer& operator=(const Pvt_Output_Writer&) = delete;
+
+    /*!
+     * \brief Adds a sink with its writer thread, and returns its identifier
+     */
+    int add_sink(const std::string& name);
+
+    /*!
+     * \brief Queues a job for the given sink. Returns false if it was dropped.
+     */
+    bool publish(int sink, Job job);
+
+    /*!
+     * \brief Waits until all the jobs published so far have been executed
+     */
+    void flush();
+
+    Pvt_Output_Stats get_stats(int sink) const;
+    std::vector<Pvt_Output_Stats> get_stats() const;
+
+    static Policy policy_from_string(const std::string& policy);
+
+private:
+    class Sink;
+    std::vector<std::unique_ptr<Sink>> d_sinks;
+    size_t d_queue_size;
+    Policy d_policy;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OUTPUT_WRITER_H
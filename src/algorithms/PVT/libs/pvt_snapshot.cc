@@ -0,0 +1,57 @@
+/*!
+ * \file pvt_snapshot.cc
+ * \brief Immutable copy of a PVT solution, to be handed to the output
+ * writer threads
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_snapshot.h"
+#include "rtklib_solver.h"
+
+
+Pvt_Snapshot::Pvt_Snapshot(const Rtklib_Solver& solver, bool copy_satellite_status)
+    : Pvt_Solution(solver),
+      pvt_sol(solver.pvt_sol),
+      d_hdop(solver.get_hdop()),
+      d_vdop(solver.get_vdop()),
+      d_pdop(solver.get_pdop()),
+      d_gdop(solver.get_gdop())
+{
+    if (copy_satellite_status)
+        {
+            pvt_ssat.assign(solver.pvt_ssat.cbegin(), solver.pvt_ssat.cend());
+        }
+}
+
+
+double Pvt_Snapshot::get_hdop() const
+{
+    return d_hdop;
+}
+
+
+double Pvt_Snapshot::get_vdop() const
+{
+    return d_vdop;
+}
+
+
+double Pvt_Snapshot::get_pdop() const
+{
+    return d_pdop;
+}
+
+
+double Pvt_Snapshot::get_gdop() const
+{
+    return d_gdop;
+}
@@ -0,0 +1,62 @@
+/*!
+ * \file pvt_snapshot.h
+ * \brief Immutable copy of a PVT solution, to be handed to the output
+ * writer threads
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_SNAPSHOT_H
+#define GNSS_SDR_PVT_SNAPSHOT_H
+
+#include "pvt_solution.h"
+#include "rtklib.h"
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+class Rtklib_Solver;
+
+/*!
+ * \brief Copy of the state of a Rtklib_Solver at a given epoch.
+ *
+ * It holds the Pvt_Solution data and the DOPs, which is what the KML, GPX,
+ * GeoJSON and AN printers need. The RTKLIB solution and the satellite
+ * status, used by the NMEA printer, are only copied if requested.
+ */
+class Pvt_Snapshot : public Pvt_Solution
+{
+public:
+    explicit Pvt_Snapshot(const Rtklib_Solver& solver, bool copy_satellite_status = false);
+
+    double get_hdop() const override;
+    double get_vdop() const override;
+    double get_pdop() const override;
+    double get_gdop() const override;
+
+    sol_t pvt_sol{};
+    std::vector<ssat_t> pvt_ssat;  //!< MAXSAT entries, or empty if not copied
+
+private:
+    double d_hdop;
+    double d_vdop;
+    double d_pdop;
+    double d_gdop;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_SNAPSHOT_H
@@ -775,6 +775,22 @@ private:
     void update_obs_header(std::fstream& out,
         const Beidou_Dnav_Utc_Model& utc_model) const;
 
+    /*
+     * Writes back an updated header. If it keeps the size of the header
+     * found in the file, it is overwritten in place, so the cost does not
+     * depend on the file size. Otherwise the whole file is rewritten.
+     * The stream must be positioned right after the old header.
+     */
+    void overwrite_header(std::fstream& out,
+        const std::string& filename,
+        const std::vector<std::string>& header) const;
+
+    /*
+     * Blank header line reserved at RINEX observation file creation, to be
+     * replaced by the LEAP SECONDS line without changing the header size.
+     */
+    std::string leap_seconds_slot() const;
+
     /*
      * Generation of RINEX signal strength indicators
      */
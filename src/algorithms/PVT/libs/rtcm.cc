@@ -23,6 +23,7 @@
 #include "Galileo_E5b.h"
 #include "Galileo_FNAV.h"
 #include "Galileo_INAV.h"
+#include "gnss_sdr_make_unique.h"
 #include <boost/algorithm/string.hpp>  // for to_upper_copy
 #include <boost/crc.hpp>
 #include <boost/date_time/gregorian/gregorian.hpp>
@@ -35,13 +36,20 @@
 #include <sstream>    // for std::stringstream
 
 
-Rtcm::Rtcm(uint16_t port) : RTCM_port(port), server_is_running(false)
+Rtcm::Rtcm(uint16_t port) : Rtcm(port, std::string(), 64)
+{
+}
+
+
+Rtcm::Rtcm(uint16_t port, const std::string& mountpoints, size_t client_queue_size) : RTCM_port(port), server_is_running(false)
 {
     preamble = std::bitset<8>("11010011");
     reserved_field = std::bitset<6>("000000");
-    rtcm_message_queue = std::make_shared<Concurrent_Queue<std::string>>();
-    boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), RTCM_port);
-    servers.emplace_back(io_context, endpoint);
+    caster = std::make_unique<Rtcm_Caster>(io_context, RTCM_port, client_queue_size);
+    if (!caster->add_mountpoints(mountpoints))
+        {
+            std::cerr << "Invalid RTCM mountpoints \"" << mountpoints << "\". Check the PVT.rtcm_mountpoints parameter.\n";
+        }
 }
 
 
@@ -76,9 +84,9 @@ void Rtcm::run_server()
     std::cout << "Starting a TCP/IP server of RTCM messages on port " << RTCM_port << '\n';
     try
         {
-            tq = std::thread([&] { std::make_shared<Queue_Reader>(io_context, rtcm_message_queue, RTCM_port)->do_read_queue(); });
             t = std::thread([&] { io_context.run(); });
             server_is_running = true;
+            std::cout << "The TCP/IP server of RTCM messages is up and running. Accepting connections ...\n";
         }
     catch (const std::exception& e)
         {
@@ -97,17 +105,15 @@ void Rtcm::stop_server()
 {
     std::cout << "Stopping TCP/IP server on port " << RTCM_port << '\n';
     Rtcm::stop_service();
-    servers.front().close_server();
-    rtcm_message_queue->push("Goodbye");  // this terminates tq
-    tq.join();
     t.join();
+    caster->close();
     server_is_running = false;
 }
 
 
 void Rtcm::send_message(const std::string& msg)
 {
-    rtcm_message_queue->push(msg);
+    caster->publish(msg);
 }
 
 
@@ -117,55 +123,42 @@ bool Rtcm::is_server_running() const
 }
 
 
+Rtcm_Caster::Stats Rtcm::get_server_stats() const
+{
+    return caster->get_stats();
+}
+
+
 // *****************************************************************************************************
 //
 //   TRANSPORT LAYER AS DEFINED AT RTCM STANDARD 10403.2
 //
 // *****************************************************************************************************
 
-std::string Rtcm::add_CRC(const std::string& message_without_crc) const
+void Rtcm::add_CRC(std::string& message) const
 {
     // ******  Computes Qualcomm CRC-24Q ******
     boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM;
-    // 1) Converts the string to a vector of uint8_t:
-    boost::dynamic_bitset<uint8_t> frame_bits(message_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    // 2) Computes CRC
-    CRC_RTCM.process_bytes(bytes.data(), bytes.size());
-    const auto crc_frame = std::bitset<24>(CRC_RTCM.checksum());
-
-    // 3) Builds the complete message
-    const std::string complete_message = message_without_crc + crc_frame.to_string();
-    return bin_to_binary_data(complete_message);
+    CRC_RTCM.process_bytes(message.data(), message.size());
+    const uint32_t crc = CRC_RTCM.checksum();
+    message.push_back(static_cast<char>((crc >> 16) & 0xFFU));
+    message.push_back(static_cast<char>((crc >> 8) & 0xFFU));
+    message.push_back(static_cast<char>(crc & 0xFFU));
 }
 
 
 bool Rtcm::check_CRC(const std::string& message) const
 {
-    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
-    // Check CRC
-    const std::string crc = message_bin.substr(message_bin.length() - 24, 24);
-    const auto read_crc = std::bitset<24>(crc);
-    const std::string msg_without_crc = message_bin.substr(0, message_bin.length() - 24);
-
-    boost::dynamic_bitset<uint8_t> frame_bits(msg_without_crc);
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_RTCM_CHECK.process_bytes(bytes.data(), bytes.size());
-    const auto computed_crc = std::bitset<24>(CRC_RTCM_CHECK.checksum());
-    if (read_crc == computed_crc)
+    if (message.size() < 3)
         {
-            return true;
+            return false;
         }
-
-    return false;
+    boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> CRC_RTCM_CHECK;
+    const size_t length = message.size() - 3;
+    CRC_RTCM_CHECK.process_bytes(message.data(), length);
+    const auto* crc = reinterpret_cast<const uint8_t*>(message.data() + length);
+    const uint32_t read_crc = (static_cast<uint32_t>(crc[0]) << 16) | (static_cast<uint32_t>(crc[1]) << 8) | crc[2];
+    return read_crc == CRC_RTCM_CHECK.checksum();
 }
 
 
@@ -397,19 +390,19 @@ int64_t Rtcm::hex_to_int(const std::string& s) const
 }
 
 
-std::string Rtcm::build_message(const std::string& data) const
+std::string Rtcm::build_message(const Rtcm_Bit_Writer& data) const
 {
-    const uint32_t msg_length_bits = data.length();
-    const uint32_t msg_length_bytes = std::ceil(static_cast<float>(msg_length_bits) / 8.0);
+    // The writer leaves the unused bits of the last byte set to 0
+    const auto msg_length_bytes = static_cast<uint32_t>(data.size_bytes());
     const auto message_length = std::bitset<10>(msg_length_bytes);
-    const uint32_t zeros_to_fill = 8 * msg_length_bytes - msg_length_bits;
-    const std::string b(zeros_to_fill, '0');
-    const std::string msg_content = data + b;
-    const std::string msg_without_crc = preamble.to_string() +
-                                        reserved_field.to_string() +
-                                        message_length.to_string() +
-                                        msg_content;
-    return Rtcm::add_CRC(msg_without_crc);
+    std::string msg;
+    msg.reserve(3 + msg_length_bytes + 3);
+    msg.push_back(static_cast<char>(preamble.to_ulong()));
+    msg.push_back(static_cast<char>((reserved_field.to_ulong() << 2) | (message_length.to_ulong() >> 8)));
+    msg.push_back(static_cast<char>(message_length.to_ulong() & 0xFFU));
+    msg.append(reinterpret_cast<const char*>(data.data()), msg_length_bytes);
+    Rtcm::add_CRC(msg);
+    return msg;
 }
 
 
@@ -426,7 +419,7 @@ std::string Rtcm::build_message(const std::string& data) const
 //
 // ********************************************************
 
-std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+void Rtcm::write_MT1001_4_header(Rtcm_Bit_Writer& bits, uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
 {
     const uint32_t reference_station_id = ref_id;  // Max: 4095
@@ -442,20 +435,17 @@ std::bitset<64> Rtcm::get_MT1001_4_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF007(divergence_free_smoothing_indicator);
     Rtcm::set_DF008(smoothing_interval);
 
-    const std::string header = DF002.to_string() +
-                               DF003.to_string() +
-                               DF004.to_string() +
-                               DF005.to_string() +
-                               DF006.to_string() +
-                               DF007.to_string() +
-                               DF008.to_string();
-
-    std::bitset<64> header_msg(header);
-    return header_msg;
+    bits << DF002
+         << DF003
+         << DF004
+         << DF005
+         << DF006
+         << DF007
+         << DF008;
 }
 
 
-std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::write_MT1001_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -464,14 +454,11 @@ std::bitset<58> Rtcm::get_MT1001_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string();
-
-    std::bitset<58> content_msg(content);
-    return content_msg;
+    bits << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013;
 }
 
 
@@ -498,21 +485,20 @@ std::string Rtcm::print_MT1001(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1001_4_header(message_bits, 1001, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.cbegin();
          observables_iter != observablesL1.cend();
          observables_iter++)
         {
-            const std::bitset<58> content = Rtcm::get_MT1001_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1001_sat_content(message_bits, gps_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -547,27 +533,26 @@ std::string Rtcm::print_MT1002(const Gps_Ephemeris& gps_eph, double obs_time, co
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1001_4_header(message_bits, 1002, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.cbegin();
          observables_iter != observablesL1.cend();
          observables_iter++)
         {
-            const std::bitset<74> content = Rtcm::get_MT1002_sat_content(gps_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1002_sat_content(message_bits, gps_eph, obs_time, observables_iter->second);
         }
 
-    const std::string msg = build_message(data);
+    const std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::write_MT1002_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchro);
@@ -576,16 +561,13 @@ std::bitset<74> Rtcm::get_MT1002_sat_content(const Gps_Ephemeris& eph, double ob
     Rtcm::set_DF012(gnss_synchro);
     Rtcm::set_DF013(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF014.to_string() +
-                                DF015.to_string();
-
-    std::bitset<74> content_msg(content);
-    return content_msg;
+    bits << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF014
+         << DF015;
 }
 
 
@@ -650,27 +632,26 @@ std::string Rtcm::print_MT1003(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1001_4_header(message_bits, 1003, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.cbegin();
          common_observables_iter != common_observables.cend();
          common_observables_iter++)
         {
-            std::bitset<101> content = Rtcm::get_MT1003_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1003_sat_content(message_bits, ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::write_MT1003_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -683,18 +664,15 @@ std::bitset<101> Rtcm::get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF018(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF016_.to_string() +
-                                DF017.to_string() +
-                                DF018.to_string() +
-                                DF019.to_string();
-
-    std::bitset<101> content_msg(content);
-    return content_msg;
+    bits << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF016_
+         << DF017
+         << DF018
+         << DF019;
 }
 
 
@@ -759,27 +737,26 @@ std::string Rtcm::print_MT1004(const Gps_Ephemeris& ephL1, const Gps_CNAV_Epheme
                 }
         }
 
-    const std::bitset<64> header = Rtcm::get_MT1001_4_header(1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1001_4_header(message_bits, 1004, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.cbegin();
          common_observables_iter != common_observables.cend();
          common_observables_iter++)
         {
-            std::bitset<125> content = Rtcm::get_MT1004_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1004_sat_content(message_bits, ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::write_MT1004_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF009(gnss_synchroL1);
@@ -795,21 +772,18 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
     Rtcm::set_DF019(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF020(gnss_synchroL2);
 
-    const std::string content = DF009.to_string() +
-                                DF010.to_string() +
-                                DF011.to_string() +
-                                DF012.to_string() +
-                                DF013.to_string() +
-                                DF014.to_string() +
-                                DF015.to_string() +
-                                DF016_.to_string() +
-                                DF017.to_string() +
-                                DF018.to_string() +
-                                DF019.to_string() +
-                                DF020.to_string();
-
-    std::bitset<125> content_msg(content);
-    return content_msg;
+    bits << DF009
+         << DF010
+         << DF011
+         << DF012
+         << DF013
+         << DF014
+         << DF015
+         << DF016_
+         << DF017
+         << DF018
+         << DF019
+         << DF020;
 }
 
 
@@ -829,7 +803,7 @@ std::bitset<125> Rtcm::get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const
    Expected output: D3 00 13 3E D7 D3 02 02 98 0E DE EF 34 B4 BD 62
                     AC 09 41 98 6F 33 36 0B 98
  */
-std::bitset<152> Rtcm::get_MT1005_test()
+void Rtcm::write_MT1005_test(Rtcm_Bit_Writer& bits)
 {
     const uint32_t mt1005 = 1005;
     const uint32_t reference_station_id = 2003;  // Max: 4095
@@ -853,22 +827,19 @@ std::bitset<152> Rtcm::get_MT1005_test()
     DF364 = std::bitset<2>("00");  // Quarter Cycle Indicator
     Rtcm::set_DF027(ECEF_Z);
 
-    const std::string message = DF002.to_string() +
-                                DF003.to_string() +
-                                DF021.to_string() +
-                                DF022.to_string() +
-                                DF023.to_string() +
-                                DF024.to_string() +
-                                DF141.to_string() +
-                                DF025.to_string() +
-                                DF142.to_string() +
-                                DF001_.to_string() +
-                                DF026.to_string() +
-                                DF364.to_string() +
-                                DF027.to_string();
-
-    std::bitset<152> test_msg(message);
-    return test_msg;
+    bits << DF002
+         << DF003
+         << DF021
+         << DF022
+         << DF023
+         << DF024
+         << DF141
+         << DF025
+         << DF142
+         << DF001_
+         << DF026
+         << DF364
+         << DF027;
 }
 
 
@@ -891,24 +862,25 @@ std::string Rtcm::print_MT1005(uint32_t ref_id, double ecef_x, double ecef_y, do
     DF364 = std::bitset<2>(quarter_cycle_indicator);
     Rtcm::set_DF027(ecef_z);
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF021.to_string() +
-                             DF022.to_string() +
-                             DF023.to_string() +
-                             DF024.to_string() +
-                             DF141.to_string() +
-                             DF025.to_string() +
-                             DF142.to_string() +
-                             DF001_.to_string() +
-                             DF026.to_string() +
-                             DF364.to_string() +
-                             DF027.to_string();
-
-    std::string msg = build_message(data);
+    message_bits.clear();
+    message_bits << DF002
+                 << DF003
+                 << DF021
+                 << DF022
+                 << DF023
+                 << DF024
+                 << DF141
+                 << DF025
+                 << DF142
+                 << DF001_
+                 << DF026
+                 << DF364
+                 << DF027;
+
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -916,9 +888,6 @@ std::string Rtcm::print_MT1005(uint32_t ref_id, double ecef_x, double ecef_y, do
 
 int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double& ecef_x, double& ecef_y, double& ecef_z, bool& gps, bool& glonass, bool& galileo)
 {
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
-
     if (!Rtcm::check_CRC(message))
         {
             LOG(WARNING) << " Bad CRC detected in RTCM message MT1005";
@@ -928,53 +897,44 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
     // Check than the message number is correct
     const uint32_t preamble_length = 8;
     const uint32_t reserved_field_length = 6;
-    uint32_t index = preamble_length + reserved_field_length;
+    Rtcm_Bit_Reader bits(message);
+    bits.skip(preamble_length + reserved_field_length);
 
-    uint32_t read_message_length = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    uint32_t read_message_length = static_cast<uint32_t>(bits.read_uint(10));
     if (read_message_length != 19)
         {
             LOG(WARNING) << " Message MT1005 with wrong length (19 bytes expected, " << read_message_length << " received)";
             return 1;
         }
 
-    const uint32_t msg_number = 1005;
-    Rtcm::set_DF002(msg_number);
-    std::bitset<12> read_msg_number(message_bin.substr(index, 12));
-    index += 12;
+    const auto read_msg_number = static_cast<uint32_t>(bits.read_uint(12));
 
-    if (DF002 != read_msg_number)
+    if (1005 != read_msg_number)
         {
             LOG(WARNING) << " This is not a MT1005 message";
             return 1;
         }
 
-    ref_id = Rtcm::bin_to_uint(message_bin.substr(index, 12));
-    index += 12;
+    ref_id = static_cast<uint32_t>(bits.read_uint(12));
 
-    index += 6;  // ITRF year
-    gps = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    bits.skip(6);  // ITRF year
+    gps = static_cast<bool>(bits.read_uint(1));
 
-    glonass = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass = static_cast<bool>(bits.read_uint(1));
 
-    galileo = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    galileo = static_cast<bool>(bits.read_uint(1));
 
-    index += 1;  // ref_station_indicator
+    bits.skip(1);  // ref_station_indicator
 
-    ecef_x = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
-    index += 38;
+    ecef_x = static_cast<double>(bits.read_int(38)) / 10000.0;
 
-    index += 1;  // single rx oscillator
-    index += 1;  // reserved
+    bits.skip(1);  // single rx oscillator
+    bits.skip(1);  // reserved
 
-    ecef_y = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
-    index += 38;
+    ecef_y = static_cast<double>(bits.read_int(38)) / 10000.0;
 
-    index += 2;  // quarter cycle indicator
-    ecef_z = Rtcm::bin_to_double(message_bin.substr(index, 38)) / 10000.0;
+    bits.skip(2);  // quarter cycle indicator
+    ecef_z = static_cast<double>(bits.read_int(38)) / 10000.0;
 
     return 0;
 }
@@ -982,8 +942,9 @@ int32_t Rtcm::read_MT1005(const std::string& message, uint32_t& ref_id, double&
 
 std::string Rtcm::print_MT1005_test()
 {
-    std::bitset<152> mt1005 = get_MT1005_test();
-    return Rtcm::build_message(mt1005.to_string());
+    message_bits.clear();
+    Rtcm::write_MT1005_test(message_bits);
+    return Rtcm::build_message(message_bits);
 }
 
 // ********************************************************
@@ -1012,25 +973,26 @@ std::string Rtcm::print_MT1006(uint32_t ref_id, double ecef_x, double ecef_y, do
     Rtcm::set_DF027(ecef_z);
     Rtcm::set_DF028(height);
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF021.to_string() +
-                             DF022.to_string() +
-                             DF023.to_string() +
-                             DF024.to_string() +
-                             DF141.to_string() +
-                             DF025.to_string() +
-                             DF142.to_string() +
-                             DF001_.to_string() +
-                             DF026.to_string() +
-                             DF364.to_string() +
-                             DF027.to_string() +
-                             DF028.to_string();
-
-    std::string msg = build_message(data);
+    message_bits.clear();
+    message_bits << DF002
+                 << DF003
+                 << DF021
+                 << DF022
+                 << DF023
+                 << DF024
+                 << DF141
+                 << DF025
+                 << DF142
+                 << DF001_
+                 << DF026
+                 << DF364
+                 << DF027
+                 << DF028;
+
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -1055,12 +1017,6 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF029 = std::bitset<8>(len);
 
-    std::string DF030_str_;
-    for (char c : ant_descriptor)
-        {
-            const auto character = std::bitset<8>(c);
-            DF030_str_ += character.to_string();
-        }
 
     Rtcm::set_DF031(antenna_setup_id);
 
@@ -1073,25 +1029,25 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
         }
     DF032 = std::bitset<8>(len2);
 
-    std::string DF033_str_;
+    message_bits.clear();
+    message_bits << DF002_
+                 << DF003
+                 << DF029;
+    for (char c : ant_descriptor)
+        {
+            message_bits.put(static_cast<uint8_t>(c), 8);  // DF030
+        }
+    message_bits << DF031
+                 << DF032;
     for (char c : ant_sn)
         {
-            const auto character = std::bitset<8>(c);
-            DF033_str_ += character.to_string();
+            message_bits.put(static_cast<uint8_t>(c), 8);  // DF033
         }
 
-    const std::string data = DF002_.to_string() +
-                             DF003.to_string() +
-                             DF029.to_string() +
-                             DF030_str_ +
-                             DF031.to_string() +
-                             DF032.to_string() +
-                             DF033_str_;
-
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -1102,7 +1058,7 @@ std::string Rtcm::print_MT1008(uint32_t ref_id, const std::string& antenna_descr
 //   MESSAGE TYPE 1009 (GLONASS L1 Basic RTK Observables)
 //
 // ********************************************************
-std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
+void Rtcm::write_MT1009_12_header(Rtcm_Bit_Writer& bits, uint32_t msg_number, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id, uint32_t smooth_int, bool sync_flag, bool divergence_free)
 {
     const uint32_t reference_station_id = ref_id;  // Max: 4095
@@ -1118,20 +1074,17 @@ std::bitset<61> Rtcm::get_MT1009_12_header(uint32_t msg_number, double obs_time,
     Rtcm::set_DF036(divergence_free_smoothing_indicator);
     Rtcm::set_DF037(smoothing_interval);
 
-    const std::string header = DF002.to_string() +
-                               DF003.to_string() +
-                               DF034.to_string() +
-                               DF005.to_string() +
-                               DF035.to_string() +
-                               DF036.to_string() +
-                               DF037.to_string();
-
-    std::bitset<61> header_msg(header);
-    return header_msg;
+    bits << DF002
+         << DF003
+         << DF034
+         << DF005
+         << DF035
+         << DF036
+         << DF037;
 }
 
 
-std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::write_MT1009_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1141,15 +1094,12 @@ std::bitset<64> Rtcm::get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF042(gnss_synchro);
     Rtcm::set_DF043(eph, obs_time, gnss_synchro);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string();
-
-    std::bitset<64> content_msg(content);
-    return content_msg;
+    bits << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043;
 }
 
 
@@ -1176,21 +1126,20 @@ std::string Rtcm::print_MT1009(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1009_12_header(message_bits, 1009, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.begin();
          observables_iter != observablesL1.end();
          observables_iter++)
         {
-            const std::bitset<64> content = Rtcm::get_MT1009_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1009_sat_content(message_bits, glonass_gnav_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -1225,27 +1174,26 @@ std::string Rtcm::print_MT1010(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, d
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1009_12_header(message_bits, 1010, obs_time, observablesL1, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (observables_iter = observablesL1.begin();
          observables_iter != observablesL1.end();
          observables_iter++)
         {
-            const std::bitset<79> content = Rtcm::get_MT1010_sat_content(glonass_gnav_eph, obs_time, observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1010_sat_content(message_bits, glonass_gnav_eph, obs_time, observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
+void Rtcm::write_MT1010_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchro);
@@ -1257,17 +1205,14 @@ std::bitset<79> Rtcm::get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& eph,
     Rtcm::set_DF044(gnss_synchro);
     Rtcm::set_DF045(gnss_synchro);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF044.to_string() +
-                                DF045.to_string();
-
-    std::bitset<79> content_msg(content);
-    return content_msg;
+    bits << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF044
+         << DF045;
 }
 
 
@@ -1332,27 +1277,26 @@ std::string Rtcm::print_MT1011(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1009_12_header(message_bits, 1011, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.begin();
          common_observables_iter != common_observables.end();
          common_observables_iter++)
         {
-            const std::bitset<107> content = Rtcm::get_MT1011_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1011_sat_content(message_bits, ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::write_MT1011_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1366,19 +1310,16 @@ std::bitset<107> Rtcm::get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF048(gnss_synchroL1, gnss_synchroL2);
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF046_.to_string() +
-                                DF047.to_string() +
-                                DF048.to_string() +
-                                DF049.to_string();
-
-    std::bitset<107> content_msg(content);
-    return content_msg;
+    bits << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF046_
+         << DF047
+         << DF048
+         << DF049;
 }
 
 
@@ -1443,27 +1384,26 @@ std::string Rtcm::print_MT1012(const Glonass_Gnav_Ephemeris& ephL1, const Glonas
                 }
         }
 
-    const std::bitset<61> header = Rtcm::get_MT1009_12_header(1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
-    std::string data = header.to_string();
+    message_bits.clear();
+    Rtcm::write_MT1009_12_header(message_bits, 1012, obs_time, observablesL1_with_L2, ref_id, smooth_int, sync_flag, divergence_free);
 
     for (common_observables_iter = common_observables.begin();
          common_observables_iter != common_observables.end();
          common_observables_iter++)
         {
-            const std::bitset<130> content = Rtcm::get_MT1012_sat_content(ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
-            data += content.to_string();
+            Rtcm::write_MT1012_sat_content(message_bits, ephL1, ephL2, obs_time, common_observables_iter->first, common_observables_iter->second);
         }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
 
 
-std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
+void Rtcm::write_MT1012_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2)
 {
     const bool code_indicator = false;  // code indicator   0: C/A code   1: P(Y) code direct
     Rtcm::set_DF038(gnss_synchroL1);
@@ -1480,22 +1420,19 @@ std::bitset<130> Rtcm::get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL
     Rtcm::set_DF049(ephL2, obs_time, gnss_synchroL2);
     Rtcm::set_DF050(gnss_synchroL2);
 
-    const std::string content = DF038.to_string() +
-                                DF039.to_string() +
-                                DF040.to_string() +
-                                DF041.to_string() +
-                                DF042.to_string() +
-                                DF043.to_string() +
-                                DF044.to_string() +
-                                DF045.to_string() +
-                                DF046_.to_string() +
-                                DF047.to_string() +
-                                DF048.to_string() +
-                                DF049.to_string() +
-                                DF050.to_string();
-
-    std::bitset<130> content_msg(content);
-    return content_msg;
+    bits << DF038
+         << DF039
+         << DF040
+         << DF041
+         << DF042
+         << DF043
+         << DF044
+         << DF045
+         << DF046_
+         << DF047
+         << DF048
+         << DF049
+         << DF050;
 }
 
 
@@ -1541,47 +1478,48 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
     Rtcm::set_DF103(gps_eph);
     Rtcm::set_DF137(gps_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF009.to_string() +
-                             DF076.to_string() +
-                             DF077.to_string() +
-                             DF078.to_string() +
-                             DF079.to_string() +
-                             DF071.to_string() +
-                             DF081.to_string() +
-                             DF082.to_string() +
-                             DF083.to_string() +
-                             DF084.to_string() +
-                             DF085.to_string() +
-                             DF086.to_string() +
-                             DF087.to_string() +
-                             DF088.to_string() +
-                             DF089.to_string() +
-                             DF090.to_string() +
-                             DF091.to_string() +
-                             DF092.to_string() +
-                             DF093.to_string() +
-                             DF094.to_string() +
-                             DF095.to_string() +
-                             DF096.to_string() +
-                             DF097.to_string() +
-                             DF098.to_string() +
-                             DF099.to_string() +
-                             DF100.to_string() +
-                             DF101.to_string() +
-                             DF102.to_string() +
-                             DF103.to_string() +
-                             DF137.to_string();
-
-    if (data.length() != 488)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_bits.clear();
+    message_bits << DF002
+                 << DF009
+                 << DF076
+                 << DF077
+                 << DF078
+                 << DF079
+                 << DF071
+                 << DF081
+                 << DF082
+                 << DF083
+                 << DF084
+                 << DF085
+                 << DF086
+                 << DF087
+                 << DF088
+                 << DF089
+                 << DF090
+                 << DF091
+                 << DF092
+                 << DF093
+                 << DF094
+                 << DF095
+                 << DF096
+                 << DF097
+                 << DF098
+                 << DF099
+                 << DF100
+                 << DF101
+                 << DF102
+                 << DF103
+                 << DF137;
+
+    if (message_bits.size_bits() != 488)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1019 (488 bits expected, found " << message_bits.size_bits() << ")";
+        }
+
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -1589,8 +1527,6 @@ std::string Rtcm::print_MT1019(const Gps_Ephemeris& gps_eph)
 
 int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) const
 {
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
 
     if (!Rtcm::check_CRC(message))
         {
@@ -1600,10 +1536,10 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
 
     const uint32_t preamble_length = 8;
     const uint32_t reserved_field_length = 6;
-    uint32_t index = preamble_length + reserved_field_length;
+    Rtcm_Bit_Reader bits(message);
+    bits.skip(preamble_length + reserved_field_length);
 
-    const uint32_t read_message_length = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    const uint32_t read_message_length = static_cast<uint32_t>(bits.read_uint(10));
 
     if (read_message_length != 61)
         {
@@ -1612,8 +1548,7 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
-    index += 12;
+    const auto read_msg_number = static_cast<uint32_t>(bits.read_uint(12));
 
     if (1019 != read_msg_number)
         {
@@ -1622,95 +1557,66 @@ int32_t Rtcm::read_MT1019(const std::string& message, Gps_Ephemeris& gps_eph) co
         }
 
     // Fill Gps Ephemeris with message data content
-    gps_eph.PRN = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 6)));
-    index += 6;
+    gps_eph.PRN = static_cast<uint32_t>(bits.read_uint(6));
 
-    gps_eph.WN = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    gps_eph.WN = static_cast<int32_t>(bits.read_uint(10));
 
-    gps_eph.SV_accuracy = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 4)));
-    index += 4;
+    gps_eph.SV_accuracy = static_cast<int32_t>(bits.read_uint(4));
 
-    gps_eph.code_on_L2 = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
-    index += 2;
+    gps_eph.code_on_L2 = static_cast<int32_t>(bits.read_uint(2));
 
-    gps_eph.idot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 14))) * I_DOT_LSB;
-    index += 14;
+    gps_eph.idot = static_cast<double>(bits.read_int(14)) * I_DOT_LSB;
 
-    gps_eph.IODE_SF2 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
-    gps_eph.IODE_SF3 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
-    index += 8;
+    gps_eph.IODE_SF2 = static_cast<double>(bits.read_uint(8));
+    gps_eph.IODE_SF3 = gps_eph.IODE_SF2;
 
-    gps_eph.toc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 16))) * T_OC_LSB;
-    index += 16;
+    gps_eph.toc = static_cast<double>(bits.read_uint(16)) * T_OC_LSB;
 
-    gps_eph.af2 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 8))) * A_F2_LSB;
-    index += 8;
+    gps_eph.af2 = static_cast<double>(bits.read_int(8)) * A_F2_LSB;
 
-    gps_eph.af1 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * A_F1_LSB;
-    index += 16;
+    gps_eph.af1 = static_cast<double>(bits.read_int(16)) * A_F1_LSB;
 
-    gps_eph.af0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 22))) * A_F0_LSB;
-    index += 22;
+    gps_eph.af0 = static_cast<double>(bits.read_int(22)) * A_F0_LSB;
 
-    gps_eph.IODC = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    gps_eph.IODC = static_cast<double>(bits.read_uint(10));
 
-    gps_eph.Crs = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RS_LSB;
-    index += 16;
+    gps_eph.Crs = static_cast<double>(bits.read_int(16)) * C_RS_LSB;
 
-    gps_eph.delta_n = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * DELTA_N_LSB;
-    index += 16;
+    gps_eph.delta_n = static_cast<double>(bits.read_int(16)) * DELTA_N_LSB;
 
-    gps_eph.M_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * M_0_LSB;
-    index += 32;
+    gps_eph.M_0 = static_cast<double>(bits.read_int(32)) * M_0_LSB;
 
-    gps_eph.Cuc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_UC_LSB;
-    index += 16;
+    gps_eph.Cuc = static_cast<double>(bits.read_int(16)) * C_UC_LSB;
 
-    gps_eph.ecc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * ECCENTRICITY_LSB;
-    index += 32;
+    gps_eph.ecc = static_cast<double>(bits.read_uint(32)) * ECCENTRICITY_LSB;
 
-    gps_eph.Cus = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_US_LSB;
-    index += 16;
+    gps_eph.Cus = static_cast<double>(bits.read_int(16)) * C_US_LSB;
 
-    gps_eph.sqrtA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * SQRT_A_LSB;
-    index += 32;
+    gps_eph.sqrtA = static_cast<double>(bits.read_uint(32)) * SQRT_A_LSB;
 
-    gps_eph.toe = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 16))) * T_OE_LSB;
-    index += 16;
+    gps_eph.toe = static_cast<double>(bits.read_uint(16)) * T_OE_LSB;
 
-    gps_eph.Cic = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IC_LSB;
-    index += 16;
+    gps_eph.Cic = static_cast<double>(bits.read_int(16)) * C_IC_LSB;
 
-    gps_eph.OMEGA_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_0_LSB;
-    index += 32;
+    gps_eph.OMEGA_0 = static_cast<double>(bits.read_int(32)) * OMEGA_0_LSB;
 
-    gps_eph.Cis = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IS_LSB;
-    index += 16;
+    gps_eph.Cis = static_cast<double>(bits.read_int(16)) * C_IS_LSB;
 
-    gps_eph.i_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * I_0_LSB;
-    index += 32;
+    gps_eph.i_0 = static_cast<double>(bits.read_int(32)) * I_0_LSB;
 
-    gps_eph.Crc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RC_LSB;
-    index += 16;
+    gps_eph.Crc = static_cast<double>(bits.read_int(16)) * C_RC_LSB;
 
-    gps_eph.omega = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_LSB;
-    index += 32;
+    gps_eph.omega = static_cast<double>(bits.read_int(32)) * OMEGA_LSB;
 
-    gps_eph.OMEGAdot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 24))) * OMEGA_DOT_LSB;
-    index += 24;
+    gps_eph.OMEGAdot = static_cast<double>(bits.read_int(24)) * OMEGA_DOT_LSB;
 
-    gps_eph.TGD = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 8))) * T_GD_LSB;
-    index += 8;
+    gps_eph.TGD = static_cast<double>(bits.read_int(8)) * T_GD_LSB;
 
-    gps_eph.SV_health = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 6)));
-    index += 6;
+    gps_eph.SV_health = static_cast<int32_t>(bits.read_uint(6));
 
-    gps_eph.L2_P_data_flag = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    gps_eph.L2_P_data_flag = static_cast<bool>(bits.read_uint(1));
 
-    gps_eph.fit_interval_flag = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gps_eph.fit_interval_flag = static_cast<bool>(bits.read_uint(1));
 
     return 0;
 }
@@ -1766,53 +1672,54 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
     Rtcm::set_DF135(glonass_gnav_utc_model);
     Rtcm::set_DF136(glonass_gnav_eph);
 
-    const std::string data = DF002.to_string() +
-                             DF038.to_string() +
-                             DF040.to_string() +
-                             DF104.to_string() +
-                             DF105.to_string() +
-                             DF106.to_string() +
-                             DF107.to_string() +
-                             DF108.to_string() +
-                             DF109.to_string() +
-                             DF110.to_string() +
-                             DF111.to_string() +
-                             DF112.to_string() +
-                             DF113.to_string() +
-                             DF114.to_string() +
-                             DF115.to_string() +
-                             DF116.to_string() +
-                             DF117.to_string() +
-                             DF118.to_string() +
-                             DF119.to_string() +
-                             DF120.to_string() +
-                             DF121.to_string() +
-                             DF122.to_string() +
-                             DF123.to_string() +
-                             DF124.to_string() +
-                             DF125.to_string() +
-                             DF126.to_string() +
-                             DF127.to_string() +
-                             DF128.to_string() +
-                             DF129.to_string() +
-                             DF130.to_string() +
-                             DF131.to_string() +
-                             DF132.to_string() +
-                             DF133.to_string() +
-                             DF134.to_string() +
-                             DF135.to_string() +
-                             DF136.to_string() +
-                             std::bitset<7>().to_string();  // Reserved bits
-
-    if (data.length() != 360)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_bits.clear();
+    message_bits << DF002
+                 << DF038
+                 << DF040
+                 << DF104
+                 << DF105
+                 << DF106
+                 << DF107
+                 << DF108
+                 << DF109
+                 << DF110
+                 << DF111
+                 << DF112
+                 << DF113
+                 << DF114
+                 << DF115
+                 << DF116
+                 << DF117
+                 << DF118
+                 << DF119
+                 << DF120
+                 << DF121
+                 << DF122
+                 << DF123
+                 << DF124
+                 << DF125
+                 << DF126
+                 << DF127
+                 << DF128
+                 << DF129
+                 << DF130
+                 << DF131
+                 << DF132
+                 << DF133
+                 << DF134
+                 << DF135
+                 << DF136
+                 << std::bitset<7>();  // Reserved bits
+
+    if (message_bits.size_bits() != 360)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1020 (360 bits expected, found " << message_bits.size_bits() << ")";
+        }
+
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -1820,8 +1727,6 @@ std::string Rtcm::print_MT1020(const Glonass_Gnav_Ephemeris& glonass_gnav_eph, c
 
 int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& glonass_gnav_eph, Glonass_Gnav_Utc_Model& glonass_gnav_utc_model) const
 {
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
     int32_t glonass_gnav_alm_health = 0;
     int32_t glonass_gnav_alm_health_ind = 0;
     int32_t fifth_str_additional_data_ind = 0;
@@ -1834,10 +1739,10 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
 
     const uint32_t preamble_length = 8;
     const uint32_t reserved_field_length = 6;
-    uint32_t index = preamble_length + reserved_field_length;
+    Rtcm_Bit_Reader bits(message);
+    bits.skip(preamble_length + reserved_field_length);
 
-    const uint32_t read_message_length = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    const uint32_t read_message_length = static_cast<uint32_t>(bits.read_uint(10));
 
     if (read_message_length != 45)  // 360 bits = 45 bytes
         {
@@ -1846,8 +1751,7 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
-    index += 12;
+    const auto read_msg_number = static_cast<uint32_t>(bits.read_uint(12));
 
     if (1020 != read_msg_number)
         {
@@ -1856,123 +1760,87 @@ int32_t Rtcm::read_MT1020(const std::string& message, Glonass_Gnav_Ephemeris& gl
         }
 
     // Fill Gps Ephemeris with message data content
-    glonass_gnav_eph.i_satellite_slot_number = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 6)));
-    index += 6;
+    glonass_gnav_eph.i_satellite_slot_number = static_cast<uint32_t>(bits.read_uint(6));
 
-    glonass_gnav_eph.i_satellite_freq_channel = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 5)) - 7.0);
-    index += 5;
+    glonass_gnav_eph.i_satellite_freq_channel = static_cast<int32_t>(bits.read_uint(5) - 7.0);
 
-    glonass_gnav_alm_health = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_alm_health = static_cast<int32_t>(bits.read_uint(1));
     if (glonass_gnav_alm_health)
         {
         }  // Avoid compiler warning
 
-    glonass_gnav_alm_health_ind = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_alm_health_ind = static_cast<int32_t>(bits.read_uint(1));
     if (glonass_gnav_alm_health_ind)
         {
         }  // Avoid compiler warning
 
-    glonass_gnav_eph.d_P_1 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
+    glonass_gnav_eph.d_P_1 = static_cast<double>(bits.read_uint(2));
     glonass_gnav_eph.d_P_1 = (glonass_gnav_eph.d_P_1 + 1) * 15;
-    index += 2;
 
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 5))) * 3600;
-    index += 5;
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 6))) * 60;
-    index += 6;
-    glonass_gnav_eph.d_t_k += static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 1))) * 30;
-    index += 1;
+    glonass_gnav_eph.d_t_k += static_cast<double>(bits.read_uint(5)) * 3600;
+    glonass_gnav_eph.d_t_k += static_cast<double>(bits.read_uint(6)) * 60;
+    glonass_gnav_eph.d_t_k += static_cast<double>(bits.read_uint(1)) * 30;
 
-    glonass_gnav_eph.d_B_n = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_eph.d_B_n = static_cast<double>(bits.read_uint(1));
 
-    glonass_gnav_eph.d_P_2 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_eph.d_P_2 = static_cast<bool>(bits.read_uint(1));
 
-    glonass_gnav_eph.d_t_b = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 7))) * 15 * 60.0;
-    index += 7;
+    glonass_gnav_eph.d_t_b = static_cast<double>(bits.read_uint(7)) * 15 * 60.0;
 
     // TODO Check for type spec for intS24
-    glonass_gnav_eph.d_VXn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
-    index += 24;
+    glonass_gnav_eph.d_VXn = static_cast<double>(bits.read_sint(24)) * TWO_N20;
 
-    glonass_gnav_eph.d_Xn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
-    index += 27;
+    glonass_gnav_eph.d_Xn = static_cast<double>(bits.read_sint(27)) * TWO_N11;
 
-    glonass_gnav_eph.d_AXn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
-    index += 5;
+    glonass_gnav_eph.d_AXn = static_cast<double>(bits.read_sint(5)) * TWO_N30;
 
-    glonass_gnav_eph.d_VYn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
-    index += 24;
+    glonass_gnav_eph.d_VYn = static_cast<double>(bits.read_sint(24)) * TWO_N20;
 
-    glonass_gnav_eph.d_Yn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
-    index += 27;
+    glonass_gnav_eph.d_Yn = static_cast<double>(bits.read_sint(27)) * TWO_N11;
 
-    glonass_gnav_eph.d_AYn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
-    index += 5;
+    glonass_gnav_eph.d_AYn = static_cast<double>(bits.read_sint(5)) * TWO_N30;
 
-    glonass_gnav_eph.d_VZn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 24))) * TWO_N20;
-    index += 24;
+    glonass_gnav_eph.d_VZn = static_cast<double>(bits.read_sint(24)) * TWO_N20;
 
-    glonass_gnav_eph.d_Zn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 27))) * TWO_N11;
-    index += 27;
+    glonass_gnav_eph.d_Zn = static_cast<double>(bits.read_sint(27)) * TWO_N11;
 
-    glonass_gnav_eph.d_AZn = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
-    index += 5;
+    glonass_gnav_eph.d_AZn = static_cast<double>(bits.read_sint(5)) * TWO_N30;
 
-    glonass_gnav_eph.d_P_3 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_eph.d_P_3 = static_cast<bool>(bits.read_uint(1));
 
-    glonass_gnav_eph.d_gamma_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 11))) * TWO_N30;
-    index += 11;
+    glonass_gnav_eph.d_gamma_n = static_cast<double>(bits.read_sint(11)) * TWO_N40;
 
-    glonass_gnav_eph.d_P = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
-    index += 2;
+    glonass_gnav_eph.d_P = static_cast<double>(bits.read_uint(2));
 
-    glonass_gnav_eph.d_l3rd_n = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_eph.d_l3rd_n = static_cast<bool>(bits.read_uint(1));
 
-    glonass_gnav_eph.d_tau_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 22))) * TWO_N30;
-    index += 22;
+    glonass_gnav_eph.d_tau_n = static_cast<double>(bits.read_sint(22)) * TWO_N30;
 
-    glonass_gnav_eph.d_Delta_tau_n = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 5))) * TWO_N30;
-    index += 5;
+    glonass_gnav_eph.d_Delta_tau_n = static_cast<double>(bits.read_sint(5)) * TWO_N30;
 
-    glonass_gnav_eph.d_E_n = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 5)));
-    index += 5;
+    glonass_gnav_eph.d_E_n = static_cast<double>(bits.read_uint(5));
 
-    glonass_gnav_eph.d_P_4 = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    glonass_gnav_eph.d_P_4 = static_cast<bool>(bits.read_uint(1));
 
-    glonass_gnav_eph.d_F_T = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 4)));
-    index += 4;
+    glonass_gnav_eph.d_F_T = static_cast<double>(bits.read_uint(4));
 
-    glonass_gnav_eph.d_N_T = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 11)));
-    index += 11;
+    glonass_gnav_eph.d_N_T = static_cast<double>(bits.read_uint(11));
 
-    glonass_gnav_eph.d_M = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
-    index += 2;
+    glonass_gnav_eph.d_M = static_cast<double>(bits.read_uint(2));
 
-    fifth_str_additional_data_ind = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
-    index += 1;
+    fifth_str_additional_data_ind = static_cast<double>(bits.read_uint(1));
 
     if (fifth_str_additional_data_ind == true)
         {
-            glonass_gnav_utc_model.d_N_A = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 11)));
-            index += 11;
+            glonass_gnav_utc_model.d_N_A = static_cast<double>(bits.read_uint(11));
 
-            glonass_gnav_utc_model.d_tau_c = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 32))) * TWO_N31;
-            index += 32;
+            glonass_gnav_utc_model.d_tau_c = static_cast<double>(bits.read_int(32)) * TWO_N31;
 
-            glonass_gnav_utc_model.d_N_4 = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 5)));
-            index += 5;
+            glonass_gnav_utc_model.d_N_4 = static_cast<double>(bits.read_uint(5));
 
-            glonass_gnav_utc_model.d_tau_gps = static_cast<double>(Rtcm::bin_to_sint(message_bin.substr(index, 22))) * TWO_N30;
-            index += 22;
+            glonass_gnav_utc_model.d_tau_gps = static_cast<double>(bits.read_sint(22)) * TWO_N30;
 
-            glonass_gnav_eph.d_l5th_n = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+            glonass_gnav_eph.d_l5th_n = static_cast<int32_t>(bits.read_uint(1));
         }
 
     return 0;
@@ -1996,7 +1864,6 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
 
     uint32_t i = 0;
     bool first = true;
-    std::string text_binary;
     for (char c : message)
         {
             if (isgraph(c) || c == ' ')
@@ -2016,25 +1883,27 @@ std::string Rtcm::print_MT1029(uint32_t ref_id, const Gps_Ephemeris& gps_eph, do
                             first = false;
                         }
                 }
-            const auto character = std::bitset<8>(c);
-            text_binary += character.to_string();
         }
 
     const auto DF138_ = std::bitset<7>(i);
     const auto DF139_ = std::bitset<8>(message.length());
 
-    const std::string data = DF002.to_string() +
-                             DF003.to_string() +
-                             DF051.to_string() +
-                             DF052.to_string() +
-                             DF138_.to_string() +
-                             DF139_.to_string() +
-                             text_binary;
+    message_bits.clear();
+    message_bits << DF002
+                 << DF003
+                 << DF051
+                 << DF052
+                 << DF138_
+                 << DF139_;
+    for (char c : message)
+        {
+            message_bits.put(static_cast<uint8_t>(c), 8);
+        }
 
-    std::string msg = build_message(data);
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -2080,45 +1949,46 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
     const uint32_t seven_zero = 0;
     const auto DF001_ = std::bitset<7>(seven_zero);
 
-    const std::string data = DF002.to_string() +
-                             DF252.to_string() +
-                             DF289.to_string() +
-                             DF290.to_string() +
-                             DF291.to_string() +
-                             DF292.to_string() +
-                             DF293.to_string() +
-                             DF294.to_string() +
-                             DF295.to_string() +
-                             DF296.to_string() +
-                             DF297.to_string() +
-                             DF298.to_string() +
-                             DF299.to_string() +
-                             DF300.to_string() +
-                             DF301.to_string() +
-                             DF302.to_string() +
-                             DF303.to_string() +
-                             DF304.to_string() +
-                             DF305.to_string() +
-                             DF306.to_string() +
-                             DF307.to_string() +
-                             DF308.to_string() +
-                             DF309.to_string() +
-                             DF310.to_string() +
-                             DF311.to_string() +
-                             DF312.to_string() +
-                             DF314.to_string() +
-                             DF315.to_string() +
-                             DF001_.to_string();
-
-    if (data.length() != 496)
-        {
-            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << data.length() << ")";
-        }
-
-    std::string msg = build_message(data);
+    message_bits.clear();
+    message_bits << DF002
+                 << DF252
+                 << DF289
+                 << DF290
+                 << DF291
+                 << DF292
+                 << DF293
+                 << DF294
+                 << DF295
+                 << DF296
+                 << DF297
+                 << DF298
+                 << DF299
+                 << DF300
+                 << DF301
+                 << DF302
+                 << DF303
+                 << DF304
+                 << DF305
+                 << DF306
+                 << DF307
+                 << DF308
+                 << DF309
+                 << DF310
+                 << DF311
+                 << DF312
+                 << DF314
+                 << DF315
+                 << DF001_;
+
+    if (message_bits.size_bits() != 496)
+        {
+            LOG(WARNING) << "Bad-formatted RTCM MT1045 (496 bits expected, found " << message_bits.size_bits() << ")";
+        }
+
+    std::string msg = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(msg);
+            caster->publish(msg);
         }
     return msg;
 }
@@ -2126,8 +1996,6 @@ std::string Rtcm::print_MT1045(const Galileo_Ephemeris& gal_eph)
 
 int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph) const
 {
-    // Convert message to binary
-    const std::string message_bin = Rtcm::binary_data_to_bin(message);
 
     if (!Rtcm::check_CRC(message))
         {
@@ -2137,10 +2005,10 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
 
     const uint32_t preamble_length = 8;
     const uint32_t reserved_field_length = 6;
-    uint32_t index = preamble_length + reserved_field_length;
+    Rtcm_Bit_Reader bits(message);
+    bits.skip(preamble_length + reserved_field_length);
 
-    const uint32_t read_message_length = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    const uint32_t read_message_length = static_cast<uint32_t>(bits.read_uint(10));
 
     if (read_message_length != 62)
         {
@@ -2149,8 +2017,7 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
         }
 
     // Check than the message number is correct
-    const uint32_t read_msg_number = Rtcm::bin_to_uint(message_bin.substr(index, 12));
-    index += 12;
+    const auto read_msg_number = static_cast<uint32_t>(bits.read_uint(12));
 
     if (1045 != read_msg_number)
         {
@@ -2159,85 +2026,59 @@ int32_t Rtcm::read_MT1045(const std::string& message, Galileo_Ephemeris& gal_eph
         }
 
     // Fill Galileo Ephemeris with message data content
-    gal_eph.PRN = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 6)));
-    index += 6;
+    gal_eph.PRN = static_cast<uint32_t>(bits.read_uint(6));
 
-    gal_eph.WN = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 12)));
-    index += 12;
+    gal_eph.WN = static_cast<double>(bits.read_uint(12));
 
-    gal_eph.IOD_nav = static_cast<int32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 10)));
-    index += 10;
+    gal_eph.IOD_nav = static_cast<int32_t>(bits.read_uint(10));
 
-    gal_eph.SISA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 8)));
-    index += 8;
+    gal_eph.SISA = static_cast<double>(bits.read_uint(8));
 
-    gal_eph.idot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 14))) * I_DOT_2_LSB;
-    index += 14;
+    gal_eph.idot = static_cast<double>(bits.read_int(14)) * I_DOT_2_LSB;
 
-    gal_eph.toc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 14))) * T0C_4_LSB;
-    index += 14;
+    gal_eph.toc = static_cast<double>(bits.read_uint(14)) * T0C_4_LSB;
 
-    gal_eph.af2 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 6))) * AF2_4_LSB;
-    index += 6;
+    gal_eph.af2 = static_cast<double>(bits.read_int(6)) * AF2_4_LSB;
 
-    gal_eph.af1 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 21))) * AF1_4_LSB;
-    index += 21;
+    gal_eph.af1 = static_cast<double>(bits.read_int(21)) * AF1_4_LSB;
 
-    gal_eph.af0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 31))) * AF0_4_LSB;
-    index += 31;
+    gal_eph.af0 = static_cast<double>(bits.read_int(31)) * AF0_4_LSB;
 
-    gal_eph.Crs = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RS_3_LSB;
-    index += 16;
+    gal_eph.Crs = static_cast<double>(bits.read_int(16)) * C_RS_3_LSB;
 
-    gal_eph.delta_n = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * DELTA_N_3_LSB;
-    index += 16;
+    gal_eph.delta_n = static_cast<double>(bits.read_int(16)) * DELTA_N_3_LSB;
 
-    gal_eph.M_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * M0_1_LSB;
-    index += 32;
+    gal_eph.M_0 = static_cast<double>(bits.read_int(32)) * M0_1_LSB;
 
-    gal_eph.Cuc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_UC_3_LSB;
-    index += 16;
+    gal_eph.Cuc = static_cast<double>(bits.read_int(16)) * C_UC_3_LSB;
 
-    gal_eph.ecc = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * E_1_LSB;
-    index += 32;
+    gal_eph.ecc = static_cast<double>(bits.read_uint(32)) * E_1_LSB;
 
-    gal_eph.Cus = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_US_3_LSB;
-    index += 16;
+    gal_eph.Cus = static_cast<double>(bits.read_int(16)) * C_US_3_LSB;
 
-    gal_eph.sqrtA = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 32))) * A_1_LSB_GAL;
-    index += 32;
+    gal_eph.sqrtA = static_cast<double>(bits.read_uint(32)) * A_1_LSB_GAL;
 
-    gal_eph.toe = static_cast<double>(Rtcm::bin_to_uint(message_bin.substr(index, 14))) * T0E_1_LSB;
-    index += 14;
+    gal_eph.toe = static_cast<double>(bits.read_uint(14)) * T0E_1_LSB;
 
-    gal_eph.Cic = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IC_4_LSB;
-    index += 16;
+    gal_eph.Cic = static_cast<double>(bits.read_int(16)) * C_IC_4_LSB;
 
-    gal_eph.OMEGA_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_0_2_LSB;
-    index += 32;
+    gal_eph.OMEGA_0 = static_cast<double>(bits.read_int(32)) * OMEGA_0_2_LSB;
 
-    gal_eph.Cis = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_IS_4_LSB;
-    index += 16;
+    gal_eph.Cis = static_cast<double>(bits.read_int(16)) * C_IS_4_LSB;
 
-    gal_eph.i_0 = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * I_0_2_LSB;
-    index += 32;
+    gal_eph.i_0 = static_cast<double>(bits.read_int(32)) * I_0_2_LSB;
 
-    gal_eph.Crc = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 16))) * C_RC_3_LSB;
-    index += 16;
+    gal_eph.Crc = static_cast<double>(bits.read_int(16)) * C_RC_3_LSB;
 
-    gal_eph.omega = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 32))) * OMEGA_2_LSB;
-    index += 32;
+    gal_eph.omega = static_cast<double>(bits.read_int(32)) * OMEGA_2_LSB;
 
-    gal_eph.OMEGAdot = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 24))) * OMEGA_DOT_3_LSB;
-    index += 24;
+    gal_eph.OMEGAdot = static_cast<double>(bits.read_int(24)) * OMEGA_DOT_3_LSB;
 
-    gal_eph.BGD_E1E5a = static_cast<double>(Rtcm::bin_to_int(message_bin.substr(index, 10)));
-    index += 10;
+    gal_eph.BGD_E1E5a = static_cast<double>(bits.read_int(10));
 
-    gal_eph.E5a_HS = static_cast<uint32_t>(Rtcm::bin_to_uint(message_bin.substr(index, 2)));
-    index += 2;
+    gal_eph.E5a_HS = static_cast<uint32_t>(bits.read_uint(2));
 
-    gal_eph.E5a_DVS = static_cast<bool>(Rtcm::bin_to_uint(message_bin.substr(index, 1)));
+    gal_eph.E5a_DVS = static_cast<bool>(bits.read_uint(1));
 
     return 0;
 }
@@ -2289,7 +2130,8 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
             msg_number = 1071;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2299,22 +2141,23 @@ std::string Rtcm::print_MSM_1(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_1_content_signal_data(observables);
+    Rtcm::write_MSM_1_content_signal_data(message_bits, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
 
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_header(uint32_t msg_number,
+void Rtcm::write_MSM_header(Rtcm_Bit_Writer& bits,
+    uint32_t msg_number,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables,
     uint32_t ref_id,
@@ -2341,39 +2184,39 @@ std::string Rtcm::get_MSM_header(uint32_t msg_number,
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
 
-    std::string header = DF002.to_string() + DF003.to_string();
+    Rtcm::set_DF396(observables);
+
+    bits << DF002
+         << DF003;
     // GNSS Epoch Time Specific to each constellation
     if ((sys == "R"))
         {
             // GLONASS Epoch Time
             Rtcm::set_DF034(obs_time);
-            header += DF034.to_string();
+            bits << DF034;
         }
     else
         {
             // GPS, Galileo Epoch Time
             Rtcm::set_DF004(obs_time);
-            header += DF004.to_string();
+            bits << DF004;
         }
 
-    header = header + DF393.to_string() +
-             DF409.to_string() +
-             DF001_.to_string() +
-             DF411.to_string() +
-             DF417.to_string() +
-             DF412.to_string() +
-             DF418.to_string() +
-             DF394.to_string() +
-             DF395.to_string() +
-             Rtcm::set_DF396(observables);
-
-    return header;
+    bits << DF393
+         << DF409
+         << DF001_
+         << DF411
+         << DF417
+         << DF412
+         << DF418
+         << DF394
+         << DF395
+         << DF396;
 }
 
 
-std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_1_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2404,16 +2247,13 @@ std::string Rtcm::get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchr
     for (uint32_t nsat = 0; nsat < num_satellites; nsat++)
         {
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            sat_data += DF398.to_string();
+            bits << DF398;
         }
-
-    return sat_data;
 }
 
 
-std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_1_content_signal_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
     const uint32_t Ncells = observables.size();
 
     auto observables_vector = std::vector<std::pair<int32_t, Gnss_Synchro>>();
@@ -2434,10 +2274,8 @@ std::string Rtcm::get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Syn
     for (uint32_t cell = 0; cell < Ncells; cell++)
         {
             Rtcm::set_DF400(ordered_by_PRN_pos.at(cell).second);
-            signal_data += DF400.to_string();
+            bits << DF400;
         }
-
-    return signal_data;
 }
 
 
@@ -2487,7 +2325,8 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
             msg_number = 1072;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2497,31 +2336,34 @@ std::string Rtcm::print_MSM_2(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_2_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_2_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_2_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
 
     const uint32_t Ncells = observables.size();
 
@@ -2545,13 +2387,14 @@ std::string Rtcm::get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF401.to_string();
-            second_data_type += DF402.to_string();
-            third_data_type += DF420.to_string();
+            first_data_type << DF401;
+            second_data_type << DF402;
+            third_data_type << DF420;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type;
 }
 
 
@@ -2601,7 +2444,8 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
             msg_number = 1073;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2611,32 +2455,35 @@ std::string Rtcm::print_MSM_3(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_1_content_sat_data(observables);
+    Rtcm::write_MSM_1_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_3_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_3_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_3_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
 
     const uint32_t Ncells = observables.size();
 
@@ -2661,14 +2508,16 @@ std::string Rtcm::get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF401(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type;
 }
 
 
@@ -2718,7 +2567,8 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
             msg_number = 1074;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2728,25 +2578,28 @@ std::string Rtcm::print_MSM_4(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::write_MSM_4_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_4_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_4_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_4_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2777,27 +2630,30 @@ std::string Rtcm::get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchr
         {
             Rtcm::set_DF397(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
-            first_data_type += DF397.to_string();
-            second_data_type += DF398.to_string();
+            first_data_type << DF397;
+            second_data_type << DF398;
         }
-    sat_data = first_data_type + second_data_type;
-    return sat_data;
+    bits << first_data_type
+         << second_data_type;
 }
 
 
-std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_4_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
+    Rtcm_Bit_Writer& fifth_data_type = msm_data_types[4];
 
     const uint32_t Ncells = observables.size();
 
@@ -2823,15 +2679,18 @@ std::string Rtcm::get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF402(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
+            fifth_data_type << DF403;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type
+         << fifth_data_type;
 }
 
 
@@ -2881,7 +2740,8 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
             msg_number = 1075;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -2891,27 +2751,30 @@ std::string Rtcm::print_MSM_5(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::write_MSM_5_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_5_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_5_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables)
+void Rtcm::write_MSM_5_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string sat_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
 
     Rtcm::set_DF394(observables);
     const uint32_t num_satellites = DF394.count();
@@ -2944,30 +2807,35 @@ std::string Rtcm::get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchr
             Rtcm::set_DF398(ordered_by_PRN_pos.at(nsat).second);
             Rtcm::set_DF399(ordered_by_PRN_pos.at(nsat).second);
             auto reserved = std::bitset<4>("0000");
-            first_data_type += DF397.to_string();
-            second_data_type += reserved.to_string();
-            third_data_type += DF398.to_string();
-            fourth_data_type += DF399.to_string();
+            first_data_type << DF397;
+            second_data_type << reserved;
+            third_data_type << DF398;
+            fourth_data_type << DF399;
         }
-    sat_data = first_data_type + second_data_type + third_data_type + fourth_data_type;
-    return sat_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type;
 }
 
 
-std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_5_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
+    Rtcm_Bit_Writer& fifth_data_type = msm_data_types[4];
+    Rtcm_Bit_Writer& sixth_data_type = msm_data_types[5];
 
     const uint32_t Ncells = observables.size();
 
@@ -2994,16 +2862,20 @@ std::string Rtcm::get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF403(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF400.to_string();
-            second_data_type += DF401.to_string();
-            third_data_type += DF402.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF403.to_string();
-            sixth_data_type += DF404.to_string();
+            first_data_type << DF400;
+            second_data_type << DF401;
+            third_data_type << DF402;
+            fourth_data_type << DF420;
+            fifth_data_type << DF403;
+            sixth_data_type << DF404;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type
+         << fifth_data_type
+         << sixth_data_type;
 }
 
 
@@ -3053,7 +2925,8 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3063,33 +2936,36 @@ std::string Rtcm::print_MSM_6(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_4_content_sat_data(observables);
+    Rtcm::write_MSM_4_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_6_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_6_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_6_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
+    Rtcm_Bit_Writer& fifth_data_type = msm_data_types[4];
 
     const uint32_t Ncells = observables.size();
 
@@ -3115,15 +2991,18 @@ std::string Rtcm::get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF407(ephNAV, ephCNAV, ephFNAV, ephGNAV, obs_time, ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
+            first_data_type << DF405;
+            second_data_type << DF406;
+            third_data_type << DF407;
+            fourth_data_type << DF420;
+            fifth_data_type << DF408;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type
+         << fifth_data_type;
 }
 
 
@@ -3173,7 +3052,8 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
             msg_number = 1076;
         }
 
-    const std::string header = Rtcm::get_MSM_header(msg_number,
+    message_bits.clear();
+    Rtcm::write_MSM_header(message_bits, msg_number,
         obs_time,
         observables,
         ref_id,
@@ -3183,34 +3063,37 @@ std::string Rtcm::print_MSM_7(const Gps_Ephemeris& gps_eph,
         divergence_free,
         more_messages);
 
-    const std::string sat_data = Rtcm::get_MSM_5_content_sat_data(observables);
+    Rtcm::write_MSM_5_content_sat_data(message_bits, observables);
 
-    const std::string signal_data = Rtcm::get_MSM_7_content_signal_data(gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
+    Rtcm::write_MSM_7_content_signal_data(message_bits, gps_eph, gps_cnav_eph, gal_eph, glo_gnav_eph, obs_time, observables);
 
-    std::string message = build_message(header + sat_data + signal_data);
+    std::string message = build_message(message_bits);
     if (server_is_running)
         {
-            rtcm_message_queue->push(message);
+            caster->publish(message);
         }
 
     return message;
 }
 
 
-std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
+void Rtcm::write_MSM_7_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV,
     const Gps_CNAV_Ephemeris& ephCNAV,
     const Galileo_Ephemeris& ephFNAV,
     const Glonass_Gnav_Ephemeris& ephGNAV,
     double obs_time,
     const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string signal_data;
-    std::string first_data_type;
-    std::string second_data_type;
-    std::string third_data_type;
-    std::string fourth_data_type;
-    std::string fifth_data_type;
-    std::string sixth_data_type;
+    for (auto& data_type : msm_data_types)
+        {
+            data_type.clear();
+        }
+    Rtcm_Bit_Writer& first_data_type = msm_data_types[0];
+    Rtcm_Bit_Writer& second_data_type = msm_data_types[1];
+    Rtcm_Bit_Writer& third_data_type = msm_data_types[2];
+    Rtcm_Bit_Writer& fourth_data_type = msm_data_types[3];
+    Rtcm_Bit_Writer& fifth_data_type = msm_data_types[4];
+    Rtcm_Bit_Writer& sixth_data_type = msm_data_types[5];
 
     const uint32_t Ncells = observables.size();
 
@@ -3237,16 +3120,20 @@ std::string Rtcm::get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV,
             Rtcm::set_DF420(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF408(ordered_by_PRN_pos.at(cell).second);
             Rtcm::set_DF404(ordered_by_PRN_pos.at(cell).second);
-            first_data_type += DF405.to_string();
-            second_data_type += DF406.to_string();
-            third_data_type += DF407.to_string();
-            fourth_data_type += DF420.to_string();
-            fifth_data_type += DF408.to_string();
-            sixth_data_type += DF404.to_string();
+            first_data_type << DF405;
+            second_data_type << DF406;
+            third_data_type << DF407;
+            fourth_data_type << DF420;
+            fifth_data_type << DF408;
+            sixth_data_type << DF404;
         }
 
-    signal_data = first_data_type + second_data_type + third_data_type + fourth_data_type + fifth_data_type + sixth_data_type;
-    return signal_data;
+    bits << first_data_type
+         << second_data_type
+         << third_data_type
+         << fourth_data_type
+         << fifth_data_type
+         << sixth_data_type;
 }
 
 
@@ -4508,12 +4395,8 @@ int32_t Rtcm::set_DF107(const Glonass_Gnav_Ephemeris& glonass_gnav_eph)
     min = (tk - hrs * 3600) / 60;
     sec = (tk - hrs * 3600 - min * 60) / 60;
 
-    std::string _hrs = std::bitset<5>(hrs).to_string();  // string conversion
-    std::string _min = std::bitset<6>(min).to_string();  // string conversion
-    std::string _sec = std::bitset<1>(sec).to_string();  // string conversion
-
     // Set hrs, min, sec in designed bit positions
-    DF107 = std::bitset<12>(_hrs + _min + _sec);
+    DF107 = std::bitset<12>(((hrs & 0x1FU) << 7) | ((min & 0x3FU) << 1) | (sec & 0x1U));
 
     return 0;
 }
@@ -4771,8 +4654,11 @@ int32_t Rtcm::set_DF134(const Glonass_Gnav_Utc_Model& glonass_gnav_utc_model)
 
 int32_t Rtcm::set_DF135(const Glonass_Gnav_Utc_Model& glonass_gnav_utc_model)
 {
-    const auto tau_gps = static_cast<int32_t>(std::round(glonass_gnav_utc_model.d_tau_gps) / TWO_N30);
-    DF135 = std::bitset<22>(tau_gps);
+    const auto tau_gps_mag = static_cast<int32_t>(std::round(fabs(glonass_gnav_utc_model.d_tau_gps / TWO_N30)));
+    const uint32_t tau_gps_sgn = glo_sgn(glonass_gnav_utc_model.d_tau_gps);
+
+    DF135 = std::bitset<22>(tau_gps_mag);
+    DF135.set(21, tau_gps_sgn);
     return 0;
 }
 
@@ -5136,9 +5022,9 @@ int32_t Rtcm::set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro)
 }
 
 
-std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
+int32_t Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 {
-    std::string DF396;
+    DF396.clear();
     std::map<int32_t, Gnss_Synchro>::const_iterator observables_iter;
     Rtcm::set_DF394(observables);
     Rtcm::set_DF395(observables);
@@ -5147,8 +5033,7 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
 
     if ((num_signals == 0) || (num_satellites == 0))
         {
-            std::string s("");
-            return s;
+            return 0;
         }
     std::vector<std::vector<bool>> matrix(num_signals, std::vector<bool>());
 
@@ -5253,24 +5138,14 @@ std::string Rtcm::set_DF396(const std::map<int32_t, Gnss_Synchro>& observables)
         }
 
     // write the matrix column-wise
-    DF396.clear();
     for (uint32_t col = 0; col < num_satellites; col++)
         {
             for (uint32_t row = 0; row < num_signals; row++)
                 {
-                    std::string ss;
-                    if (matrix[row].at(col))
-                        {
-                            ss = "1";
-                        }
-                    else
-                        {
-                            ss = "0";
-                        }
-                    DF396 += ss;
+                    DF396.put(matrix[row].at(col) ? 1 : 0, 1);
                 }
         }
-    return DF396;
+    return 0;
 }
 
 
@@ -19,27 +19,23 @@
 #define GNSS_SDR_RTCM_H
 
 
-#include "concurrent_queue.h"
 #include "galileo_ephemeris.h"
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
 #include "gnss_synchro.h"
 #include "gps_cnav_ephemeris.h"
 #include "gps_ephemeris.h"
+#include "rtcm_bit_stream.h"
+#include "rtcm_caster.h"
 #include <boost/asio.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <glog/logging.h>
-#include <algorithm>  // for min
 #include <array>
 #include <bitset>
 #include <cstddef>  // for size_t
 #include <cstdint>
-#include <cstring>  // for memcpy
-#include <deque>
-#include <list>
 #include <map>
 #include <memory>
-#include <set>
 #include <string>
 #include <thread>
 #include <utility>
@@ -91,6 +87,14 @@ class Rtcm
 {
 public:
     explicit Rtcm(uint16_t port = 2101);  //!< Default constructor that sets TCP port of the RTCM message server and RTCM Station ID. 2101 is the standard RTCM port according to the Internet Assigned Numbers Authority (IANA). See https://www.iana.org/assignments/service-names-port-numbers/service-names-port-numbers.xml
+
+    /*!
+     * \brief Constructor that also sets the mountpoints of the server, as a
+     * list such as "MSM7:1005,1077,1087;EPH:1019,1020", and the number of
+     * messages that each client can have queued. See Rtcm_Caster.
+     */
+    Rtcm(uint16_t port, const std::string& mountpoints, size_t client_queue_size);
+
     ~Rtcm();
 
     /*!
@@ -368,14 +372,15 @@ public:
     void run_server();   //!< Starts running the server
     void stop_server();  //!< Stops the server
 
-    void send_message(const std::string& msg);  //!< Sends a message through the server to all connected clients
-    bool is_server_running() const;             //!< Returns true if the server is running, false otherwise
+    void send_message(const std::string& msg);    //!< Sends a message through the server to all connected clients
+    bool is_server_running() const;               //!< Returns true if the server is running, false otherwise
+    Rtcm_Caster::Stats get_server_stats() const;  //!< Returns the message and client counters of the server
 
 private:
     //
     // Generation of messages content
     //
-    std::bitset<64> get_MT1001_4_header(uint32_t msg_number,
+    void write_MT1001_4_header(Rtcm_Bit_Writer& bits, uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -383,25 +388,25 @@ private:
         bool sync_flag,
         bool divergence_free);
 
-    std::bitset<58> get_MT1001_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<74> get_MT1002_sat_content(const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
-    std::bitset<101> get_MT1003_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
-    std::bitset<125> get_MT1004_sat_content(const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void write_MT1001_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void write_MT1002_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& eph, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void write_MT1003_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void write_MT1004_sat_content(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephL1, const Gps_CNAV_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
 
-    std::bitset<152> get_MT1005_test();
+    void write_MT1005_test(Rtcm_Bit_Writer& bits);
 
     /*!
-     * \brief Generates contents of message header for types 1009, 1010, 1011 and 1012. GLONASS RTK Message
+     * \brief Appends the message header for types 1009, 1010, 1011 and 1012. GLONASS RTK Message
      * \note Code added as part of GSoC 2017 program
+     * \param bits Writer to which the header is appended
      * \param msg_number Message type number, acceptable options include 1009 to 1012
      * \param obs_time Time of observation at the moment of printing
      * \param observables Set of observables as defined by the platform
      * \param ref_id
      * \param smooth_int
      * \param divergence_free
-     * \return Returns the message header content as set of bits
      */
-    std::bitset<61> get_MT1009_12_header(uint32_t msg_number,
+    void write_MT1009_12_header(Rtcm_Bit_Writer& bits, uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -410,51 +415,52 @@ private:
         bool divergence_free);
 
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1009 Message (GLONASS Basic RTK, L1 Only)
+     * \brief Appends the contents of the satellite specific portion of a type 1009 Message (GLONASS Basic RTK, L1 Only)
      * \details Contents generated for each satellite. See table 3.5-11
      * \note Code added as part of GSoC 2017 program
+     * \param bits Writer to which the content is appended
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<64> get_MT1009_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void write_MT1009_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1010 Message (GLONASS Extended RTK, L1 Only)
+     * \brief Appends the contents of the satellite specific portion of a type 1010 Message (GLONASS Extended RTK, L1 Only)
      * \details Contents generated for each satellite. See table 3.5-12
      * \note Code added as part of GSoC 2017 program
+     * \param bits Writer to which the content is appended
      * \param ephGNAV Ephemeris for GLONASS GNAV in L1 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchro Information generated by channels while processing the satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<79> get_MT1010_sat_content(const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
+    void write_MT1010_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const Gnss_Synchro& gnss_synchro);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1011 Message (GLONASS Basic RTK, L1 & L2)
+     * \brief Appends the contents of the satellite specific portion of a type 1011 Message (GLONASS Basic RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-13
      * \note Code added as part of GSoC 2017 program
+     * \param bits Writer to which the content is appended
      * \param ephGNAVL1 Ephemeris for GLONASS GNAV in L1 satellites
      * \param ephGNAVL2 Ephemeris for GLONASS GNAV in L2 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<107> get_MT1011_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void write_MT1011_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
     /*!
-     * \brief Get the contents of the satellite specific portion of a type 1012 Message (GLONASS Extended RTK, L1 & L2)
+     * \brief Appends the contents of the satellite specific portion of a type 1012 Message (GLONASS Extended RTK, L1 & L2)
      * \details Contents generated for each satellite. See table 3.5-14
      * \note Code added as part of GSoC 2017 program
+     * \param bits Writer to which the content is appended
      * \param ephGNAVL1 Ephemeris for GLONASS GNAV in L1 satellites
      * \param ephGNAVL2 Ephemeris for GLONASS GNAV in L2 satellites
      * \param obs_time Time of observation at the moment of printing
      * \param gnss_synchroL1 Information generated by channels while processing the GLONASS GNAV L1 satellite
      * \param gnss_synchroL2 Information generated by channels while processing the GLONASS GNAV L2 satellite
-     * \return Returns the message content as set of bits
      */
-    std::bitset<130> get_MT1012_sat_content(const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
+    void write_MT1012_sat_content(Rtcm_Bit_Writer& bits, const Glonass_Gnav_Ephemeris& ephL1, const Glonass_Gnav_Ephemeris& ephL2, double obs_time, const Gnss_Synchro& gnss_synchroL1, const Gnss_Synchro& gnss_synchroL2);
 
-    std::string get_MSM_header(uint32_t msg_number,
+    void write_MSM_header(Rtcm_Bit_Writer& bits,
+        uint32_t msg_number,
         double obs_time,
         const std::map<int32_t, Gnss_Synchro>& observables,
         uint32_t ref_id,
@@ -464,17 +470,17 @@ private:
         bool divergence_free,
         bool more_messages);
 
-    std::string get_MSM_1_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_sat_data(const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_1_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_4_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_5_content_sat_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables);
 
-    std::string get_MSM_1_content_signal_data(const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_2_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_3_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_4_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_5_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_6_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
-    std::string get_MSM_7_content_signal_data(const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_1_content_signal_data(Rtcm_Bit_Writer& bits, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_2_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_3_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_4_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_5_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_6_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
+    void write_MSM_7_content_signal_data(Rtcm_Bit_Writer& bits, const Gps_Ephemeris& ephNAV, const Gps_CNAV_Ephemeris& ephCNAV, const Galileo_Ephemeris& ephFNAV, const Glonass_Gnav_Ephemeris& ephGNAV, double obs_time, const std::map<int32_t, Gnss_Synchro>& observables);
 
     //
     // Utilities
@@ -498,458 +504,13 @@ private:
     uint32_t msm_extended_lock_time_indicator(uint32_t lock_time_period_s);
 
     //
-    // Classes for TCP communication
+    // TCP server
     //
     uint16_t RTCM_port;
     // uint16_t RTCM_Station_ID;
-    class Rtcm_Message
-    {
-    public:
-        static const std::size_t header_length = 6;
-        static const std::size_t max_body_length = 1029;
-
-        Rtcm_Message()
-            : body_length_(0)
-        {
-        }
-
-        const char* data() const
-        {
-            return data_.data();
-        }
-
-        char* data()
-        {
-            return data_.data();
-        }
-
-        inline std::size_t length() const
-        {
-            return header_length + body_length_;
-        }
-
-        const char* body() const
-        {
-            return data_.data() + header_length;
-        }
-
-        char* body()
-        {
-            return data_.data() + header_length;
-        }
-
-        std::size_t body_length() const
-        {
-            return body_length_;
-        }
-
-        void body_length(std::size_t new_length)
-        {
-            body_length_ = new_length;
-            if (body_length_ > max_body_length)
-                {
-                    body_length_ = max_body_length;
-                }
-        }
-
-        inline bool decode_header()
-        {
-            char header[header_length + 1] = "";
-            std::strncat(header, data_.data(), header_length);
-            if (header[0] != 'G' || header[1] != 'S')
-                {
-                    return false;
-                }
-
-            char header2_[header_length - 1] = "";
-            std::strncat(header2_, data_.data() + 2, header_length - 2);
-            body_length_ = std::atoi(header2_);
-            if (body_length_ == 0)
-                {
-                    return false;
-                }
-
-            if (body_length_ > max_body_length)
-                {
-                    body_length_ = 0;
-                    return false;
-                }
-            return true;
-        }
-
-        inline void encode_header()
-        {
-            char header[header_length + 1] = "";
-            std::snprintf(header, header_length + 1, "GS%4d", std::max(std::min(static_cast<int>(body_length_), static_cast<int>(max_body_length)), 0));
-            std::memcpy(data_.data(), header, header_length);
-        }
-
-    private:
-        std::array<char, header_length + max_body_length> data_{};
-        std::size_t body_length_;
-    };
-
-
-    class RtcmListener
-    {
-    public:
-        virtual ~RtcmListener() = default;
-        virtual void deliver(const Rtcm_Message& msg) = 0;
-    };
-
-
-    class Rtcm_Listener_Room
-    {
-    public:
-        inline void join(const std::shared_ptr<RtcmListener>& participant)
-        {
-            participants_.insert(participant);
-            for (auto msg : recent_msgs_)
-                {
-                    participant->deliver(msg);
-                }
-        }
-
-        inline void leave(const std::shared_ptr<RtcmListener>& participant)
-        {
-            participants_.erase(participant);
-        }
-
-        inline void deliver(const Rtcm_Message& msg)
-        {
-            recent_msgs_.push_back(msg);
-            while (recent_msgs_.size() > max_recent_msgs)
-                {
-                    recent_msgs_.pop_front();
-                }
-
-            for (const auto& participant : participants_)
-                {
-                    participant->deliver(msg);
-                }
-        }
-
-    private:
-        std::set<std::shared_ptr<RtcmListener>> participants_;
-        enum
-        {
-            max_recent_msgs = 1
-        };
-        std::deque<Rtcm_Message> recent_msgs_;
-    };
-
-
-    class Rtcm_Session
-        : public RtcmListener,
-          public std::enable_shared_from_this<Rtcm_Session>
-    {
-    public:
-        Rtcm_Session(boost::asio::ip::tcp::socket socket, Rtcm_Listener_Room& room) : socket_(std::move(socket)), room_(room) {}
-        inline void start()
-        {
-            room_.join(shared_from_this());
-            do_read_message_header();
-        }
-
-        inline void deliver(const Rtcm_Message& msg)
-        {
-            bool write_in_progress = !write_msgs_.empty();
-            write_msgs_.push_back(msg);
-            if (!write_in_progress)
-                {
-                    do_write();
-                }
-        }
-
-    private:
-        inline void do_read_message_header()
-        {
-            auto self(shared_from_this());
-            boost::asio::async_read(socket_,
-                boost::asio::buffer(read_msg_.data(), Rtcm_Message::header_length),
-                [this, self](boost::system::error_code ec, std::size_t /*length*/) {
-                    if (!ec and read_msg_.decode_header())
-                        {
-                            do_read_message_body();
-                        }
-                    else if (!ec and !read_msg_.decode_header())
-                        {
-                            client_says += read_msg_.data();
-                            bool first = true;
-                            while (client_says.length() >= 80)
-                                {
-                                    if (first == true)
-                                        {
-                                            LOG(INFO) << "Client says:";
-                                            first = false;
-                                        }
-                                    LOG(INFO) << client_says;
-                                    client_says = client_says.substr(80, client_says.length() - 80);
-                                }
-                            do_read_message_header();
-                        }
-                    else
-                        {
-                            std::cout << "Closing connection with RTCM client\n";
-                            room_.leave(shared_from_this());
-                        }
-                });
-        }
-
-        inline void do_read_message_body()
-        {
-            auto self(shared_from_this());
-            boost::asio::async_read(socket_,
-                boost::asio::buffer(read_msg_.body(), read_msg_.body_length()),
-                [this, self](boost::system::error_code ec, std::size_t /*length*/) {
-                    if (!ec)
-                        {
-                            room_.deliver(read_msg_);
-                            // std::cout << "Delivered message (session): ";
-                            // std::cout.write(read_msg_.body(), read_msg_.body_length());
-                            // std::cout << '\n';
-                            do_read_message_header();
-                        }
-                    else
-                        {
-                            std::cout << "Closing connection with RTCM client\n";
-                            room_.leave(shared_from_this());
-                        }
-                });
-        }
-
-        inline void do_write()
-        {
-            auto self(shared_from_this());
-            boost::asio::async_write(socket_,
-                boost::asio::buffer(write_msgs_.front().body(), write_msgs_.front().body_length()),
-                [this, self](boost::system::error_code ec, std::size_t /*length*/) {
-                    if (!ec)
-                        {
-                            write_msgs_.pop_front();
-                            if (!write_msgs_.empty())
-                                {
-                                    do_write();
-                                }
-                        }
-                    else
-                        {
-                            std::cout << "Closing connection with RTCM client\n";
-                            room_.leave(shared_from_this());
-                        }
-                });
-        }
-
-        boost::asio::ip::tcp::socket socket_;
-        Rtcm_Listener_Room& room_;
-        Rtcm_Message read_msg_;
-        std::deque<Rtcm_Message> write_msgs_;
-        std::string client_says;
-    };
-
-
-    class Tcp_Internal_Client
-        : public std::enable_shared_from_this<Tcp_Internal_Client>
-    {
-    public:
-        Tcp_Internal_Client(b_io_context& io_context,
-            boost::asio::ip::tcp::resolver::iterator endpoint_iterator)
-            : io_context_(io_context), socket_(io_context)
-        {
-            do_connect(std::move(endpoint_iterator));
-        }
-
-        inline void close()
-        {
-            io_context_.post([this]() { socket_.close(); });
-        }
-
-        inline void write(const Rtcm_Message& msg)
-        {
-            io_context_.post(
-                [this, msg]() {
-                    bool write_in_progress = !write_msgs_.empty();
-                    write_msgs_.push_back(msg);
-                    if (!write_in_progress)
-                        {
-                            do_write();
-                        }
-                });
-        }
-
-    private:
-        inline void do_connect(boost::asio::ip::tcp::resolver::iterator endpoint_iterator)
-        {
-            boost::asio::async_connect(socket_, std::move(endpoint_iterator),
-                [this](boost::system::error_code ec, boost::asio::ip::tcp::resolver::iterator) {
-                    if (!ec)
-                        {
-                            do_read_message();
-                        }
-                    else
-                        {
-                            std::cout << "Server is down.\n";
-                        }
-                });
-        }
-
-        inline void do_read_message()
-        {
-            boost::asio::async_read(socket_,
-                boost::asio::buffer(read_msg_.data(), 1029),
-                [this](boost::system::error_code ec, std::size_t /*length*/) {
-                    if (!ec)
-                        {
-                            do_read_message();
-                        }
-                    else
-                        {
-                            std::cout << "Error in client\n";
-                            socket_.close();
-                        }
-                });
-        }
-
-        inline void do_write()
-        {
-            boost::asio::async_write(socket_,
-                boost::asio::buffer(write_msgs_.front().data(), write_msgs_.front().length()),
-                [this](boost::system::error_code ec, std::size_t /*length*/) {
-                    if (!ec)
-                        {
-                            write_msgs_.pop_front();
-                            if (!write_msgs_.empty())
-                                {
-                                    do_write();
-                                }
-                        }
-                    else
-                        {
-                            socket_.close();
-                        }
-                });
-        }
-
-        b_io_context& io_context_;
-        boost::asio::ip::tcp::socket socket_;
-        Rtcm_Message read_msg_;
-        std::deque<Rtcm_Message> write_msgs_;
-    };
-
-
-    class Queue_Reader
-    {
-    public:
-        Queue_Reader(b_io_context& io_context, std::shared_ptr<Concurrent_Queue<std::string>>& queue, int32_t port) : queue_(queue)
-        {
-            boost::asio::ip::tcp::resolver resolver(io_context);
-            std::string host("localhost");
-            std::string port_str = std::to_string(port);
-            auto queue_endpoint_iterator = resolver.resolve({host.c_str(), port_str.c_str()});
-            c = std::make_shared<Tcp_Internal_Client>(io_context, queue_endpoint_iterator);
-        }
-
-        inline void do_read_queue()
-        {
-            for (;;)
-                {
-                    std::string message;
-                    Rtcm_Message msg;
-                    queue_->wait_and_pop(message);  // message += '\n';
-                    if (message == "Goodbye")
-                        {
-                            break;
-                        }
-
-                    const char* char_msg = message.c_str();
-                    msg.body_length(message.length());
-                    std::memcpy(msg.body(), char_msg, msg.body_length());
-                    msg.encode_header();
-                    c->write(msg);
-                }
-        }
-
-    private:
-        std::shared_ptr<Tcp_Internal_Client> c;
-        std::shared_ptr<Concurrent_Queue<std::string>>& queue_;
-    };
-
-
-    class Tcp_Server
-    {
-    public:
-        Tcp_Server(b_io_context& io_context, const boost::asio::ip::tcp::endpoint& endpoint)
-            : acceptor_(io_context), socket_(io_context)
-        {
-            acceptor_.open(endpoint.protocol());
-            acceptor_.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
-            acceptor_.bind(endpoint);
-            acceptor_.listen();
-            do_accept();
-        }
-
-        inline void close_server()
-        {
-            socket_.close();
-            acceptor_.close();
-        }
-
-    private:
-        inline void do_accept()
-        {
-            acceptor_.async_accept(socket_, [this](boost::system::error_code ec) {
-                if (!ec)
-                    {
-                        if (first_client)
-                            {
-                                std::cout << "The TCP/IP server of RTCM messages is up and running. Accepting connections ...\n";
-                                first_client = false;
-                            }
-                        else
-                            {
-                                std::cout << "Starting RTCM TCP/IP server session...\n";
-                                boost::system::error_code ec2;
-                                boost::asio::ip::tcp::endpoint endpoint = socket_.remote_endpoint(ec2);
-                                if (ec2)
-                                    {
-                                        // Error creating remote_endpoint
-                                        std::cout << "Error getting remote IP address, closing session.\n";
-                                        LOG(INFO) << "Error getting remote IP address";
-                                        start_session = false;
-                                    }
-                                else
-                                    {
-                                        std::string remote_addr = endpoint.address().to_string();
-                                        std::cout << "Serving client from " << remote_addr << '\n';
-                                        LOG(INFO) << "Serving client from " << remote_addr;
-                                    }
-                            }
-                        if (start_session)
-                            {
-                                std::make_shared<Rtcm_Session>(std::move(socket_), room_)->start();
-                            }
-                    }
-                else
-                    {
-                        std::cout << "Error when invoking a RTCM session. " << ec << '\n';
-                    }
-                start_session = true;
-                do_accept();
-            });
-        }
-
-        boost::asio::ip::tcp::acceptor acceptor_;
-        boost::asio::ip::tcp::socket socket_;
-        Rtcm_Listener_Room room_;
-        bool first_client = true;
-        bool start_session = true;
-    };
-
     b_io_context io_context;
-    std::shared_ptr<Concurrent_Queue<std::string>> rtcm_message_queue;
+    std::unique_ptr<Rtcm_Caster> caster;
     std::thread t;
-    std::thread tq;
-    std::list<Rtcm::Tcp_Server> servers;
     bool server_is_running;
     void stop_service();
 
@@ -958,8 +519,10 @@ private:
     //
     std::bitset<8> preamble;
     std::bitset<6> reserved_field;
-    std::string add_CRC(const std::string& m) const;
-    std::string build_message(const std::string& data) const;  // adds 0s to complete a byte and adds the CRC
+    void add_CRC(std::string& message) const;                      // appends the CRC of message
+    std::string build_message(const Rtcm_Bit_Writer& data) const;  // adds the transport header and the CRC
+    Rtcm_Bit_Writer message_bits;                                  // data message being built, reused between messages
+    std::array<Rtcm_Bit_Writer, 6> msm_data_types;                 // MSM fields, written one data type at a time
 
     //
     // Data Fields
@@ -1412,7 +975,8 @@ private:
     std::bitset<32> DF395;
     int32_t set_DF395(const std::map<int32_t, Gnss_Synchro>& gnss_synchro);
 
-    std::string set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
+    Rtcm_Bit_Writer DF396;
+    int32_t set_DF396(const std::map<int32_t, Gnss_Synchro>& observables);
 
     std::bitset<8> DF397;
     int32_t set_DF397(const Gnss_Synchro& gnss_synchro);
@@ -0,0 +1,247 @@
+/*!
+ * \file rtcm_bit_stream.h
+ * \brief Bit-level writer and reader for RTCM 3 messages, working on packed
+ * bytes
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_BIT_STREAM_H
+#define GNSS_SDR_RTCM_BIT_STREAM_H
+
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Appends bit fields, most significant bit first, to a byte buffer.
+ *
+ * The unused bits of the last byte are always zero, so the buffer can be
+ * sent as it is once the message is complete. clear() keeps the capacity,
+ * so a writer that is reused does not allocate in steady state.
+ */
+class Rtcm_Bit_Writer
+{
+public:
+    Rtcm_Bit_Writer() = default;
+
+    /*!
+     * \brief Appends the nbits least significant bits of value (nbits <= 64)
+     */
+    inline void put(uint64_t value, uint32_t nbits)
+    {
+        while (nbits > 0)
+            {
+                const uint32_t used = d_size_bits & 7U;
+                if (used == 0)
+                    {
+                        d_bytes.push_back(0);
+                    }
+                const uint32_t available = 8U - used;
+                const uint32_t n = nbits < available ? nbits : available;
+                const auto chunk = static_cast<uint8_t>((value >> (nbits - n)) & ((1U << n) - 1U));
+                d_bytes.back() |= static_cast<uint8_t>(chunk << (available - n));
+                nbits -= n;
+                d_size_bits += n;
+            }
+    }
+
+    /*!
+     * \brief Appends all the bits of a data field
+     */
+    template <std::size_t N>
+    inline Rtcm_Bit_Writer& operator<<(const std::bitset<N>& field)
+    {
+        static const std::bitset<N> low_bits(~0ULL);
+        std::size_t remaining = N;
+        while (remaining > 64)
+            {
+                remaining -= 64;
+                put(((field >> remaining) & low_bits).to_ullong(), 64);
+            }
+        put((field & low_bits).to_ullong(), static_cast<uint32_t>(remaining));
+        return *this;
+    }
+
+    /*!
+     * \brief Appends the content of another writer
+     */
+    inline Rtcm_Bit_Writer& operator<<(const Rtcm_Bit_Writer& other)
+    {
+        const std::size_t full_bytes = other.d_size_bits / 8;
+        if ((d_size_bits & 7U) == 0)
+            {
+                d_bytes.insert(d_bytes.end(), other.d_bytes.begin(), other.d_bytes.begin() + full_bytes);
+                d_size_bits += full_bytes * 8;
+            }
+        else
+            {
+                for (std::size_t i = 0; i < full_bytes; i++)
+                    {
+                        put(other.d_bytes[i], 8);
+                    }
+            }
+        const auto tail = static_cast<uint32_t>(other.d_size_bits & 7U);
+        if (tail > 0)
+            {
+                put(other.d_bytes[full_bytes] >> (8U - tail), tail);
+            }
+        return *this;
+    }
+
+    inline void clear()
+    {
+        d_bytes.clear();
+        d_size_bits = 0;
+    }
+
+    inline void reserve(std::size_t nbytes)
+    {
+        d_bytes.reserve(nbytes);
+    }
+
+    inline std::size_t size_bits() const
+    {
+        return d_size_bits;
+    }
+
+    inline std::size_t size_bytes() const
+    {
+        return d_bytes.size();
+    }
+
+    inline const uint8_t* data() const
+    {
+        return d_bytes.data();
+    }
+
+private:
+    std::vector<uint8_t> d_bytes;
+    std::size_t d_size_bits{0};
+};
+
+
+/*!
+ * \brief Reads bit fields, most significant bit first, from a byte buffer.
+ *
+ * Reading past the end of the buffer returns zeros and clears ok().
+ */
+class Rtcm_Bit_Reader
+{
+public:
+    Rtcm_Bit_Reader(const uint8_t* data, std::size_t size_bytes) : d_data(data),
+                                                                   d_size_bits(size_bytes * 8)
+    {
+    }
+
+    explicit Rtcm_Bit_Reader(const std::string& data) : Rtcm_Bit_Reader(reinterpret_cast<const uint8_t*>(data.data()), data.size())
+    {
+    }
+
+    /*!
+     * \brief Reads an unsigned field of nbits bits (nbits <= 64)
+     */
+    inline uint64_t read_uint(uint32_t nbits)
+    {
+        if (d_position + nbits > d_size_bits)
+            {
+                d_ok = false;
+                d_position = d_size_bits;
+                return 0;
+            }
+        uint64_t value = 0;
+        while (nbits > 0)
+            {
+                const auto used = static_cast<uint32_t>(d_position & 7U);
+                const uint32_t available = 8U - used;
+                const uint32_t n = nbits < available ? nbits : available;
+                const uint32_t byte = d_data[d_position / 8];
+                value = (value << n) | ((byte >> (available - n)) & ((1U << n) - 1U));
+                nbits -= n;
+                d_position += n;
+            }
+        return value;
+    }
+
+    /*!
+     * \brief Reads a two's complement field of nbits bits (nbits <= 64)
+     */
+    inline int64_t read_int(uint32_t nbits)
+    {
+        const uint64_t value = read_uint(nbits);
+        if (nbits > 0 && nbits < 64 && (value >> (nbits - 1)) != 0)
+            {
+                return static_cast<int64_t>(value | (~0ULL << nbits));
+            }
+        return static_cast<int64_t>(value);
+    }
+
+    /*!
+     * \brief Reads a sign-magnitude field of nbits bits (nbits <= 64), as used
+     * by GLONASS data fields. The sign bit is set for negative values.
+     */
+    inline int64_t read_sint(uint32_t nbits)
+    {
+        const bool negative = read_uint(1) != 0;
+        const auto magnitude = static_cast<int64_t>(read_uint(nbits - 1));
+        return negative ? -magnitude : magnitude;
+    }
+
+    inline bool read_bool()
+    {
+        return read_uint(1) != 0;
+    }
+
+    inline void skip(uint32_t nbits)
+    {
+        if (d_position + nbits > d_size_bits)
+            {
+                d_ok = false;
+                d_position = d_size_bits;
+                return;
+            }
+        d_position += nbits;
+    }
+
+    inline std::size_t position() const
+    {
+        return d_position;
+    }
+
+    inline std::size_t remaining_bits() const
+    {
+        return d_size_bits - d_position;
+    }
+
+    inline bool ok() const
+    {
+        return d_ok;
+    }
+
+private:
+    const uint8_t* d_data;
+    std::size_t d_size_bits;
+    std::size_t d_position{0};
+    bool d_ok{true};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_BIT_STREAM_H
@@ -0,0 +1,520 @@
+/*!
+ * \file rtcm_caster.cc
+ * \brief Implementation of a TCP server that distributes RTCM 3 messages to
+ * multiple clients, with NTRIP-style mountpoints
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm_caster.h"
+#include <glog/logging.h>
+#include <algorithm>  // for std::min
+#include <array>
+#include <deque>
+#include <iostream>
+#include <istream>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+
+class Rtcm_Caster::Session : public std::enable_shared_from_this<Rtcm_Caster::Session>
+{
+public:
+    static constexpr size_t max_frames_per_write = 16;
+    static constexpr size_t max_request_size = 4096;
+
+    Session(boost::asio::ip::tcp::socket socket, Rtcm_Caster& caster, std::string remote_addr)
+        : d_socket(std::move(socket)),
+          d_caster(caster),
+          d_request(max_request_size),
+          d_request_timer(caster.d_io_context),
+          d_remote_addr(std::move(remote_addr)),
+          d_queue_size(std::max<size_t>(caster.d_client_queue_size, 1))
+    {
+    }
+
+    void start()
+    {
+        auto self(shared_from_this());
+#if USE_BOOST_ASIO_IO_CONTEXT
+        d_request_timer.expires_after(std::chrono::milliseconds(static_cast<int64_t>(request_timeout_ms)));
+#else
+        d_request_timer.expires_from_now(std::chrono::milliseconds(static_cast<int64_t>(request_timeout_ms)));
+#endif
+        d_request_timer.async_wait([this, self](const boost::system::error_code& ec) {
+            if (!ec && !d_requested && !d_closed)
+                {
+                    start_streaming(nullptr);
+                }
+        });
+        read_request();
+    }
+
+    void deliver(const Frame& frame)
+    {
+        if (!d_streaming || d_closed || (d_filter != nullptr && d_filter->count(frame.type) == 0))
+            {
+                return;
+            }
+        if (d_queue.size() >= d_queue_size)
+            {
+                if (d_queue.size() == d_in_flight)
+                    {
+                        // everything in the queue is being written
+                        drop();
+                        return;
+                    }
+                d_queue.erase(d_queue.begin() + static_cast<std::ptrdiff_t>(d_in_flight));
+                drop();
+            }
+        d_queue.push_back(frame);
+        do_write();
+    }
+
+    void close()
+    {
+        if (d_closed)
+            {
+                return;
+            }
+        d_closed = true;
+        boost::system::error_code ec;
+        d_request_timer.cancel(ec);
+        d_socket.close(ec);
+        std::cout << "Closing connection with RTCM client " << d_remote_addr << '\n';
+        LOG(INFO) << "RTCM client " << d_remote_addr << " disconnected. Sent " << d_sent_messages
+                  << " messages (" << d_sent_bytes << " bytes), dropped " << d_dropped_messages
+                  << ", max lag " << d_max_lag_us / 1000.0 << " ms";
+    }
+
+private:
+    void read_request()
+    {
+        auto self(shared_from_this());
+        boost::asio::async_read_until(d_socket, d_request, "\r\n\r\n",
+            [this, self](const boost::system::error_code& ec, std::size_t length) {
+                if (d_closed)
+                    {
+                        return;
+                    }
+                if (ec == boost::asio::error::not_found)
+                    {
+                        // too long for a request
+                        d_request.consume(d_request.size());
+                        read_discard();
+                        return;
+                    }
+                if (ec)
+                    {
+                        leave();
+                        return;
+                    }
+                std::string request(length, '\0');
+                std::istream is(&d_request);
+                is.read(&request[0], static_cast<std::streamsize>(length));
+                d_request.consume(d_request.size());
+                if (!d_requested && !d_streaming && request.compare(0, 4, "GET ") == 0)
+                    {
+                        handle_request(request);
+                    }
+                else
+                    {
+                        LOG(INFO) << "RTCM client " << d_remote_addr << " says: " << request.substr(0, 80);
+                    }
+                if (!d_closed)
+                    {
+                        read_discard();
+                    }
+            });
+    }
+
+    void handle_request(const std::string& request)
+    {
+        // GET /mountpoint HTTP/1.0
+        const size_t begin = request.find('/');
+        const size_t end = request.find_first_of(" \r\n", begin);
+        const std::string mountpoint = begin == std::string::npos ? std::string() : request.substr(begin + 1, end - begin - 1);
+        d_requested = true;
+        boost::system::error_code ec;
+        d_request_timer.cancel(ec);
+        const std::set<uint32_t>* filter = mountpoint.empty() ? nullptr : d_caster.find_mountpoint(mountpoint);
+        if (filter == nullptr)
+            {
+                LOG(INFO) << "RTCM client " << d_remote_addr << " requested the sourcetable (mountpoint \"" << mountpoint << "\")";
+                auto self(shared_from_this());
+                auto response = std::make_shared<std::string>(d_caster.sourcetable());
+                boost::asio::async_write(d_socket, boost::asio::buffer(*response),
+                    [this, self, response](const boost::system::error_code& /*ec*/, std::size_t /*length*/) {
+                        leave();
+                    });
+                return;
+            }
+        LOG(INFO) << "RTCM client " << d_remote_addr << " connected to mountpoint " << mountpoint;
+        static const auto ok = std::make_shared<const std::string>("ICY 200 OK\r\n\r\n");
+        d_queue.push_back(Frame{ok, std::chrono::steady_clock::now(), 0});
+        start_streaming(filter);
+    }
+
+    void start_streaming(const std::set<uint32_t>* filter)
+    {
+        d_streaming = true;
+        d_filter = (filter != nullptr && filter->empty()) ? nullptr : filter;
+        if (d_caster.d_latest.data)
+            {
+                deliver(d_caster.d_latest);
+            }
+        do_write();
+    }
+
+    // Reads and ignores anything the client sends once it is streaming,
+    // such as NMEA GGA sentences from NTRIP rovers.
+    void read_discard()
+    {
+        auto self(shared_from_this());
+        d_socket.async_read_some(boost::asio::buffer(d_discard),
+            [this, self](const boost::system::error_code& ec, std::size_t length) {
+                if (d_closed)
+                    {
+                        return;
+                    }
+                if (ec)
+                    {
+                        leave();
+                        return;
+                    }
+                DLOG(INFO) << "RTCM client " << d_remote_addr << " says: " << std::string(d_discard.data(), std::min<size_t>(length, 80));
+                read_discard();
+            });
+    }
+
+    void do_write()
+    {
+        if (d_closed || d_in_flight > 0 || d_queue.empty())
+            {
+                return;
+            }
+        d_in_flight = std::min({d_queue.size(), max_frames_per_write, d_queue_size});
+        d_buffers.clear();
+        for (size_t i = 0; i < d_in_flight; i++)
+            {
+                d_buffers.emplace_back(boost::asio::buffer(*d_queue[i].data));
+            }
+        auto self(shared_from_this());
+        boost::asio::async_write(d_socket, d_buffers,
+            [this, self](const boost::system::error_code& ec, std::size_t length) {
+                if (d_closed)
+                    {
+                        return;
+                    }
+                if (ec)
+                    {
+                        leave();
+                        return;
+                    }
+                const auto now = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < d_in_flight; i++)
+                    {
+                        const auto lag_us = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(now - d_queue.front().published).count());
+                        d_max_lag_us = std::max(d_max_lag_us, lag_us);
+                        if (lag_us > d_caster.d_max_lag_us.load(std::memory_order_relaxed))
+                            {
+                                d_caster.d_max_lag_us.store(lag_us, std::memory_order_relaxed);
+                            }
+                        d_queue.pop_front();
+                    }
+                d_sent_messages += d_in_flight;
+                d_sent_bytes += length;
+                d_caster.d_sent_messages.fetch_add(d_in_flight, std::memory_order_relaxed);
+                d_caster.d_sent_bytes.fetch_add(length, std::memory_order_relaxed);
+                d_in_flight = 0;
+                do_write();
+            });
+    }
+
+    void drop()
+    {
+        d_dropped_messages++;
+        d_caster.d_dropped_messages.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void leave()
+    {
+        close();
+        d_caster.leave(shared_from_this());
+    }
+
+    boost::asio::ip::tcp::socket d_socket;
+    Rtcm_Caster& d_caster;
+    boost::asio::streambuf d_request;
+    boost::asio::steady_timer d_request_timer;
+    std::array<char, 512> d_discard{};
+    std::string d_remote_addr;
+    std::deque<Frame> d_queue;
+    std::vector<boost::asio::const_buffer> d_buffers;
+    const std::set<uint32_t>* d_filter{nullptr};  // nullptr: all message types
+    size_t d_queue_size;
+    size_t d_in_flight{0};  // frames at the front of d_queue being written
+    uint64_t d_sent_messages{0};
+    uint64_t d_sent_bytes{0};
+    uint64_t d_dropped_messages{0};
+    uint64_t d_max_lag_us{0};
+    bool d_requested{false};
+    bool d_streaming{false};
+    bool d_closed{false};
+};
+
+
+Rtcm_Caster::Rtcm_Caster(b_io_context& io_context, uint16_t port, size_t client_queue_size)
+    : d_io_context(io_context),
+      d_acceptor(io_context),
+      d_socket(io_context),
+      d_stats_timer(io_context),
+      d_client_queue_size(client_queue_size)
+{
+    const boost::asio::ip::tcp::endpoint endpoint(boost::asio::ip::tcp::v4(), port);
+    d_acceptor.open(endpoint.protocol());
+    d_acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address(true));
+    d_acceptor.bind(endpoint);
+    d_acceptor.listen();
+    do_accept();
+    do_log_stats();
+}
+
+
+Rtcm_Caster::~Rtcm_Caster()
+{
+    close();
+}
+
+
+bool Rtcm_Caster::add_mountpoints(const std::string& list)
+{
+    std::stringstream ss(list);
+    std::string item;
+    bool valid = true;
+    while (std::getline(ss, item, ';'))
+        {
+            if (item.empty())
+                {
+                    continue;
+                }
+            const size_t colon = item.find(':');
+            const std::string name = item.substr(0, colon);
+            if (name.empty() || name.find_first_of(" /\r\n") != std::string::npos)
+                {
+                    LOG(WARNING) << "Invalid RTCM mountpoint name in \"" << item << "\"";
+                    valid = false;
+                    continue;
+                }
+            std::set<uint32_t> message_types;
+            if (colon != std::string::npos)
+                {
+                    std::stringstream types(item.substr(colon + 1));
+                    std::string type;
+                    while (std::getline(types, type, ','))
+                        {
+                            try
+                                {
+                                    const unsigned long value = std::stoul(type);  // NOLINT(google-runtime-int)
+                                    if (value == 0 || value > 4095)
+                                        {
+                                            throw std::out_of_range(type);
+                                        }
+                                    message_types.insert(static_cast<uint32_t>(value));
+                                }
+                            catch (const std::logic_error&)
+                                {
+                                    LOG(WARNING) << "Invalid RTCM message type \"" << type << "\" in mountpoint " << name;
+                                    valid = false;
+                                }
+                        }
+                }
+            add_mountpoint(name, message_types);
+        }
+    return valid;
+}
+
+
+void Rtcm_Caster::add_mountpoint(const std::string& name, const std::set<uint32_t>& message_types)
+{
+    d_mountpoints[name] = message_types;
+}
+
+
+void Rtcm_Caster::publish(const std::string& frame)
+{
+    if (d_closed.load(std::memory_order_relaxed))
+        {
+            return;
+        }
+    Frame f{std::make_shared<const std::string>(frame), std::chrono::steady_clock::now(), message_type(frame)};
+#if USE_BOOST_ASIO_IO_CONTEXT
+    boost::asio::post(d_io_context, [this, f]() { fan_out(f); });
+#else
+    d_io_context.post([this, f]() { fan_out(f); });
+#endif
+}
+
+
+void Rtcm_Caster::close()
+{
+    if (d_closed.exchange(true))
+        {
+            return;
+        }
+    boost::system::error_code ec;
+    d_stats_timer.cancel(ec);
+    d_acceptor.close(ec);
+    d_socket.close(ec);
+    std::set<std::shared_ptr<Session>> sessions;
+    std::swap(sessions, d_sessions);
+    for (const auto& session : sessions)
+        {
+            session->close();
+        }
+    d_clients = 0;
+}
+
+
+Rtcm_Caster::Stats Rtcm_Caster::get_stats() const
+{
+    Stats stats{};
+    stats.published_messages = d_published_messages.load(std::memory_order_relaxed);
+    stats.published_bytes = d_published_bytes.load(std::memory_order_relaxed);
+    stats.sent_messages = d_sent_messages.load(std::memory_order_relaxed);
+    stats.sent_bytes = d_sent_bytes.load(std::memory_order_relaxed);
+    stats.dropped_messages = d_dropped_messages.load(std::memory_order_relaxed);
+    stats.clients = d_clients.load(std::memory_order_relaxed);
+    stats.max_lag_us = d_max_lag_us.load(std::memory_order_relaxed);
+    return stats;
+}
+
+
+uint32_t Rtcm_Caster::message_type(const std::string& frame)
+{
+    if (frame.size() < 6 || static_cast<uint8_t>(frame[0]) != 0xD3)
+        {
+            return 0;
+        }
+    return (static_cast<uint32_t>(static_cast<uint8_t>(frame[3])) << 4) | (static_cast<uint8_t>(frame[4]) >> 4);
+}
+
+
+void Rtcm_Caster::do_accept()
+{
+    d_acceptor.async_accept(d_socket, [this](const boost::system::error_code& ec) {
+        if (ec)
+            {
+                if (!d_closed)
+                    {
+                        std::cout << "Error when invoking a RTCM session. " << ec << '\n';
+                        do_accept();
+                    }
+                return;
+            }
+        boost::system::error_code ec2;
+        const boost::asio::ip::tcp::endpoint endpoint = d_socket.remote_endpoint(ec2);
+        if (ec2)
+            {
+                std::cout << "Error getting remote IP address, closing session.\n";
+                LOG(INFO) << "Error getting remote IP address";
+                d_socket.close(ec2);
+            }
+        else
+            {
+                const std::string remote_addr = endpoint.address().to_string() + ':' + std::to_string(endpoint.port());
+                std::cout << "Serving RTCM client from " << remote_addr << '\n';
+                LOG(INFO) << "Serving RTCM client from " << remote_addr;
+                d_socket.set_option(boost::asio::ip::tcp::no_delay(true), ec2);
+                auto session = std::make_shared<Session>(std::move(d_socket), *this, remote_addr);
+                d_sessions.insert(session);
+                d_clients = d_sessions.size();
+                session->start();
+            }
+        d_socket = boost::asio::ip::tcp::socket(d_io_context);
+        do_accept();
+    });
+}
+
+
+void Rtcm_Caster::do_log_stats()
+{
+#if USE_BOOST_ASIO_IO_CONTEXT
+    d_stats_timer.expires_after(std::chrono::seconds(static_cast<int64_t>(stats_period_s)));
+#else
+    d_stats_timer.expires_from_now(std::chrono::seconds(static_cast<int64_t>(stats_period_s)));
+#endif
+    d_stats_timer.async_wait([this](const boost::system::error_code& ec) {
+        if (ec || d_closed)
+            {
+                return;
+            }
+        if (!d_sessions.empty())
+            {
+                const Stats stats = get_stats();
+                LOG(INFO) << "RTCM caster: " << stats.clients << " clients, "
+                          << stats.published_messages << " messages published, "
+                          << stats.sent_bytes << " bytes sent, "
+                          << stats.dropped_messages << " messages dropped, max lag "
+                          << stats.max_lag_us / 1000.0 << " ms";
+            }
+        do_log_stats();
+    });
+}
+
+
+void Rtcm_Caster::fan_out(const Frame& frame)
+{
+    d_published_messages.fetch_add(1, std::memory_order_relaxed);
+    d_published_bytes.fetch_add(frame.data->size(), std::memory_order_relaxed);
+    d_latest = frame;
+    for (const auto& session : d_sessions)
+        {
+            session->deliver(frame);
+        }
+}
+
+
+void Rtcm_Caster::leave(const std::shared_ptr<Session>& session)
+{
+    d_sessions.erase(session);
+    d_clients = d_sessions.size();
+}
+
+
+const std::set<uint32_t>* Rtcm_Caster::find_mountpoint(const std::string& name) const
+{
+    const auto it = d_mountpoints.find(name);
+    if (it == d_mountpoints.cend())
+        {
+            return nullptr;
+        }
+    return &it->second;
+}
+
+
+std::string Rtcm_Caster::sourcetable() const
+{
+    std::string table;
+    for (const auto& mountpoint : d_mountpoints)
+        {
+            std::string types;
+            for (const auto type : mountpoint.second)
+                {
+                    types += (types.empty() ? "" : ",") + std::to_string(type);
+                }
+            table += "STR;" + mountpoint.first + ';' + mountpoint.first + ";RTCM 3.2;" + types +
+                     ";2;GPS+GLO+GAL+BDS;GNSS-SDR;;0.00;0.00;0;0;GNSS-SDR;none;N;N;0;\r\n";
+        }
+    return "SOURCETABLE 200 OK\r\nServer: GNSS-SDR\r\nContent-Type: text/plain\r\nContent-Length: " +
+           std::to_string(table.size() + 16) + "\r\n\r\n" + table + "ENDSOURCETABLE\r\n";
+}
@@ -0,0 +1,159 @@
+/*!
+ * \file rtcm_caster.h
+ * \brief Interface of a TCP server that distributes RTCM 3 messages to
+ * multiple clients, with NTRIP-style mountpoints
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTCM_CASTER_H
+#define GNSS_SDR_RTCM_CASTER_H
+
+#include <boost/asio.hpp>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Distributes RTCM 3 frames to the clients connected to a TCP port.
+ *
+ * publish() can be called from any thread. It copies the frame once and hands
+ * it over to the thread that runs the io_context, which shares it by
+ * reference count among all the clients.
+ *
+ * Each client has a queue of at most client_queue_size frames. When a client
+ * does not keep up, the oldest frames that are not being written are dropped.
+ *
+ * A client that sends an NTRIP 1.0 request (GET /mountpoint) receives only the
+ * message types of that mountpoint, after an "ICY 200 OK" response. A request
+ * for an unknown mountpoint, or for "/", is answered with the sourcetable. A
+ * client that sends no request within request_timeout_ms receives all the
+ * message types.
+ *
+ * A client only gets frames once it starts streaming, that is, after its
+ * request or after request_timeout_ms. The frames published before that are
+ * not queued for it, except the latest one, which it receives first.
+ */
+class Rtcm_Caster
+{
+public:
+#if USE_BOOST_ASIO_IO_CONTEXT
+    using b_io_context = boost::asio::io_context;
+#else
+    using b_io_context = boost::asio::io_service;
+#endif
+
+    static constexpr int request_timeout_ms = 1000;  //!< Wait for an NTRIP request before streaming all types
+    static constexpr int stats_period_s = 60;        //!< Period of the statistics written to the log
+
+    /*!
+     * \brief Counters since the caster was created
+     */
+    struct Stats
+    {
+        uint64_t published_messages;
+        uint64_t published_bytes;
+        uint64_t sent_messages;
+        uint64_t sent_bytes;
+        uint64_t dropped_messages;
+        uint64_t clients;     //!< Clients connected right now
+        uint64_t max_lag_us;  //!< Longest time from publish() to the end of a write
+    };
+
+    /*!
+     * \brief Opens the TCP port and starts accepting clients
+     */
+    Rtcm_Caster(b_io_context& io_context, uint16_t port, size_t client_queue_size = 64);
+    ~Rtcm_Caster();
+
+    Rtcm_Caster(const Rtcm_Caster&) = delete;
+    Rtcm_Caster& operator=(const Rtcm_Caster&) = delete;
+
+    /*!
+     * \brief Adds mountpoints from a list such as "MSM7:1005,1077,1087;EPH:1019,1020".
+     * Must be called before the io_context runs. Returns false if the list is not valid.
+     */
+    bool add_mountpoints(const std::string& list);
+
+    /*!
+     * \brief Adds a mountpoint. An empty set of message types selects all of them.
+     */
+    void add_mountpoint(const std::string& name, const std::set<uint32_t>& message_types);
+
+    /*!
+     * \brief Sends a complete RTCM frame to the clients. Thread-safe.
+     */
+    void publish(const std::string& frame);
+
+    /*!
+     * \brief Stops accepting clients and closes all the connections
+     */
+    void close();
+
+    Stats get_stats() const;
+
+    /*!
+     * \brief Returns the message type of an RTCM 3 frame, or 0 if it is not one
+     */
+    static uint32_t message_type(const std::string& frame);
+
+private:
+    class Session;
+    friend class Session;
+
+    struct Frame
+    {
+        std::shared_ptr<const std::string> data;
+        std::chrono::steady_clock::time_point published;
+        uint32_t type;
+    };
+
+    void do_accept();
+    void do_log_stats();
+    void fan_out(const Frame& frame);
+    void leave(const std::shared_ptr<Session>& session);
+    const std::set<uint32_t>* find_mountpoint(const std::string& name) const;
+    std::string sourcetable() const;
+
+    b_io_context& d_io_context;
+    boost::asio::ip::tcp::acceptor d_acceptor;
+    boost::asio::ip::tcp::socket d_socket;
+    boost::asio::steady_timer d_stats_timer;
+    std::set<std::shared_ptr<Session>> d_sessions;
+    std::map<std::string, std::set<uint32_t>> d_mountpoints;
+    Frame d_latest{};  // last published frame, sent first to a client that starts streaming
+    size_t d_client_queue_size;
+
+    std::atomic<uint64_t> d_published_messages{0};
+    std::atomic<uint64_t> d_published_bytes{0};
+    std::atomic<uint64_t> d_sent_messages{0};
+    std::atomic<uint64_t> d_sent_bytes{0};
+    std::atomic<uint64_t> d_dropped_messages{0};
+    std::atomic<uint64_t> d_clients{0};
+    std::atomic<uint64_t> d_max_lag_us{0};
+    std::atomic<bool> d_closed{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTCM_CASTER_H
@@ -58,7 +58,9 @@ public:
         uint16_t rtcm_station_id,
         const std::string& rtcm_dump_devname,
         bool time_tag_name = true,
-        const std::string& base_path = ".");
+        const std::string& base_path = ".",
+        const std::string& rtcm_mountpoints = std::string(),
+        int32_t rtcm_client_queue_size = 64);
 
     /*!
      * \brief Default destructor.
@@ -34,11 +34,15 @@
 #include "Beidou_DNAV.h"
 #include "gnss_sdr_filesystem.h"
 #include "rtklib_conversions.h"
+#include "rtklib_pntpos.h"
+#include "rtklib_rtkcmn.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solution.h"
 #include <glog/logging.h>
 #include <matio.h>
+#include <algorithm>
 #include <exception>
+#include <iterator>
 #include <utility>
 #include <vector>
 
@@ -53,6 +57,19 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk,
 {
     this->set_averaging_flag(false);
 
+    // Matrix workspace for the RTKLIB routines: room for the filter covariance
+    // products plus the per-observation matrices of the single point solution.
+    // It grows by itself if an epoch ever needs more.
+    const int nx = d_rtk.opt.mode == PMODE_SINGLE ? 0 : d_rtk.nx;
+    wsinit(&d_wksp, 2 * nx * nx + 64 * MAXOBS);
+    d_rtk.ws = &d_wksp;
+
+    // Satellite state cache of this solver, used with EPHOPT_BRDCCACHE
+    d_nav_data.satcache = d_satcache.data();
+    // There is at most one ephemeris per satellite in d_eph_data and
+    // d_geph_data, so seleph() and selgeph() can look it up by satellite
+    d_nav_data.ephidx = d_eph_index.data();
+
     // ############# ENABLE DATA FILE LOG #################
     if (d_flag_dump_enabled == true)
         {
@@ -76,6 +93,8 @@ Rtklib_Solver::Rtklib_Solver(const rtk_t &rtk,
 Rtklib_Solver::~Rtklib_Solver()
 {
     DLOG(INFO) << "Rtklib_Solver destructor called.";
+    DLOG(INFO) << "RTKLIB workspace: " << d_wksp.size << " doubles, " << d_wksp.nheap << " heap fallbacks";
+    wsfree(&d_wksp);
     if (d_dump_file.is_open() == true)
         {
             const auto pos = d_dump_file.tellp();
@@ -379,6 +398,46 @@ Monitor_Pvt Rtklib_Solver::get_monitor_pvt() const
 }
 
 
+void Rtklib_Solver::set_clock_offset_only(bool flag)
+{
+    d_clock_offset_only = flag;
+}
+
+
+void Rtklib_Solver::set_ephemeris_index(int sat, int index)
+{
+    // A satellite converted twice keeps the last entry, the one that the
+    // linear search of seleph() would also pick
+    if (sat >= 1 && sat <= MAXSAT)
+        {
+            d_eph_index[sat - 1] = index + 1;
+        }
+}
+
+
+int Rtklib_Solver::ephemeris_index(int sat) const
+{
+    if (sat >= 1 && sat <= MAXSAT)
+        {
+            return d_eph_index[sat - 1] - 1;
+        }
+    return -1;
+}
+
+
+void Rtklib_Solver::reset_nav_models()
+{
+    std::fill(std::begin(d_nav_data.ion_gps), std::end(d_nav_data.ion_gps), 0.0);
+    std::fill(std::begin(d_nav_data.ion_gal), std::end(d_nav_data.ion_gal), 0.0);
+    std::fill(std::begin(d_nav_data.ion_cmp), std::end(d_nav_data.ion_cmp), 0.0);
+    std::fill(std::begin(d_nav_data.utc_gps), std::end(d_nav_data.utc_gps), 0.0);
+    std::fill(std::begin(d_nav_data.utc_glo), std::end(d_nav_data.utc_glo), 0.0);
+    std::fill(std::begin(d_nav_data.utc_gal), std::end(d_nav_data.utc_gal), 0.0);
+    std::fill(std::begin(d_nav_data.utc_cmp), std::end(d_nav_data.utc_cmp), 0.0);
+    d_nav_data.leaps = 0;
+}
+
+
 bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, bool flag_averaging)
 {
     std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
@@ -399,8 +458,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     int glo_valid_obs = 0;  // GLONASS L1/L2 valid observations counter
 
     d_obs_data.fill({});
-    std::vector<eph_t> eph_data(MAXOBS);
-    std::vector<geph_t> geph_data(MAXOBS);
+    d_eph_index.fill(0);
 
     // Workaround for NAV/CNAV clash problem
     bool gps_dual_band = false;
@@ -453,7 +511,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                        d_eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                        set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -475,24 +534,20 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 galileo_ephemeris_iter = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
                                 if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
                                     {
-                                        bool found_E1_obs = false;
-                                        for (int i = 0; i < valid_obs; i++)
+                                        const int i = ephemeris_index(static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO));
+                                        if (i >= 0)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO)))
-                                                    {
-                                                        d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            galileo_ephemeris_iter->second.WN,
-                                                            2);  // Band 3 (L5/E5)
-                                                        found_E1_obs = true;
-                                                        break;
-                                                    }
+                                                d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
+                                                    gnss_observables_iter->second,
+                                                    galileo_ephemeris_iter->second.WN,
+                                                    2);  // Band 3 (L5/E5)
                                             }
-                                        if (!found_E1_obs)
+                                        else
                                             {
                                                 // insert Galileo E5 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                                set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -527,7 +582,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (gps_ephemeris_iter != gps_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(gps_ephemeris_iter->second, this->is_pre_2009());
+                                        d_eph_data[valid_obs] = eph_to_rtklib(gps_ephemeris_iter->second, this->is_pre_2009());
+                                        set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -557,12 +613,12 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                 // (more precise!), and attach the L2 observation to the L1 observation in RTKLIB structure
                                                 for (int i = 0; i < valid_obs; i++)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
+                                                        if (d_eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                d_eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
                                                                 d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
                                                                     gnss_observables_iter->second,
-                                                                    eph_data[i].week,
+                                                                    d_eph_data[i].week,
                                                                     1);  // Band 2 (L2)
                                                                 break;
                                                             }
@@ -573,7 +629,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L2 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -603,24 +660,22 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 2. If found, replace the existing GPS L1 ephemeris with the GPS L5 ephemeris
                                                 // (more precise!), and attach the L5 observation to the L1 observation in RTKLIB structure
-                                                for (int i = 0; i < valid_obs; i++)
+                                                const int i = ephemeris_index(static_cast<int>(gnss_observables_iter->second.PRN));
+                                                if (i >= 0)
                                                     {
-                                                        if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
-                                                            {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
-                                                                d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i],
-                                                                    gnss_observables_iter->second,
-                                                                    gps_cnav_ephemeris_iter->second.WN,
-                                                                    2);  // Band 3 (L5)
-                                                                break;
-                                                            }
+                                                        d_eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                        d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i],
+                                                            gnss_observables_iter->second,
+                                                            gps_cnav_ephemeris_iter->second.WN,
+                                                            2);  // Band 3 (L5)
                                                     }
                                             }
                                         else
                                             {
                                                 // 3. If not found, insert the GPS L5 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -651,7 +706,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                        d_geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                        set_ephemeris_index(d_geph_data[glo_valid_obs].sat, glo_valid_obs);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -672,24 +728,20 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 glonass_gnav_ephemeris_iter = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
                                 if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
                                     {
-                                        bool found_L1_obs = false;
-                                        for (int i = 0; i < glo_valid_obs; i++)
+                                        const int i = ephemeris_index(static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS));
+                                        if (i >= 0)
                                             {
-                                                if (geph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS)))
-                                                    {
-                                                        d_obs_data[i + valid_obs] = insert_obs_to_rtklib(d_obs_data[i + valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            glonass_gnav_ephemeris_iter->second.d_WN,
-                                                            1);  // Band 1 (L2)
-                                                        found_L1_obs = true;
-                                                        break;
-                                                    }
+                                                d_obs_data[i + valid_obs] = insert_obs_to_rtklib(d_obs_data[i + valid_obs],
+                                                    gnss_observables_iter->second,
+                                                    glonass_gnav_ephemeris_iter->second.d_WN,
+                                                    1);  // Band 1 (L2)
                                             }
-                                        if (!found_L1_obs)
+                                        else
                                             {
                                                 // insert GLONASS GNAV L2 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                                d_geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                                set_ephemeris_index(d_geph_data[glo_valid_obs].sat, glo_valid_obs);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 obsd_t newobs{};
                                                 d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -717,7 +769,8 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                        d_eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                        set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         d_obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
@@ -737,24 +790,20 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                 beidou_ephemeris_iter = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
                                 if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
                                     {
-                                        bool found_B1I_obs = false;
-                                        for (int i = 0; i < valid_obs; i++)
+                                        const int i = ephemeris_index(static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS));
+                                        if (i >= 0)
                                             {
-                                                if (eph_data[i].sat == (static_cast<int>(gnss_observables_iter->second.PRN + NSATGPS + NSATGLO + NSATGAL + NSATQZS)))
-                                                    {
-                                                        d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
-                                                            gnss_observables_iter->second,
-                                                            beidou_ephemeris_iter->second.WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
-                                                            2);  // Band 3 (L2/G2/B3)
-                                                        found_B1I_obs = true;
-                                                        break;
-                                                    }
+                                                d_obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(d_obs_data[i + glo_valid_obs],
+                                                    gnss_observables_iter->second,
+                                                    beidou_ephemeris_iter->second.WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                                    2);  // Band 3 (L2/G2/B3)
                                             }
-                                        if (!found_B1I_obs)
+                                        else
                                             {
                                                 // insert BeiDou B3I obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                                d_eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                                set_ephemeris_index(d_eph_data[valid_obs].sat, valid_obs);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -789,89 +838,92 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     if ((valid_obs + glo_valid_obs) > 3)
         {
             int result = 0;
-            nav_t nav_data{};
-            nav_data.eph = eph_data.data();
-            nav_data.geph = geph_data.data();
-            nav_data.n = valid_obs;
-            nav_data.ng = glo_valid_obs;
+            // d_nav_data is reused across epochs: value-initializing a whole
+            // nav_t here would clear more than 400 kB at every epoch, so only
+            // the fields filled below are reset.
+            d_nav_data.eph = d_eph_data.data();
+            d_nav_data.geph = d_geph_data.data();
+            d_nav_data.n = valid_obs;
+            d_nav_data.ng = glo_valid_obs;
+            reset_nav_models();
             if (gps_iono.valid)
                 {
-                    nav_data.ion_gps[0] = gps_iono.alpha0;
-                    nav_data.ion_gps[1] = gps_iono.alpha1;
-                    nav_data.ion_gps[2] = gps_iono.alpha2;
-                    nav_data.ion_gps[3] = gps_iono.alpha3;
-                    nav_data.ion_gps[4] = gps_iono.beta0;
-                    nav_data.ion_gps[5] = gps_iono.beta1;
-                    nav_data.ion_gps[6] = gps_iono.beta2;
-                    nav_data.ion_gps[7] = gps_iono.beta3;
+                    d_nav_data.ion_gps[0] = gps_iono.alpha0;
+                    d_nav_data.ion_gps[1] = gps_iono.alpha1;
+                    d_nav_data.ion_gps[2] = gps_iono.alpha2;
+                    d_nav_data.ion_gps[3] = gps_iono.alpha3;
+                    d_nav_data.ion_gps[4] = gps_iono.beta0;
+                    d_nav_data.ion_gps[5] = gps_iono.beta1;
+                    d_nav_data.ion_gps[6] = gps_iono.beta2;
+                    d_nav_data.ion_gps[7] = gps_iono.beta3;
                 }
             if (!(gps_iono.valid) and gps_cnav_iono.valid)
                 {
-                    nav_data.ion_gps[0] = gps_cnav_iono.alpha0;
-                    nav_data.ion_gps[1] = gps_cnav_iono.alpha1;
-                    nav_data.ion_gps[2] = gps_cnav_iono.alpha2;
-                    nav_data.ion_gps[3] = gps_cnav_iono.alpha3;
-                    nav_data.ion_gps[4] = gps_cnav_iono.beta0;
-                    nav_data.ion_gps[5] = gps_cnav_iono.beta1;
-                    nav_data.ion_gps[6] = gps_cnav_iono.beta2;
-                    nav_data.ion_gps[7] = gps_cnav_iono.beta3;
+                    d_nav_data.ion_gps[0] = gps_cnav_iono.alpha0;
+                    d_nav_data.ion_gps[1] = gps_cnav_iono.alpha1;
+                    d_nav_data.ion_gps[2] = gps_cnav_iono.alpha2;
+                    d_nav_data.ion_gps[3] = gps_cnav_iono.alpha3;
+                    d_nav_data.ion_gps[4] = gps_cnav_iono.beta0;
+                    d_nav_data.ion_gps[5] = gps_cnav_iono.beta1;
+                    d_nav_data.ion_gps[6] = gps_cnav_iono.beta2;
+                    d_nav_data.ion_gps[7] = gps_cnav_iono.beta3;
                 }
             if (galileo_iono.ai0 != 0.0)
                 {
-                    nav_data.ion_gal[0] = galileo_iono.ai0;
-                    nav_data.ion_gal[1] = galileo_iono.ai1;
-                    nav_data.ion_gal[2] = galileo_iono.ai2;
-                    nav_data.ion_gal[3] = 0.0;
+                    d_nav_data.ion_gal[0] = galileo_iono.ai0;
+                    d_nav_data.ion_gal[1] = galileo_iono.ai1;
+                    d_nav_data.ion_gal[2] = galileo_iono.ai2;
+                    d_nav_data.ion_gal[3] = 0.0;
                 }
             if (beidou_dnav_iono.valid)
                 {
-                    nav_data.ion_cmp[0] = beidou_dnav_iono.alpha0;
-                    nav_data.ion_cmp[1] = beidou_dnav_iono.alpha1;
-                    nav_data.ion_cmp[2] = beidou_dnav_iono.alpha2;
-                    nav_data.ion_cmp[3] = beidou_dnav_iono.alpha3;
-                    nav_data.ion_cmp[4] = beidou_dnav_iono.beta0;
-                    nav_data.ion_cmp[5] = beidou_dnav_iono.beta0;
-                    nav_data.ion_cmp[6] = beidou_dnav_iono.beta0;
-                    nav_data.ion_cmp[7] = beidou_dnav_iono.beta3;
+                    d_nav_data.ion_cmp[0] = beidou_dnav_iono.alpha0;
+                    d_nav_data.ion_cmp[1] = beidou_dnav_iono.alpha1;
+                    d_nav_data.ion_cmp[2] = beidou_dnav_iono.alpha2;
+                    d_nav_data.ion_cmp[3] = beidou_dnav_iono.alpha3;
+                    d_nav_data.ion_cmp[4] = beidou_dnav_iono.beta0;
+                    d_nav_data.ion_cmp[5] = beidou_dnav_iono.beta0;
+                    d_nav_data.ion_cmp[6] = beidou_dnav_iono.beta0;
+                    d_nav_data.ion_cmp[7] = beidou_dnav_iono.beta3;
                 }
             if (gps_utc_model.valid)
                 {
-                    nav_data.utc_gps[0] = gps_utc_model.A0;
-                    nav_data.utc_gps[1] = gps_utc_model.A1;
-                    nav_data.utc_gps[2] = gps_utc_model.tot;
-                    nav_data.utc_gps[3] = gps_utc_model.WN_T;
-                    nav_data.leaps = gps_utc_model.DeltaT_LS;
+                    d_nav_data.utc_gps[0] = gps_utc_model.A0;
+                    d_nav_data.utc_gps[1] = gps_utc_model.A1;
+                    d_nav_data.utc_gps[2] = gps_utc_model.tot;
+                    d_nav_data.utc_gps[3] = gps_utc_model.WN_T;
+                    d_nav_data.leaps = gps_utc_model.DeltaT_LS;
                 }
             if (!(gps_utc_model.valid) and gps_cnav_utc_model.valid)
                 {
-                    nav_data.utc_gps[0] = gps_cnav_utc_model.A0;
-                    nav_data.utc_gps[1] = gps_cnav_utc_model.A1;
-                    nav_data.utc_gps[2] = gps_cnav_utc_model.tot;
-                    nav_data.utc_gps[3] = gps_cnav_utc_model.WN_T;
-                    nav_data.leaps = gps_cnav_utc_model.DeltaT_LS;
+                    d_nav_data.utc_gps[0] = gps_cnav_utc_model.A0;
+                    d_nav_data.utc_gps[1] = gps_cnav_utc_model.A1;
+                    d_nav_data.utc_gps[2] = gps_cnav_utc_model.tot;
+                    d_nav_data.utc_gps[3] = gps_cnav_utc_model.WN_T;
+                    d_nav_data.leaps = gps_cnav_utc_model.DeltaT_LS;
                 }
             if (glonass_gnav_utc_model.valid)
                 {
-                    nav_data.utc_glo[0] = glonass_gnav_utc_model.d_tau_c;  // ??
-                    nav_data.utc_glo[1] = 0.0;                             // ??
-                    nav_data.utc_glo[2] = 0.0;                             // ??
-                    nav_data.utc_glo[3] = 0.0;                             // ??
+                    d_nav_data.utc_glo[0] = glonass_gnav_utc_model.d_tau_c;  // ??
+                    d_nav_data.utc_glo[1] = 0.0;                             // ??
+                    d_nav_data.utc_glo[2] = 0.0;                             // ??
+                    d_nav_data.utc_glo[3] = 0.0;                             // ??
                 }
             if (galileo_utc_model.A0 != 0.0)
                 {
-                    nav_data.utc_gal[0] = galileo_utc_model.A0;
-                    nav_data.utc_gal[1] = galileo_utc_model.A1;
-                    nav_data.utc_gal[2] = galileo_utc_model.tot;
-                    nav_data.utc_gal[3] = galileo_utc_model.WNot;
-                    nav_data.leaps = galileo_utc_model.Delta_tLS;
+                    d_nav_data.utc_gal[0] = galileo_utc_model.A0;
+                    d_nav_data.utc_gal[1] = galileo_utc_model.A1;
+                    d_nav_data.utc_gal[2] = galileo_utc_model.tot;
+                    d_nav_data.utc_gal[3] = galileo_utc_model.WNot;
+                    d_nav_data.leaps = galileo_utc_model.Delta_tLS;
                 }
             if (beidou_dnav_utc_model.valid)
                 {
-                    nav_data.utc_cmp[0] = beidou_dnav_utc_model.A0_UTC;
-                    nav_data.utc_cmp[1] = beidou_dnav_utc_model.A1_UTC;
-                    nav_data.utc_cmp[2] = 0.0;  // ??
-                    nav_data.utc_cmp[3] = 0.0;  // ??
-                    nav_data.leaps = beidou_dnav_utc_model.DeltaT_LS;
+                    d_nav_data.utc_cmp[0] = beidou_dnav_utc_model.A0_UTC;
+                    d_nav_data.utc_cmp[1] = beidou_dnav_utc_model.A1_UTC;
+                    d_nav_data.utc_cmp[2] = 0.0;  // ??
+                    d_nav_data.utc_cmp[3] = 0.0;  // ??
+                    d_nav_data.leaps = beidou_dnav_utc_model.DeltaT_LS;
                 }
 
             /* update carrier wave length using native function call in RTKlib */
@@ -882,16 +934,37 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                             if (j == 2 && gal_e5_is_e5b)
                                 {
                                     // frq = 4 corresponds to E5B in that function
-                                    nav_data.lam[i][j] = satwavelen(i + 1, 4, &nav_data);
+                                    d_nav_data.lam[i][j] = satwavelen(i + 1, 4, &d_nav_data);
                                 }
                             else
                                 {
-                                    nav_data.lam[i][j] = satwavelen(i + 1, j, &nav_data);
+                                    d_nav_data.lam[i][j] = satwavelen(i + 1, j, &d_nav_data);
                                 }
                         }
                 }
 
-            result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &nav_data);
+            if (d_clock_offset_only)
+                {
+                    // single-point position and clock bias only, without velocity nor output products
+                    result = pntclk(d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data, &d_rtk.opt, &d_rtk.sol, d_rtk.errbuf, &d_wksp);
+                    if (result == 0)
+                        {
+                            LOG(INFO) << "RTKLIB pntclk error: " << d_rtk.errbuf;
+                            this->set_time_offset_s(0.0);  // reset rx time estimation
+                            this->set_num_valid_observations(0);
+                        }
+                    else
+                        {
+                            this->set_num_valid_observations(d_rtk.sol.ns);
+                            pvt_sol = d_rtk.sol;
+                            this->set_valid_position(true);
+                            // the internal solver always works in SINGLE mode, so dtr is expressed in [s]
+                            this->set_time_offset_s(pvt_sol.dtr[0] + pvt_sol.dtr[2]);
+                        }
+                    return this->is_valid_position();
+                }
+
+            result = rtkpos(&d_rtk, d_obs_data.data(), valid_obs + glo_valid_obs, &d_nav_data);
 
             if (result == 0)
                 {
@@ -992,7 +1065,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     // TOW
                     d_monitor_pvt.TOW_at_current_symbol_ms = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
                     // WEEK
-                    d_monitor_pvt.week = adjgpsweek(nav_data.eph[0].week, this->is_pre_2009());
+                    d_monitor_pvt.week = adjgpsweek(d_nav_data.eph[0].week, this->is_pre_2009());
                     // PVT GPS time
                     d_monitor_pvt.RX_time = gnss_observables_map.cbegin()->second.RX_time;
                     // User clock offset [s]
@@ -1058,7 +1131,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     tmp_uint32 = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // WEEK
-                                    tmp_uint32 = adjgpsweek(nav_data.eph[0].week, this->is_pre_2009());
+                                    tmp_uint32 = adjgpsweek(d_nav_data.eph[0].week, this->is_pre_2009());
                                     d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
                                     // PVT GPS time
                                     tmp_double = gnss_observables_map.cbegin()->second.RX_time;
@@ -86,6 +86,14 @@ public:
     double get_gdop() const override;
     Monitor_Pvt get_monitor_pvt() const;
 
+    /*!
+     * \brief If set, get_PVT() only estimates the receiver position and clock
+     * offset, skipping the Doppler velocity and the products for the user
+     * (DOPs, UTC time, monitor and dump). Used by the internal solver that
+     * steers the receiver clock.
+     */
+    void set_clock_offset_only(bool flag);
+
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
 
@@ -115,15 +123,25 @@ public:
 
 private:
     bool save_matfile() const;
+    void reset_nav_models();
+    void set_ephemeris_index(int sat, int index);
+    int ephemeris_index(int sat) const;  // index in d_eph_data or d_geph_data, or -1
 
     std::array<obsd_t, MAXOBS> d_obs_data{};
+    std::array<eph_t, MAXOBS> d_eph_data{};
+    std::array<geph_t, MAXOBS> d_geph_data{};
+    nav_t d_nav_data{};
+    std::array<satcache_t, MAXSAT> d_satcache{};
+    std::array<int, MAXSAT> d_eph_index{};  // index+1 of the ephemeris of each satellite, 0: none
     std::array<double, 4> d_dop{};
     rtk_t d_rtk{};
+    wksp_t d_wksp{};
     Monitor_Pvt d_monitor_pvt{};
     std::string d_dump_filename;
     std::ofstream d_dump_file;
     bool d_flag_dump_enabled;
     bool d_flag_dump_mat_enabled;
+    bool d_clock_offset_only{false};
 };
 
 
@@ -0,0 +1,192 @@
+/*!
+ * \file fused_signal_conditioner.cc
+ * \brief Signal conditioner that applies the configured data type adapter,
+ * input filter and resampler in a single block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_signal_conditioner.h"
+#include "configuration_interface.h"
+#include "remez_fir_taps.h"
+#include <glog/logging.h>
+#include <gnuradio/filter/firdes.h>
+#include <utility>
+
+
+FusedSignalConditioner::FusedSignalConditioner(const ConfigurationInterface* configuration,
+    std::string role,
+    const std::string& role_data_type_adapter,
+    const std::string& role_input_filter,
+    const std::string& role_resampler)
+    : role_(std::move(role)),
+      intermediate_freq_(0.0),
+      sampling_freq_(0.0),
+      resampler_freq_in_(0.0),
+      resampler_freq_out_(0.0),
+      item_size_(0),
+      decimation_factor_(1),
+      inverted_spectrum_(false),
+      supported_(false)
+{
+    supported_ = configure_data_type_adapter(configuration, role_data_type_adapter) &&
+                 configure_input_filter(configuration, role_input_filter) &&
+                 configure_resampler(configuration, role_resampler) &&
+                 stream_item_type_ == "gr_complex";
+    if (!supported_)
+        {
+            LOG(WARNING) << role_ << ": the configured " << role_data_type_adapter << ", "
+                         << role_input_filter << " and " << role_resampler
+                         << " have no fused implementation";
+            return;
+        }
+
+    conditioner_ = make_fused_conditioner_cc(input_item_type_, inverted_spectrum_, taps_,
+        decimation_factor_, intermediate_freq_, sampling_freq_, resampler_freq_in_, resampler_freq_out_);
+    item_size_ = conditioner_->input_signature()->sizeof_stream_item(0);
+    DLOG(INFO) << "signal_conditioner(" << conditioner_->unique_id() << ") with " << taps_.size()
+               << " taps, decimation " << decimation_factor_ << " and relative rate " << conditioner_->relative_rate();
+}
+
+
+bool FusedSignalConditioner::configure_data_type_adapter(const ConfigurationInterface* configuration, const std::string& role)
+{
+    const std::string implementation = configuration->property(role + ".implementation", std::string("Pass_Through"));
+    if (implementation == "Pass_Through")
+        {
+            input_item_type_ = configuration->property(role + ".item_type", std::string("gr_complex"));
+            stream_item_type_ = input_item_type_;
+        }
+    else if (implementation == "Ishort_To_Complex")
+        {
+            input_item_type_ = "ishort";
+            stream_item_type_ = "gr_complex";
+        }
+    else if (implementation == "Ibyte_To_Complex")
+        {
+            input_item_type_ = "ibyte";
+            stream_item_type_ = "gr_complex";
+        }
+    else
+        {
+            return false;
+        }
+    inverted_spectrum_ = configuration->property(role + ".inverted_spectrum", false);
+    return input_item_type_ == "gr_complex" || input_item_type_ == "cshort" || input_item_type_ == "cbyte" ||
+           input_item_type_ == "ishort" || input_item_type_ == "ibyte";
+}
+
+
+bool FusedSignalConditioner::configure_input_filter(const ConfigurationInterface* configuration, const std::string& role)
+{
+    const std::string implementation = configuration->property(role + ".implementation", std::string("Pass_Through"));
+    if (implementation == "Pass_Through")
+        {
+            // the Pass_Through of a gr_complex stream may conjugate it
+            if (configuration->property(role + ".item_type", std::string("gr_complex")) != stream_item_type_)
+                {
+                    return false;
+                }
+            inverted_spectrum_ ^= configuration->property(role + ".inverted_spectrum", false);
+            return true;
+        }
+
+    const std::string input_item_type = configuration->property(role + ".input_item_type", std::string("gr_complex"));
+    const std::string output_item_type = configuration->property(role + ".output_item_type", std::string("gr_complex"));
+    const std::string taps_item_type = configuration->property(role + ".taps_item_type", std::string("float"));
+    const std::string filter_type = configuration->property(role + ".filter_type", std::string("bandpass"));
+    if (input_item_type != stream_item_type_ || output_item_type != "gr_complex" || taps_item_type != "float")
+        {
+            return false;
+        }
+
+    if (implementation == "Fir_Filter")
+        {
+            taps_ = remez_fir_taps(configuration, role, filter_type);
+        }
+    else if (implementation == "Freq_Xlating_Fir_Filter" && input_item_type == "gr_complex")
+        {
+            intermediate_freq_ = configuration->property(role + ".IF", 0.0);
+            sampling_freq_ = configuration->property(role + ".sampling_frequency", 4000000.0);
+            decimation_factor_ = configuration->property(role + ".decimation_factor", 1);
+            if (filter_type != "lowpass")
+                {
+                    taps_ = remez_fir_taps(configuration, role, filter_type);
+                }
+            else
+                {
+                    const double default_bw = (sampling_freq_ / decimation_factor_) / 2;
+                    const double bw = configuration->property(role + ".bw", default_bw);
+                    const double tw = configuration->property(role + ".tw", bw / 10.0);
+                    taps_ = gr::filter::firdes::low_pass(1.0, sampling_freq_, bw, tw);
+                }
+        }
+    else
+        {
+            return false;
+        }
+    stream_item_type_ = output_item_type;
+    return true;
+}
+
+
+bool FusedSignalConditioner::configure_resampler(const ConfigurationInterface* configuration, const std::string& role)
+{
+    const std::string implementation = configuration->property(role + ".implementation", std::string("Pass_Through"));
+    if (configuration->property(role + ".item_type", std::string("gr_complex")) != stream_item_type_)
+        {
+            return false;
+        }
+    if (implementation == "Pass_Through")
+        {
+            inverted_spectrum_ ^= configuration->property(role + ".inverted_spectrum", false);
+            return true;
+        }
+    if (implementation == "Direct_Resampler")
+        {
+            const double fs_in_deprecated = configuration->property("GNSS-SDR.internal_fs_hz", 2048000.0);
+            const double fs_in = configuration->property("GNSS-SDR.internal_fs_sps", fs_in_deprecated);
+            resampler_freq_in_ = configuration->property(role + ".sample_freq_in", 4000000.0);
+            resampler_freq_out_ = configuration->property(role + ".sample_freq_out", fs_in);
+            return true;
+        }
+    return false;
+}
+
+
+void FusedSignalConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (top_block)
+        { /* top_block is not null */
+        };
+    DLOG(INFO) << "nothing to connect internally";
+}
+
+
+void FusedSignalConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (top_block)
+        { /* top_block is not null */
+        };
+    // Nothing to disconnect
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_left_block()
+{
+    return conditioner_;
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_right_block()
+{
+    return conditioner_;
+}
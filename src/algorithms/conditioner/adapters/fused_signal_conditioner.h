@@ -0,0 +1,98 @@
+/*!
+ * \file fused_signal_conditioner.h
+ * \brief Signal conditioner that applies the configured data type adapter,
+ * input filter and resampler in a single block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+#define GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+
+#include "fused_conditioner_cc.h"
+#include "gnss_block_interface.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Reads the configuration of the DataTypeAdapter, InputFilter and
+ * Resampler of a Signal_Conditioner, and applies them with a single
+ * fused_conditioner_cc block, without scheduler buffers between the stages.
+ *
+ * Supported stages:
+ * - DataTypeAdapter: Pass_Through (gr_complex, cshort or cbyte),
+ *   Ishort_To_Complex and Ibyte_To_Complex.
+ * - InputFilter: Pass_Through, Fir_Filter and Freq_Xlating_Fir_Filter, with
+ *   float taps and gr_complex output.
+ * - Resampler: Pass_Through and Direct_Resampler (gr_complex).
+ *
+ * Other combinations are reported by is_supported().
+ */
+class FusedSignalConditioner : public GNSSBlockInterface
+{
+public:
+    //! Constructor
+    FusedSignalConditioner(const ConfigurationInterface* configuration,
+        std::string role,
+        const std::string& role_data_type_adapter,
+        const std::string& role_input_filter,
+        const std::string& role_resampler);
+
+    //! Destructor
+    ~FusedSignalConditioner() = default;
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+    inline std::string role() override { return role_; }
+
+    inline std::string implementation() override { return "Fused_Signal_Conditioner"; }  //!< Returns "Fused_Signal_Conditioner"
+
+    inline size_t item_size() override { return item_size_; }
+
+    //! False if the configured stages have no fused implementation
+    inline bool is_supported() const { return supported_; }
+
+private:
+    bool configure_data_type_adapter(const ConfigurationInterface* configuration, const std::string& role);
+    bool configure_input_filter(const ConfigurationInterface* configuration, const std::string& role);
+    bool configure_resampler(const ConfigurationInterface* configuration, const std::string& role);
+
+    fused_conditioner_cc_sptr conditioner_;
+    std::vector<float> taps_;
+    std::string role_;
+    std::string input_item_type_;
+    std::string stream_item_type_;  // item type between the stages
+    double intermediate_freq_;
+    double sampling_freq_;
+    double resampler_freq_in_;
+    double resampler_freq_out_;
+    size_t item_size_;
+    unsigned int decimation_factor_;
+    bool inverted_spectrum_;
+    bool supported_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
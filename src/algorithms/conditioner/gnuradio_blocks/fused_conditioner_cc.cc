@@ -0,0 +1,72 @@
+/*!
+ * \file fused_conditioner_cc.cc
+ * \brief GNU Radio block that converts, filters and resamples the input
+ * samples of a signal conditioner in a single pass.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_conditioner_cc.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for std::max
+#include <cmath>      // for std::ceil
+
+
+fused_conditioner_cc_sptr make_fused_conditioner_cc(
+    const std::string& input_item_type,
+    bool inverted_spectrum,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    double intermediate_freq,
+    double sampling_freq,
+    double resampler_freq_in,
+    double resampler_freq_out)
+{
+    const Fused_Conditioner conditioner(input_item_type, inverted_spectrum, taps, decimation,
+        intermediate_freq, sampling_freq, resampler_freq_in, resampler_freq_out);
+    // Interleaved samples come from the signal source as one item per component
+    const int items_per_sample = (input_item_type == "ishort" || input_item_type == "ibyte") ? 2 : 1;
+    return fused_conditioner_cc_sptr(new fused_conditioner_cc(conditioner, items_per_sample));
+}
+
+
+fused_conditioner_cc::fused_conditioner_cc(const Fused_Conditioner& conditioner, int items_per_sample)
+    : gr::block("fused_conditioner_cc",
+          gr::io_signature::make(1, 1, conditioner.input_item_size() / items_per_sample),
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_conditioner(conditioner),
+      d_items_per_sample(items_per_sample)
+{
+    set_relative_rate(d_conditioner.relative_rate() / d_items_per_sample);
+}
+
+
+void fused_conditioner_cc::forecast(int noutput_items, gr_vector_int& ninput_items_required)
+{
+    // The conditioner keeps its own filter history, so any amount of input is progress
+    const int nreqd = d_items_per_sample * std::max(1, static_cast<int>(std::ceil(noutput_items / d_conditioner.relative_rate())));
+    for (auto& required : ninput_items_required)
+        {
+            required = nreqd;
+        }
+}
+
+
+int fused_conditioner_cc::general_work(int noutput_items, gr_vector_int& ninput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    auto* out = reinterpret_cast<gr_complex*>(output_items[0]);
+    int consumed = 0;
+    const int produced = d_conditioner.process(input_items[0], ninput_items[0] / d_items_per_sample, out, noutput_items, consumed);
+    consume_each(consumed * d_items_per_sample);
+    return produced;
+}
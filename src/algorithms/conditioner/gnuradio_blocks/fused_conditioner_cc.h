@@ -0,0 +1,85 @@
+/*!
+ * \file fused_conditioner_cc.h
+ * \brief GNU Radio block that converts, filters and resamples the input
+ * samples of a signal conditioner in a single pass.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_CONDITIONER_CC_H
+#define GNSS_SDR_FUSED_CONDITIONER_CC_H
+
+#include "fused_conditioner.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_gnuradio_blocks conditioner_gr_blocks
+ * GNU Radio blocks of the signal conditioner
+ * \{ */
+
+
+class fused_conditioner_cc;
+
+using fused_conditioner_cc_sptr = gnss_shared_ptr<fused_conditioner_cc>;
+
+fused_conditioner_cc_sptr make_fused_conditioner_cc(
+    const std::string& input_item_type,
+    bool inverted_spectrum,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    double intermediate_freq,
+    double sampling_freq,
+    double resampler_freq_in,
+    double resampler_freq_out);
+
+/*!
+ * \brief Block with the data type adapter, input filter and resampler of a
+ * Signal_Conditioner in one place. See Fused_Conditioner.
+ *
+ * As with the signal sources and the data type adapters, "ishort" and
+ * "ibyte" inputs take one item per I or Q component.
+ */
+class fused_conditioner_cc : public gr::block
+{
+public:
+    ~fused_conditioner_cc() = default;
+
+    void forecast(int noutput_items, gr_vector_int& ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int& ninput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend fused_conditioner_cc_sptr make_fused_conditioner_cc(
+        const std::string& input_item_type,
+        bool inverted_spectrum,
+        const std::vector<float>& taps,
+        unsigned int decimation,
+        double intermediate_freq,
+        double sampling_freq,
+        double resampler_freq_in,
+        double resampler_freq_out);
+
+    fused_conditioner_cc(const Fused_Conditioner& conditioner, int items_per_sample);
+
+    Fused_Conditioner d_conditioner;
+    int d_items_per_sample;  // input items per complex sample (2 for "ishort" and "ibyte")
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_CONDITIONER_CC_H
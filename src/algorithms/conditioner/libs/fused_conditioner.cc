@@ -0,0 +1,297 @@
+/*!
+ * \file fused_conditioner.cc
+ * \brief Data type conversion, frequency translation, decimating FIR filter
+ * and direct resampler of a signal conditioner, applied in a single pass.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_conditioner.h"
+#include "MATH_CONSTANTS.h"  // for TWO_PI
+#include <volk/volk.h>
+#include <algorithm>  // for std::min, std::max, std::copy
+#include <cmath>      // for std::floor, std::remainder
+#include <stdexcept>  // for std::invalid_argument
+
+
+namespace
+{
+// Input samples converted per pass. The converted samples and the filter
+// output of a pass stay in the cache until the next stage reads them.
+const int FUSED_CONDITIONER_CHUNK = 4096;
+}  // namespace
+
+
+Fused_Conditioner::Fused_Conditioner(const std::string& input_item_type,
+    bool inverted_spectrum,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    double intermediate_freq,
+    double sampling_freq,
+    double resampler_freq_in,
+    double resampler_freq_out)
+    : d_phasor_step(1.0F, 0.0F),
+      d_current_sample(0.0F, 0.0F),
+      d_ntaps(static_cast<int>(taps.size())),
+      d_decimation(std::max(1, static_cast<int>(decimation))),
+      d_window_items(0),
+      d_filtered_pos(0),
+      d_filtered_items(0),
+      d_phase(0),
+      d_last_phase(0),
+      d_phase_step(0),
+      d_xlating_phase_rad(0.0),
+      d_xlating_phase_step_rad(0.0),
+      d_resampler_freq_in(resampler_freq_in),
+      d_resampler_freq_out(resampler_freq_out),
+      d_inverted_spectrum(inverted_spectrum),
+      d_xlating(d_ntaps > 0 && intermediate_freq != 0.0),
+      d_resampling(resampler_freq_out > 0.0 && resampler_freq_in > 0.0 && resampler_freq_out != resampler_freq_in),
+      d_upsampling(resampler_freq_out > resampler_freq_in),
+      d_have_current_sample(false)
+{
+    if (input_item_type == "gr_complex")
+        {
+            d_input_kind = Input_Kind::gr_complex;
+            d_input_item_size = sizeof(std::complex<float>);
+        }
+    else if (input_item_type == "cshort" || input_item_type == "ishort")
+        {
+            d_input_kind = Input_Kind::cshort;
+            d_input_item_size = 2 * sizeof(int16_t);
+        }
+    else if (input_item_type == "cbyte" || input_item_type == "ibyte")
+        {
+            d_input_kind = Input_Kind::cbyte;
+            d_input_item_size = 2 * sizeof(int8_t);
+        }
+    else
+        {
+            throw std::invalid_argument("Fused_Conditioner: unsupported input item type " + input_item_type);
+        }
+
+    if (d_ntaps > 0)
+        {
+            // The filter starts with ntaps - 1 zeros of history, as GNU Radio filters do
+            d_window_items = d_ntaps - 1;
+            d_window = volk_gnsssdr::vector<std::complex<float>>(d_ntaps + d_decimation + FUSED_CONDITIONER_CHUNK);
+            d_taps = volk_gnsssdr::vector<float>(taps.rbegin(), taps.rend());
+            if (d_xlating)
+                {
+                    // Band-pass taps centered at the IF, followed by a rotation at the output rate
+                    const double phase_step_rad = TWO_PI * intermediate_freq / sampling_freq;
+                    d_complex_taps = volk_gnsssdr::vector<std::complex<float>>(d_ntaps);
+                    for (int k = 0; k < d_ntaps; k++)
+                        {
+                            d_complex_taps[d_ntaps - 1 - k] = taps[k] * std::exp(std::complex<float>(0.0F, static_cast<float>(k * phase_step_rad)));
+                        }
+                    d_xlating_phase_step_rad = -phase_step_rad * d_decimation;
+                    d_phasor_step = std::exp(std::complex<float>(0.0F, static_cast<float>(d_xlating_phase_step_rad)));
+                }
+        }
+    if (d_resampling)
+        {
+            // Same phase accumulator as direct_resampler_conditioner_cc
+            const double two_32 = 4294967296.0;
+            const double ratio = d_upsampling ? resampler_freq_in / resampler_freq_out : resampler_freq_out / resampler_freq_in;
+            d_phase_step = static_cast<uint32_t>(std::floor(two_32 * ratio));
+        }
+    d_filtered = volk_gnsssdr::vector<std::complex<float>>(FUSED_CONDITIONER_CHUNK);
+}
+
+
+double Fused_Conditioner::relative_rate() const
+{
+    double rate = 1.0 / static_cast<double>(d_decimation);
+    if (d_resampling)
+        {
+            rate *= d_resampler_freq_out / d_resampler_freq_in;
+        }
+    return rate;
+}
+
+
+void Fused_Conditioner::convert(const void* input, int nitems, std::complex<float>* output) const
+{
+    switch (d_input_kind)
+        {
+        case Input_Kind::cshort:
+            volk_16i_s32f_convert_32f(reinterpret_cast<float*>(output), reinterpret_cast<const int16_t*>(input), 1.0F, 2 * nitems);
+            break;
+        case Input_Kind::cbyte:
+            volk_8i_s32f_convert_32f(reinterpret_cast<float*>(output), reinterpret_cast<const int8_t*>(input), 1.0F, 2 * nitems);
+            break;
+        default:
+            if (!d_inverted_spectrum)
+                {
+                    const auto* in = reinterpret_cast<const std::complex<float>*>(input);
+                    std::copy(in, in + nitems, output);
+                }
+            break;
+        }
+    if (d_inverted_spectrum)
+        {
+            volk_32fc_conjugate_32fc(output, d_input_kind == Input_Kind::gr_complex ? reinterpret_cast<const std::complex<float>*>(input) : output, nitems);
+        }
+}
+
+
+int Fused_Conditioner::filter(int nitems, std::complex<float>* output)
+{
+    // The window holds the samples of the next output, and nitems new samples after them
+    const int window_items = d_window_items + nitems;
+    int noutputs = 0;
+    int start = 0;
+    // The phase is kept in double precision, so that the rotation does not drift
+    std::complex<float> phasor = std::exp(std::complex<float>(0.0F, static_cast<float>(d_xlating_phase_rad)));
+    while (start + d_ntaps <= window_items)
+        {
+            if (d_xlating)
+                {
+                    volk_32fc_x2_dot_prod_32fc(&output[noutputs], &d_window[start], d_complex_taps.data(), d_ntaps);
+                    output[noutputs] *= phasor;
+                    phasor *= d_phasor_step;
+                }
+            else
+                {
+                    volk_32fc_32f_dot_prod_32fc(&output[noutputs], &d_window[start], d_taps.data(), d_ntaps);
+                }
+            noutputs++;
+            start += d_decimation;
+        }
+    if (d_xlating)
+        {
+            d_xlating_phase_rad = std::remainder(d_xlating_phase_rad + noutputs * d_xlating_phase_step_rad, TWO_PI);
+        }
+
+    // Keep the samples that the next outputs still need. With a decimation
+    // larger than the number of taps, the next output may start after the
+    // window: then the count is negative, and those input samples are skipped
+    d_window_items = window_items - start;
+    if (d_window_items > 0)
+        {
+            std::copy(d_window.begin() + start, d_window.begin() + window_items, d_window.begin());
+        }
+    return noutputs;
+}
+
+
+int Fused_Conditioner::resample(std::complex<float>* output, int noutput_items)
+{
+    int noutputs = 0;
+    if (!d_upsampling)
+        {
+            // A filtered sample is output when the phase accumulator has wrapped
+            while (noutputs < noutput_items && d_filtered_pos < d_filtered_items)
+                {
+                    if (d_phase <= d_last_phase)
+                        {
+                            output[noutputs++] = d_filtered[d_filtered_pos];
+                        }
+                    d_last_phase = d_phase;
+                    d_phase += d_phase_step;
+                    d_filtered_pos++;
+                }
+            return noutputs;
+        }
+
+    // A filtered sample is repeated until the phase accumulator wraps
+    if (!d_have_current_sample)
+        {
+            if (d_filtered_pos == d_filtered_items)
+                {
+                    return 0;
+                }
+            d_current_sample = d_filtered[d_filtered_pos++];
+            d_have_current_sample = true;
+        }
+    while (noutputs < noutput_items)
+        {
+            const uint32_t next_phase = d_phase + d_phase_step;
+            if (next_phase <= d_phase)
+                {
+                    if (d_filtered_pos == d_filtered_items)
+                        {
+                            break;  // wait for the next filtered sample
+                        }
+                    d_current_sample = d_filtered[d_filtered_pos++];
+                }
+            d_phase = next_phase;
+            output[noutputs++] = d_current_sample;
+        }
+    return noutputs;
+}
+
+
+int Fused_Conditioner::process(const void* input, int ninput_items, std::complex<float>* output, int noutput_items, int& consumed)
+{
+    const auto* in = reinterpret_cast<const uint8_t*>(input);
+    int produced = 0;
+    consumed = 0;
+    while (true)
+        {
+            if (d_resampling)
+                {
+                    // the filtered samples of the previous pass go first
+                    produced += resample(output + produced, noutput_items - produced);
+                }
+            if (produced == noutput_items)
+                {
+                    break;
+                }
+            if (consumed == ninput_items && (d_ntaps == 0 || d_window_items < d_ntaps))
+                {
+                    break;
+                }
+
+            if (d_window_items < 0)
+                {
+                    const int nskip = std::min(ninput_items - consumed, -d_window_items);
+                    d_window_items += nskip;
+                    consumed += nskip;
+                    continue;
+                }
+
+            // Next pass. Without a resampler, it writes to the output directly
+            const int max_outputs = d_resampling ? FUSED_CONDITIONER_CHUNK : std::min(FUSED_CONDITIONER_CHUNK, noutput_items - produced);
+            std::complex<float>* pass_output = d_resampling ? d_filtered.data() : output + produced;
+            int nitems = std::min(ninput_items - consumed, FUSED_CONDITIONER_CHUNK);
+            int noutputs = 0;
+            if (d_ntaps > 0)
+                {
+                    // no more input than the one needed for max_outputs filter outputs
+                    nitems = std::min(nitems, std::max(0, (max_outputs - 1) * d_decimation + d_ntaps - d_window_items));
+                    convert(in + consumed * d_input_item_size, nitems, &d_window[d_window_items]);
+                    noutputs = filter(nitems, pass_output);
+                }
+            else
+                {
+                    nitems = std::min(nitems, max_outputs);
+                    convert(in + consumed * d_input_item_size, nitems, pass_output);
+                    noutputs = nitems;
+                }
+            consumed += nitems;
+            if (d_resampling)
+                {
+                    d_filtered_pos = 0;
+                    d_filtered_items = noutputs;
+                }
+            else
+                {
+                    produced += noutputs;
+                }
+            if (nitems == 0 && noutputs == 0)
+                {
+                    break;
+                }
+        }
+    return produced;
+}
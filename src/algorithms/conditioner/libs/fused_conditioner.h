@@ -0,0 +1,122 @@
+/*!
+ * \file fused_conditioner.h
+ * \brief Data type conversion, frequency translation, decimating FIR filter
+ * and direct resampler of a signal conditioner, applied in a single pass.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_CONDITIONER_H
+#define GNSS_SDR_FUSED_CONDITIONER_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_libs conditioner_libs
+ * Library with the processing of the fused signal conditioner
+ * \{ */
+
+
+/*!
+ * \brief Applies the stages of a Signal_Conditioner chain to blocks of
+ * samples that fit in the cache, instead of one full pass over the stream per
+ * stage:
+ *
+ * - Conversion of "gr_complex", "cshort"/"ishort" or "cbyte"/"ibyte" samples
+ *   to complex floats, optionally conjugated (inverted spectrum).
+ * - FIR filter with float taps, optionally decimating and translating the
+ *   intermediate frequency to baseband, as gr::filter::fir_filter_ccf and
+ *   gr::filter::freq_xlating_fir_filter_ccf do.
+ * - Direct resampler, as direct_resampler_conditioner_cc does.
+ *
+ * Each stage is optional. The output is the same as the one of the chain of
+ * blocks, up to floating-point rounding.
+ */
+class Fused_Conditioner
+{
+public:
+    /*!
+     * \brief Constructor. An empty \p taps skips the filter, and a
+     * \p resampler_freq_out equal to \p resampler_freq_in (or zero) skips the
+     * resampler. Throws std::invalid_argument on unknown input item types.
+     */
+    Fused_Conditioner(const std::string& input_item_type,
+        bool inverted_spectrum,
+        const std::vector<float>& taps,
+        unsigned int decimation,
+        double intermediate_freq,
+        double sampling_freq,
+        double resampler_freq_in,
+        double resampler_freq_out);
+
+    //! Size in bytes of an input sample
+    inline size_t input_item_size() const { return d_input_item_size; }
+
+    //! Number of output samples per input sample
+    double relative_rate() const;
+
+    /*!
+     * \brief Processes up to \p ninput_items input samples into up to
+     * \p noutput_items output samples. Returns the number of output samples,
+     * and the number of input samples consumed in \p consumed. Samples that
+     * are consumed but not yet output are kept for the next call.
+     */
+    int process(const void* input, int ninput_items, std::complex<float>* output, int noutput_items, int& consumed);
+
+private:
+    enum class Input_Kind
+    {
+        gr_complex,
+        cshort,
+        cbyte
+    };
+
+    void convert(const void* input, int nitems, std::complex<float>* output) const;
+    int filter(int nitems, std::complex<float>* output);
+    int resample(std::complex<float>* output, int noutput_items);
+
+    volk_gnsssdr::vector<std::complex<float>> d_window;  // converted samples not fully used by the filter yet
+    volk_gnsssdr::vector<std::complex<float>> d_filtered;
+    volk_gnsssdr::vector<std::complex<float>> d_complex_taps;
+    volk_gnsssdr::vector<float> d_taps;  // in reverse order, as the dot products need them
+    std::complex<float> d_phasor_step;
+    std::complex<float> d_current_sample;
+    size_t d_input_item_size;
+    Input_Kind d_input_kind;
+    int d_ntaps;
+    int d_decimation;
+    int d_window_items;
+    int d_filtered_pos;
+    int d_filtered_items;
+    uint32_t d_phase;
+    uint32_t d_last_phase;
+    uint32_t d_phase_step;
+    double d_xlating_phase_rad;
+    double d_xlating_phase_step_rad;
+    double d_resampler_freq_in;
+    double d_resampler_freq_out;
+    bool d_inverted_spectrum;
+    bool d_xlating;
+    bool d_resampling;
+    bool d_upsampling;
+    bool d_have_current_sample;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_CONDITIONER_H
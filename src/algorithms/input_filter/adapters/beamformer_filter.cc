@@ -33,11 +33,19 @@ BeamformerFilter::BeamformerFilter(
     item_type_ = configuration->property(role + ".item_type", default_item_type);
     dump_ = configuration->property(role + ".dump", false);
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
+    const int n_channels = configuration->property(role + ".channels", GNSS_SDR_BEAMFORMER_CHANNELS);
+    const bool adaptive = configuration->property(role + ".adaptive", false);
+    const int default_decimation = 16;
+    const int decimation = configuration->property(role + ".decimation", default_decimation);
+    const int default_snapshots = 4096;
+    const int snapshots = configuration->property(role + ".snapshots", default_snapshots);
+    const float default_diagonal_loading = 0.01;
+    const float diagonal_loading = configuration->property(role + ".diagonal_loading", default_diagonal_loading);
     DLOG(INFO) << "role " << role_;
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            beamformer_ = make_beamformer_sptr();
+            beamformer_ = make_beamformer_sptr(n_channels, adaptive, decimation, snapshots, diagonal_loading);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "resampler(" << beamformer_->unique_id() << ")";
         }
@@ -53,9 +61,9 @@ BeamformerFilter::BeamformerFilter(
             file_sink_ = gr::blocks::file_sink::make(item_size_, dump_filename_.c_str());
             DLOG(INFO) << "file_sink(" << file_sink_->unique_id() << ")";
         }
-    if (in_stream_ > 8)
+    if (n_channels < 1)
         {
-            LOG(ERROR) << "This implementation only supports eight input streams";
+            LOG(ERROR) << "The beamformer needs at least one input channel";
         }
     if (out_stream_ > 1)
         {
@@ -17,8 +17,8 @@
 
 #include "fir_filter.h"
 #include "configuration_interface.h"
+#include "remez_fir_taps.h"
 #include <glog/logging.h>
-#include <gnuradio/filter/pm_remez.h>
 #include <volk/volk.h>
 #include <utility>
 
@@ -140,17 +140,8 @@ void FirFilter::init()
     const std::string default_taps_item_type("float");
     const std::string default_dump_filename("../data/input_filter.dat");
     const std::string default_filter_type("bandpass");
-    const std::vector<double> default_bands = {0.0, 0.4, 0.6, 1.0};
-    const std::vector<double> default_ampl = {1.0, 1.0, 0.0, 0.0};
-    const std::vector<double> default_error_w = {1.0, 1.0};
-    const int default_grid_density = 16;
-    const int default_number_of_taps = 6;
-    const unsigned int default_number_of_bands = 2;
 
-    const int number_of_taps = config_->property(role_ + ".number_of_taps", default_number_of_taps);
-    const unsigned int number_of_bands = config_->property(role_ + ".number_of_bands", default_number_of_bands);
     const std::string filter_type = config_->property(role_ + ".filter_type", default_filter_type);
-    const int grid_density = config_->property(role_ + ".grid_density", default_grid_density);
 
     input_item_type_ = config_->property(role_ + ".input_item_type", default_input_item_type);
     output_item_type_ = config_->property(role_ + ".output_item_type", default_output_item_type);
@@ -158,40 +149,7 @@ void FirFilter::init()
     dump_ = config_->property(role_ + ".dump", false);
     dump_filename_ = config_->property(role_ + ".dump_filename", default_dump_filename);
 
-    std::vector<double> bands;
-    std::vector<double> ampl;
-    std::vector<double> error_w;
-    std::string option;
-    double option_value;
-    for (unsigned int i = 0; i < number_of_bands; i++)
-        {
-            option = ".band" + std::to_string(i + 1) + "_begin";
-            option_value = config_->property(role_ + option, default_bands[i]);
-            bands.push_back(option_value);
-
-            option = ".band" + std::to_string(i + 1) + "_end";
-            option_value = config_->property(role_ + option, default_bands[i]);
-            bands.push_back(option_value);
-
-            option = ".ampl" + std::to_string(i + 1) + "_begin";
-            option_value = config_->property(role_ + option, default_bands[i]);
-            ampl.push_back(option_value);
-
-            option = ".ampl" + std::to_string(i + 1) + "_end";
-            option_value = config_->property(role_ + option, default_bands[i]);
-            ampl.push_back(option_value);
-
-            option = ".band" + std::to_string(i + 1) + "_error";
-            option_value = config_->property(role_ + option, default_bands[i]);
-            error_w.push_back(option_value);
-        }
-
-    // pm_remez implements the Parks-McClellan FIR filter design.
-    // It calculates the optimal (in the Chebyshev/minimax sense) FIR filter
-    // impulse response given a set of band edges, the desired response on
-    // those bands, and the weight given to the error in those bands.
-    const std::vector<double> taps_d = gr::filter::pm_remez(number_of_taps - 1, bands, ampl, error_w, filter_type, grid_density);
-    taps_ = std::vector<float>(taps_d.begin(), taps_d.end());
+    taps_ = remez_fir_taps(config_, role_, filter_type);
 }
 
 
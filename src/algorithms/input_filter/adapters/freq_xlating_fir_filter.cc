@@ -17,10 +17,10 @@
 
 #include "freq_xlating_fir_filter.h"
 #include "configuration_interface.h"
+#include "remez_fir_taps.h"
 #include <glog/logging.h>
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/filter/firdes.h>
-#include <gnuradio/filter/pm_remez.h>
 #include <volk/volk.h>
 #include <utility>
 
@@ -39,17 +39,9 @@ FreqXlatingFirFilter::FreqXlatingFirFilter(const ConfigurationInterface* configu
     const std::string default_dump_filename("../data/input_filter.dat");
     const double default_intermediate_freq = 0.0;
     const double default_sampling_freq = 4000000.0;
-    const int default_number_of_taps = 6;
-    const unsigned int default_number_of_bands = 2;
-    const std::vector<double> default_bands = {0.0, 0.4, 0.6, 1.0};
-    const std::vector<double> default_ampl = {1.0, 1.0, 0.0, 0.0};
-    const std::vector<double> default_error_w = {1.0, 1.0};
     const std::string default_filter_type("bandpass");
-    const int default_grid_density = 16;
     const int default_decimation_factor = 1;
 
-    const int number_of_taps = configuration->property(role_ + ".number_of_taps", default_number_of_taps);
-    const unsigned int number_of_bands = configuration->property(role_ + ".number_of_bands", default_number_of_bands);
     const std::string filter_type = configuration->property(role_ + ".filter_type", default_filter_type);
 
     dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
@@ -63,38 +55,7 @@ FreqXlatingFirFilter::FreqXlatingFirFilter(const ConfigurationInterface* configu
 
     if (filter_type != "lowpass")
         {
-            std::vector<double> bands;
-            std::vector<double> ampl;
-            std::vector<double> error_w;
-            std::string option;
-            double option_value;
-
-            for (unsigned int i = 0; i < number_of_bands; i++)
-                {
-                    option = ".band" + std::to_string(i + 1) + "_begin";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    bands.push_back(option_value);
-
-                    option = ".band" + std::to_string(i + 1) + "_end";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    bands.push_back(option_value);
-
-                    option = ".ampl" + std::to_string(i + 1) + "_begin";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    ampl.push_back(option_value);
-
-                    option = ".ampl" + std::to_string(i + 1) + "_end";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    ampl.push_back(option_value);
-
-                    option = ".band" + std::to_string(i + 1) + "_error";
-                    option_value = configuration->property(role_ + option, default_bands[i]);
-                    error_w.push_back(option_value);
-                }
-
-            const int grid_density = configuration->property(role_ + ".grid_density", default_grid_density);
-            const std::vector<double> taps_d = gr::filter::pm_remez(number_of_taps - 1, bands, ampl, error_w, filter_type, grid_density);
-            taps_ = std::vector<float>(taps_d.begin(), taps_d.end());
+            taps_ = remez_fir_taps(configuration, role_, filter_type);
         }
     else
         {
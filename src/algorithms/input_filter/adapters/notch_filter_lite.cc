@@ -39,6 +39,7 @@ NotchFilterLite::NotchFilterLite(const ConfigurationInterface* configuration,
     const int default_n_segments_reset = 5000000;
     const int default_length_ = 32;
     const int default_n_segments_est = 12500;
+    const int default_n_notches = 1;
 
     const float samp_freq = configuration->property("SignalSource.sampling_frequency", default_samp_freq);
     const float default_coeff_rate = samp_freq * 0.1F;
@@ -48,6 +49,7 @@ NotchFilterLite::NotchFilterLite(const ConfigurationInterface* configuration,
     const int length_ = configuration->property(role + ".length", default_length_);
     const int n_segments_est = configuration->property(role + ".segments_est", default_n_segments_est);
     const int n_segments_reset = configuration->property(role + ".segments_reset", default_n_segments_reset);
+    const int n_notches = configuration->property(role + ".notches", default_n_notches);
 
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
@@ -59,7 +61,7 @@ NotchFilterLite::NotchFilterLite(const ConfigurationInterface* configuration,
     if (item_type_ == "gr_complex")
         {
             item_size_ = sizeof(gr_complex);
-            notch_filter_lite_ = make_notch_filter_lite(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff);
+            notch_filter_lite_ = make_notch_filter_lite(p_c_factor, pfa, length_, n_segments_est, n_segments_reset, n_segments_coeff, n_notches);
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "input filter(" << notch_filter_lite_->unique_id() << ")";
         }
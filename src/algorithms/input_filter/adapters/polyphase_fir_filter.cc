@@ -0,0 +1,192 @@
+/*!
+ * \file polyphase_fir_filter.cc
+ * \brief Adapts a decimating FIR filter for integer and complex samples, with
+ * an optional cascade of half-band decimators
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_fir_filter.h"
+#include "configuration_interface.h"
+#include "remez_fir_taps.h"
+#include <glog/logging.h>
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/filter/pm_remez.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+#include <cstdint>
+#include <utility>
+
+
+namespace
+{
+// Half-band low-pass filter with 4m + 3 taps, the cut-off at a quarter of
+// the input rate and tw the transition width relative to the Nyquist rate
+std::vector<float> halfband_taps(int number_of_taps, double tw)
+{
+    const int ntaps = number_of_taps < 3 ? 3 : number_of_taps + (3 - number_of_taps % 4 + 4) % 4;
+    const std::vector<double> bands = {0.0, 0.5 - tw / 2.0, 0.5 + tw / 2.0, 1.0};
+    const std::vector<double> ampl = {1.0, 1.0, 0.0, 0.0};
+    const std::vector<double> error_w = {1.0, 1.0};
+    const std::vector<double> taps_d = gr::filter::pm_remez(ntaps - 1, bands, ampl, error_w, "bandpass");
+    std::vector<float> taps(taps_d.begin(), taps_d.end());
+
+    // The design is already close to a half-band filter: make the odd taps exact
+    const int center = (ntaps - 1) / 2;
+    for (int k = 1; k < ntaps; k += 2)
+        {
+            taps[k] = 0.0F;
+        }
+    taps[center] = 0.5F;
+    return taps;
+}
+}  // namespace
+
+
+PolyphaseFirFilter::PolyphaseFirFilter(const ConfigurationInterface* configuration,
+    std::string role,
+    unsigned int in_streams,
+    unsigned int out_streams)
+    : role_(std::move(role)),
+      item_size_(0),
+      decimation_factor_(1),
+      halfband_stages_(0),
+      in_streams_(in_streams),
+      out_streams_(out_streams),
+      dump_(false)
+{
+    const std::string default_item_type("gr_complex");
+    const std::string default_dump_filename("../data/input_filter.dat");
+    const std::string default_filter_type("bandpass");
+    const double default_sampling_freq = 4000000.0;
+    const int default_halfband_number_of_taps = 19;
+    const double default_halfband_tw = 0.3;
+
+    input_item_type_ = configuration->property(role_ + ".input_item_type", default_item_type);
+    const std::string output_item_type = configuration->property(role_ + ".output_item_type", default_item_type);
+    const std::string filter_type = configuration->property(role_ + ".filter_type", default_filter_type);
+    const double sampling_freq = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
+    const bool halfband_cascade = configuration->property(role_ + ".halfband_cascade", false);
+    const int halfband_number_of_taps = configuration->property(role_ + ".halfband_number_of_taps", default_halfband_number_of_taps);
+    const double halfband_tw = configuration->property(role_ + ".halfband_transition_width", default_halfband_tw);
+    decimation_factor_ = configuration->property(role_ + ".decimation_factor", 1);
+    dump_ = configuration->property(role_ + ".dump", false);
+    dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
+    if (decimation_factor_ == 0)
+        {
+            decimation_factor_ = 1;
+        }
+
+    // Each factor of two of the decimation goes to a half-band stage
+    unsigned int fir_decimation = decimation_factor_;
+    if (halfband_cascade)
+        {
+            while (fir_decimation % 2 == 0)
+                {
+                    fir_decimation /= 2;
+                    halfband_stages_++;
+                }
+            halfband_taps_ = halfband_taps(halfband_number_of_taps, halfband_tw);
+        }
+
+    // The FIR filter works at the output rate of the half-band stages
+    if (filter_type != "lowpass")
+        {
+            taps_ = remez_fir_taps(configuration, role_, filter_type);
+        }
+    else
+        {
+            const double fir_sampling_freq = sampling_freq / static_cast<double>(1U << halfband_stages_);
+            const double default_bw = (fir_sampling_freq / fir_decimation) / 2;
+            const double bw = configuration->property(role_ + ".bw", default_bw);
+            const double tw = configuration->property(role_ + ".tw", bw / 10.0);
+            taps_ = gr::filter::firdes::low_pass(1.0, fir_sampling_freq, bw, tw);
+        }
+
+    DLOG(INFO) << "role " << role_;
+    if (input_item_type_ == "gr_complex")
+        {
+            item_size_ = sizeof(gr_complex);
+        }
+    else if (input_item_type_ == "cshort")
+        {
+            item_size_ = sizeof(lv_16sc_t);
+        }
+    else if (input_item_type_ == "ishort")
+        {
+            item_size_ = sizeof(int16_t);
+        }
+    else if (input_item_type_ == "cbyte")
+        {
+            item_size_ = sizeof(lv_8sc_t);
+        }
+    else if (input_item_type_ == "ibyte")
+        {
+            item_size_ = sizeof(int8_t);
+        }
+    if (item_size_ > 0 && output_item_type == "gr_complex")
+        {
+            decimator_ = make_polyphase_fir_decimator(input_item_type_, taps_, fir_decimation, halfband_taps_, halfband_stages_);
+            DLOG(INFO) << "input_filter(" << decimator_->unique_id() << ") with " << taps_.size() << " taps, "
+                       << halfband_stages_ << " half-band stages and decimation " << decimation_factor_;
+            if (dump_)
+                {
+                    DLOG(INFO) << "Dumping output into file " << dump_filename_;
+                    file_sink_ = gr::blocks::file_sink::make(sizeof(gr_complex), dump_filename_.c_str());
+                }
+        }
+    else
+        {
+            LOG(ERROR) << input_item_type_ << " to " << output_item_type << " unknown item type conversion for " << role_;
+            item_size_ = 0;  // notify wrong configuration
+        }
+    if (in_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void PolyphaseFirFilter::connect(gr::top_block_sptr top_block)
+{
+    if (dump_ && decimator_)
+        {
+            top_block->connect(decimator_, 0, file_sink_, 0);
+        }
+    else
+        {
+            DLOG(INFO) << "nothing to connect internally";
+        }
+}
+
+
+void PolyphaseFirFilter::disconnect(gr::top_block_sptr top_block)
+{
+    if (dump_ && decimator_)
+        {
+            top_block->disconnect(decimator_, 0, file_sink_, 0);
+        }
+}
+
+
+gr::basic_block_sptr PolyphaseFirFilter::get_left_block()
+{
+    return decimator_;
+}
+
+
+gr::basic_block_sptr PolyphaseFirFilter::get_right_block()
+{
+    return decimator_;
+}
@@ -0,0 +1,95 @@
+/*!
+ * \file polyphase_fir_filter.h
+ * \brief Adapts a decimating FIR filter for integer and complex samples, with
+ * an optional cascade of half-band decimators
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_POLYPHASE_FIR_FILTER_H
+#define GNSS_SDR_POLYPHASE_FIR_FILTER_H
+
+#include "gnss_block_interface.h"
+#include "polyphase_fir_decimator.h"
+#include <gnuradio/blocks/file_sink.h>
+#include <string>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Adapts a polyphase_fir_decimator. It takes "gr_complex", "cshort",
+ * "cbyte", "ishort" or "ibyte" samples and outputs "gr_complex" samples,
+ * decimated by decimation_factor. item_size() is the size of an input item.
+ *
+ * The taps are designed with pm_remez from the same parameters as the ones of
+ * Fir_Filter, or with firdes::low_pass from bw and tw if filter_type is
+ * "lowpass". With halfband_cascade=true, each factor of two of
+ * decimation_factor is done by a half-band filter of halfband_number_of_taps
+ * taps, and the FIR filter does the rest of the decimation at the lower rate.
+ */
+class PolyphaseFirFilter : public GNSSBlockInterface
+{
+public:
+    PolyphaseFirFilter(const ConfigurationInterface* configuration,
+        std::string role,
+        unsigned int in_streams,
+        unsigned int out_streams);
+
+    ~PolyphaseFirFilter() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Polyphase_Fir_Filter"
+    inline std::string implementation() override
+    {
+        return "Polyphase_Fir_Filter";
+    }
+
+    inline size_t item_size() override
+    {
+        return item_size_;
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    polyphase_fir_decimator_sptr decimator_;
+    gr::blocks::file_sink::sptr file_sink_;
+    std::vector<float> taps_;
+    std::vector<float> halfband_taps_;
+    std::string dump_filename_;
+    std::string input_item_type_;
+    std::string role_;
+    size_t item_size_;
+    unsigned int decimation_factor_;
+    unsigned int halfband_stages_;
+    unsigned int in_streams_;
+    unsigned int out_streams_;
+    bool dump_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_POLYPHASE_FIR_FILTER_H
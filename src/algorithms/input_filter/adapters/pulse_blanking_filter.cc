@@ -44,6 +44,26 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
     const int n_segments_est = configuration->property(role_ + ".segments_est", default_n_segments_est);
     const int default_n_segments_reset = 5000000;
     const int n_segments_reset = configuration->property(role_ + ".segments_reset", default_n_segments_reset);
+    const std::string default_blanking("segment");
+    const std::string blanking = configuration->property(role_ + ".blanking", default_blanking);
+    const int default_overlap = (blanking == "sliding") ? length_ / 2 : 0;
+    int overlap = configuration->property(role_ + ".overlap", default_overlap);
+    bool frequency_domain = false;
+    if (blanking == "frequency")
+        {
+            frequency_domain = true;
+            overlap = 0;
+        }
+    else if (blanking != "segment" && blanking != "sliding")
+        {
+            LOG(WARNING) << blanking << " unrecognized blanking mode for pulse blanking filter, using segment";
+            overlap = 0;
+        }
+    if (overlap != 0 && (overlap < 0 || overlap >= length_ || length_ % (length_ - overlap) != 0))
+        {
+            LOG(WARNING) << "The overlap of the pulse blanking filter must leave a hop that divides its length, using no overlap";
+            overlap = 0;
+        }
     const double default_if = 0.0;
     const double if_aux = configuration->property(role_ + ".if", default_if);
     const double if_ = configuration->property(role_ + ".IF", if_aux);
@@ -58,7 +78,7 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
         {
             item_size = sizeof(gr_complex);    // output
             input_size_ = sizeof(gr_complex);  // input
-            pulse_blanking_cc_ = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset);
+            pulse_blanking_cc_ = make_pulse_blanking_cc(pfa, length_, n_segments_est, n_segments_reset, overlap, frequency_domain);
         }
     else
         {
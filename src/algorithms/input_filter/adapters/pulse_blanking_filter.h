@@ -36,6 +36,18 @@
 
 class ConfigurationInterface;
 
+/*!
+ * \brief Adapts pulse_blanking_cc, optionally after a frequency translation
+ * to baseband. Main properties:
+ *
+ * - pfa, length: probability of false alarm and samples per segment.
+ * - segments_est, segments_reset: segments used to estimate the noise floor,
+ *   and after which the estimation restarts. With the "sliding" blanking
+ *   they count hops of length - overlap samples, not segments.
+ * - blanking: "segment" (default), "sliding" or "frequency".
+ * - overlap: samples shared by consecutive windows in the "sliding" mode
+ *   (length / 2 by default).
+ */
 class PulseBlankingFilter : public GNSSBlockInterface
 {
 public:
@@ -1,7 +1,7 @@
 /*!
  * \file beamformer.cc
  *
- * \brief Unpacks byte samples to NSR 2 bits samples
+ * \brief Simple spatial filter using RAW array input and beamforming coefficients
  * \author Javier Arribas jarribas (at) cttc.es
  * -----------------------------------------------------------------------------
  *
@@ -16,50 +16,261 @@
 
 
 #include "beamformer.h"
+#include <armadillo>
+#include <glog/logging.h>
 #include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
 #include <cstddef>
 
+#if HAS_GENERIC_LAMBDA
+#else
+#include <boost/bind/bind.hpp>
+#endif
 
-beamformer_sptr make_beamformer_sptr()
+
+beamformer_sptr make_beamformer_sptr(int32_t n_channels, bool adaptive,
+    int32_t decimation, int32_t snapshots, float diagonal_loading, bool estimator_thread)
 {
-    return beamformer_sptr(new beamformer());
+    return beamformer_sptr(new beamformer(n_channels, adaptive, decimation, snapshots, diagonal_loading, estimator_thread));
 }
 
 
-beamformer::beamformer()
+beamformer::beamformer(int32_t n_channels, bool adaptive, int32_t decimation,
+    int32_t snapshots, float diagonal_loading, bool estimator_thread)
     : gr::sync_block("beamformer",
-          gr::io_signature::make(GNSS_SDR_BEAMFORMER_CHANNELS, GNSS_SDR_BEAMFORMER_CHANNELS, sizeof(gr_complex)),
-          gr::io_signature::make(1, 1, sizeof(gr_complex)))
+          gr::io_signature::make(n_channels, n_channels, sizeof(gr_complex)),
+          gr::io_signature::make(1, 1, sizeof(gr_complex))),
+      d_weights(n_channels, gr_complex(1.0, 0.0)),
+      d_in(n_channels),
+      d_covariance(n_channels * n_channels),
+      d_estimator_covariance(n_channels * n_channels),
+      d_estimated_weights(n_channels),
+      d_new_weights(false),
+      d_diagonal_loading(diagonal_loading),
+      d_n_channels(n_channels),
+      d_decimation(std::max(decimation, 1)),
+      d_snapshots(std::max(snapshots, n_channels)),
+      d_n_snapshots(0),
+      d_next_snapshot(0),
+      d_adaptive(adaptive),
+      d_estimator_thread(estimator_thread),
+      d_covariance_ready(false),
+      d_stop_estimator(false)
 {
+    if (d_adaptive)
+        {
+            d_snapshot_buffer = volk_gnsssdr::vector<gr_complex>(d_n_channels * d_snapshots);
+        }
+    this->message_port_register_in(pmt::mp("weights"));
+    this->set_msg_handler(pmt::mp("weights"),
+#if HAS_GENERIC_LAMBDA
+        [this](auto &&PH1) { msg_handler_weights(PH1); });
+#else
+#if USE_BOOST_BIND_PLACEHOLDERS
+        boost::bind(&beamformer::msg_handler_weights, this, boost::placeholders::_1));
+#else
+        boost::bind(&beamformer::msg_handler_weights, this, _1));
+#endif
+#endif
 }
 
 
-int beamformer::work(int noutput_items, gr_vector_const_void_star &input_items,
-    gr_vector_void_star &output_items)
+beamformer::~beamformer()
 {
-    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    // channel output buffers
-    //  gr_complex *ch1 = (gr_complex *) input_items[0];
-    //  gr_complex *ch2 = (gr_complex *) input_items[1];
-    //  gr_complex *ch3 = (gr_complex *) input_items[2];
-    //  gr_complex *ch4 = (gr_complex *) input_items[3];
-    //  gr_complex *ch5 = (gr_complex *) input_items[4];
-    //  gr_complex *ch6 = (gr_complex *) input_items[5];
-    //  gr_complex *ch7 = (gr_complex *) input_items[6];
-    //  gr_complex *ch8 = (gr_complex *) input_items[7];
-
-    // NON-VOLK beamforming operation
-    // TODO: Implement VOLK SIMD-accelerated beamformer!
-    gr_complex sum;
-    for (int n = 0; n < noutput_items; n++)
+    stop_estimator();
+}
+
+
+bool beamformer::start()
+{
+    if (d_adaptive && d_estimator_thread && !d_estimator.joinable())
+        {
+            d_stop_estimator = false;
+            d_estimator = std::thread(&beamformer::estimate_weights, this);
+        }
+    return true;
+}
+
+
+bool beamformer::stop()
+{
+    stop_estimator();
+    return true;
+}
+
+
+void beamformer::stop_estimator()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop_estimator = true;
+    }
+    d_condition.notify_one();
+    if (d_estimator.joinable())
+        {
+            d_estimator.join();
+        }
+}
+
+
+std::vector<gr_complex> beamformer::weights() const
+{
+    return std::vector<gr_complex>(d_weights.begin(), d_weights.end());
+}
+
+
+void beamformer::msg_handler_weights(const pmt::pmt_t &msg)
+{
+    if (!pmt::is_c32vector(msg) || static_cast<int32_t>(pmt::length(msg)) != d_n_channels)
+        {
+            LOG(WARNING) << "The beamformer expects a c32vector of " << d_n_channels << " weights";
+            return;
+        }
+    set_weights(pmt::c32vector_elements(msg));
+}
+
+
+void beamformer::set_weights(const std::vector<gr_complex> &weights)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_pending_weights = weights;
+    d_new_weights = true;
+}
+
+
+void beamformer::accumulate_covariance(int noutput_items)
+{
+    int32_t n = d_next_snapshot;
+    gr_complex dot;
+    while (n < noutput_items)
+        {
+            // Snapshots of this call, up to the end of the covariance block,
+            // gathered per channel so that each entry is one dot product
+            const int32_t count = std::min((noutput_items - 1 - n) / d_decimation + 1, d_snapshots - d_n_snapshots);
+            for (int32_t i = 0; i < d_n_channels; i++)
+                {
+                    gr_complex *snapshots = &d_snapshot_buffer[i * d_snapshots];
+                    for (int32_t k = 0; k < count; k++)
+                        {
+                            snapshots[k] = d_in[i][n + k * d_decimation];
+                        }
+                }
+            // Upper triangle of the sum of x x^H
+            for (int32_t i = 0; i < d_n_channels; i++)
+                {
+                    for (int32_t j = i; j < d_n_channels; j++)
+                        {
+                            volk_32fc_x2_conjugate_dot_prod_32fc(&dot, &d_snapshot_buffer[i * d_snapshots], &d_snapshot_buffer[j * d_snapshots], count);
+                            d_covariance[i * d_n_channels + j] += dot;
+                        }
+                }
+            n += count * d_decimation;
+            d_n_snapshots += count;
+            if (d_n_snapshots == d_snapshots)
+                {
+                    if (!d_estimator_thread)
+                        {
+                            if (mvdr_weights(d_covariance, d_estimated_weights))
+                                {
+                                    set_weights(d_estimated_weights);
+                                }
+                        }
+                    else
+                        {
+                            // Hand it over if the estimator is idle, or start over
+                            std::unique_lock<std::mutex> lock(d_mutex, std::try_to_lock);
+                            if (lock.owns_lock() && !d_covariance_ready)
+                                {
+                                    d_estimator_covariance.swap(d_covariance);
+                                    d_covariance_ready = true;
+                                    lock.unlock();
+                                    d_condition.notify_one();
+                                }
+                        }
+                    std::fill(d_covariance.begin(), d_covariance.end(), gr_complex(0.0, 0.0));
+                    d_n_snapshots = 0;
+                }
+        }
+    d_next_snapshot = n - noutput_items;
+}
+
+
+void beamformer::estimate_weights()
+{
+    std::vector<gr_complex> covariance(d_n_channels * d_n_channels);
+    std::vector<gr_complex> weights(d_n_channels);
+    while (true)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_condition.wait(lock, [this] { return d_covariance_ready || d_stop_estimator; });
+                if (d_stop_estimator)
+                    {
+                        return;
+                    }
+                covariance.swap(d_estimator_covariance);
+                d_covariance_ready = false;
+            }
+            if (mvdr_weights(covariance, weights))
+                {
+                    set_weights(weights);
+                }
+        }
+}
+
+
+bool beamformer::mvdr_weights(const std::vector<gr_complex> &covariance, std::vector<gr_complex> &weights) const
+{
+    // Only the upper triangle of the row major covariance is accumulated
+    arma::cx_fmat r(d_n_channels, d_n_channels);
+    for (int32_t i = 0; i < d_n_channels; i++)
         {
-            sum = gr_complex(0, 0);
-            for (size_t i = 0; i < weight_vector.size(); i++)
+            for (int32_t j = i; j < d_n_channels; j++)
                 {
-                    sum = sum + (reinterpret_cast<const gr_complex *>(input_items[i]))[n] * weight_vector[i];
+                    r(i, j) = covariance[i * d_n_channels + j];
+                    r(j, i) = std::conj(r(i, j));
                 }
-            out[n] = sum;
         }
+    const float loading = d_diagonal_loading * std::real(arma::trace(r)) / static_cast<float>(d_n_channels);
+    r.diag() += gr_complex(loading, 0.0);
+    // R a = e, a / (e^H a), and the output is sum conj(a_i) x_i
+    arma::cx_fvec reference(d_n_channels, arma::fill::zeros);
+    reference(0) = gr_complex(1.0, 0.0);
+    arma::cx_fvec a;
+    if (!arma::solve(a, r, reference, arma::solve_opts::no_approx) || std::abs(a(0)) == 0.0)
+        {
+            DLOG(INFO) << "Singular array covariance, keeping the beamformer weights";
+            return false;
+        }
+    a /= a(0);
+    for (int32_t i = 0; i < d_n_channels; i++)
+        {
+            weights[i] = std::conj(a(i));
+        }
+    return true;
+}
 
+
+int beamformer::work(int noutput_items, gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+    if (d_new_weights)
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            std::copy(d_pending_weights.begin(), d_pending_weights.end(), d_weights.begin());
+            d_new_weights = false;
+        }
+    for (int32_t i = 0; i < d_n_channels; i++)
+        {
+            d_in[i] = reinterpret_cast<const gr_complex *>(input_items[i]);
+        }
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc(out, d_in.data(), d_weights.data(), d_n_channels, noutput_items);
+    if (d_adaptive)
+        {
+            accumulate_covariance(noutput_items);
+        }
     return noutput_items;
 }
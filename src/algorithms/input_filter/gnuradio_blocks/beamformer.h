@@ -20,6 +20,13 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_block.h>
+#include <pmt/pmt.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 /** \addtogroup Input_Filter
@@ -32,24 +39,88 @@ class beamformer;
 
 using beamformer_sptr = gnss_shared_ptr<beamformer>;
 
-beamformer_sptr make_beamformer_sptr();
-
 const int GNSS_SDR_BEAMFORMER_CHANNELS = 8;
 
+/*!
+ * \brief Makes a beamformer for \p n_channels array elements, with all the
+ * weights set to one. With \p adaptive, the weights are estimated from the
+ * covariance of one array snapshot every \p decimation samples, over blocks
+ * of \p snapshots snapshots. \p diagonal_loading is added to the
+ * covariance, relative to its mean diagonal. The weights are estimated by a
+ * thread of their own, or with \p estimator_thread set to false, by work()
+ * itself at the end of each block, which makes the output reproducible.
+ */
+beamformer_sptr make_beamformer_sptr(
+    int32_t n_channels,
+    bool adaptive,
+    int32_t decimation,
+    int32_t snapshots,
+    float diagonal_loading,
+    bool estimator_thread = true);
+
 /*!
  * \brief This class implements a real-time software-defined spatial filter using the CTTC GNSS experimental antenna array input and a set of dynamically reloadable weights
+ *
+ * The output is the weighted sum of the channels. New weights can be sent at
+ * any time to the "weights" message port, as a c32vector of one weight per
+ * channel, and they are used from the next call to work().
+ *
+ * In adaptive mode, while the flowgraph runs, the block also accumulates the covariance of the
+ * decimated array snapshots and hands it to an estimator thread, which
+ * computes the power minimization weights, w = conj(R^-1 e) / (e^T R^-1 e)
+ * with e the first element of the array, and updates them in the same way.
+ * This is the MVDR beamformer steered to the reference element. It keeps the
+ * signals of that element and cancels the strong interference seen by the
+ * whole array.
  */
 class beamformer : public gr::sync_block
 {
 public:
-    ~beamformer() = default;
+    ~beamformer();
+
     int work(int noutput_items, gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    bool start() override;
+    bool stop() override;
+
+    //! Weights in use by work()
+    std::vector<gr_complex> weights() const;
+
+    //! Sets the weights used from the next call to work(), as the "weights" message port does
+    void set_weights(const std::vector<gr_complex> &weights);
+
 private:
-    friend beamformer_sptr make_beamformer_sptr();
-    beamformer();
-    std::vector<gr_complex> weight_vector = std::vector<gr_complex>(GNSS_SDR_BEAMFORMER_CHANNELS, gr_complex(1.0, 0.0));
+    friend beamformer_sptr make_beamformer_sptr(int32_t n_channels, bool adaptive, int32_t decimation, int32_t snapshots, float diagonal_loading, bool estimator_thread);
+    beamformer(int32_t n_channels, bool adaptive, int32_t decimation, int32_t snapshots, float diagonal_loading, bool estimator_thread);
+
+    void msg_handler_weights(const pmt::pmt_t &msg);
+    void accumulate_covariance(int noutput_items);
+    void estimate_weights();
+    bool mvdr_weights(const std::vector<gr_complex> &covariance, std::vector<gr_complex> &weights) const;
+    void stop_estimator();
+
+    volk_gnsssdr::vector<gr_complex> d_weights;
+    std::vector<const gr_complex *> d_in;
+    volk_gnsssdr::vector<gr_complex> d_snapshot_buffer;  // decimated samples of each channel
+    std::vector<gr_complex> d_pending_weights;    // set by messages or by the estimator
+    std::vector<gr_complex> d_covariance;         // being accumulated, row major
+    std::vector<gr_complex> d_estimator_covariance;  // handed to the estimator thread
+    std::vector<gr_complex> d_estimated_weights;     // without the estimator thread
+    std::thread d_estimator;
+    std::mutex d_mutex;
+    std::condition_variable d_condition;
+    std::atomic<bool> d_new_weights;
+    float d_diagonal_loading;
+    int32_t d_n_channels;
+    int32_t d_decimation;
+    int32_t d_snapshots;
+    int32_t d_n_snapshots;
+    int32_t d_next_snapshot;  // index in the next call of the next sample to accumulate
+    bool d_adaptive;
+    bool d_estimator_thread;
+    bool d_covariance_ready;
+    bool d_stop_estimator;
 };
 
 
@@ -38,9 +38,8 @@ Notch::Notch(float pfa,
     : gr::block("Notch",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
-      last_out_(gr_complex(0.0, 0.0)),
-      z_0_(gr_complex(0.0, 0.0)),
-      p_c_factor_(gr_complex(p_c_factor, 0.0)),
+      section_(length),
+      p_c_factor_(p_c_factor),
       pfa_(pfa),
       noise_pow_est_(0.0),
       length_(length),          // Set the number of samples per segment
@@ -54,8 +53,7 @@ Notch::Notch(float pfa,
     set_alignment(std::max(1, alignment_multiple));
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
-    c_samples_ = volk_gnsssdr::vector<gr_complex>(length_);
-    angle_ = volk_gnsssdr::vector<float>(length_);
+    z_ = volk_gnsssdr::vector<gr_complex>(length_);
     power_spect_ = volk_gnsssdr::vector<float>(length_);
     d_fft_ = gnss_fft_fwd_make_unique(length_);
 }
@@ -91,16 +89,10 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
                             if (filter_state_ == false)
                                 {
                                     filter_state_ = true;
-                                    last_out_ = gr_complex(0.0, 0.0);
-                                }
-                            volk_32fc_x2_multiply_conjugate_32fc(c_samples_.data(), in, (in - 1), length_);
-                            volk_32fc_s32f_atan2_32f(angle_.data(), c_samples_.data(), static_cast<float>(1.0), length_);
-                            for (int32_t aux = 0; aux < length_; aux++)
-                                {
-                                    z_0_ = std::exp(gr_complex(0.0, 1.0) * (*(angle_.data() + aux)));
-                                    *(out + aux) = *(in + aux) - z_0_ * (*(in + aux - 1)) + p_c_factor_ * z_0_ * last_out_;
-                                    last_out_ = *(out + aux);
+                                    section_.reset();
                                 }
+                            Notch_Section::phasors(in, z_.data(), length_);
+                            section_.filter(in, z_.data(), p_c_factor_, out);
                         }
                     else
                         {
@@ -20,6 +20,7 @@
 
 #include "gnss_block_interface.h"
 #include "gnss_sdr_fft.h"
+#include "notch_section.h"
 #include <gnuradio/block.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
@@ -59,12 +60,10 @@ private:
     Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
-    volk_gnsssdr::vector<gr_complex> c_samples_;
-    volk_gnsssdr::vector<float> angle_;
+    Notch_Section section_;
+    volk_gnsssdr::vector<gr_complex> z_;
     volk_gnsssdr::vector<float> power_spect_;
-    gr_complex last_out_;
-    gr_complex z_0_;
-    gr_complex p_c_factor_;
+    float p_c_factor_;
     float pfa_;
     float noise_pow_est_;
     float thres_;
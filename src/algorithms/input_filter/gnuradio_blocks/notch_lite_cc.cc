@@ -16,6 +16,7 @@
  */
 
 #include "notch_lite_cc.h"
+#include "MATH_CONSTANTS.h"
 #include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
@@ -24,9 +25,9 @@
 #include <cstring>
 
 
-notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff)
+notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, int32_t n_notches)
 {
-    return notch_lite_sptr(new NotchLite(p_c_factor, pfa, length, n_segments_est, n_segments_reset, n_segments_coeff));
+    return notch_lite_sptr(new NotchLite(p_c_factor, pfa, length, n_segments_est, n_segments_reset, n_segments_coeff, n_notches));
 }
 
 
@@ -35,19 +36,14 @@ NotchLite::NotchLite(float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
     int32_t n_segments_reset,
-    int32_t n_segments_coeff)
+    int32_t n_segments_coeff,
+    int32_t n_notches)
     : gr::block("NotchLite",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
-      last_out_(gr_complex(0.0, 0.0)),
-      z_0_(gr_complex(0.0, 0.0)),
-      p_c_factor_(gr_complex(p_c_factor, 0.0)),
-      c_samples1_(gr_complex(0.0, 0.0)),
-      c_samples2_(gr_complex(0.0, 0.0)),
+      p_c_factor_(p_c_factor),
       pfa_(pfa),
       noise_pow_est_(0.0),
-      angle1_(0.0),
-      angle2_(0.0),
       length_(length),
       n_segments_(0),
       n_segments_est_(n_segments_est),
@@ -55,6 +51,7 @@ NotchLite::NotchLite(float p_c_factor,
       n_segments_coeff_reset_(n_segments_coeff),
       n_segments_coeff_(0),
       n_deg_fred_(2 * length),
+      n_notches_(std::max(1, n_notches)),
       filter_state_(false)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
@@ -64,11 +61,83 @@ NotchLite::NotchLite(float p_c_factor,
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
 
+    sections_ = std::vector<Notch_Section>(n_notches_, Notch_Section(length_));
+    notch_state_ = std::vector<bool>(n_notches_, false);
+    z_ = volk_gnsssdr::vector<gr_complex>(n_notches_ * length_);
+    stage_in_ = volk_gnsssdr::vector<gr_complex>(length_ + 1);
+    stage_last_in_ = volk_gnsssdr::vector<gr_complex>(n_notches_);
     power_spect_ = volk_gnsssdr::vector<float>(length_);
     d_fft_ = gnss_fft_fwd_make_unique(length_);
 }
 
 
+// Phase difference between consecutive samples at both ends of the segment
+gr_complex NotchLite::estimate_phasor(const gr_complex *in) const
+{
+    const float angle1 = std::arg(in[1] * std::conj(in[0]));
+    const float angle2 = std::arg(in[length_ - 1] * std::conj(in[length_ - 2]));
+    const float angle = (angle1 + angle2) / 2.0F;
+    return gr_complex(std::cos(angle), std::sin(angle));
+}
+
+
+// Frequencies of the strongest bins of the segment spectrum, interpolated
+// between bins with Jacobsen's estimator, one per notch
+void NotchLite::estimate_phasors(const gr_complex *in)
+{
+    memcpy(d_fft_->get_inbuf(), in, sizeof(gr_complex) * length_);
+    d_fft_->execute();
+    const gr_complex *spectrum = d_fft_->get_outbuf();
+    volk_32fc_magnitude_squared_32f(power_spect_.data(), spectrum, length_);
+    for (int32_t notch = 0; notch < n_notches_; notch++)
+        {
+            const auto peak = static_cast<int32_t>(std::max_element(power_spect_.begin(), power_spect_.end()) - power_spect_.begin());
+            const int32_t prev = (peak + length_ - 1) % length_;
+            const int32_t next = (peak + 1) % length_;
+            const gr_complex den = 2.0F * spectrum[peak] - spectrum[prev] - spectrum[next];
+            const float delta = (std::norm(den) > 0.0F) ? std::real((spectrum[prev] - spectrum[next]) / den) : 0.0F;
+            const float angle = static_cast<float>(TWO_PI) * (static_cast<float>(peak) + delta) / static_cast<float>(length_);
+            set_phasor(notch, gr_complex(std::cos(angle), std::sin(angle)));
+            // The next notch takes a peak away from the leakage of this one
+            power_spect_[prev] = -1.0F;
+            power_spect_[peak] = -1.0F;
+            power_spect_[next] = -1.0F;
+        }
+}
+
+
+void NotchLite::set_phasor(int32_t notch, gr_complex z_0)
+{
+    std::fill(z_.begin() + notch * length_, z_.begin() + (notch + 1) * length_, z_0);
+}
+
+
+// Applies a notch after the first one to the output of the previous ones,
+// while interference remains in it
+void NotchLite::filter_residual(int32_t notch, gr_complex *out)
+{
+    lv_32fc_t dot_prod_;
+    stage_in_[0] = stage_last_in_[notch];
+    memcpy(&stage_in_[1], out, sizeof(gr_complex) * length_);
+    stage_last_in_[notch] = out[length_ - 1];
+    const gr_complex *in = &stage_in_[1];
+    volk_32fc_x2_conjugate_dot_prod_32fc(&dot_prod_, in, in, length_);
+    if ((lv_creal(dot_prod_) / noise_pow_est_) > thres_)
+        {
+            if (notch_state_[notch] == false)
+                {
+                    notch_state_[notch] = true;
+                    sections_[notch].reset();
+                }
+            sections_[notch].filter(in, &z_[notch * length_], p_c_factor_, out);
+        }
+    else
+        {
+            notch_state_[notch] = false;
+        }
+}
+
+
 int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
     gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
 {
@@ -99,22 +168,26 @@ int NotchLite::general_work(int noutput_items, gr_vector_int &ninput_items __att
                             if (filter_state_ == false)
                                 {
                                     filter_state_ = true;
-                                    last_out_ = gr_complex(0, 0);
+                                    sections_[0].reset();
                                     n_segments_coeff_ = 0;
+                                    std::fill(notch_state_.begin(), notch_state_.end(), false);
+                                    std::fill(stage_last_in_.begin(), stage_last_in_.end(), gr_complex(0.0, 0.0));
                                 }
                             if (n_segments_coeff_ == 0)
                                 {
-                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples1_, (in + 1), in, 1);
-                                    volk_32fc_s32f_atan2_32f(&angle1_, &c_samples1_, static_cast<float>(1.0), 1);
-                                    volk_32fc_x2_multiply_conjugate_32fc(&c_samples2_, (in + length_ - 1), (in + length_ - 2), 1);
-                                    volk_32fc_s32f_atan2_32f(&angle2_, &c_samples2_, static_cast<float>(1.0), 1);
-                                    float angle_ = (angle1_ + angle2_) / 2.0F;
-                                    z_0_ = std::exp(gr_complex(0, 1) * angle_);
+                                    if (n_notches_ > 1)
+                                        {
+                                            estimate_phasors(in);
+                                        }
+                                    else
+                                        {
+                                            set_phasor(0, estimate_phasor(in));
+                                        }
                                 }
-                            for (int32_t aux = 0; aux < length_; aux++)
+                            sections_[0].filter(in, z_.data(), p_c_factor_, out);
+                            for (int32_t notch = 1; notch < n_notches_; notch++)
                                 {
-                                    *(out + aux) = *(in + aux) - z_0_ * (*(in + aux - 1)) + p_c_factor_ * z_0_ * last_out_;
-                                    last_out_ = *(out + aux);
+                                    filter_residual(notch, out);
                                 }
                             n_segments_coeff_++;
                             n_segments_coeff_ = n_segments_coeff_ % n_segments_coeff_reset_;
@@ -20,10 +20,12 @@
 
 #include "gnss_block_interface.h"
 #include "gnss_sdr_fft.h"
+#include "notch_section.h"
 #include <gnuradio/block.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 /** \addtogroup Input_Filter
  * \{ */
@@ -41,10 +43,17 @@ notch_lite_sptr make_notch_filter_lite(
     int32_t length,
     int32_t n_segments_est,
     int32_t n_segments_reset,
-    int32_t n_segments_coeff);
+    int32_t n_segments_coeff,
+    int32_t n_notches);
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter light version
+ *
+ * Up to \p n_notches notches are cascaded. With a single notch, its frequency
+ * is the phase difference between consecutive samples. With more, the
+ * frequencies are the strongest peaks of the segment spectrum, and each notch
+ * after the first one is only applied while the output of the previous ones
+ * is still above the detection threshold.
  */
 class NotchLite : public gr::block
 {
@@ -56,21 +65,25 @@ public:
         gr_vector_void_star &output_items);
 
 private:
-    friend notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
-    NotchLite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff);
+    friend notch_lite_sptr make_notch_filter_lite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, int32_t n_notches);
+    NotchLite(float p_c_factor, float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t n_segments_coeff, int32_t n_notches);
+
+    gr_complex estimate_phasor(const gr_complex *in) const;
+    void estimate_phasors(const gr_complex *in);
+    void set_phasor(int32_t notch, gr_complex z_0);
+    void filter_residual(int32_t notch, gr_complex *out);
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
+    std::vector<Notch_Section> sections_;
+    std::vector<bool> notch_state_;
+    volk_gnsssdr::vector<gr_complex> z_;          // phasor of each notch, repeated over a segment
+    volk_gnsssdr::vector<gr_complex> stage_in_;   // input of a later notch, after the sample before it
+    volk_gnsssdr::vector<gr_complex> stage_last_in_;
     volk_gnsssdr::vector<float> power_spect_;
-    gr_complex last_out_;
-    gr_complex z_0_;
-    gr_complex p_c_factor_;
-    gr_complex c_samples1_;
-    gr_complex c_samples2_;
+    float p_c_factor_;
     float pfa_;
     float thres_;
     float noise_pow_est_;
-    float angle1_;
-    float angle2_;
     int32_t length_;
     int32_t n_segments_;
     int32_t n_segments_est_;
@@ -78,6 +91,7 @@ private:
     int32_t n_segments_coeff_reset_;
     int32_t n_segments_coeff_;
     int32_t n_deg_fred_;
+    int32_t n_notches_;
     bool filter_state_;
 };
 
@@ -0,0 +1,116 @@
+/*!
+ * \file notch_section.cc
+ * \brief Second-order section of the adaptive notch filters, applied to a
+ * segment of samples at once
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "notch_section.h"
+#include <cmath>
+
+
+namespace
+{
+// Chunks of the recursion solved side by side
+const int32_t NOTCH_SCAN_CHUNKS = 4;
+
+// Shortest chunk worth the correction pass
+const int32_t NOTCH_SCAN_MIN_CHUNK = 4;
+
+
+// Complex product without the checks for infinite operands of std::complex,
+// so that the loops below can be vectorized
+inline gr_complex mul(const gr_complex& a, const gr_complex& b)
+{
+    return gr_complex(a.real() * b.real() - a.imag() * b.imag(), a.real() * b.imag() + a.imag() * b.real());
+}
+}  // namespace
+
+
+Notch_Section::Notch_Section(int32_t length)
+    : d_pole(length),
+      d_gain(length),
+      d_last_out(gr_complex(0.0, 0.0)),
+      d_length(length)
+{
+}
+
+
+void Notch_Section::phasors(const gr_complex* in, gr_complex* phasors, int32_t length)
+{
+    for (int32_t n = 0; n < length; n++)
+        {
+            const gr_complex c(in[n].real() * in[n - 1].real() + in[n].imag() * in[n - 1].imag(),
+                in[n].imag() * in[n - 1].real() - in[n].real() * in[n - 1].imag());
+            const float magnitude = std::sqrt(c.real() * c.real() + c.imag() * c.imag());
+            // atan2(0, 0) is zero, and so is the phase of a null product
+            phasors[n] = (magnitude > 0.0F) ? c / magnitude : gr_complex(1.0, 0.0);
+        }
+}
+
+
+void Notch_Section::filter(const gr_complex* in, const gr_complex* phasors, float p_c_factor, gr_complex* out)
+{
+    gr_complex* pole = d_pole.data();
+    gr_complex* gain = d_gain.data();
+    for (int32_t n = 0; n < d_length; n++)
+        {
+            out[n] = in[n] - mul(phasors[n], in[n - 1]);
+            pole[n] = p_c_factor * phasors[n];
+        }
+
+    // out[n] += pole[n] out[n - 1], starting each chunk from a null state
+    // except the first one, and keeping the product of the poles
+    const int32_t chunk = d_length / NOTCH_SCAN_CHUNKS;
+    int32_t start = 0;
+    if (chunk >= NOTCH_SCAN_MIN_CHUNK)
+        {
+            gr_complex state[NOTCH_SCAN_CHUNKS];
+            gr_complex product[NOTCH_SCAN_CHUNKS];
+            for (int32_t c = 0; c < NOTCH_SCAN_CHUNKS; c++)
+                {
+                    state[c] = gr_complex(0.0, 0.0);
+                    product[c] = gr_complex(1.0, 0.0);
+                }
+            state[0] = d_last_out;
+            for (int32_t i = 0; i < chunk; i++)
+                {
+                    for (int32_t c = 0; c < NOTCH_SCAN_CHUNKS; c++)
+                        {
+                            const int32_t n = c * chunk + i;
+                            state[c] = out[n] + mul(pole[n], state[c]);
+                            product[c] = mul(pole[n], product[c]);
+                            out[n] = state[c];
+                            gain[n] = product[c];
+                        }
+                }
+            // The state entering each chunk is the last output of the
+            // previous one, already corrected
+            for (int32_t c = 1; c < NOTCH_SCAN_CHUNKS; c++)
+                {
+                    const gr_complex carry = out[c * chunk - 1];
+                    for (int32_t n = c * chunk; n < (c + 1) * chunk; n++)
+                        {
+                            out[n] += mul(gain[n], carry);
+                        }
+                }
+            start = NOTCH_SCAN_CHUNKS * chunk;
+        }
+
+    gr_complex state = (start > 0) ? out[start - 1] : d_last_out;
+    for (int32_t n = start; n < d_length; n++)
+        {
+            state = out[n] + mul(pole[n], state);
+            out[n] = state;
+        }
+    d_last_out = state;
+}
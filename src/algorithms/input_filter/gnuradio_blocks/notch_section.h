@@ -0,0 +1,73 @@
+/*!
+ * \file notch_section.h
+ * \brief Second-order section of the adaptive notch filters, applied to a
+ * segment of samples at once
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NOTCH_SECTION_H
+#define GNSS_SDR_NOTCH_SECTION_H
+
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+/*!
+ * \brief Notch section of Notch and NotchLite:
+ *
+ * out[n] = in[n] - z[n] in[n - 1] + p z[n] out[n - 1]
+ *
+ * where z[n] is the unit phasor of the interference and p the pole
+ * contraction factor. The feed-forward part is computed for the whole segment
+ * in one loop. The recursion is split in chunks that are solved side by side,
+ * and the output of each chunk is then corrected with the state that enters
+ * it, so that the dependency chain is one chunk long instead of one segment.
+ */
+class Notch_Section
+{
+public:
+    explicit Notch_Section(int32_t length);
+
+    /*!
+     * \brief Filters \p length samples of \p in, which must also hold the
+     * sample before the first one at in[-1]. \p out cannot overlap \p in.
+     */
+    void filter(const gr_complex* in, const gr_complex* phasors, float p_c_factor, gr_complex* out);
+
+    //! Clears the previous output, as when the filter is switched on
+    inline void reset() { d_last_out = gr_complex(0.0, 0.0); }
+
+    /*!
+     * \brief Writes in \p phasors the unit phasors in[n] conj(in[n - 1]) /
+     * |in[n] conj(in[n - 1])|, which are exp(j atan2()) of the phase
+     * differences without the trigonometric functions. \p in must hold the
+     * sample before the first one at in[-1].
+     */
+    static void phasors(const gr_complex* in, gr_complex* phasors, int32_t length);
+
+private:
+    volk_gnsssdr::vector<gr_complex> d_pole;  // p z[n]
+    volk_gnsssdr::vector<gr_complex> d_gain;  // product of the poles since the start of the chunk
+    gr_complex d_last_out;
+    int32_t d_length;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NOTCH_SECTION_H
@@ -0,0 +1,220 @@
+/*!
+ * \file polyphase_fir_decimator.cc
+ * \brief Decimating FIR filter for gr_complex and integer samples, with an
+ * optional cascade of half-band decimators.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_fir_decimator.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>  // for std::max, std::min
+#include <cstdint>
+#include <utility>    // for std::swap
+
+
+namespace
+{
+// Outputs of a half-band stage computed together
+const int HALFBAND_BLOCK_ITEMS = 1024;
+}  // namespace
+
+
+polyphase_fir_decimator_sptr make_polyphase_fir_decimator(
+    const std::string& input_item_type,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    const std::vector<float>& halfband_taps,
+    unsigned int halfband_stages)
+{
+    auto input_kind = polyphase_fir_decimator::Input_Kind::gr_complex;
+    size_t input_item_size = sizeof(gr_complex);
+    if (input_item_type == "cshort" || input_item_type == "ishort")
+        {
+            input_kind = polyphase_fir_decimator::Input_Kind::cshort;
+            input_item_size = sizeof(lv_16sc_t);
+        }
+    else if (input_item_type == "cbyte" || input_item_type == "ibyte")
+        {
+            input_kind = polyphase_fir_decimator::Input_Kind::cbyte;
+            input_item_size = sizeof(lv_8sc_t);
+        }
+    const bool interleaved = input_item_type == "ishort" || input_item_type == "ibyte";
+    if (interleaved)
+        {
+            input_item_size /= 2;
+        }
+    return polyphase_fir_decimator_sptr(new polyphase_fir_decimator(input_kind, input_item_size, interleaved, taps, decimation, halfband_taps, halfband_stages));
+}
+
+
+polyphase_fir_decimator::polyphase_fir_decimator(Input_Kind input_kind,
+    size_t input_item_size,
+    bool interleaved,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    const std::vector<float>& halfband_taps,
+    unsigned int halfband_stages)
+    : gr::sync_decimator("polyphase_fir_decimator",
+          gr::io_signature::make(1, 1, input_item_size),
+          gr::io_signature::make(1, 1, sizeof(gr_complex)),
+          (std::max(1U, decimation) << halfband_stages) * (interleaved ? 2 : 1)),
+      d_input_kind(input_kind),
+      d_first_sample(0),
+      d_halfband_center_tap(0.0F),
+      d_ntaps(static_cast<int>(taps.size())),
+      d_halfband_ntaps(static_cast<int>(halfband_taps.size())),
+      d_halfband_stages(static_cast<int>(halfband_stages)),
+      d_decimation(static_cast<int>(std::max(1U, decimation))),
+      d_total_decimation(1),
+      d_sample_history(1)
+{
+    // Without taps, the filter just decimates
+    d_taps = taps.empty() ? volk_gnsssdr::vector<float>(1, 1.0F) : volk_gnsssdr::vector<float>(taps.rbegin(), taps.rend());
+    d_ntaps = static_cast<int>(d_taps.size());
+
+    if (d_halfband_stages == 0)
+        {
+            d_halfband_ntaps = 1;
+        }
+    else
+        {
+            // Only the even taps and the center one are not zero
+            for (int k = 0; k < d_halfband_ntaps; k += 2)
+                {
+                    d_halfband_even_taps.push_back(halfband_taps[d_halfband_ntaps - 1 - k]);
+                }
+            d_halfband_center_tap = halfband_taps[(d_halfband_ntaps - 1) / 2];
+        }
+
+    // Input samples behind each output, through all the stages
+    int history = 1;
+    int stage_decimation = 1;
+    for (int s = 0; s < d_halfband_stages; s++)
+        {
+            history += (d_halfband_ntaps - 1) * stage_decimation;
+            stage_decimation *= 2;
+        }
+    history += (d_ntaps - 1) * stage_decimation;
+    d_total_decimation = d_decimation * stage_decimation;
+    d_sample_history = history;
+    if (interleaved)
+        {
+            // One item per component: 2 * history items would start at a Q
+            // component, so the block keeps one more item and skips the
+            // sample in front of the window
+            set_history(2 * history + 1);
+            d_first_sample = 2 * input_item_size;
+        }
+    else
+        {
+            set_history(history);
+        }
+}
+
+
+int polyphase_fir_decimator::halfband(const gr_complex* in, int ninput_items, volk_gnsssdr::vector<gr_complex>& out)
+{
+    // y[n] = sum_j h[2j] x[2n + 2j] + h[c] x[2n + c], with the center c odd
+    const int noutput_items = (ninput_items - d_halfband_ntaps) / 2 + 1;
+    const int neven_taps = static_cast<int>(d_halfband_even_taps.size());
+    const int center = (d_halfband_ntaps - 1) / 2;
+    d_even.resize(noutput_items + neven_taps - 1);
+    out.resize(noutput_items);
+    for (size_t i = 0; i < d_even.size(); i++)
+        {
+            d_even[i] = in[2 * i];
+        }
+    for (int n = 0; n < noutput_items; n++)
+        {
+            out[n] = d_halfband_center_tap * in[2 * n + center];
+        }
+
+    // One tap at a time over a block of outputs that stays in the cache: the
+    // taps are few, and the loops over the real and imaginary parts vectorize
+    auto* y = reinterpret_cast<float*>(out.data());
+    const auto* x = reinterpret_cast<const float*>(d_even.data());
+    for (int start = 0; start < 2 * noutput_items; start += 2 * HALFBAND_BLOCK_ITEMS)
+        {
+            const int end = std::min(start + 2 * HALFBAND_BLOCK_ITEMS, 2 * noutput_items);
+            for (int j = 0; j < neven_taps; j++)
+                {
+                    const float tap = d_halfband_even_taps[j];
+                    for (int i = start; i < end; i++)
+                        {
+                            y[i] += tap * x[2 * j + i];
+                        }
+                }
+        }
+    return noutput_items;
+}
+
+
+void polyphase_fir_decimator::filter(const gr_complex* in, gr_complex* out, int noutput_items) const
+{
+    for (int n = 0; n < noutput_items; n++)
+        {
+            volk_32fc_32f_dot_prod_32fc(&out[n], in + n * d_decimation, d_taps.data(), d_ntaps);
+        }
+}
+
+
+int polyphase_fir_decimator::work(int noutput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    auto* out = reinterpret_cast<gr_complex*>(output_items[0]);
+    const void* window = static_cast<const uint8_t*>(input_items[0]) + d_first_sample;
+    if (d_halfband_stages == 0)
+        {
+            // The integer samples go to the filter without a conversion pass
+            switch (d_input_kind)
+                {
+                case Input_Kind::cshort:
+                    volk_gnsssdr_16ic_32f_fir_decimate_32fc(out, static_cast<const lv_16sc_t*>(window), d_taps.data(), d_ntaps, d_decimation, noutput_items);
+                    break;
+                case Input_Kind::cbyte:
+                    volk_gnsssdr_8ic_32f_fir_decimate_32fc(out, static_cast<const lv_8sc_t*>(window), d_taps.data(), d_ntaps, d_decimation, noutput_items);
+                    break;
+                default:
+                    filter(static_cast<const gr_complex*>(window), out, noutput_items);
+                    break;
+                }
+            return noutput_items;
+        }
+
+    // The half-band stages work on float samples
+    int nitems = (noutput_items - 1) * d_total_decimation + d_sample_history;
+    const auto* in = static_cast<const gr_complex*>(window);
+    if (d_input_kind != Input_Kind::gr_complex)
+        {
+            d_converted.resize(nitems);
+            if (d_input_kind == Input_Kind::cshort)
+                {
+                    volk_16i_s32f_convert_32f(reinterpret_cast<float*>(d_converted.data()), static_cast<const int16_t*>(window), 1.0F, 2 * nitems);
+                }
+            else
+                {
+                    volk_8i_s32f_convert_32f(reinterpret_cast<float*>(d_converted.data()), static_cast<const int8_t*>(window), 1.0F, 2 * nitems);
+                }
+            in = d_converted.data();
+        }
+    for (int s = 0; s < d_halfband_stages; s++)
+        {
+            nitems = halfband(in, nitems, d_stage_out);
+            std::swap(d_stage_in, d_stage_out);
+            in = d_stage_in.data();
+        }
+    filter(in, out, noutput_items);
+    return noutput_items;
+}
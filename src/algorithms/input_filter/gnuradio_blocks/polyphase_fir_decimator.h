@@ -0,0 +1,116 @@
+/*!
+ * \file polyphase_fir_decimator.h
+ * \brief Decimating FIR filter for gr_complex, cshort and cbyte samples, with
+ * an optional cascade of half-band decimators.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_POLYPHASE_FIR_DECIMATOR_H
+#define GNSS_SDR_POLYPHASE_FIR_DECIMATOR_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class polyphase_fir_decimator;
+
+using polyphase_fir_decimator_sptr = gnss_shared_ptr<polyphase_fir_decimator>;
+
+polyphase_fir_decimator_sptr make_polyphase_fir_decimator(
+    const std::string& input_item_type,
+    const std::vector<float>& taps,
+    unsigned int decimation,
+    const std::vector<float>& halfband_taps,
+    unsigned int halfband_stages);
+
+/*!
+ * \brief Filters "gr_complex", "cshort", "cbyte", "ishort" or "ibyte" samples
+ * with real taps and outputs gr_complex samples, computing only the outputs
+ * that are kept after the decimation. As from the signal sources, "ishort" and
+ * "ibyte" streams have one item per I or Q component. Integer samples go through the
+ * volk_gnsssdr_16ic_32f_fir_decimate_32fc and
+ * volk_gnsssdr_8ic_32f_fir_decimate_32fc kernels, without a previous
+ * conversion to float.
+ *
+ * Optionally, \p halfband_stages half-band filters, each one decimating by
+ * two, go before the filter. Every other tap of a half-band filter is zero,
+ * so each stage only computes the even polyphase branch and the center tap.
+ * The taps of \p halfband_taps must have a length of the form 4m + 3.
+ *
+ * The total decimation is decimation * 2^halfband_stages. The output is the
+ * one of gr::filter::fir_filter_ccf (or a chain of them) with the same taps.
+ */
+class polyphase_fir_decimator : public gr::sync_decimator
+{
+public:
+    ~polyphase_fir_decimator() = default;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend polyphase_fir_decimator_sptr make_polyphase_fir_decimator(
+        const std::string& input_item_type,
+        const std::vector<float>& taps,
+        unsigned int decimation,
+        const std::vector<float>& halfband_taps,
+        unsigned int halfband_stages);
+
+    enum class Input_Kind
+    {
+        gr_complex,
+        cshort,
+        cbyte
+    };
+
+    polyphase_fir_decimator(Input_Kind input_kind,
+        size_t input_item_size,
+        bool interleaved,
+        const std::vector<float>& taps,
+        unsigned int decimation,
+        const std::vector<float>& halfband_taps,
+        unsigned int halfband_stages);
+
+    void filter(const gr_complex* in, gr_complex* out, int noutput_items) const;
+    int halfband(const gr_complex* in, int ninput_items, volk_gnsssdr::vector<gr_complex>& out);
+
+    volk_gnsssdr::vector<gr_complex> d_converted;  // input samples converted to float
+    volk_gnsssdr::vector<gr_complex> d_stage_in;
+    volk_gnsssdr::vector<gr_complex> d_stage_out;
+    volk_gnsssdr::vector<gr_complex> d_even;  // even polyphase branch of a half-band stage
+    volk_gnsssdr::vector<float> d_taps;  // in the order they multiply the input
+    volk_gnsssdr::vector<float> d_halfband_even_taps;
+    Input_Kind d_input_kind;
+    size_t d_first_sample;  // bytes before the first sample of the window
+    float d_halfband_center_tap;
+    int d_ntaps;
+    int d_halfband_ntaps;
+    int d_halfband_stages;
+    int d_decimation;
+    int d_total_decimation;  // in samples, through all the stages
+    int d_sample_history;    // in samples, through all the stages
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_POLYPHASE_FIR_DECIMATOR_H
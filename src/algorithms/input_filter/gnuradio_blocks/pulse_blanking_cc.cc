@@ -20,30 +20,39 @@
 #include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <algorithm>
+#include <cstring>
 
 
 pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length,
-    int32_t n_segments_est, int32_t n_segments_reset)
+    int32_t n_segments_est, int32_t n_segments_reset, int32_t overlap,
+    bool frequency_domain)
 {
-    return pulse_blanking_cc_sptr(new pulse_blanking_cc(pfa, length, n_segments_est, n_segments_reset));
+    return pulse_blanking_cc_sptr(new pulse_blanking_cc(pfa, length, n_segments_est, n_segments_reset, overlap, frequency_domain));
 }
 
 
 pulse_blanking_cc::pulse_blanking_cc(float pfa,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset)
+    int32_t n_segments_reset,
+    int32_t overlap,
+    bool frequency_domain)
     : gr::block("pulse_blanking_cc",
           gr::io_signature::make(1, 1, sizeof(gr_complex)),
           gr::io_signature::make(1, 1, sizeof(gr_complex))),
       noise_power_estimation_(0.0),
       pfa_(pfa),
       length_(length),
+      hop_(length),
+      hops_per_window_(1),
+      blank_hops_(0),
       n_segments_(0),
       n_segments_est_(n_segments_est),
       n_segments_reset_(n_segments_reset),
       n_deg_fred_(2 * length),
+      frequency_domain_(frequency_domain),
       last_filtered_(false)
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
@@ -51,31 +60,140 @@ pulse_blanking_cc::pulse_blanking_cc(float pfa,
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
     zeros_ = volk_gnsssdr::vector<gr_complex>(length_);
+    if (frequency_domain_)
+        {
+            // The power of each bin, normalized by the noise power of a real
+            // component, is chi-squared with two degrees of freedom
+            boost::math::chi_squared_distribution<float> bin_dist_(2);
+            bin_thres_ = boost::math::quantile(boost::math::complement(bin_dist_, pfa_));
+            d_fft_ = gnss_fft_fwd_make_unique(length_);
+            d_ifft_ = gnss_fft_rev_make_unique(length_);
+            bin_power_ = volk_gnsssdr::vector<float>(length_);
+        }
+    else
+        {
+            bin_thres_ = 0.0;
+            if ((overlap > 0) && (overlap < length_) && (length_ % (length_ - overlap) == 0))
+                {
+                    hop_ = length_ - overlap;
+                    hops_per_window_ = length_ / hop_;
+                    // Look-ahead of the window ending at the last hop
+                    set_history((hops_per_window_ - 1) * hop_ + 1);
+                }
+        }
 }
 
 
-int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
-    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+bool pulse_blanking_cc::estimating() const
 {
-    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
-    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
-    auto magnitude = volk_gnsssdr::vector<float>(noutput_items);
-    volk_32fc_magnitude_squared_32f(magnitude.data(), in, noutput_items);
-    int32_t sample_index = 0;
-    float segment_energy;
-    while ((sample_index + length_) < noutput_items)
+    return (n_segments_ < n_segments_est_) && (last_filtered_ == false);
+}
+
+
+void pulse_blanking_cc::update_estimation(float segment_energy)
+{
+    noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + segment_energy / static_cast<float>(n_deg_fred_)) / static_cast<float>(n_segments_ + 1);
+}
+
+
+int32_t pulse_blanking_cc::blank_in_time(int32_t noutput_items, const gr_complex *in, gr_complex *out)
+{
+    // Windows starting at each hop, which also need the hops of the history
+    const int32_t n_hops = std::max(0, (noutput_items - 1) / hop_);
+    if (n_hops == 0)
+        {
+            return 0;
+        }
+    const int32_t n_energies = n_hops + hops_per_window_ - 1;
+    if (hop_energy_.size() < static_cast<size_t>(n_energies))
+        {
+            hop_energy_.resize(n_energies);
+        }
+    volk_gnsssdr_32fc_segment_energy_32f(hop_energy_.data(), in, hop_, n_energies);
+    // Pass everything through, and then blank the hops that need it
+    memcpy(out, in, sizeof(gr_complex) * n_hops * hop_);
+    for (int32_t h = 0; h < n_hops; h++)
         {
-            volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), length_);
-            if ((n_segments_ < n_segments_est_) && (last_filtered_ == false))
+            float segment_energy = hop_energy_[h];
+            for (int32_t k = 1; k < hops_per_window_; k++)
                 {
-                    noise_power_estimation_ = (static_cast<float>(n_segments_) * noise_power_estimation_ + segment_energy / static_cast<float>(n_deg_fred_)) / static_cast<float>(n_segments_ + 1);
-                    memcpy(out, in, sizeof(gr_complex) * length_);
+                    segment_energy += hop_energy_[h + k];
+                }
+            if (estimating())
+                {
+                    update_estimation(segment_energy);
                 }
             else
                 {
                     if ((segment_energy / noise_power_estimation_) > thres_)
                         {
-                            memcpy(out, zeros_.data(), sizeof(gr_complex) * length_);
+                            // Every hop of the window, including the ones
+                            // still ahead
+                            blank_hops_ = hops_per_window_;
+                            last_filtered_ = true;
+                        }
+                    else
+                        {
+                            last_filtered_ = false;
+                            if (n_segments_ > n_segments_reset_)
+                                {
+                                    n_segments_ = 0;
+                                }
+                        }
+                }
+            if (blank_hops_ > 0)
+                {
+                    memcpy(out, zeros_.data(), sizeof(gr_complex) * hop_);
+                    blank_hops_--;
+                }
+            out += hop_;
+            n_segments_++;
+        }
+    return n_hops * hop_;
+}
+
+
+int32_t pulse_blanking_cc::blank_in_frequency(int32_t noutput_items, const gr_complex *in, gr_complex *out)
+{
+    const int32_t n_segments = std::max(0, (noutput_items - 1) / length_);
+    if (n_segments == 0)
+        {
+            return 0;
+        }
+    if (hop_energy_.size() < static_cast<size_t>(n_segments))
+        {
+            hop_energy_.resize(n_segments);
+        }
+    volk_gnsssdr_32fc_segment_energy_32f(hop_energy_.data(), in, length_, n_segments);
+    const float scale = 1.0F / static_cast<float>(length_);
+    for (int32_t s = 0; s < n_segments; s++)
+        {
+            if (estimating())
+                {
+                    update_estimation(hop_energy_[s]);
+                    memcpy(out, in, sizeof(gr_complex) * length_);
+                }
+            else
+                {
+                    memcpy(d_fft_->get_inbuf(), in, sizeof(gr_complex) * length_);
+                    d_fft_->execute();
+                    gr_complex *spectrum = d_fft_->get_outbuf();
+                    volk_32fc_magnitude_squared_32f(bin_power_.data(), spectrum, length_);
+                    const float bin_threshold = bin_thres_ * noise_power_estimation_ * static_cast<float>(length_);
+                    bool blanked = false;
+                    for (int32_t k = 0; k < length_; k++)
+                        {
+                            if (bin_power_[k] > bin_threshold)
+                                {
+                                    spectrum[k] = gr_complex(0.0, 0.0);
+                                    blanked = true;
+                                }
+                        }
+                    if (blanked)
+                        {
+                            memcpy(d_ifft_->get_inbuf(), spectrum, sizeof(gr_complex) * length_);
+                            d_ifft_->execute();
+                            volk_32f_s32f_multiply_32f(reinterpret_cast<float *>(out), reinterpret_cast<const float *>(d_ifft_->get_outbuf()), scale, 2 * length_);
                             last_filtered_ = true;
                         }
                     else
@@ -90,9 +208,18 @@ int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_ite
                 }
             in += length_;
             out += length_;
-            sample_index += length_;
             n_segments_++;
         }
+    return n_segments * length_;
+}
+
+
+int pulse_blanking_cc::general_work(int noutput_items, gr_vector_int &ninput_items __attribute__((unused)),
+    gr_vector_const_void_star &input_items, gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
+    const int32_t sample_index = frequency_domain_ ? blank_in_frequency(noutput_items, in, out) : blank_in_time(noutput_items, in, out);
     consume_each(sample_index);
     return sample_index;
 }
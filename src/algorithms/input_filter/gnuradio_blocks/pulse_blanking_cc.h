@@ -20,9 +20,11 @@
 #define GNSS_SDR_PULSE_BLANKING_CC_H
 
 #include "gnss_block_interface.h"
+#include "gnss_sdr_fft.h"
 #include <gnuradio/block.h>
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
+#include <memory>
 
 /** \addtogroup Input_Filter
  * \{ */
@@ -39,8 +41,28 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     float pfa,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset);
+    int32_t n_segments_reset,
+    int32_t overlap,
+    bool frequency_domain);
 
+/*!
+ * \brief Blanks the segments of \p length samples whose energy exceeds the
+ * noise floor estimation by the threshold set by \p pfa.
+ *
+ * With \p overlap > 0, the detection window slides by length - overlap
+ * samples, which must divide \p length, and every hop inside a window above
+ * the threshold is blanked. The output is then delayed by length - hop
+ * samples, which are the look-ahead of the window, and \p n_segments_est and
+ * \p n_segments_reset count hops instead of segments. With \p frequency_domain,
+ * only the bins of each segment spectrum above the threshold are zeroed,
+ * which removes pulses and narrow band interference while keeping the rest
+ * of the segment. \p overlap is ignored in that mode.
+ *
+ * Without overlap, the detections are equivalent to the ones of a plain sum
+ * of the squared magnitudes up to float rounding: the segment energies are
+ * summed in a different order, so segments right at the threshold can go
+ * either way.
+ */
 class pulse_blanking_cc : public gr::block
 {
 public:
@@ -50,17 +72,32 @@ public:
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
 private:
-    friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t overlap, bool frequency_domain);
+    pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, int32_t overlap, bool frequency_domain);
+
+    int32_t blank_in_time(int32_t noutput_items, const gr_complex *in, gr_complex *out);
+    int32_t blank_in_frequency(int32_t noutput_items, const gr_complex *in, gr_complex *out);
+    bool estimating() const;
+    void update_estimation(float segment_energy);
+
+    std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
+    std::unique_ptr<gnss_fft_complex_rev> d_ifft_;
     volk_gnsssdr::vector<gr_complex> zeros_;
+    volk_gnsssdr::vector<float> hop_energy_;  // kept across calls, grown when needed
+    volk_gnsssdr::vector<float> bin_power_;
     float noise_power_estimation_;
     float thres_;
+    float bin_thres_;
     float pfa_;
     int32_t length_;
+    int32_t hop_;
+    int32_t hops_per_window_;
+    int32_t blank_hops_;
     int32_t n_segments_;
     int32_t n_segments_est_;
     int32_t n_segments_reset_;
     int32_t n_deg_fred_;
+    bool frequency_domain_;
     bool last_filtered_;
 };
 
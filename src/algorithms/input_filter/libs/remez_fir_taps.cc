@@ -0,0 +1,55 @@
+/*!
+ * \file remez_fir_taps.cc
+ * \brief Designs the taps of a FIR filter with the Parks-McClellan algorithm,
+ * from the band edges given in the configuration of an input filter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "remez_fir_taps.h"
+#include "configuration_interface.h"
+#include <gnuradio/filter/pm_remez.h>
+
+
+std::vector<float> remez_fir_taps(const ConfigurationInterface* configuration,
+    const std::string& role,
+    const std::string& filter_type)
+{
+    const std::vector<double> default_bands = {0.0, 0.4, 0.6, 1.0};
+    const int default_grid_density = 16;
+    const int default_number_of_taps = 6;
+    const unsigned int default_number_of_bands = 2;
+
+    const int number_of_taps = configuration->property(role + ".number_of_taps", default_number_of_taps);
+    const unsigned int number_of_bands = configuration->property(role + ".number_of_bands", default_number_of_bands);
+    const int grid_density = configuration->property(role + ".grid_density", default_grid_density);
+
+    std::vector<double> bands;
+    std::vector<double> ampl;
+    std::vector<double> error_w;
+    for (unsigned int i = 0; i < number_of_bands; i++)
+        {
+            const std::string band = ".band" + std::to_string(i + 1);
+            const std::string amplitude = ".ampl" + std::to_string(i + 1);
+            bands.push_back(configuration->property(role + band + "_begin", default_bands[i]));
+            bands.push_back(configuration->property(role + band + "_end", default_bands[i]));
+            ampl.push_back(configuration->property(role + amplitude + "_begin", default_bands[i]));
+            ampl.push_back(configuration->property(role + amplitude + "_end", default_bands[i]));
+            error_w.push_back(configuration->property(role + band + "_error", default_bands[i]));
+        }
+
+    // pm_remez implements the Parks-McClellan FIR filter design.
+    // It calculates the optimal (in the Chebyshev/minimax sense) FIR filter
+    // impulse response given a set of band edges, the desired response on
+    // those bands, and the weight given to the error in those bands.
+    const std::vector<double> taps_d = gr::filter::pm_remez(number_of_taps - 1, bands, ampl, error_w, filter_type, grid_density);
+    return std::vector<float>(taps_d.begin(), taps_d.end());
+}
@@ -0,0 +1,46 @@
+/*!
+ * \file remez_fir_taps.h
+ * \brief Designs the taps of a FIR filter with the Parks-McClellan algorithm,
+ * from the band edges given in the configuration of an input filter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_REMEZ_FIR_TAPS_H
+#define GNSS_SDR_REMEZ_FIR_TAPS_H
+
+#include <string>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_libs input_filter_libs
+ * Library with the filter design shared by the input filters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Returns the taps designed by gr::filter::pm_remez from the
+ * number_of_taps, number_of_bands, bandN_begin, bandN_end, amplN_begin,
+ * amplN_end, bandN_error and grid_density properties of \p role.
+ *
+ * \p filter_type is "bandpass", "hilbert" or "differentiator".
+ */
+std::vector<float> remez_fir_taps(const ConfigurationInterface* configuration,
+    const std::string& role,
+    const std::string& filter_type);
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_REMEZ_FIR_TAPS_H
@@ -38,6 +38,10 @@ DEFINE_string(timestamp_source, "-",
 
 DEFINE_bool(rf_shutdown, true, "If set to false, AD9361 RF channels are not shut down when exiting the program. Useful to leave the AD9361 configured and running.");
 
+DEFINE_bool(replay, false, "If set to true, file sources are processed in replay mode, as fast as possible, and the achieved real-time factor is reported at the end (same as GNSS-SDR.replay=true in the configuration file).");
+
+DEFINE_double(replay_speed, 0.0, "If defined, enables the replay mode and limits the processing speed of file sources to this multiple of real time.");
+
 DEFINE_int32(doppler_max, 0, "If defined, sets the maximum Doppler value in the search grid, in Hz (overrides the configuration file).");
 
 DEFINE_int32(doppler_step, 0, "If defined, sets the frequency step in the search grid, in Hz (overrides the configuration file).");
@@ -207,6 +211,17 @@ static bool ValidatePllBw(const char* flagname, double value)
     return false;
 }
 
+static bool ValidateReplaySpeed(const char* flagname, double value)
+{
+    if (value >= 0.0)
+        {  // value is ok
+            return true;
+        }
+    std::cout << "Invalid value for flag -" << flagname << ": " << value << ". Allowed range is 0 <= " << flagname << ".\n";
+    std::cout << "GNSS-SDR program ended.\n";
+    return false;
+}
+
 static bool ValidateCarrierSmoothingFactor(const char* flagname, int32_t value)
 {
     const int32_t min_value = 1;
@@ -233,5 +248,6 @@ DEFINE_validator(carrier_lock_th, &ValidateCarrierLockTh);
 DEFINE_validator(dll_bw_hz, &ValidateDllBw);
 DEFINE_validator(pll_bw_hz, &ValidatePllBw);
 DEFINE_validator(carrier_smoothing_factor, &ValidateCarrierSmoothingFactor);
+DEFINE_validator(replay_speed, &ValidateReplaySpeed);
 
 #endif
@@ -39,6 +39,8 @@ DECLARE_string(s);                 //!< Path to the file containing the signal s
 DECLARE_string(signal_source);     //!< Path to the file containing the signal samples.
 DECLARE_string(timestamp_source);  //!< Path to the file containing the signal samples.
 DECLARE_bool(rf_shutdown);         //!< Shutdown RF when program exits.
+DECLARE_bool(replay);              //!< Post-process file sources in replay mode.
+DECLARE_double(replay_speed);      //!< In replay mode, maximum speed as a multiple of real time (0 for no limit).
 
 // Declare flags for acquisition blocks
 DECLARE_int32(doppler_max);   //!< If defined, maximum Doppler value in the search grid, in Hz (overrides the configuration file).
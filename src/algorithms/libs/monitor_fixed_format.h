@@ -0,0 +1,383 @@
+/*!
+ * \file monitor_fixed_format.h
+ * \brief Fixed-layout binary format for the Gnss_Synchro and Monitor_Pvt
+ * monitoring streams, with its writer and reader
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MONITOR_FIXED_FORMAT_H
+#define GNSS_SDR_MONITOR_FIXED_FORMAT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+/*
+ * Each datagram starts with a Fixed_Format_Header, followed by record_count
+ * records of record_size bytes each. All the fields are little-endian, at
+ * the offsets given by the structures below, which have no padding.
+ *
+ * Fields are only ever appended at the end of a record. Each time this
+ * happens, FIXED_FORMAT_VERSION is increased. Readers use record_size to step
+ * over the records and ignore the bytes they do not know about, so an old
+ * reader can consume newer streams. Likewise, header_size allows the header
+ * to grow.
+ *
+ * This file does not depend on the rest of GNSS-SDR (and it only requires
+ * C++11), so it can be copied into client applications.
+ */
+
+constexpr uint8_t FIXED_FORMAT_MAGIC[4] = {'G', 'S', 'M', 'F'};
+constexpr uint16_t FIXED_FORMAT_VERSION = 1;
+constexpr uint16_t FIXED_FORMAT_GNSS_SYNCHRO = 1;  //!< Record type of Gnss_Synchro_Record
+constexpr uint16_t FIXED_FORMAT_MONITOR_PVT = 2;   //!< Record type of Monitor_Pvt_Record
+constexpr size_t FIXED_FORMAT_MAX_DATAGRAM_SIZE = 1472;  //!< Fits in an Ethernet frame without IP fragmentation
+
+
+struct Fixed_Format_Header
+{
+    uint8_t magic[4];       //!< FIXED_FORMAT_MAGIC
+    uint16_t version;       //!< Layout version of the records
+    uint16_t record_type;   //!< FIXED_FORMAT_GNSS_SYNCHRO or FIXED_FORMAT_MONITOR_PVT
+    uint16_t header_size;   //!< Offset of the first record
+    uint16_t record_size;   //!< Size of each record, in bytes
+    uint32_t record_count;  //!< Number of records in the datagram
+};
+
+
+/*!
+ * \brief Gnss_Synchro fields, in a layout without padding
+ */
+struct Gnss_Synchro_Record
+{
+    char System;
+    char Signal[2];
+    uint8_t flags;  //!< Bits 0 to 4: Flag_valid_acquisition, Flag_valid_symbol_output, Flag_valid_word, Flag_valid_pseudorange, Flag_PLL_180_deg_phase_locked
+    uint32_t PRN;
+    int32_t Channel_ID;
+    uint32_t Acq_doppler_step;
+    double Acq_delay_samples;
+    double Acq_doppler_hz;
+    uint64_t Acq_samplestamp_samples;
+    int64_t fs;
+    double Prompt_I;
+    double Prompt_Q;
+    double CN0_dB_hz;
+    double Carrier_Doppler_hz;
+    double Carrier_phase_rads;
+    double Code_phase_samples;
+    uint64_t Tracking_sample_counter;
+    int32_t correlation_length_ms;
+    uint32_t TOW_at_current_symbol_ms;
+    double Pseudorange_m;
+    double RX_time;
+    double interp_TOW_ms;
+};
+
+
+/*!
+ * \brief Monitor_Pvt fields, in a layout without padding
+ */
+struct Monitor_Pvt_Record
+{
+    uint32_t TOW_at_current_symbol_ms;
+    uint32_t week;
+    double RX_time;
+    double user_clk_offset;
+    double pos_x;
+    double pos_y;
+    double pos_z;
+    double vel_x;
+    double vel_y;
+    double vel_z;
+    double cov_xx;
+    double cov_yy;
+    double cov_zz;
+    double cov_xy;
+    double cov_yz;
+    double cov_zx;
+    double latitude;
+    double longitude;
+    double height;
+    uint8_t valid_sats;
+    uint8_t solution_status;
+    uint8_t solution_type;
+    uint8_t reserved0;
+    float AR_ratio_factor;
+    float AR_ratio_threshold;
+    uint32_t reserved1;
+    double gdop;
+    double pdop;
+    double hdop;
+    double vdop;
+    double user_clk_drift_ppm;
+};
+
+
+static_assert(sizeof(Fixed_Format_Header) == 16, "Unexpected padding in Fixed_Format_Header");
+static_assert(offsetof(Fixed_Format_Header, record_count) == 12, "Unexpected padding in Fixed_Format_Header");
+static_assert(sizeof(Gnss_Synchro_Record) == 136, "Unexpected padding in Gnss_Synchro_Record");
+static_assert(offsetof(Gnss_Synchro_Record, Acq_delay_samples) == 16, "Unexpected padding in Gnss_Synchro_Record");
+static_assert(offsetof(Gnss_Synchro_Record, correlation_length_ms) == 104, "Unexpected padding in Gnss_Synchro_Record");
+static_assert(sizeof(Monitor_Pvt_Record) == 200, "Unexpected padding in Monitor_Pvt_Record");
+static_assert(offsetof(Monitor_Pvt_Record, valid_sats) == 144, "Unexpected padding in Monitor_Pvt_Record");
+static_assert(offsetof(Monitor_Pvt_Record, gdop) == 160, "Unexpected padding in Monitor_Pvt_Record");
+
+
+/*!
+ * \brief Conversion between the host byte order and little-endian.
+ * On little-endian hosts, which are the common case, this does nothing and
+ * records are copied as they are.
+ */
+class Fixed_Format_Byte_Order
+{
+public:
+    static void swap(Fixed_Format_Header& h)
+    {
+        if (host_is_big_endian())
+            {
+                swap_field(h.version);
+                swap_field(h.record_type);
+                swap_field(h.header_size);
+                swap_field(h.record_size);
+                swap_field(h.record_count);
+            }
+    }
+
+    static void swap(Gnss_Synchro_Record& r)
+    {
+        if (host_is_big_endian())
+            {
+                swap_field(r.PRN);
+                swap_field(r.Channel_ID);
+                swap_field(r.Acq_doppler_step);
+                swap_field(r.Acq_delay_samples);
+                swap_field(r.Acq_doppler_hz);
+                swap_field(r.Acq_samplestamp_samples);
+                swap_field(r.fs);
+                swap_field(r.Prompt_I);
+                swap_field(r.Prompt_Q);
+                swap_field(r.CN0_dB_hz);
+                swap_field(r.Carrier_Doppler_hz);
+                swap_field(r.Carrier_phase_rads);
+                swap_field(r.Code_phase_samples);
+                swap_field(r.Tracking_sample_counter);
+                swap_field(r.correlation_length_ms);
+                swap_field(r.TOW_at_current_symbol_ms);
+                swap_field(r.Pseudorange_m);
+                swap_field(r.RX_time);
+                swap_field(r.interp_TOW_ms);
+            }
+    }
+
+    static void swap(Monitor_Pvt_Record& r)
+    {
+        if (host_is_big_endian())
+            {
+                swap_field(r.TOW_at_current_symbol_ms);
+                swap_field(r.week);
+                swap_field(r.RX_time);
+                swap_field(r.user_clk_offset);
+                swap_field(r.pos_x);
+                swap_field(r.pos_y);
+                swap_field(r.pos_z);
+                swap_field(r.vel_x);
+                swap_field(r.vel_y);
+                swap_field(r.vel_z);
+                swap_field(r.cov_xx);
+                swap_field(r.cov_yy);
+                swap_field(r.cov_zz);
+                swap_field(r.cov_xy);
+                swap_field(r.cov_yz);
+                swap_field(r.cov_zx);
+                swap_field(r.latitude);
+                swap_field(r.longitude);
+                swap_field(r.height);
+                swap_field(r.AR_ratio_factor);
+                swap_field(r.AR_ratio_threshold);
+                swap_field(r.gdop);
+                swap_field(r.pdop);
+                swap_field(r.hdop);
+                swap_field(r.vdop);
+                swap_field(r.user_clk_drift_ppm);
+            }
+    }
+
+    template <typename T>
+    static void swap_field(T& field)
+    {
+        if (host_is_big_endian())
+            {
+                uint8_t bytes[sizeof(T)];
+                std::memcpy(bytes, &field, sizeof(T));
+                for (size_t i = 0; i < sizeof(T) / 2; i++)
+                    {
+                        const uint8_t tmp = bytes[i];
+                        bytes[i] = bytes[sizeof(T) - 1 - i];
+                        bytes[sizeof(T) - 1 - i] = tmp;
+                    }
+                std::memcpy(&field, bytes, sizeof(T));
+            }
+    }
+
+private:
+    static bool host_is_big_endian()
+    {
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+        return __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__;
+#else
+        const uint16_t one = 1;
+        uint8_t first_byte;
+        std::memcpy(&first_byte, &one, 1);
+        return first_byte == 0;
+#endif
+    }
+};
+
+
+/*!
+ * \brief Writes records of a given type into datagrams.
+ *
+ * begin() writes the header at the start of a datagram buffer, append()
+ * copies records after it and updates record_count in place, until full()
+ * says that the next record would exceed max_datagram_size.
+ */
+template <typename Record>
+class Fixed_Format_Writer
+{
+public:
+    Fixed_Format_Writer(uint16_t record_type, size_t max_datagram_size = FIXED_FORMAT_MAX_DATAGRAM_SIZE)
+        : d_record_type(record_type),
+          d_max_records(max_datagram_size > sizeof(Fixed_Format_Header) + sizeof(Record) ? (max_datagram_size - sizeof(Fixed_Format_Header)) / sizeof(Record) : 1)
+    {
+    }
+
+    void begin(std::string& datagram)
+    {
+        Fixed_Format_Header header;
+        std::memcpy(header.magic, FIXED_FORMAT_MAGIC, sizeof(header.magic));
+        header.version = FIXED_FORMAT_VERSION;
+        header.record_type = d_record_type;
+        header.header_size = static_cast<uint16_t>(sizeof(Fixed_Format_Header));
+        header.record_size = static_cast<uint16_t>(sizeof(Record));
+        header.record_count = 0;
+        Fixed_Format_Byte_Order::swap(header);
+        datagram.reserve(sizeof(Fixed_Format_Header) + d_max_records * sizeof(Record));
+        datagram.assign(reinterpret_cast<const char*>(&header), sizeof(header));
+        d_datagram = &datagram;
+        d_count = 0;
+    }
+
+    void append(Record record)
+    {
+        Fixed_Format_Byte_Order::swap(record);
+        d_datagram->append(reinterpret_cast<const char*>(&record), sizeof(Record));
+        d_count++;
+        uint32_t count = d_count;
+        Fixed_Format_Byte_Order::swap_field(count);
+        std::memcpy(&(*d_datagram)[offsetof(Fixed_Format_Header, record_count)], &count, sizeof(count));
+    }
+
+    bool is_open() const { return d_datagram != nullptr; }
+    bool full() const { return d_count >= d_max_records; }
+    void end() { d_datagram = nullptr; }
+
+private:
+    std::string* d_datagram{nullptr};
+    uint16_t d_record_type;
+    size_t d_max_records;
+    uint32_t d_count{0};
+};
+
+
+/*!
+ * \brief Validates a datagram and gives access to its records.
+ *
+ * The reader does not copy the datagram, which must outlive it.
+ */
+class Fixed_Format_Reader
+{
+public:
+    static bool has_magic(const char* data, size_t size)
+    {
+        return size >= sizeof(FIXED_FORMAT_MAGIC) && std::memcmp(data, FIXED_FORMAT_MAGIC, sizeof(FIXED_FORMAT_MAGIC)) == 0;
+    }
+
+    /*!
+     * \brief Returns false if the datagram is not in the fixed format, or if
+     * it is truncated
+     */
+    bool parse(const char* data, size_t size)
+    {
+        d_data = nullptr;
+        if (size < sizeof(Fixed_Format_Header) || !has_magic(data, size))
+            {
+                return false;
+            }
+        std::memcpy(&d_header, data, sizeof(d_header));
+        Fixed_Format_Byte_Order::swap(d_header);
+        if (d_header.version == 0 || d_header.header_size < sizeof(Fixed_Format_Header) || d_header.record_size == 0 ||
+            d_header.header_size > size || (size - d_header.header_size) / d_header.record_size < d_header.record_count)
+            {
+                return false;
+            }
+        d_data = data;
+        return true;
+    }
+
+    bool parse(const std::string& datagram)
+    {
+        return parse(datagram.data(), datagram.size());
+    }
+
+    uint16_t version() const { return d_header.version; }
+    uint16_t record_type() const { return d_header.record_type; }
+    size_t record_count() const { return d_data == nullptr ? 0 : d_header.record_count; }
+
+    bool get(size_t index, Gnss_Synchro_Record& record) const
+    {
+        return get_record(index, FIXED_FORMAT_GNSS_SYNCHRO, record);
+    }
+
+    bool get(size_t index, Monitor_Pvt_Record& record) const
+    {
+        return get_record(index, FIXED_FORMAT_MONITOR_PVT, record);
+    }
+
+private:
+    template <typename Record>
+    bool get_record(size_t index, uint16_t type, Record& record) const
+    {
+        // Records written by a newer version may be longer than the ones we know
+        if (index >= record_count() || d_header.record_type != type || d_header.record_size < sizeof(Record))
+            {
+                return false;
+            }
+        std::memcpy(&record, d_data + d_header.header_size + index * d_header.record_size, sizeof(Record));
+        Fixed_Format_Byte_Order::swap(record);
+        return true;
+    }
+
+    Fixed_Format_Header d_header{};
+    const char* d_data{nullptr};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MONITOR_FIXED_FORMAT_H
@@ -284,12 +284,13 @@ const int TROPOPT_COR = 5;   //!<    troposphere option: ZTD correction
 const int TROPOPT_CORG = 6;  //!<    troposphere option: ZTD+grad correction
 
 
-const int EPHOPT_BRDC = 0;    //!<    ephemeris option: broadcast ephemeris
-const int EPHOPT_PREC = 1;    //!<    ephemeris option: precise ephemeris
-const int EPHOPT_SBAS = 2;    //!<    ephemeris option: broadcast + SBAS
-const int EPHOPT_SSRAPC = 3;  //!<    ephemeris option: broadcast + SSR_APC
-const int EPHOPT_SSRCOM = 4;  //!<    ephemeris option: broadcast + SSR_COM
-const int EPHOPT_LEX = 5;     //!<    ephemeris option: QZSS LEX ephemeris
+const int EPHOPT_BRDC = 0;       //!<    ephemeris option: broadcast ephemeris
+const int EPHOPT_PREC = 1;       //!<    ephemeris option: precise ephemeris
+const int EPHOPT_SBAS = 2;       //!<    ephemeris option: broadcast + SBAS
+const int EPHOPT_SSRAPC = 3;     //!<    ephemeris option: broadcast + SSR_APC
+const int EPHOPT_SSRCOM = 4;     //!<    ephemeris option: broadcast + SSR_COM
+const int EPHOPT_LEX = 5;        //!<    ephemeris option: QZSS LEX ephemeris
+const int EPHOPT_BRDCCACHE = 6;  //!<    ephemeris option: broadcast ephemeris interpolated from cached nodes
 
 const double EFACT_GPS = 1.0;  //!<    error factor: GPS
 const double EFACT_GLO = 1.5;  //!<    error factor: GLONASS
@@ -744,6 +745,18 @@ typedef struct
 } pppcorr_t;
 
 
+typedef struct
+{                   /* satellite state cache type */
+    int sys;        /* navigation system of the nodes (0:empty) */
+    int iode;       /* IODE of the ephemeris used for the nodes */
+    gtime_t toe;    /* toe of the ephemeris used for the nodes */
+    double key[4];  /* ephemeris parameters used for the nodes */
+    gtime_t t0;     /* time of the first node (gpst) */
+    double x[2][8]; /* node states {x,y,z,vx,vy,vz,bias,drift} (m|m/s|s|s/s) */
+    double var;     /* sat position and clock error variance (m^2) */
+} satcache_t;
+
+
 typedef struct
 {                                 /* navigation data type */
     int n, nmax;                  /* number of broadcast ephemeris */
@@ -790,6 +803,8 @@ typedef struct
     lexeph_t lexeph[MAXSAT];      /* LEX ephemeris */
     lexion_t lexion;              /* LEX ionosphere correction */
     pppcorr_t pppcorr;            /* ppp corrections */
+    satcache_t *satcache;         /* satellite state cache {MAXSAT} (NULL: none) */
+    int *ephidx;                  /* index+1 in eph/geph of the only ephemeris of each satellite, 0: none {MAXSAT} (NULL: search) */
 } nav_t;
 
 
@@ -1057,6 +1072,16 @@ typedef struct
 } ambc_t;
 
 
+typedef struct
+{                       /* matrix workspace type */
+    double *buff;       /* preallocated buffer */
+    int size;           /* size of buffer (doubles) */
+    int used;           /* doubles in use */
+    int over;           /* doubles allocated on heap since last empty */
+    unsigned int nheap; /* number of heap allocations */
+} wksp_t;
+
+
 typedef struct
 {                           /* RTK control/result type */
     sol_t sol;              /* RTK solution */
@@ -1071,6 +1096,7 @@ typedef struct
     int neb;                /* bytes in error message buffer */
     char errbuf[MAXERRMSG]; /* error message buffer */
     prcopt_t opt;           /* processing options */
+    wksp_t *ws;             /* matrix workspace (NULL: heap) */
 } rtk_t;
 
 
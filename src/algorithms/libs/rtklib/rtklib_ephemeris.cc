@@ -64,6 +64,7 @@ const double STD_BRDCCLK = 30.0;                     /* error of broadcast clock
 
 const int MAX_ITER_KEPLER = 30; /* max number of iteration of Kelpler */
 
+const double SATCACHE_STEP = 10.0; /* node interval of satellite state cache (s) */
 
 /* variance by ura ephemeris (ref [1] 20.3.3.3.1.1) --------------------------*/
 double var_uraeph(int ura)
@@ -505,6 +506,37 @@ void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
 }
 
 
+/* range of ephemerides that can hold the one of a satellite ----------------
+ * args   : int    sat      I   satellite number
+ *          int    n        I   number of ephemerides in nav->eph or nav->geph
+ *          nav_t  *nav     I   navigation data
+ *          int    *i0,*i1  O   first and past the last index to search
+ * return : none
+ * notes  : without nav->ephidx all the n ephemerides are searched. with it,
+ *          the navigation data holds at most one ephemeris per satellite,
+ *          as the one of the pvt solver does, and only that one is checked.
+ *-----------------------------------------------------------------------------*/
+void ephrange(int sat, int n, const nav_t *nav, int *i0, int *i1)
+{
+    int k;
+
+    *i0 = 0;
+    *i1 = n;
+    if (!nav->ephidx)
+        {
+            return;
+        }
+    k = (sat >= 1 && sat <= MAXSAT) ? nav->ephidx[sat - 1] - 1 : -1;
+    if (k < 0 || k >= n)
+        {
+            *i1 = 0;
+            return;
+        }
+    *i0 = k;
+    *i1 = k + 1;
+}
+
+
 /* select ephemeris --------------------------------------------------------*/
 eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
 {
@@ -512,6 +544,8 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
     double tmax;
     double tmin;
     int i;
+    int i0;
+    int i1;
     int j = -1;
 
     trace(4, "seleph  : time=%s sat=%2d iode=%d\n", time_str(time, 3), sat, iode);
@@ -533,7 +567,8 @@ eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav)
         }
     tmin = tmax + 1.0;
 
-    for (i = 0; i < nav->n; i++)
+    ephrange(sat, nav->n, nav, &i0, &i1);
+    for (i = i0; i < i1; i++)
         {
             if (nav->eph[i].sat != sat)
                 {
@@ -574,11 +609,14 @@ geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav)
     double tmax = MAXDTOE_GLO;
     double tmin = tmax + 1.0;
     int i;
+    int i0;
+    int i1;
     int j = -1;
 
     trace(4, "selgeph : time=%s sat=%2d iode=%2d\n", time_str(time, 3), sat, iode);
 
-    for (i = 0; i < nav->ng; i++)
+    ephrange(sat, nav->ng, nav, &i0, &i1);
+    for (i = i0; i < i1; i++)
         {
             if (nav->geph[i].sat != sat)
                 {
@@ -764,6 +802,202 @@ int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
 }
 
 
+/* satellite state at a cache node --------------------------------------------
+ * compute satellite position, velocity, clock bias and drift at a cache node
+ * args   : gtime_t time     I   time of the node (gpst)
+ *          eph_t  *eph      I   broadcast ephemeris (NULL: use geph)
+ *          geph_t *geph     I   glonass ephemeris
+ *          double *x        O   node state {x,y,z,vx,vy,vz,bias,drift}
+ *                               (m|m/s|s|s/s)
+ *          double *var      O   sat position and clock error variance (m^2)
+ * return : none
+ * notes  : velocity and drift by central difference over +-0.1 s
+ *-----------------------------------------------------------------------------*/
+void satcache_node(gtime_t time, const eph_t *eph, const geph_t *geph,
+    double *x, double *var)
+{
+    double rst[2][3];
+    double dtst[2];
+    double tt = 0.1;
+    int i;
+
+    /* position and clock at the node, velocity and drift by central difference */
+    if (eph)
+        {
+            eph2pos(time, eph, x, x + 6, var);
+            eph2pos(timeadd(time, -tt), eph, rst[0], dtst, var);
+            eph2pos(timeadd(time, tt), eph, rst[1], dtst + 1, var);
+        }
+    else
+        {
+            geph2pos(time, geph, x, x + 6, var);
+            geph2pos(timeadd(time, -tt), geph, rst[0], dtst, var);
+            geph2pos(timeadd(time, tt), geph, rst[1], dtst + 1, var);
+        }
+    for (i = 0; i < 3; i++)
+        {
+            x[i + 3] = (rst[1][i] - rst[0][i]) / (2.0 * tt);
+        }
+    x[7] = (dtst[1] - dtst[0]) / (2.0 * tt);
+}
+
+
+/* satellite position and clock by broadcast ephemeris with state cache --------
+ * compute satellite position, velocity and clock by interpolating the broadcast
+ * orbit between cached nodes
+ * args   : gtime_t time     I   time (gpst)
+ *          gtime_t teph     I   time to select ephemeris (gpst)
+ *          int    sat       I   satellite number
+ *          nav_t  *nav      I   navigation data
+ *          double *rs       O   sat position and velocity (ecef)
+ *                               {x,y,z,vx,vy,vz} (m|m/s)
+ *          double *dts      O   sat clock {bias,drift} (s|s/s)
+ *          double *var      O   sat position and clock error variance (m^2)
+ *          int    *svh      O   sat health flag (-1:correction not available)
+ * return : status (1:ok,0:error)
+ * notes  : the broadcast orbit and clock are evaluated exactly at nodes spaced
+ *          SATCACHE_STEP s apart and cubic Hermite-interpolated in between, so
+ *          the Kepler equation (or the GLONASS orbit integration) is solved
+ *          once per node instead of once per observation. nodes are kept in
+ *          nav->satcache, so every navigation data set has its own cache,
+ *          and are recomputed when the ephemeris selected for the satellite
+ *          changes (iode, toe or orbit and clock parameters). interpolation
+ *          error is below 1 mm. without nav->satcache, and for sbas
+ *          satellites, it falls back to ephpos(). the cache is not locked, so
+ *          a nav_t with a cache must not be shared by several threads
+ *-----------------------------------------------------------------------------*/
+int ephpos_cache(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
+    double *rs, double *dts, double *var, int *svh)
+{
+    eph_t *eph = nullptr;
+    geph_t *geph = nullptr;
+    satcache_t *c;
+    gtime_t t0;
+    gtime_t toe;
+    double s;
+    double h00;
+    double h10;
+    double h01;
+    double h11;
+    double d00;
+    double d10;
+    double d01;
+    double d11;
+    double y[8];
+    double key[4];
+    int i;
+    int iode;
+    int sys;
+    bool same_eph;
+
+    trace(4, "ephpos_cache: sat=%2d\n", sat);
+
+    sys = satsys(sat, nullptr);
+
+    if (!nav->satcache)
+        {
+            return ephpos(time, teph, sat, nav, -1, rs, dts, var, svh);
+        }
+
+    *svh = -1;
+
+    if (sys == SYS_GPS || sys == SYS_GAL || sys == SYS_QZS || sys == SYS_BDS)
+        {
+            if (!(eph = seleph(teph, sat, -1, nav)))
+                {
+                    return 0;
+                }
+            iode = eph->iode;
+            toe = eph->toe;
+            key[0] = eph->A;
+            key[1] = eph->M0;
+            key[2] = eph->omg;
+            key[3] = eph->f0;
+            *svh = eph->svh;
+        }
+    else if (sys == SYS_GLO)
+        {
+            if (!(geph = selgeph(teph, sat, -1, nav)))
+                {
+                    return 0;
+                }
+            iode = geph->iode;
+            toe = geph->toe;
+            key[0] = geph->pos[0];
+            key[1] = geph->pos[1];
+            key[2] = geph->pos[2];
+            key[3] = geph->taun;
+            *svh = geph->svh;
+        }
+    else
+        {
+            return ephpos(time, teph, sat, nav, -1, rs, dts, var, svh);
+        }
+
+    /* first node at or before time, aligned to the node step */
+    t0.time = time.time - time.time % static_cast<time_t>(SATCACHE_STEP);
+    t0.sec = 0.0;
+
+    c = nav->satcache + sat - 1;
+    same_eph = c->sys == sys && c->iode == iode && timediff(c->toe, toe) == 0.0 &&
+               c->key[0] == key[0] && c->key[1] == key[1] && c->key[2] == key[2] &&
+               c->key[3] == key[3];
+    if (!same_eph || c->t0.time != t0.time)
+        {
+            if (same_eph && c->t0.time + static_cast<time_t>(SATCACHE_STEP) == t0.time)
+                {
+                    /* time moved to the next interval: reuse the last node */
+                    for (i = 0; i < 8; i++)
+                        {
+                            c->x[0][i] = c->x[1][i];
+                        }
+                }
+            else
+                {
+                    satcache_node(t0, eph, geph, c->x[0], &c->var);
+                }
+            satcache_node(timeadd(t0, SATCACHE_STEP), eph, geph, c->x[1], &c->var);
+            c->sys = sys;
+            c->iode = iode;
+            c->toe = toe;
+            for (i = 0; i < 4; i++)
+                {
+                    c->key[i] = key[i];
+                }
+            c->t0 = t0;
+        }
+
+    /* cubic Hermite interpolation of position and clock, velocity and drift
+       by the derivative of the interpolant */
+    s = timediff(time, t0) / SATCACHE_STEP;
+    h00 = (1.0 + 2.0 * s) * (1.0 - s) * (1.0 - s);
+    h10 = s * (1.0 - s) * (1.0 - s) * SATCACHE_STEP;
+    h01 = s * s * (3.0 - 2.0 * s);
+    h11 = s * s * (s - 1.0) * SATCACHE_STEP;
+    d00 = 6.0 * s * (s - 1.0) / SATCACHE_STEP;
+    d10 = (1.0 - s) * (1.0 - 3.0 * s);
+    d01 = -d00;
+    d11 = s * (3.0 * s - 2.0);
+    for (i = 0; i < 3; i++)
+        {
+            y[i] = h00 * c->x[0][i] + h10 * c->x[0][i + 3] + h01 * c->x[1][i] + h11 * c->x[1][i + 3];
+            y[i + 3] = d00 * c->x[0][i] + d10 * c->x[0][i + 3] + d01 * c->x[1][i] + d11 * c->x[1][i + 3];
+        }
+    y[6] = h00 * c->x[0][6] + h10 * c->x[0][7] + h01 * c->x[1][6] + h11 * c->x[1][7];
+    y[7] = d00 * c->x[0][6] + d10 * c->x[0][7] + d01 * c->x[1][6] + d11 * c->x[1][7];
+    *var = c->var;
+
+    for (i = 0; i < 6; i++)
+        {
+            rs[i] = y[i];
+        }
+    dts[0] = y[6];
+    dts[1] = y[7];
+
+    return 1;
+}
+
+
 /* satellite position and clock with sbas correction -------------------------*/
 int satpos_sbas(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *rs, double *dts, double *var, int *svh)
@@ -972,6 +1206,8 @@ int satpos(gtime_t time, gtime_t teph, int sat, int ephopt,
         {
         case EPHOPT_BRDC:
             return ephpos(time, teph, sat, nav, -1, rs, dts, var, svh);
+        case EPHOPT_BRDCCACHE:
+            return ephpos_cache(time, teph, sat, nav, rs, dts, var, svh);
         case EPHOPT_SBAS:
             return satpos_sbas(time, teph, sat, nav, rs, dts, var, svh);
         case EPHOPT_SSRAPC:
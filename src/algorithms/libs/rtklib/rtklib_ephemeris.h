@@ -52,6 +52,8 @@ void geph2pos(gtime_t time, const geph_t *geph, double *rs, double *dts,
 double seph2clk(gtime_t time, const seph_t *seph);
 void seph2pos(gtime_t time, const seph_t *seph, double *rs, double *dts,
     double *var);
+// range of the n entries of eph or geph that can hold the ephemeris of a satellite
+void ephrange(int sat, int n, const nav_t *nav, int *i0, int *i1);
 eph_t *seleph(gtime_t time, int sat, int iode, const nav_t *nav);
 geph_t *selgeph(gtime_t time, int sat, int iode, const nav_t *nav);
 seph_t *selseph(gtime_t time, int sat, const nav_t *nav);
@@ -60,6 +62,12 @@ int ephclk(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
 // satellite position and clock by broadcast ephemeris
 int ephpos(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     int iode, double *rs, double *dts, double *var, int *svh);
+// satellite position, velocity, clock bias and drift at a node of the satellite state cache
+void satcache_node(gtime_t time, const eph_t *eph, const geph_t *geph,
+    double *x, double *var);
+// satellite position and clock by broadcast ephemeris interpolated between cached nodes
+int ephpos_cache(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
+    double *rs, double *dts, double *var, int *svh);
 int satpos_sbas(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
     double *rs, double *dts, double *var, int *svh);
 int satpos_ssr(gtime_t time, gtime_t teph, int sat, const nav_t *nav,
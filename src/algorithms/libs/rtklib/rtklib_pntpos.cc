@@ -602,7 +602,7 @@ int valsol(const double *azel, const int *vsat, int n,
 int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
     const double *vare, const int *svh, const nav_t *nav,
     const prcopt_t *opt, sol_t *sol, double *azel, int *vsat,
-    double *resp, char *msg)
+    double *resp, char *msg, wksp_t *ws)
 {
     double x[NX] = {0};
     double dx[NX];
@@ -618,13 +618,14 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
     int stat;
     int nv;
     int ns;
+    int mark = wsmark(ws);
     char msg_aux[128];
 
     trace(3, "estpos  : n=%d\n", n);
 
-    v = mat(n + 4, 1);
-    H = mat(NX, n + 4);
-    var = mat(n + 4, 1);
+    v = wsmat(ws, n + 4, 1);
+    H = wsmat(ws, NX, n + 4);
+    var = wsmat(ws, n + 4, 1);
 
     for (i = 0; i < 3; i++)
         {
@@ -652,7 +653,7 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
                         }
                 }
             /* least square estimation */
-            if ((info = lsq(H, v, NX, nv, dx, Q)))
+            if ((info = lsq(H, v, NX, nv, dx, Q, ws)))
                 {
                     std::snprintf(msg_aux, sizeof(msg_aux), "lsq error info=%d", info);
                     break;
@@ -689,9 +690,10 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
                         {
                             sol->stat = opt->sateph == EPHOPT_SBAS ? SOLQ_SBAS : SOLQ_SINGLE;
                         }
-                    free(v);
-                    free(H);
-                    free(var);
+                    wsdel(ws, v);
+                    wsdel(ws, H);
+                    wsdel(ws, var);
+                    wsrelease(ws, mark);
                     msg = msg_aux;
                     return stat;
                 }
@@ -701,9 +703,10 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
             std::snprintf(msg_aux, sizeof(msg_aux), "iteration divergent i=%d", i);
         }
 
-    free(v);
-    free(H);
-    free(var);
+    wsdel(ws, v);
+    wsdel(ws, H);
+    wsdel(ws, var);
+    wsrelease(ws, mark);
     msg = msg_aux;
 
     return 0;
@@ -714,7 +717,7 @@ int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
 int raim_fde(const obsd_t *obs, int n, const double *rs,
     const double *dts, const double *vare, const int *svh,
     const nav_t *nav, const prcopt_t *opt, sol_t *sol,
-    double *azel, int *vsat, double *resp, char *msg)
+    double *azel, int *vsat, double *resp, char *msg, wksp_t *ws)
 {
     obsd_t *obs_e;
     sol_t sol_e = {{0, 0}, {}, {}, {}, '0', '0', '0', 0.0, 0.0, 0.0};
@@ -736,6 +739,7 @@ int raim_fde(const obsd_t *obs, int n, const double *rs,
     int *svh_e;
     int *vsat_e;
     int sat = 0;
+    int mark = wsmark(ws);
 
     trace(3, "raim_fde: %s n=%2d\n", time_str(obs[0].time, 0), n);
 
@@ -743,13 +747,13 @@ int raim_fde(const obsd_t *obs, int n, const double *rs,
         {
             return 0;
         }
-    rs_e = mat(6, n);
-    dts_e = mat(2, n);
-    vare_e = mat(1, n);
-    azel_e = zeros(2, n);
-    svh_e = imat(1, n);
-    vsat_e = imat(1, n);
-    resp_e = mat(1, n);
+    rs_e = wsmat(ws, 6, n);
+    dts_e = wsmat(ws, 2, n);
+    vare_e = wsmat(ws, 1, n);
+    azel_e = wszeros(ws, 2, n);
+    svh_e = wsimat(ws, 1, n);
+    vsat_e = wsimat(ws, 1, n);
+    resp_e = wsmat(ws, 1, n);
 
     for (i = 0; i < n; i++)
         {
@@ -768,7 +772,7 @@ int raim_fde(const obsd_t *obs, int n, const double *rs,
                 }
             /* estimate receiver position without a satellite */
             if (!estpos(obs_e, n - 1, rs_e, dts_e, vare_e, svh_e, nav, opt, &sol_e, azel_e,
-                    vsat_e, resp_e, msg_e))
+                    vsat_e, resp_e, msg_e, ws))
                 {
                     trace(3, "raim_fde: exsat=%2d (%s)\n", obs[i].sat, msg);
                     continue;
@@ -822,13 +826,14 @@ int raim_fde(const obsd_t *obs, int n, const double *rs,
             trace(2, "%s: %s excluded by raim\n", tstr + 11, name);
         }
     free(obs_e);
-    free(rs_e);
-    free(dts_e);
-    free(vare_e);
-    free(azel_e);
-    free(svh_e);
-    free(vsat_e);
-    free(resp_e);
+    wsdel(ws, rs_e);
+    wsdel(ws, dts_e);
+    wsdel(ws, vare_e);
+    wsdel(ws, azel_e);
+    wsdel(ws, svh_e);
+    wsdel(ws, vsat_e);
+    wsdel(ws, resp_e);
+    wsrelease(ws, mark);
 
     return stat;
 }
@@ -911,7 +916,7 @@ int resdop(const obsd_t *obs, int n, const double *rs, const double *dts,
 /* estimate receiver velocity ------------------------------------------------*/
 void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
     const nav_t *nav, const prcopt_t *opt __attribute__((unused)), sol_t *sol,
-    const double *azel, const int *vsat)
+    const double *azel, const int *vsat, wksp_t *ws)
 {
     double x[4] = {0};
     double dx[4];
@@ -921,11 +926,12 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
     int i;
     int j;
     int nv;
+    int mark = wsmark(ws);
 
     trace(3, "estvel  : n=%d\n", n);
 
-    v = mat(n, 1);
-    H = mat(4, n);
+    v = wsmat(ws, n, 1);
+    H = wsmat(ws, 4, n);
 
     for (i = 0; i < MAXITR; i++)
         {
@@ -935,7 +941,7 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
                     break;
                 }
             /* least square estimation */
-            if (lsq(H, v, 4, nv, dx, Q))
+            if (lsq(H, v, 4, nv, dx, Q, ws))
                 {
                     break;
                 }
@@ -955,8 +961,9 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
                     break;
                 }
         }
-    free(v);
-    free(H);
+    wsdel(ws, v);
+    wsdel(ws, H);
+    wsrelease(ws, mark);
 }
 
 
@@ -971,6 +978,7 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
  *          double *azel     IO  azimuth/elevation angle (rad) (NULL: no output)
  *          ssat_t *ssat     IO  satellite status              (NULL: no output)
  *          char   *msg      O   error message for error exit
+ *          wksp_t *ws       IO  matrix workspace (NULL: heap)
  * return : status(1:ok,0:error)
  * notes  : assuming sbas-gps, galileo-gps, qzss-gps, compass-gps time offset and
  *          receiver bias are negligible (only involving glonass-gps time offset
@@ -978,7 +986,7 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
  *-----------------------------------------------------------------------------*/
 int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     const prcopt_t *opt, sol_t *sol, double *azel, ssat_t *ssat,
-    char *msg)
+    char *msg, wksp_t *ws)
 {
     prcopt_t opt_ = *opt;
     double *rs;
@@ -990,6 +998,7 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     int stat;
     int vsat[MAXOBS] = {0};
     int svh[MAXOBS];
+    int mark = wsmark(ws);
 
     sol->stat = SOLQ_NONE;
 
@@ -1004,11 +1013,11 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     sol->time = obs[0].time;
     msg[0] = '\0';
 
-    rs = mat(6, n);
-    dts = mat(2, n);
-    var = mat(1, n);
-    azel_ = zeros(2, n);
-    resp = mat(1, n);
+    rs = wsmat(ws, 6, n);
+    dts = wsmat(ws, 2, n);
+    var = wsmat(ws, 1, n);
+    azel_ = wszeros(ws, 2, n);
+    resp = wsmat(ws, 1, n);
 
     if (opt_.mode != PMODE_SINGLE)
         { /* for precise positioning */
@@ -1022,17 +1031,17 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     satposs(sol->time, obs, n, nav, opt_.sateph, rs, dts, var, svh);
 
     /* estimate receiver position with pseudorange */
-    stat = estpos(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg);
+    stat = estpos(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg, ws);
 
     /* raim fde */
     if (!stat && n >= 6 && opt->posopt[4])
         {
-            stat = raim_fde(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg);
+            stat = raim_fde(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg, ws);
         }
     /* estimate receiver velocity with doppler */
     if (stat)
         {
-            estvel(obs, n, rs, dts, nav, &opt_, sol, azel_, vsat);
+            estvel(obs, n, rs, dts, nav, &opt_, sol, azel_, vsat, ws);
         }
 
     if (azel)
@@ -1064,10 +1073,84 @@ int pntpos(const obsd_t *obs, int n, const nav_t *nav,
                     ssat[obs[i].sat - 1].resp[0] = resp[i];
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
-    free(azel_);
-    free(resp);
+    wsdel(ws, rs);
+    wsdel(ws, dts);
+    wsdel(ws, var);
+    wsdel(ws, azel_);
+    wsdel(ws, resp);
+    wsrelease(ws, mark);
+    return stat;
+}
+
+
+/* single-point receiver clock -------------------------------------------------
+ * compute receiver position and clock bias by single-point positioning with
+ * pseudorange observables, skipping the doppler velocity estimation and the
+ * satellite status output of pntpos()
+ * args   : obsd_t *obs      I   observation data
+ *          int    n         I   number of observation data
+ *          nav_t  *nav      I   navigation data
+ *          prcopt_t *opt    I   processing options
+ *          sol_t  *sol      IO  solution (velocity and clock drift not updated)
+ *          char   *msg      O   error message for error exit
+ *          wksp_t *ws       IO  matrix workspace (NULL: heap)
+ * return : status(1:ok,0:error)
+ * notes  : position and clock bias are the same as the ones of pntpos()
+ *-----------------------------------------------------------------------------*/
+int pntclk(const obsd_t *obs, int n, const nav_t *nav,
+    const prcopt_t *opt, sol_t *sol, char *msg, wksp_t *ws)
+{
+    prcopt_t opt_ = *opt;
+    double *rs;
+    double *dts;
+    double *var;
+    double *azel_;
+    double *resp;
+    int stat;
+    int vsat[MAXOBS] = {0};
+    int svh[MAXOBS];
+    int mark = wsmark(ws);
+
+    sol->stat = SOLQ_NONE;
+
+    if (n <= 0)
+        {
+            std::strncpy(msg, "no observation data", 20);
+            return 0;
+        }
+
+    trace(3, "pntclk  : n=%d\n", n);
+
+    sol->time = obs[0].time;
+    msg[0] = '\0';
+
+    rs = wsmat(ws, 6, n);
+    dts = wsmat(ws, 2, n);
+    var = wsmat(ws, 1, n);
+    azel_ = wszeros(ws, 2, n);
+    resp = wsmat(ws, 1, n);
+
+    if (opt_.mode != PMODE_SINGLE)
+        { /* for precise positioning */
+            opt_.ionoopt = IONOOPT_BRDC;
+            opt_.tropopt = TROPOPT_SAAS;
+        }
+    /* satellite positions, velocities and clocks */
+    satposs(sol->time, obs, n, nav, opt_.sateph, rs, dts, var, svh);
+
+    /* estimate receiver position and clock with pseudorange */
+    stat = estpos(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg, ws);
+
+    /* raim fde */
+    if (!stat && n >= 6 && opt->posopt[4])
+        {
+            stat = raim_fde(obs, n, rs, dts, var, svh, nav, &opt_, sol, azel_, vsat, resp, msg, ws);
+        }
+    wsdel(ws, rs);
+    wsdel(ws, dts);
+    wsdel(ws, var);
+    wsdel(ws, azel_);
+    wsdel(ws, resp);
+    wsrelease(ws, mark);
     return stat;
 }
@@ -103,13 +103,13 @@ int valsol(const double *azel, const int *vsat, int n,
 int estpos(const obsd_t *obs, int n, const double *rs, const double *dts,
     const double *vare, const int *svh, const nav_t *nav,
     const prcopt_t *opt, sol_t *sol, double *azel, int *vsat,
-    double *resp, char *msg);
+    double *resp, char *msg, wksp_t *ws);
 
 /* raim fde (failure detection and exclution) -------------------------------*/
 int raim_fde(const obsd_t *obs, int n, const double *rs,
     const double *dts, const double *vare, const int *svh,
     const nav_t *nav, const prcopt_t *opt, sol_t *sol,
-    double *azel, int *vsat, double *resp, char *msg);
+    double *azel, int *vsat, double *resp, char *msg, wksp_t *ws);
 
 /* doppler residuals ---------------------------------------------------------*/
 int resdop(const obsd_t *obs, int n, const double *rs, const double *dts,
@@ -119,7 +119,7 @@ int resdop(const obsd_t *obs, int n, const double *rs, const double *dts,
 /* estimate receiver velocity ------------------------------------------------*/
 void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
     const nav_t *nav, const prcopt_t *opt, sol_t *sol,
-    const double *azel, const int *vsat);
+    const double *azel, const int *vsat, wksp_t *ws);
 
 /*!
  * \brief single-point positioning
@@ -133,6 +133,7 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
  *          double *azel     IO  azimuth/elevation angle (rad) (NULL: no output)
  *          ssat_t *ssat     IO  satellite status              (NULL: no output)
  *          char   *msg      O   error message for error exit
+ *          wksp_t *ws       IO  matrix workspace (NULL: heap)
  * return : status(1:ok,0:error)
  * notes  : assuming sbas-gps, galileo-gps, qzss-gps, compass-gps time offset and
  *          receiver bias are negligible (only involving glonass-gps time offset
@@ -140,6 +141,13 @@ void estvel(const obsd_t *obs, int n, const double *rs, const double *dts,
  */
 int pntpos(const obsd_t *obs, int n, const nav_t *nav,
     const prcopt_t *opt, sol_t *sol, double *azel, ssat_t *ssat,
-    char *msg);
+    char *msg, wksp_t *ws);
+
+/*!
+ * \brief single-point receiver clock: same position and clock bias as pntpos,
+ * without Doppler velocity estimation nor satellite status output
+ */
+int pntclk(const obsd_t *obs, int n, const nav_t *nav,
+    const prcopt_t *opt, sol_t *sol, char *msg, wksp_t *ws);
 
 #endif  // GNSS_SDR_RTKLIB_PNTPOS_H
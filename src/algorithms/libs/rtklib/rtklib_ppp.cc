@@ -402,9 +402,9 @@ int fix_sol(rtk_t *rtk, const int *sat1, const int *sat2,
             return 0;
         }
 
-    v = zeros(n, 1);
-    H = zeros(rtk->nx, n);
-    R = zeros(n, n);
+    v = wszeros(rtk->ws, n, 1);
+    H = wszeros(rtk->ws, rtk->nx, n);
+    R = wszeros(rtk->ws, n, n);
 
     /* constraints to fixed ambiguities */
     for (i = 0; i < n; i++)
@@ -417,12 +417,12 @@ int fix_sol(rtk_t *rtk, const int *sat1, const int *sat2,
             R[i + i * n] = std::pow(CONST_AMB, 2.0);
         }
     /* update states with constraints */
-    if ((info = filter(rtk->x, rtk->P, H, v, R, rtk->nx, n)))
+    if ((info = filter(rtk->x, rtk->P, H, v, R, rtk->nx, n, rtk->ws)))
         {
             trace(1, "filter error (info=%d)\n", info);
-            free(v);
-            free(H);
-            free(R);
+            wsdel(rtk->ws, v);
+            wsdel(rtk->ws, H);
+            wsdel(rtk->ws, R);
             return 0;
         }
     /* set solution */
@@ -440,9 +440,9 @@ int fix_sol(rtk_t *rtk, const int *sat1, const int *sat2,
             rtk->ambc[sat1[i] - 1].flags[sat2[i] - 1] = 1;
             rtk->ambc[sat2[i] - 1].flags[sat1[i] - 1] = 1;
         }
-    free(v);
-    free(H);
-    free(R);
+    wsdel(rtk->ws, v);
+    wsdel(rtk->ws, H);
+    wsdel(rtk->ws, R);
     return 1;
 }
 
@@ -1783,13 +1783,14 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     int info;
     int svh[MAXOBS];
     int stat = SOLQ_SINGLE;
+    int mark = wsmark(rtk->ws);
 
     trace(3, "pppos   : nx=%d n=%d\n", rtk->nx, n);
 
-    rs = mat(6, n);
-    dts = mat(2, n);
-    var = mat(1, n);
-    azel = zeros(2, n);
+    rs = wsmat(rtk->ws, 6, n);
+    dts = wsmat(rtk->ws, 2, n);
+    var = wsmat(rtk->ws, 1, n);
+    azel = wszeros(rtk->ws, 2, n);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -1810,13 +1811,13 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
         {
             testeclipse(obs, n, nav, rs);
         }
-    xp = mat(rtk->nx, 1);
-    Pp = zeros(rtk->nx, rtk->nx);
+    xp = wsmat(rtk->ws, rtk->nx, 1);
+    Pp = wszeros(rtk->ws, rtk->nx, rtk->nx);
     matcpy(xp, rtk->x, rtk->nx, 1);
     nv = n * rtk->opt.nf * 2;
-    v = mat(nv, 1);
-    H = mat(rtk->nx, nv);
-    R = mat(nv, nv);
+    v = wsmat(rtk->ws, nv, 1);
+    H = wsmat(rtk->ws, rtk->nx, nv);
+    R = wsmat(rtk->ws, nv, nv);
 
     for (i = 0; i < rtk->opt.niter; i++)
         {
@@ -1829,7 +1830,7 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
             /* measurement update */
             matcpy(Pp, rtk->P, rtk->nx, rtk->nx);
 
-            if ((info = filter(xp, Pp, H, v, R, rtk->nx, nv)))
+            if ((info = filter(xp, Pp, H, v, R, rtk->nx, nv, rtk->ws)))
                 {
                     trace(2, "ppp filter error %s info=%d\n", time_str(rtk->sol.time, 0), info);
                     break;
@@ -1893,13 +1894,14 @@ void pppos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
                         }
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
-    free(azel);
-    free(xp);
-    free(Pp);
-    free(v);
-    free(H);
-    free(R);
+    wsdel(rtk->ws, rs);
+    wsdel(rtk->ws, dts);
+    wsdel(rtk->ws, var);
+    wsdel(rtk->ws, azel);
+    wsdel(rtk->ws, xp);
+    wsdel(rtk->ws, Pp);
+    wsdel(rtk->ws, v);
+    wsdel(rtk->ws, H);
+    wsdel(rtk->ws, R);
+    wsrelease(rtk->ws, mark);
 }
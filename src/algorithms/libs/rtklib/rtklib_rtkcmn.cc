@@ -31,6 +31,7 @@
 
 #include "rtklib_rtkcmn.h"
 #include <glog/logging.h>
+#include <algorithm>
 #include <cassert>
 #include <cstring>
 #include <dirent.h>
@@ -1050,6 +1051,170 @@ double *eye(int n)
 }
 
 
+/* matrix workspace ------------------------------------------------------------
+ * the positioning routines take their temporary matrices from a preallocated
+ * buffer in stack order instead of the heap. a routine takes a mark with
+ * wsmark() on entry and gives back everything allocated after it with
+ * wsrelease() on exit. requests that do not fit in the buffer fall back to the
+ * heap, and the buffer is enlarged by that amount when it is released to empty,
+ * so the steady state does not allocate. all the functions accept a NULL
+ * workspace, meaning plain heap allocation (mat()/free())
+ *-----------------------------------------------------------------------------*/
+
+/* initialize workspace --------------------------------------------------------
+ * args   : wksp_t *ws       O   workspace
+ *          int    size      I   initial size of buffer (doubles)
+ * return : none
+ *-----------------------------------------------------------------------------*/
+void wsinit(wksp_t *ws, int size)
+{
+    ws->buff = mat(size, 1);
+    ws->size = ws->buff ? size : 0;
+    ws->used = ws->over = 0;
+    ws->nheap = 0;
+}
+
+
+/* free workspace buffer -------------------------------------------------------*/
+void wsfree(wksp_t *ws)
+{
+    free(ws->buff);
+    ws->buff = nullptr;
+    ws->size = ws->used = ws->over = 0;
+}
+
+
+/* take doubles from workspace (NULL: does not fit) ---------------------------
+ * blocks are kept 16-byte aligned like the ones returned by malloc()
+ *-----------------------------------------------------------------------------*/
+static double *wsget(wksp_t *ws, int n)
+{
+    double *p;
+
+    n = (n + 1) & ~1;
+
+    if (ws->used + n > ws->size)
+        {
+            ws->over += n;
+            ws->nheap++;
+            return nullptr;
+        }
+    p = ws->buff + ws->used;
+    ws->used += n;
+    return p;
+}
+
+
+/* new matrix in workspace -----------------------------------------------------
+ * same as mat() but taken from workspace ws
+ *-----------------------------------------------------------------------------*/
+double *wsmat(wksp_t *ws, int n, int m)
+{
+    double *p;
+
+    if (!ws || n <= 0 || m <= 0 || !(p = wsget(ws, n * m)))
+        {
+            return mat(n, m);
+        }
+    return p;
+}
+
+
+/* new integer matrix in workspace ---------------------------------------------
+ * same as imat() but taken from workspace ws
+ *-----------------------------------------------------------------------------*/
+int *wsimat(wksp_t *ws, int n, int m)
+{
+    double *p;
+
+    if (!ws || n <= 0 || m <= 0 ||
+        !(p = wsget(ws, static_cast<int>((sizeof(int) * n * m + sizeof(double) - 1) / sizeof(double)))))
+        {
+            return imat(n, m);
+        }
+    return reinterpret_cast<int *>(p);
+}
+
+
+/* zero matrix in workspace ----------------------------------------------------
+ * same as zeros() but taken from workspace ws
+ *-----------------------------------------------------------------------------*/
+double *wszeros(wksp_t *ws, int n, int m)
+{
+    double *p;
+
+    if (!ws || n <= 0 || m <= 0 || !(p = wsget(ws, n * m)))
+        {
+            return zeros(n, m);
+        }
+    std::fill_n(p, n * m, 0.0);
+    return p;
+}
+
+
+/* identity matrix in workspace ------------------------------------------------
+ * same as eye() but taken from workspace ws
+ *-----------------------------------------------------------------------------*/
+double *wseye(wksp_t *ws, int n)
+{
+    double *p;
+    int i;
+
+    if ((p = wszeros(ws, n, n)))
+        {
+            for (i = 0; i < n; i++)
+                {
+                    p[i + i * n] = 1.0;
+                }
+        }
+    return p;
+}
+
+
+/* delete matrix of workspace --------------------------------------------------
+ * free matrix p if it was allocated on the heap. matrices in the workspace
+ * buffer are given back by wsrelease()
+ *-----------------------------------------------------------------------------*/
+void wsdel(wksp_t *ws, void *p)
+{
+    if (ws && ws->buff && static_cast<double *>(p) >= ws->buff &&
+        static_cast<double *>(p) < ws->buff + ws->size)
+        {
+            return;
+        }
+    free(p);
+}
+
+
+/* workspace mark --------------------------------------------------------------*/
+int wsmark(const wksp_t *ws)
+{
+    return ws ? ws->used : 0;
+}
+
+
+/* release workspace -----------------------------------------------------------
+ * give back the matrices allocated after mark. when released to empty, the
+ * buffer grows to fit the requests that fell back to the heap
+ *-----------------------------------------------------------------------------*/
+void wsrelease(wksp_t *ws, int mark)
+{
+    if (!ws)
+        {
+            return;
+        }
+    ws->used = mark;
+    if (mark == 0 && ws->over > 0)
+        {
+            trace(3, "wsrelease: workspace size=%d grows by %d\n", ws->size, ws->over);
+            free(ws->buff);
+            ws->buff = mat(ws->size + ws->over, 1);
+            ws->size = ws->buff ? ws->size + ws->over : 0;
+            ws->over = 0;
+        }
+}
+
+
 /* inner product ---------------------------------------------------------------
  * inner product of vectors
  * args   : double *a,*b     I   vector a,b (n x 1)
@@ -1157,20 +1322,31 @@ void matmul(const char *tr, int n, int k, int m, double alpha,
  * return : status (0:ok,0>:error)
  *-----------------------------------------------------------------------------*/
 int matinv(double *A, int n)
+{
+    return wsmatinv(nullptr, A, n);
+}
+
+
+/* inverse of matrix in workspace ----------------------------------------------
+ * same as matinv() with work arrays taken from workspace ws
+ *-----------------------------------------------------------------------------*/
+int wsmatinv(wksp_t *ws, double *A, int n)
 {
     double *work;
     int info;
     int lwork = n * 16;
-    int *ipiv = imat(n, 1);
+    int mark = wsmark(ws);
+    int *ipiv = wsimat(ws, n, 1);
 
-    work = mat(lwork, 1);
+    work = wsmat(ws, lwork, 1);
     dgetrf_(&n, &n, A, &n, ipiv, &info);
     if (!info)
         {
             dgetri_(&n, A, &n, ipiv, work, &lwork, &info);
         }
-    free(ipiv);
-    free(work);
+    wsdel(ws, ipiv);
+    wsdel(ws, work);
+    wsrelease(ws, mark);
     return info;
 }
 
@@ -1215,28 +1391,32 @@ int solve(const char *tr, const double *A, const double *Y, int n,
  *          int    n,m       I   number of parameters and measurements (n <= m)
  *          double *x        O   estmated parameters (n x 1)
  *          double *Q        O   esimated parameters covariance matrix (n x n)
+ *          wksp_t *ws       IO  matrix workspace (NULL: heap)
  * return : status (0:ok,0>:error)
  * notes  : for weighted least square, replace A and y by A*w and w*y (w=W^(1/2))
  *          matirix stored by column-major order (fortran convention)
  *-----------------------------------------------------------------------------*/
 int lsq(const double *A, const double *y, int n, int m, double *x,
-    double *Q)
+    double *Q, wksp_t *ws)
 {
     double *Ay;
     int info;
+    int mark;
 
     if (m < n)
         {
             return -1;
         }
-    Ay = mat(n, 1);
+    mark = wsmark(ws);
+    Ay = wsmat(ws, n, 1);
     matmul("NN", n, 1, m, 1.0, A, y, 0.0, Ay); /* Ay=A*y */
     matmul("NT", n, n, m, 1.0, A, A, 0.0, Q);  /* Q=A*A' */
-    if (!(info = matinv(Q, n)))
+    if (!(info = wsmatinv(ws, Q, n)))
         {
             matmul("NN", n, 1, n, 1.0, Q, Ay, 0.0, x); /* x=Q^-1*Ay */
         }
-    free(Ay);
+    wsdel(ws, Ay);
+    wsrelease(ws, mark);
     return info;
 }
 
@@ -1254,41 +1434,44 @@ int lsq(const double *A, const double *y, int n, int m, double *x,
  *          int    n,m       I   number of states and measurements
  *          double *xp       O   states vector after update (n x 1)
  *          double *Pp       O   covariance matrix of states after update (n x n)
+ *          wksp_t *ws       IO  matrix workspace (NULL: heap)
  * return : status (0:ok,<0:error)
  * notes  : matirix stored by column-major order (fortran convention)
  *          if state x[i]==0.0, not updates state x[i]/P[i+i*n]
  *-----------------------------------------------------------------------------*/
 int filter_(const double *x, const double *P, const double *H,
     const double *v, const double *R, int n, int m,
-    double *xp, double *Pp)
+    double *xp, double *Pp, wksp_t *ws)
 {
-    double *F = mat(n, m);
-    double *Q = mat(m, m);
-    double *K = mat(n, m);
-    double *I = eye(n);
+    int mark = wsmark(ws);
+    double *F = wsmat(ws, n, m);
+    double *Q = wsmat(ws, m, m);
+    double *K = wsmat(ws, n, m);
+    double *I = wseye(ws, n);
     int info;
 
     matcpy(Q, R, m, m);
     matcpy(xp, x, n, 1);
     matmul("NN", n, m, n, 1.0, P, H, 0.0, F); /* Q=H'*P*H+R */
     matmul("TN", m, m, n, 1.0, H, F, 1.0, Q);
-    if (!(info = matinv(Q, m)))
+    if (!(info = wsmatinv(ws, Q, m)))
         {
             matmul("NN", n, m, m, 1.0, F, Q, 0.0, K);  /* K=P*H*Q^-1 */
             matmul("NN", n, 1, m, 1.0, K, v, 1.0, xp); /* xp=x+K*v */
             matmul("NT", n, n, m, -1.0, K, H, 1.0, I); /* Pp=(I-K*H')*P */
             matmul("NN", n, n, n, 1.0, I, P, 0.0, Pp);
         }
-    free(F);
-    free(Q);
-    free(K);
-    free(I);
+    wsdel(ws, F);
+    wsdel(ws, Q);
+    wsdel(ws, K);
+    wsdel(ws, I);
+    wsrelease(ws, mark);
     return info;
 }
 
 
 int filter(double *x, double *P, const double *H, const double *v,
-    const double *R, int n, int m)
+    const double *R, int n, int m, wksp_t *ws)
 {
     double *x_;
     double *xp_;
@@ -1299,9 +1482,10 @@ int filter(double *x, double *P, const double *H, const double *v,
     int j;
     int k;
     int info;
+    int mark = wsmark(ws);
     int *ix;
 
-    ix = imat(n, 1);
+    ix = wsimat(ws, n, 1);
     for (i = k = 0; i < n; i++)
         {
             if (x[i] != 0.0 && P[i + i * n] > 0.0)
@@ -1309,18 +1493,11 @@ int filter(double *x, double *P, const double *H, const double *v,
                     ix[k++] = i;
                 }
         }
-    x_ = mat(k, 1);
-    xp_ = mat(k, 1);
-    P_ = mat(k, k);
-    Pp_ = mat(k, k);
-    for (i = 0; i < k; i++)
-        {
-            for (j = 0; j < k; j++)
-                {
-                    Pp_[i * k + j] = 0.0;
-                }
-        }
-    H_ = mat(k, m);
+    x_ = wsmat(ws, k, 1);
+    xp_ = wsmat(ws, k, 1);
+    P_ = wsmat(ws, k, k);
+    Pp_ = wszeros(ws, k, k);
+    H_ = wsmat(ws, k, m);
     for (i = 0; i < k; i++)
         {
             x_[i] = x[ix[i]];
@@ -1333,7 +1510,7 @@ int filter(double *x, double *P, const double *H, const double *v,
                     H_[i + j * k] = H[ix[i] + j * n];
                 }
         }
-    info = filter_(x_, P_, H_, v, R, k, m, xp_, Pp_);
+    info = filter_(x_, P_, H_, v, R, k, m, xp_, Pp_, ws);
     for (i = 0; i < k; i++)
         {
             x[ix[i]] = xp_[i];
@@ -1342,12 +1519,13 @@ int filter(double *x, double *P, const double *H, const double *v,
                     P[ix[i] + ix[j] * n] = Pp_[i + j * k];
                 }
         }
-    free(ix);
-    free(x_);
-    free(xp_);
-    free(P_);
-    free(Pp_);
-    free(H_);
+    wsdel(ws, ix);
+    wsdel(ws, x_);
+    wsdel(ws, xp_);
+    wsdel(ws, P_);
+    wsdel(ws, Pp_);
+    wsdel(ws, H_);
+    wsrelease(ws, mark);
     return info;
 }
 
@@ -121,6 +121,15 @@ double *mat(int n, int m);
 int *imat(int n, int m);
 double *zeros(int n, int m);
 double *eye(int n);
+void wsinit(wksp_t *ws, int size);
+void wsfree(wksp_t *ws);
+double *wsmat(wksp_t *ws, int n, int m);
+int *wsimat(wksp_t *ws, int n, int m);
+double *wszeros(wksp_t *ws, int n, int m);
+double *wseye(wksp_t *ws, int n);
+void wsdel(wksp_t *ws, void *p);
+int wsmark(const wksp_t *ws);
+void wsrelease(wksp_t *ws, int mark);
 double dot(const double *a, const double *b, int n);
 double norm_rtk(const double *a, int n);
 void cross3(const double *a, const double *b, double *c);
@@ -129,15 +138,16 @@ void matcpy(double *A, const double *B, int n, int m);
 void matmul(const char *tr, int n, int k, int m, double alpha,
     const double *A, const double *B, double beta, double *C);
 int matinv(double *A, int n);
+int wsmatinv(wksp_t *ws, double *A, int n);
 int solve(const char *tr, const double *A, const double *Y, int n,
     int m, double *X);
 int lsq(const double *A, const double *y, int n, int m, double *x,
-    double *Q);
+    double *Q, wksp_t *ws);
 int filter_(const double *x, const double *P, const double *H,
     const double *v, const double *R, int n, int m,
-    double *xp, double *Pp);
+    double *xp, double *Pp, wksp_t *ws);
 int filter(double *x, double *P, const double *H, const double *v,
-    const double *R, int n, int m);
+    const double *R, int n, int m, wksp_t *ws);
 int smoother(const double *xf, const double *Qf, const double *xb,
     const double *Qb, int n, double *xs, double *Qs);
 void matfprint(const double A[], int n, int m, int p, int q, FILE *fp);
@@ -731,9 +731,9 @@ void udpos(rtk_t *rtk, double tt)
             return;
         }
     /* state transition of position/velocity/acceleration */
-    F = eye(rtk->nx);
-    FP = mat(rtk->nx, rtk->nx);
-    xp = mat(rtk->nx, 1);
+    F = wseye(rtk->ws, rtk->nx);
+    FP = wsmat(rtk->ws, rtk->nx, rtk->nx);
+    xp = wsmat(rtk->ws, rtk->nx, 1);
 
     for (i = 0; i < 6; i++)
         {
@@ -757,9 +757,9 @@ void udpos(rtk_t *rtk, double tt)
                     rtk->P[i + 6 + (j + 6) * rtk->nx] += Qv[i + j * 3];
                 }
         }
-    free(F);
-    free(FP);
-    free(xp);
+    wsdel(rtk->ws, F);
+    wsdel(rtk->ws, FP);
+    wsdel(rtk->ws, xp);
 }
 
 
@@ -1125,7 +1125,7 @@ void udbias(rtk_t *rtk, double tt, const obsd_t *obs, const int *sat,
                     rtk->x[j] = 0.0;
                     rtk->ssat[sat[i] - 1].lock[f] = -rtk->opt.minlock;
                 }
-            bias = zeros(ns, 1);
+            bias = wszeros(rtk->ws, ns, 1);
 
             /* estimate approximate phase-bias by phase - code */
             for (i = j = 0, offset = 0.0; i < ns; i++)
@@ -1185,7 +1185,7 @@ void udbias(rtk_t *rtk, double tt, const obsd_t *obs, const int *sat,
                         }
                     initx_rtk(rtk, bias[i], std::pow(rtk->opt.std[0], 2.0), IB_RTK(sat[i], f, &rtk->opt));
                 }
-            free(bias);
+            wsdel(rtk->ws, bias);
         }
 }
 
@@ -1598,6 +1598,7 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
     int sysi;
     int sysj;
     int nf = NF_RTK(opt);
+    int mark = wsmark(rtk->ws);
 
     trace(3, "ddres   : dt=%.1f nx=%d ns=%d\n", dt, rtk->nx, ns);
 
@@ -1605,13 +1606,13 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
     ecef2pos(x, posu);
     ecef2pos(rtk->rb, posr);
 
-    Ri = mat(ns * nf * 2 + 2, 1);
-    Rj = mat(ns * nf * 2 + 2, 1);
-    im = mat(ns, 1);
-    tropu = mat(ns, 1);
-    tropr = mat(ns, 1);
-    dtdxu = mat(ns, 3);
-    dtdxr = mat(ns, 3);
+    Ri = wsmat(rtk->ws, ns * nf * 2 + 2, 1);
+    Rj = wsmat(rtk->ws, ns * nf * 2 + 2, 1);
+    im = wsmat(rtk->ws, ns, 1);
+    tropu = wsmat(rtk->ws, ns, 1);
+    tropr = wsmat(rtk->ws, ns, 1);
+    dtdxu = wsmat(rtk->ws, ns, 3);
+    dtdxr = wsmat(rtk->ws, ns, 3);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -1854,13 +1855,14 @@ int ddres(rtk_t *rtk, const nav_t *nav, double dt, const double *x,
     /* double-differenced measurement error covariance */
     ddcov(nb, b, Ri, Rj, nv, R);
 
-    free(Ri);
-    free(Rj);
-    free(im);
-    free(tropu);
-    free(tropr);
-    free(dtdxu);
-    free(dtdxr);
+    wsdel(rtk->ws, Ri);
+    wsdel(rtk->ws, Rj);
+    wsdel(rtk->ws, im);
+    wsdel(rtk->ws, tropu);
+    wsdel(rtk->ws, tropr);
+    wsdel(rtk->ws, dtdxu);
+    wsdel(rtk->ws, dtdxr);
+    wsrelease(rtk->ws, mark);
 
     return nv;
 }
@@ -2090,8 +2092,8 @@ void holdamb(rtk_t *rtk, const double *xa)
 
     trace(3, "holdamb :\n");
 
-    v = mat(nb, 1);
-    H = zeros(nb, rtk->nx);
+    v = wsmat(rtk->ws, nb, 1);
+    H = wszeros(rtk->ws, nb, rtk->nx);
 
     for (m = 0; m < 4; m++)
         {
@@ -2120,21 +2122,21 @@ void holdamb(rtk_t *rtk, const double *xa)
         }
     if (nv > 0)
         {
-            R = zeros(nv, nv);
+            R = wszeros(rtk->ws, nv, nv);
             for (i = 0; i < nv; i++)
                 {
                     R[i + i * nv] = VAR_HOLDAMB;
                 }
 
             /* update states with constraints */
-            if ((info = filter(rtk->x, rtk->P, H, v, R, rtk->nx, nv)))
+            if ((info = filter(rtk->x, rtk->P, H, v, R, rtk->nx, nv, rtk->ws)))
                 {
                     errmsg(rtk, "filter error (info=%d)\n", info);
                 }
-            free(R);
+            wsdel(rtk->ws, R);
         }
-    free(v);
-    free(H);
+    wsdel(rtk->ws, v);
+    wsdel(rtk->ws, H);
 }
 
 
@@ -2170,22 +2172,22 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
             return 0;
         }
     /* single to double-difference transformation matrix (D') */
-    D = zeros(nx, nx);
+    D = wszeros(rtk->ws, nx, nx);
     if ((nb = ddmat(rtk, D)) <= 0)
         {
             errmsg(rtk, "no valid double-difference\n");
-            free(D);
+            wsdel(rtk->ws, D);
             return 0;
         }
     ny = na + nb;
-    y = mat(ny, 1);
-    Qy = mat(ny, ny);
-    DP = mat(ny, nx);
-    b = mat(nb, 2);
-    db = mat(nb, 1);
-    Qb = mat(nb, nb);
-    Qab = mat(na, nb);
-    QQ = mat(na, nb);
+    y = wsmat(rtk->ws, ny, 1);
+    Qy = wsmat(rtk->ws, ny, ny);
+    DP = wsmat(rtk->ws, ny, nx);
+    b = wsmat(rtk->ws, nb, 2);
+    db = wsmat(rtk->ws, nb, 1);
+    Qb = wsmat(rtk->ws, nb, nb);
+    Qab = wsmat(rtk->ws, na, nb);
+    QQ = wsmat(rtk->ws, na, nb);
 
     /* transform single to double-differenced phase-bias (y=D'*x, Qy=D'*P*D) */
     matmul("TN", ny, 1, nx, 1.0, D, rtk->x, 0.0, y);
@@ -2242,7 +2244,7 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
                             bias[i] = b[i];
                             y[na + i] -= b[i];
                         }
-                    if (!matinv(Qb, nb))
+                    if (!wsmatinv(rtk->ws, Qb, nb))
                         {
                             matmul("NN", nb, 1, nb, 1.0, Qb, y + na, 0.0, db);
                             matmul("NN", na, 1, nb, -1.0, Qab, db, 1.0, rtk->xa);
@@ -2273,15 +2275,15 @@ int resamb_LAMBDA(rtk_t *rtk, double *bias, double *xa)
         {
             errmsg(rtk, "lambda error (info=%d)\n", info);
         }
-    free(D);
-    free(y);
-    free(Qy);
-    free(DP);
-    free(b);
-    free(db);
-    free(Qb);
-    free(Qab);
-    free(QQ);
+    wsdel(rtk->ws, D);
+    wsdel(rtk->ws, y);
+    wsdel(rtk->ws, Qy);
+    wsdel(rtk->ws, DP);
+    wsdel(rtk->ws, b);
+    wsdel(rtk->ws, db);
+    wsdel(rtk->ws, Qb);
+    wsdel(rtk->ws, Qab);
+    wsdel(rtk->ws, QQ);
 
     return nb; /* number of ambiguities */
 }
@@ -2380,17 +2382,18 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
     int svh[MAXOBS * 2];
     int stat = rtk->opt.mode <= PMODE_DGPS ? SOLQ_DGPS : SOLQ_FLOAT;
     int nf = opt->ionoopt == IONOOPT_IFLC ? 1 : opt->nf;
+    int mark = wsmark(rtk->ws);
 
     trace(3, "relpos  : nx=%d nu=%d nr=%d\n", rtk->nx, nu, nr);
 
     dt = timediff(time, obs[nu].time);
 
-    rs = mat(6, n);
-    dts = mat(2, n);
-    var = mat(1, n);
-    y = mat(nf * 2, n);
-    e = mat(3, n);
-    azel = zeros(2, n);
+    rs = wsmat(rtk->ws, 6, n);
+    dts = wsmat(rtk->ws, 2, n);
+    var = wsmat(rtk->ws, 1, n);
+    y = wsmat(rtk->ws, nf * 2, n);
+    e = wsmat(rtk->ws, 3, n);
+    azel = wszeros(rtk->ws, 2, n);
 
     for (i = 0; i < MAXSAT; i++)
         {
@@ -2409,12 +2412,13 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
         {
             errmsg(rtk, "initial base station position error\n");
 
-            free(rs);
-            free(dts);
-            free(var);
-            free(y);
-            free(e);
-            free(azel);
+            wsdel(rtk->ws, rs);
+            wsdel(rtk->ws, dts);
+            wsdel(rtk->ws, var);
+            wsdel(rtk->ws, y);
+            wsdel(rtk->ws, e);
+            wsdel(rtk->ws, azel);
+            wsrelease(rtk->ws, mark);
             return 0;
         }
     /* time-interpolation of residuals (for post-processing) */
@@ -2427,12 +2431,13 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
         {
             errmsg(rtk, "no common satellite\n");
 
-            free(rs);
-            free(dts);
-            free(var);
-            free(y);
-            free(e);
-            free(azel);
+            wsdel(rtk->ws, rs);
+            wsdel(rtk->ws, dts);
+            wsdel(rtk->ws, var);
+            wsdel(rtk->ws, y);
+            wsdel(rtk->ws, e);
+            wsdel(rtk->ws, azel);
+            wsrelease(rtk->ws, mark);
             return 0;
         }
     /* temporal update of states */
@@ -2441,16 +2446,16 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
     trace(4, "x(0)=");
     tracemat(4, rtk->x, 1, NR_RTK(opt), 13, 4);
 
-    xp = mat(rtk->nx, 1);
-    Pp = zeros(rtk->nx, rtk->nx);
-    xa = mat(rtk->nx, 1);
+    xp = wsmat(rtk->ws, rtk->nx, 1);
+    Pp = wszeros(rtk->ws, rtk->nx, rtk->nx);
+    xa = wsmat(rtk->ws, rtk->nx, 1);
     matcpy(xp, rtk->x, rtk->nx, 1);
 
     ny = ns * nf * 2 + 2;
-    v = mat(ny, 1);
-    H = zeros(rtk->nx, ny);
-    R = mat(ny, ny);
-    bias = mat(rtk->nx, 1);
+    v = wsmat(rtk->ws, ny, 1);
+    H = wszeros(rtk->ws, rtk->nx, ny);
+    R = wsmat(rtk->ws, ny, ny);
+    bias = wsmat(rtk->ws, rtk->nx, 1);
 
     /* add 2 iterations for baseline-constraint moving-base */
     niter = opt->niter + (opt->mode == PMODE_MOVEB && opt->baseline[0] > 0.0 ? 2 : 0);
@@ -2473,7 +2478,7 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
                 }
             /* kalman filter measurement update */
             matcpy(Pp, rtk->P, rtk->nx, rtk->nx);
-            if ((info = filter(xp, Pp, H, v, R, rtk->nx, nv)))
+            if ((info = filter(xp, Pp, H, v, R, rtk->nx, nv, rtk->ws)))
                 {
                     errmsg(rtk, "filter error (info=%d)\n", info);
                     stat = SOLQ_NONE;
@@ -2619,19 +2624,20 @@ int relpos(rtk_t *rtk, const obsd_t *obs, int nu, int nr,
                         }
                 }
         }
-    free(rs);
-    free(dts);
-    free(var);
-    free(y);
-    free(e);
-    free(azel);
-    free(xp);
-    free(Pp);
-    free(xa);
-    free(v);
-    free(H);
-    free(R);
-    free(bias);
+    wsdel(rtk->ws, rs);
+    wsdel(rtk->ws, dts);
+    wsdel(rtk->ws, var);
+    wsdel(rtk->ws, y);
+    wsdel(rtk->ws, e);
+    wsdel(rtk->ws, azel);
+    wsdel(rtk->ws, xp);
+    wsdel(rtk->ws, Pp);
+    wsdel(rtk->ws, xa);
+    wsdel(rtk->ws, v);
+    wsdel(rtk->ws, H);
+    wsdel(rtk->ws, R);
+    wsdel(rtk->ws, bias);
+    wsrelease(rtk->ws, mark);
 
     if (stat != SOLQ_NONE)
         {
@@ -2680,6 +2686,7 @@ void rtkinit(rtk_t *rtk, const prcopt_t *opt)
             rtk->errbuf[i] = 0;
         }
     rtk->opt = *opt;
+    rtk->ws = nullptr;
 }
 
 
@@ -2797,7 +2804,7 @@ int rtkpos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     time = rtk->sol.time; /* previous epoch */
 
     /* rover position by single point positioning */
-    if (!pntpos(obs, nu, nav, &rtk->opt, &rtk->sol, nullptr, rtk->ssat, msg))
+    if (!pntpos(obs, nu, nav, &rtk->opt, &rtk->sol, nullptr, rtk->ssat, msg, rtk->ws))
         {
             errmsg(rtk, "point pos error (%s)\n", msg);
             if (!rtk->opt.dynamics)
@@ -2839,7 +2846,7 @@ int rtkpos(rtk_t *rtk, const obsd_t *obs, int n, const nav_t *nav)
     if (opt->mode == PMODE_MOVEB)
         { /*  moving baseline */
             /* estimate position/velocity of base station */
-            if (!pntpos(obs + nu, nr, nav, &rtk->opt, &solb, nullptr, nullptr, msg))
+            if (!pntpos(obs + nu, nr, nav, &rtk->opt, &solb, nullptr, nullptr, msg, rtk->ws))
                 {
                     errmsg(rtk, "base station position error (%s)\n", msg);
                     return 0;
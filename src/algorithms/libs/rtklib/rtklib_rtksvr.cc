@@ -776,6 +776,8 @@ int rtksvrinit(rtksvr_t *svr)
     svr->nav.n = MAXSAT * 2;
     svr->nav.ng = NSATGLO * 2;
     svr->nav.ns = NSATSBS * 2;
+    svr->nav.satcache = nullptr;
+    svr->nav.ephidx = nullptr; /* two ephemerides per satellite */
 
     for (i = 0; i < 3; i++)
         {
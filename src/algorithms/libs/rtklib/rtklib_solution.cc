@@ -2087,7 +2087,7 @@ int outprcopts(unsigned char *buff, const prcopt_t *opt)
         "ionex tec", "qzs", "lex", "vtec_sf", "vtec_ef", "gtec", ""};
     const char *s5[] = {"off", "saastamoinen", "sbas", "est ztd", "est ztd+grad", ""};
     const char *s6[] = {"broadcast", "precise", "broadcast+sbas", "broadcast+ssr apc",
-        "broadcast+ssr com", "qzss lex", ""};
+        "broadcast+ssr com", "qzss lex", "broadcast cached", ""};
     const char *s7[] = {"gps", "glonass", "galileo", "qzss", "sbas", ""};
     const char *s8[] = {"off", "continuous", "instantaneous", "fix and hold", ""};
     const char *s9[] = {"off", "on", "auto calib", "external calib", ""};
@@ -0,0 +1,295 @@
+/*!
+ * \file udp_datagram_sender.cc
+ * \brief Implementation of a class that sends batches of UDP datagrams to
+ * one or multiple endpoints through sockets opened once
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <cstring>
+#endif
+
+
+Udp_Datagram_Sender::Udp_Datagram_Sender(const std::vector<std::string>& addresses,
+    uint16_t port,
+    bool sender_thread) : d_stream(&d_appender),
+                          d_use_thread(sender_thread)
+{
+    for (const auto& address : addresses)
+        {
+            boost::system::error_code error;
+            const boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
+            if (error)
+                {
+                    std::cerr << "Invalid UDP address " << address << ": " << error.message() << '\n';
+                    continue;
+                }
+            boost::asio::ip::udp::socket socket(d_io_context);
+            socket.open(endpoint.protocol(), error);
+            if (!error)
+                {
+                    socket.connect(endpoint, error);
+                }
+            if (error)
+                {
+                    std::cerr << "Cannot open UDP socket to " << address << ':' << port << ": " << error.message() << '\n';
+                    continue;
+                }
+            d_sockets.push_back(std::move(socket));
+        }
+    d_batch.reserve(max_batch_size);
+#if defined(__linux__)
+    d_iov.resize(max_batch_size);
+    d_msgs.resize(max_batch_size);
+#endif
+    if (d_use_thread)
+        {
+            d_thread = std::thread([this]() { run(); });
+        }
+}
+
+
+Udp_Datagram_Sender::~Udp_Datagram_Sender()
+{
+    if (d_use_thread)
+        {
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_cv.wait(lock, [this]() { return d_in_flight_count == 0; });
+                if (d_queued > 0)
+                    {
+                        std::swap(d_batch, d_in_flight);
+                        d_in_flight_count = d_queued;
+                        d_queued = 0;
+                    }
+                d_stop = true;
+            }
+            d_cv.notify_all();
+            d_thread.join();
+        }
+    else
+        {
+            flush();
+        }
+}
+
+
+std::string& Udp_Datagram_Sender::buffer()
+{
+    if (d_queued == d_batch.size())
+        {
+            d_batch.emplace_back();
+        }
+    std::string& buf = d_batch[d_queued];
+    buf.clear();
+    return buf;
+}
+
+
+std::ostream& Udp_Datagram_Sender::stream()
+{
+    d_appender.target = &buffer();
+    d_stream.clear();
+    return d_stream;
+}
+
+
+bool Udp_Datagram_Sender::queue()
+{
+    d_queued++;
+    if (d_queued % max_batch_size == 0)
+        {
+            return flush();
+        }
+    return true;
+}
+
+
+bool Udp_Datagram_Sender::flush()
+{
+    if (d_queued == 0)
+        {
+            return true;
+        }
+    if (!d_use_thread)
+        {
+            const bool sent = transmit(d_batch, d_queued);
+            d_queued = 0;
+            return sent;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        if (d_in_flight_count == 0)
+            {
+                std::swap(d_batch, d_in_flight);
+                d_in_flight_count = d_queued;
+                d_queued = 0;
+            }
+        else if (d_queued >= max_pending)
+            {
+                // the sender thread cannot keep up
+                d_dropped += d_queued;
+                d_queued = 0;
+                return false;
+            }
+        else
+            {
+                return true;
+            }
+    }
+    d_cv.notify_all();
+    return true;
+}
+
+
+uint64_t Udp_Datagram_Sender::get_dropped() const
+{
+    return d_dropped;
+}
+
+
+void Udp_Datagram_Sender::run()
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+        {
+            d_cv.wait(lock, [this]() { return d_stop || d_in_flight_count > 0; });
+            if (d_in_flight_count > 0)
+                {
+                    const size_t n = d_in_flight_count;
+                    lock.unlock();
+                    transmit(d_in_flight, n);
+                    lock.lock();
+                    d_in_flight_count = 0;
+                    d_cv.notify_all();
+                    continue;
+                }
+            if (d_stop)
+                {
+                    return;
+                }
+        }
+}
+
+
+bool Udp_Datagram_Sender::transmit(const std::vector<std::string>& batch, size_t n)
+{
+    bool sent = true;
+#if defined(__linux__)
+    for (size_t first = 0; first < n; first += max_batch_size)
+        {
+            const size_t count = n - first < max_batch_size ? n - first : max_batch_size;
+            for (size_t i = 0; i < count; i++)
+                {
+                    d_iov[i].iov_base = const_cast<char*>(batch[first + i].data());
+                    d_iov[i].iov_len = batch[first + i].size();
+                    d_msgs[i] = mmsghdr{};
+                    d_msgs[i].msg_hdr.msg_iov = &d_iov[i];
+                    d_msgs[i].msg_hdr.msg_iovlen = 1;
+                }
+            for (auto& socket : d_sockets)
+                {
+                    size_t done = 0;
+                    bool retried = false;
+                    while (done < count)
+                        {
+                            const int ret = sendmmsg(socket.native_handle(), &d_msgs[done], static_cast<unsigned int>(count - done), 0);
+                            if (ret < 0)
+                                {
+                                    // A connected UDP socket reports a previous ICMP port
+                                    // unreachable on the next send. Try once more.
+                                    if (errno == ECONNREFUSED && !retried)
+                                        {
+                                            retried = true;
+                                            continue;
+                                        }
+                                    report_failure(socket, std::strerror(errno));
+                                    sent = false;
+                                    break;
+                                }
+                            if (ret == 0)
+                                {
+                                    report_failure(socket, "no datagram sent");
+                                    sent = false;
+                                    break;
+                                }
+                            done += static_cast<size_t>(ret);
+                        }
+                }
+        }
+#else
+    for (auto& socket : d_sockets)
+        {
+            for (size_t i = 0; i < n; i++)
+                {
+                    boost::system::error_code error;
+                    if (socket.send(boost::asio::buffer(batch[i]), 0, error) == 0 || error)
+                        {
+                            report_failure(socket, error ? error.message() : "sent 0 bytes");
+                            sent = false;
+                        }
+                }
+        }
+#endif
+    return sent;
+}
+
+
+void Udp_Datagram_Sender::report_failure(const boost::asio::ip::udp::socket& socket, const std::string& reason)
+{
+    // At most one message per second, so that a missing listener does not
+    // flood the console
+    const auto now = std::chrono::steady_clock::now();
+    if (d_failures_reported && now - d_last_report < std::chrono::seconds(1))
+        {
+            d_failures_not_reported++;
+            return;
+        }
+    boost::system::error_code error;
+    std::cerr << "Udp_Datagram_Sender cannot send to " << socket.remote_endpoint(error) << ": " << reason;
+    if (d_failures_not_reported > 0)
+        {
+            std::cerr << " (" << d_failures_not_reported << " more failures since the last message)";
+        }
+    std::cerr << '\n';
+    d_failures_reported = true;
+    d_failures_not_reported = 0;
+    d_last_report = now;
+}
+
+
+Udp_Datagram_Sender::String_Appender::int_type Udp_Datagram_Sender::String_Appender::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()) || target == nullptr)
+        {
+            return traits_type::not_eof(ch);
+        }
+    target->push_back(traits_type::to_char_type(ch));
+    return ch;
+}
+
+
+std::streamsize Udp_Datagram_Sender::String_Appender::xsputn(const char* s, std::streamsize n)
+{
+    if (target == nullptr)
+        {
+            return 0;
+        }
+    target->append(s, static_cast<size_t>(n));
+    return n;
+}
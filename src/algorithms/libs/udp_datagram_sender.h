@@ -0,0 +1,150 @@
+/*!
+ * \file udp_datagram_sender.h
+ * \brief Interface of a class that sends batches of UDP datagrams to one or
+ * multiple endpoints through sockets opened once
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_DATAGRAM_SENDER_H
+#define GNSS_SDR_UDP_DATAGRAM_SENDER_H
+
+#include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <thread>
+#include <vector>
+#if defined(__linux__)
+#include <sys/socket.h>  // for mmsghdr, sendmmsg
+#include <sys/uio.h>     // for iovec
+#endif
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Sends datagrams over UDP to one or multiple endpoints.
+ *
+ * There is one socket per endpoint, opened and connected at construction.
+ * Datagrams are serialized into buffers owned by this class, which keep their
+ * capacity from one message to the next, and queued. flush() sends all the
+ * queued datagrams, using one sendmmsg() call per endpoint on Linux. If the
+ * sender thread is enabled, flush() hands the batch over to it and returns
+ * immediately. If that thread is still busy with the previous batch, the new
+ * one waits for the next flush(), and it is dropped once it reaches
+ * max_pending datagrams. Send failures are reported on std::cerr, at most once
+ * per second.
+ */
+class Udp_Datagram_Sender
+{
+public:
+    static constexpr size_t max_batch_size = 64;  //!< Datagrams per sendmmsg() call
+    static constexpr size_t max_pending = 1024;   //!< Backlog kept while the sender thread is busy
+
+    Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port, bool sender_thread = false);
+    ~Udp_Datagram_Sender();
+
+    Udp_Datagram_Sender(const Udp_Datagram_Sender&) = delete;
+    Udp_Datagram_Sender& operator=(const Udp_Datagram_Sender&) = delete;
+
+    /*!
+     * \brief Returns an empty buffer in which to write the next datagram
+     */
+    std::string& buffer();
+
+    /*!
+     * \brief Returns a stream that writes the next datagram into buffer()
+     */
+    std::ostream& stream();
+
+    /*!
+     * \brief Queues the content of buffer(). Flushes if the batch is full.
+     */
+    bool queue();
+
+    /*!
+     * \brief Sends all the queued datagrams
+     */
+    bool flush();
+
+    /*!
+     * \brief Queues the content of buffer() and sends it right away
+     */
+    inline bool send()
+    {
+        return queue() && flush();
+    }
+
+    uint64_t get_dropped() const;
+
+private:
+#if USE_BOOST_ASIO_IO_CONTEXT
+    using b_io_context = boost::asio::io_context;
+#else
+    using b_io_context = boost::asio::io_service;
+#endif
+
+    // std::streambuf that appends to a std::string, without its own buffer
+    class String_Appender : public std::streambuf
+    {
+    public:
+        std::string* target{nullptr};
+
+    protected:
+        int_type overflow(int_type ch) override;
+        std::streamsize xsputn(const char* s, std::streamsize n) override;
+    };
+
+    bool transmit(const std::vector<std::string>& batch, size_t n);
+    void report_failure(const boost::asio::ip::udp::socket& socket, const std::string& reason);
+    void run();
+
+    b_io_context d_io_context;
+    std::vector<boost::asio::ip::udp::socket> d_sockets;
+#if defined(__linux__)
+    std::vector<struct iovec> d_iov;
+    std::vector<struct mmsghdr> d_msgs;
+#endif
+
+    std::vector<std::string> d_batch;
+    size_t d_queued{0};
+    String_Appender d_appender;
+    std::ostream d_stream;
+
+    // batch owned by the sender thread
+    std::vector<std::string> d_in_flight;
+    size_t d_in_flight_count{0};
+    uint64_t d_dropped{0};
+    std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::thread d_thread;
+    bool d_use_thread;
+    bool d_stop{false};
+
+    // send failures, reported on std::cerr at most once per second
+    std::chrono::steady_clock::time_point d_last_report{};
+    uint64_t d_failures_not_reported{0};
+    bool d_failures_reported{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_DATAGRAM_SENDER_H
@@ -0,0 +1,83 @@
+/*!
+ * \file volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc.h
+ * \brief VOLK_GNSSSDR puppet for the 16-bit integer complex decimating FIR kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the 16-bit integer complex decimating FIR into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_16ic_32f_fir_decimate_32fc.h"
+#include <string.h>
+
+// A number of taps that goes through the vector code and its tail
+#define FIRDECIMATEPUPPET_16IC_TAPS 21
+#define FIRDECIMATEPUPPET_16IC_DECIMATION 3
+
+// Outputs whose input samples are within the num_points of the test buffer
+static inline unsigned int volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_outputs(unsigned int num_points)
+{
+    if (num_points < FIRDECIMATEPUPPET_16IC_TAPS)
+        {
+            return 0;
+        }
+    return (num_points - FIRDECIMATEPUPPET_16IC_TAPS) / FIRDECIMATEPUPPET_16IC_DECIMATION + 1;
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_generic(lv_32fc_t* result, const lv_16sc_t* in, const float* taps, unsigned int num_points)
+{
+    const unsigned int num_outputs = volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_outputs(num_points);
+    volk_gnsssdr_16ic_32f_fir_decimate_32fc_generic(result, in, taps, FIRDECIMATEPUPPET_16IC_TAPS, FIRDECIMATEPUPPET_16IC_DECIMATION, num_outputs);
+    memset(result + num_outputs, 0, sizeof(lv_32fc_t) * (num_points - num_outputs));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+static inline void volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_u_sse4_1(lv_32fc_t* result, const lv_16sc_t* in, const float* taps, unsigned int num_points)
+{
+    const unsigned int num_outputs = volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_outputs(num_points);
+    volk_gnsssdr_16ic_32f_fir_decimate_32fc_u_sse4_1(result, in, taps, FIRDECIMATEPUPPET_16IC_TAPS, FIRDECIMATEPUPPET_16IC_DECIMATION, num_outputs);
+    memset(result + num_outputs, 0, sizeof(lv_32fc_t) * (num_points - num_outputs));
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_u_avx2(lv_32fc_t* result, const lv_16sc_t* in, const float* taps, unsigned int num_points)
+{
+    const unsigned int num_outputs = volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_outputs(num_points);
+    volk_gnsssdr_16ic_32f_fir_decimate_32fc_u_avx2(result, in, taps, FIRDECIMATEPUPPET_16IC_TAPS, FIRDECIMATEPUPPET_16IC_DECIMATION, num_outputs);
+    memset(result + num_outputs, 0, sizeof(lv_32fc_t) * (num_points - num_outputs));
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_neon(lv_32fc_t* result, const lv_16sc_t* in, const float* taps, unsigned int num_points)
+{
+    const unsigned int num_outputs = volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_outputs(num_points);
+    volk_gnsssdr_16ic_32f_fir_decimate_32fc_neon(result, in, taps, FIRDECIMATEPUPPET_16IC_TAPS, FIRDECIMATEPUPPET_16IC_DECIMATION, num_outputs);
+    memset(result + num_outputs, 0, sizeof(lv_32fc_t) * (num_points - num_outputs));
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc_H */
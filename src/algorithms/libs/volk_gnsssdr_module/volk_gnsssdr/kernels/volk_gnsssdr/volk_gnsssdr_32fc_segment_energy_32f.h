@@ -0,0 +1,202 @@
+/*!
+ * \file volk_gnsssdr_32fc_segment_energy_32f.h
+ * \brief VOLK_GNSSSDR kernel: energy of consecutive segments of a 32-bit
+ * float complex vector.
+ *
+ * VOLK_GNSSSDR kernel that computes the sum of the squared magnitudes of the
+ * samples in each segment, in a single pass over the input.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_segment_energy_32f
+ *
+ * \b Overview
+ *
+ * Energy of consecutive, non-overlapping segments of \p segment_length
+ * samples:
+ *
+ * result[n] = sum_k |in[n * segment_length + k]|^2
+ *
+ * It fuses the squared magnitude and the accumulation of each segment, so
+ * that no vector of magnitudes is written and read back.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_segment_energy_32f(float* result, const lv_32fc_t* in, unsigned int segment_length, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in:             Input samples, num_points * segment_length of them.
+ * \li segment_length: Samples per segment.
+ * \li num_points:     Number of segments.
+ *
+ * \b Outputs
+ * \li result:         Energy of each segment.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_segment_energy_32f_H
+#define INCLUDED_volk_gnsssdr_32fc_segment_energy_32f_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_segment_energy_32f_generic(float* result, const lv_32fc_t* in, unsigned int segment_length, unsigned int num_points)
+{
+    unsigned int n;
+    unsigned int k;
+    float energy;
+    const float* in_ptr = (const float*)in;
+    for (n = 0; n < num_points; n++)
+        {
+            energy = 0.0F;
+            for (k = 0; k < 2 * segment_length; k++)
+                {
+                    energy += in_ptr[k] * in_ptr[k];
+                }
+            result[n] = energy;
+            in_ptr += 2 * segment_length;
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_segment_energy_32f_u_sse3(float* result, const lv_32fc_t* in, unsigned int segment_length, unsigned int num_points)
+{
+    const unsigned int sse_iters = segment_length / 4;
+    unsigned int n;
+    unsigned int k;
+    float energy;
+    __m128 x0, x1, acc0, acc1;
+    const float* in_ptr = (const float*)in;
+
+    for (n = 0; n < num_points; n++)
+        {
+            acc0 = _mm_setzero_ps();
+            acc1 = _mm_setzero_ps();
+            for (k = 0; k < sse_iters; k++)
+                {
+                    // four complex samples
+                    x0 = _mm_loadu_ps(in_ptr);
+                    x1 = _mm_loadu_ps(in_ptr + 4);
+                    acc0 = _mm_add_ps(acc0, _mm_mul_ps(x0, x0));
+                    acc1 = _mm_add_ps(acc1, _mm_mul_ps(x1, x1));
+                    in_ptr += 8;
+                }
+            acc0 = _mm_add_ps(acc0, acc1);
+            acc0 = _mm_hadd_ps(acc0, acc0);
+            acc0 = _mm_hadd_ps(acc0, acc0);
+            energy = _mm_cvtss_f32(acc0);
+            for (k = sse_iters * 4; k < segment_length; k++)
+                {
+                    energy += in_ptr[0] * in_ptr[0] + in_ptr[1] * in_ptr[1];
+                    in_ptr += 2;
+                }
+            result[n] = energy;
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_segment_energy_32f_u_avx(float* result, const lv_32fc_t* in, unsigned int segment_length, unsigned int num_points)
+{
+    const unsigned int avx_iters = segment_length / 8;
+    unsigned int n;
+    unsigned int k;
+    float energy;
+    __m256 x0, x1, acc0, acc1;
+    __m128 acc;
+    const float* in_ptr = (const float*)in;
+
+    for (n = 0; n < num_points; n++)
+        {
+            acc0 = _mm256_setzero_ps();
+            acc1 = _mm256_setzero_ps();
+            for (k = 0; k < avx_iters; k++)
+                {
+                    // eight complex samples
+                    x0 = _mm256_loadu_ps(in_ptr);
+                    x1 = _mm256_loadu_ps(in_ptr + 8);
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(x0, x0));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(x1, x1));
+                    in_ptr += 16;
+                }
+            acc0 = _mm256_add_ps(acc0, acc1);
+            acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+            acc = _mm_hadd_ps(acc, acc);
+            acc = _mm_hadd_ps(acc, acc);
+            energy = _mm_cvtss_f32(acc);
+            for (k = avx_iters * 8; k < segment_length; k++)
+                {
+                    energy += in_ptr[0] * in_ptr[0] + in_ptr[1] * in_ptr[1];
+                    in_ptr += 2;
+                }
+            result[n] = energy;
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_segment_energy_32f_neon(float* result, const lv_32fc_t* in, unsigned int segment_length, unsigned int num_points)
+{
+    const unsigned int neon_iters = segment_length / 4;
+    unsigned int n;
+    unsigned int k;
+    float energy;
+    float32x4_t x0, x1, acc0, acc1;
+    float32x2_t acc;
+    const float* in_ptr = (const float*)in;
+
+    for (n = 0; n < num_points; n++)
+        {
+            acc0 = vdupq_n_f32(0.0F);
+            acc1 = vdupq_n_f32(0.0F);
+            for (k = 0; k < neon_iters; k++)
+                {
+                    x0 = vld1q_f32(in_ptr);
+                    x1 = vld1q_f32(in_ptr + 4);
+                    __VOLK_GNSSSDR_PREFETCH(in_ptr + 8);
+                    acc0 = vmlaq_f32(acc0, x0, x0);
+                    acc1 = vmlaq_f32(acc1, x1, x1);
+                    in_ptr += 8;
+                }
+            acc0 = vaddq_f32(acc0, acc1);
+            acc = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+            energy = vget_lane_f32(acc, 0) + vget_lane_f32(acc, 1);
+            for (k = neon_iters * 4; k < segment_length; k++)
+                {
+                    energy += in_ptr[0] * in_ptr[0] + in_ptr[1] * in_ptr[1];
+                    in_ptr += 2;
+                }
+            result[n] = energy;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_segment_energy_32f_H */
@@ -0,0 +1,72 @@
+/*!
+ * \file volk_gnsssdr_32fc_segmentenergypuppet_32f.h
+ * \brief VOLK_GNSSSDR puppet for the segment energy kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the segment energy kernel into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_segmentenergypuppet_32f_H
+#define INCLUDED_volk_gnsssdr_32fc_segmentenergypuppet_32f_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_segment_energy_32f.h"
+#include <string.h>
+
+// A segment length that goes through the vector code and its tail
+#define SEGMENTENERGYPUPPET_LENGTH 21
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_segmentenergypuppet_32f_generic(float* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    const unsigned int num_segments = num_points / SEGMENTENERGYPUPPET_LENGTH;
+    volk_gnsssdr_32fc_segment_energy_32f_generic(result, in, SEGMENTENERGYPUPPET_LENGTH, num_segments);
+    memset(result + num_segments, 0, sizeof(float) * (num_points - num_segments));
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_gnsssdr_32fc_segmentenergypuppet_32f_u_sse3(float* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    const unsigned int num_segments = num_points / SEGMENTENERGYPUPPET_LENGTH;
+    volk_gnsssdr_32fc_segment_energy_32f_u_sse3(result, in, SEGMENTENERGYPUPPET_LENGTH, num_segments);
+    memset(result + num_segments, 0, sizeof(float) * (num_points - num_segments));
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32fc_segmentenergypuppet_32f_u_avx(float* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    const unsigned int num_segments = num_points / SEGMENTENERGYPUPPET_LENGTH;
+    volk_gnsssdr_32fc_segment_energy_32f_u_avx(result, in, SEGMENTENERGYPUPPET_LENGTH, num_segments);
+    memset(result + num_segments, 0, sizeof(float) * (num_points - num_segments));
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32fc_segmentenergypuppet_32f_neon(float* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    const unsigned int num_segments = num_points / SEGMENTENERGYPUPPET_LENGTH;
+    volk_gnsssdr_32fc_segment_energy_32f_neon(result, in, SEGMENTENERGYPUPPET_LENGTH, num_segments);
+    memset(result + num_segments, 0, sizeof(float) * (num_points - num_segments));
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_segmentenergypuppet_32f_H */
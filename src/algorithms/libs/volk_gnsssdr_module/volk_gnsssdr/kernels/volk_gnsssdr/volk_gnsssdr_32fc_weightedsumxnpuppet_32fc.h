@@ -0,0 +1,121 @@
+/*!
+ * \file volk_gnsssdr_32fc_weightedsumxnpuppet_32fc.h
+ * \brief VOLK_GNSSSDR puppet for the weighted sum kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the weighted sum kernel into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32fc_xn_weighted_sum_32fc.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_malloc.h>
+#include <math.h>
+#include <string.h>
+
+// Eight channels, as in an antenna array. Each one is the input delayed by
+// its index, with a different weight.
+#define WEIGHTEDSUMXNPUPPET_CHANNELS 8
+
+
+static inline lv_32fc_t** volk_gnsssdr_weightedsumxnpuppet_make_inputs(const lv_32fc_t* in, lv_32fc_t* weights, unsigned int num_points)
+{
+    int n;
+    lv_32fc_t** in_a = (lv_32fc_t**)volk_gnsssdr_malloc(sizeof(lv_32fc_t*) * WEIGHTEDSUMXNPUPPET_CHANNELS, volk_gnsssdr_get_alignment());
+    for (n = 0; n < WEIGHTEDSUMXNPUPPET_CHANNELS; n++)
+        {
+            in_a[n] = (lv_32fc_t*)volk_gnsssdr_malloc(sizeof(lv_32fc_t) * num_points, volk_gnsssdr_get_alignment());
+            memset(in_a[n], 0, sizeof(lv_32fc_t) * num_points);
+            if ((unsigned int)n < num_points)
+                {
+                    memcpy(in_a[n] + n, in, sizeof(lv_32fc_t) * (num_points - n));
+                }
+            weights[n] = lv_cmake(cosf(0.7F * (float)n), sinf(0.7F * (float)n));
+        }
+    return in_a;
+}
+
+
+static inline void volk_gnsssdr_weightedsumxnpuppet_free_inputs(lv_32fc_t** in_a)
+{
+    int n;
+    for (n = 0; n < WEIGHTEDSUMXNPUPPET_CHANNELS; n++)
+        {
+            volk_gnsssdr_free(in_a[n]);
+        }
+    volk_gnsssdr_free(in_a);
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_generic(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    lv_32fc_t weights[WEIGHTEDSUMXNPUPPET_CHANNELS];
+    lv_32fc_t** in_a = volk_gnsssdr_weightedsumxnpuppet_make_inputs(in, weights, num_points);
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_generic(result, (const lv_32fc_t**)in_a, weights, WEIGHTEDSUMXNPUPPET_CHANNELS, num_points);
+    volk_gnsssdr_weightedsumxnpuppet_free_inputs(in_a);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+static inline void volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_u_sse3(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    lv_32fc_t weights[WEIGHTEDSUMXNPUPPET_CHANNELS];
+    lv_32fc_t** in_a = volk_gnsssdr_weightedsumxnpuppet_make_inputs(in, weights, num_points);
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_sse3(result, (const lv_32fc_t**)in_a, weights, WEIGHTEDSUMXNPUPPET_CHANNELS, num_points);
+    volk_gnsssdr_weightedsumxnpuppet_free_inputs(in_a);
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+static inline void volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_u_avx(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    lv_32fc_t weights[WEIGHTEDSUMXNPUPPET_CHANNELS];
+    lv_32fc_t** in_a = volk_gnsssdr_weightedsumxnpuppet_make_inputs(in, weights, num_points);
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx(result, (const lv_32fc_t**)in_a, weights, WEIGHTEDSUMXNPUPPET_CHANNELS, num_points);
+    volk_gnsssdr_weightedsumxnpuppet_free_inputs(in_a);
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_u_avx2(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    lv_32fc_t weights[WEIGHTEDSUMXNPUPPET_CHANNELS];
+    lv_32fc_t** in_a = volk_gnsssdr_weightedsumxnpuppet_make_inputs(in, weights, num_points);
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx2(result, (const lv_32fc_t**)in_a, weights, WEIGHTEDSUMXNPUPPET_CHANNELS, num_points);
+    volk_gnsssdr_weightedsumxnpuppet_free_inputs(in_a);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_neon(lv_32fc_t* result, const lv_32fc_t* in, unsigned int num_points)
+{
+    lv_32fc_t weights[WEIGHTEDSUMXNPUPPET_CHANNELS];
+    lv_32fc_t** in_a = volk_gnsssdr_weightedsumxnpuppet_make_inputs(in, weights, num_points);
+    volk_gnsssdr_32fc_xn_weighted_sum_32fc_neon(result, (const lv_32fc_t**)in_a, weights, WEIGHTEDSUMXNPUPPET_CHANNELS, num_points);
+    volk_gnsssdr_weightedsumxnpuppet_free_inputs(in_a);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_weightedsumxnpuppet_32fc_H */
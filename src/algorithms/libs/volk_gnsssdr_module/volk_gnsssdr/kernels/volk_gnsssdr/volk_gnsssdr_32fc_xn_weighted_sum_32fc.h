@@ -0,0 +1,265 @@
+/*!
+ * \file volk_gnsssdr_32fc_xn_weighted_sum_32fc.h
+ * \brief VOLK_GNSSSDR kernel: weighted sum of N 32-bit float complex vectors.
+ *
+ * VOLK_GNSSSDR kernel that multiplies each input vector by its complex weight
+ * and adds them up, as a beamformer does with the channels of an antenna
+ * array.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_xn_weighted_sum_32fc
+ *
+ * \b Overview
+ *
+ * Weighted sum of \p num_a_vectors complex vectors:
+ *
+ * result[n] = sum_i weights[i] * in_a[i][n]
+ *
+ * Each block of samples is accumulated over all the input vectors in
+ * registers, so the output is written only once.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_xn_weighted_sum_32fc(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in_a:          Pointers to the input vectors.
+ * \li weights:       Complex weight of each input vector.
+ * \li num_a_vectors: Number of input vectors.
+ * \li num_points:    Number of samples of each vector.
+ *
+ * \b Outputs
+ * \li result:        Weighted sum.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_generic(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    unsigned int n;
+    int i;
+    lv_32fc_t sum;
+    for (n = 0; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0F, 0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    sum += in_a[i][n] * weights[i];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE3
+#include <pmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_sse3(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 4;
+    const float* weights_ptr = (const float*)weights;
+    unsigned int n;
+    int i;
+    lv_32fc_t sum;
+    __m128 x0, x1, w_re, w_im;
+    __m128 acc_re0, acc_im0, acc_re1, acc_im1;
+
+    for (n = 0; n < sse_iters; n++)
+        {
+            acc_re0 = _mm_setzero_ps();
+            acc_im0 = _mm_setzero_ps();
+            acc_re1 = _mm_setzero_ps();
+            acc_im1 = _mm_setzero_ps();
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    w_re = _mm_load1_ps(weights_ptr + 2 * i);
+                    w_im = _mm_load1_ps(weights_ptr + 2 * i + 1);
+                    x0 = _mm_loadu_ps((const float*)(in_a[i] + 4 * n));
+                    x1 = _mm_loadu_ps((const float*)(in_a[i] + 4 * n + 2));
+                    // re * w, and swapped re/im * w_im, to be combined once at the end
+                    acc_re0 = _mm_add_ps(acc_re0, _mm_mul_ps(x0, w_re));
+                    acc_im0 = _mm_add_ps(acc_im0, _mm_mul_ps(_mm_shuffle_ps(x0, x0, 0xB1), w_im));
+                    acc_re1 = _mm_add_ps(acc_re1, _mm_mul_ps(x1, w_re));
+                    acc_im1 = _mm_add_ps(acc_im1, _mm_mul_ps(_mm_shuffle_ps(x1, x1, 0xB1), w_im));
+                }
+            _mm_storeu_ps((float*)(result + 4 * n), _mm_addsub_ps(acc_re0, acc_im0));
+            _mm_storeu_ps((float*)(result + 4 * n + 2), _mm_addsub_ps(acc_re1, acc_im1));
+        }
+
+    for (n = sse_iters * 4; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0F, 0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    sum += in_a[i][n] * weights[i];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_SSE3 */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 8;
+    const float* weights_ptr = (const float*)weights;
+    unsigned int n;
+    int i;
+    lv_32fc_t sum;
+    __m256 x0, x1, w_re, w_im;
+    __m256 acc_re0, acc_im0, acc_re1, acc_im1;
+
+    for (n = 0; n < avx_iters; n++)
+        {
+            acc_re0 = _mm256_setzero_ps();
+            acc_im0 = _mm256_setzero_ps();
+            acc_re1 = _mm256_setzero_ps();
+            acc_im1 = _mm256_setzero_ps();
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    w_re = _mm256_broadcast_ss(weights_ptr + 2 * i);
+                    w_im = _mm256_broadcast_ss(weights_ptr + 2 * i + 1);
+                    x0 = _mm256_loadu_ps((const float*)(in_a[i] + 8 * n));
+                    x1 = _mm256_loadu_ps((const float*)(in_a[i] + 8 * n + 4));
+                    acc_re0 = _mm256_add_ps(acc_re0, _mm256_mul_ps(x0, w_re));
+                    acc_im0 = _mm256_add_ps(acc_im0, _mm256_mul_ps(_mm256_permute_ps(x0, 0xB1), w_im));
+                    acc_re1 = _mm256_add_ps(acc_re1, _mm256_mul_ps(x1, w_re));
+                    acc_im1 = _mm256_add_ps(acc_im1, _mm256_mul_ps(_mm256_permute_ps(x1, 0xB1), w_im));
+                }
+            _mm256_storeu_ps((float*)(result + 8 * n), _mm256_addsub_ps(acc_re0, acc_im0));
+            _mm256_storeu_ps((float*)(result + 8 * n + 4), _mm256_addsub_ps(acc_re1, acc_im1));
+        }
+
+    for (n = avx_iters * 8; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0F, 0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    sum += in_a[i][n] * weights[i];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_u_avx2(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 8;
+    const float* weights_ptr = (const float*)weights;
+    unsigned int n;
+    int i;
+    lv_32fc_t sum;
+    __m256 x0, x1, w_re, w_im;
+    __m256 acc_re0, acc_im0, acc_re1, acc_im1;
+
+    for (n = 0; n < avx_iters; n++)
+        {
+            acc_re0 = _mm256_setzero_ps();
+            acc_im0 = _mm256_setzero_ps();
+            acc_re1 = _mm256_setzero_ps();
+            acc_im1 = _mm256_setzero_ps();
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    w_re = _mm256_broadcast_ss(weights_ptr + 2 * i);
+                    w_im = _mm256_broadcast_ss(weights_ptr + 2 * i + 1);
+                    x0 = _mm256_loadu_ps((const float*)(in_a[i] + 8 * n));
+                    x1 = _mm256_loadu_ps((const float*)(in_a[i] + 8 * n + 4));
+                    acc_re0 = _mm256_fmadd_ps(x0, w_re, acc_re0);
+                    acc_im0 = _mm256_fmadd_ps(_mm256_permute_ps(x0, 0xB1), w_im, acc_im0);
+                    acc_re1 = _mm256_fmadd_ps(x1, w_re, acc_re1);
+                    acc_im1 = _mm256_fmadd_ps(_mm256_permute_ps(x1, 0xB1), w_im, acc_im1);
+                }
+            _mm256_storeu_ps((float*)(result + 8 * n), _mm256_addsub_ps(acc_re0, acc_im0));
+            _mm256_storeu_ps((float*)(result + 8 * n + 4), _mm256_addsub_ps(acc_re1, acc_im1));
+        }
+
+    for (n = avx_iters * 8; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0F, 0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    sum += in_a[i][n] * weights[i];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_xn_weighted_sum_32fc_neon(lv_32fc_t* result, const lv_32fc_t** in_a, const lv_32fc_t* weights, int num_a_vectors, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    const float* weights_ptr = (const float*)weights;
+    unsigned int n;
+    int i;
+    lv_32fc_t sum;
+    float32x4x2_t x, acc;
+    float32_t w_re, w_im;
+
+    for (n = 0; n < neon_iters; n++)
+        {
+            acc.val[0] = vdupq_n_f32(0.0F);
+            acc.val[1] = vdupq_n_f32(0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    w_re = weights_ptr[2 * i];
+                    w_im = weights_ptr[2 * i + 1];
+                    // deinterleaved real and imaginary parts of four samples
+                    x = vld2q_f32((const float32_t*)(in_a[i] + 4 * n));
+                    acc.val[0] = vmlaq_n_f32(acc.val[0], x.val[0], w_re);
+                    acc.val[0] = vmlsq_n_f32(acc.val[0], x.val[1], w_im);
+                    acc.val[1] = vmlaq_n_f32(acc.val[1], x.val[0], w_im);
+                    acc.val[1] = vmlaq_n_f32(acc.val[1], x.val[1], w_re);
+                }
+            vst2q_f32((float32_t*)(result + 4 * n), acc);
+        }
+
+    for (n = neon_iters * 4; n < num_points; n++)
+        {
+            sum = lv_cmake(0.0F, 0.0F);
+            for (i = 0; i < num_a_vectors; i++)
+                {
+                    sum += in_a[i][n] * weights[i];
+                }
+            result[n] = sum;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_xn_weighted_sum_32fc_H */
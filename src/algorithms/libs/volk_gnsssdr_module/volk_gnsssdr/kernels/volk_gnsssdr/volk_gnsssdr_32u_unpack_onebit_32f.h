@@ -0,0 +1,188 @@
+/*!
+ * \file volk_gnsssdr_32u_unpack_onebit_32f.h
+ * \brief VOLK_GNSSSDR kernel: unpacks a pair of 1-bit samples from each 32-bit
+ * word into 32-bit floating point samples.
+ *
+ * VOLK_GNSSSDR kernel that unpacks a pair of 1-bit samples (e.g., the I and Q
+ * components of a channel) from each 32-bit word into 32-bit floating point
+ * samples.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32u_unpack_onebit_32f
+ *
+ * \b Overview
+ *
+ * For each 32-bit word of \p packed, writes two samples: the first one is
+ * +amplitude if bit \p first_bit of the word is set and -amplitude otherwise,
+ * and the second one does the same with bit \p first_bit + 1.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32u_unpack_onebit_32f(float* result, const uint32_t* packed, float amplitude, unsigned int first_bit, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed:     Words to unpack.
+ * \li amplitude:  Absolute value of the samples.
+ * \li first_bit:  Position of the first bit of the pair, from 0 to 30.
+ * \li num_points: Number of words in \p packed.
+ *
+ * \b Outputs
+ * \li result:     Unpacked samples, 2 * \p num_points values.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32u_unpack_onebit_32f_H
+#define INCLUDED_volk_gnsssdr_32u_unpack_onebit_32f_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32u_unpack_onebit_32f_generic(float* result, const uint32_t* packed, float amplitude, unsigned int first_bit, unsigned int num_points)
+{
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            *result++ = ((packed[n] >> first_bit) & 1) ? amplitude : -amplitude;
+            *result++ = ((packed[n] >> (first_bit + 1)) & 1) ? amplitude : -amplitude;
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_gnsssdr_32u_unpack_onebit_32f_u_sse2(float* result, const uint32_t* packed, float amplitude, unsigned int first_bit, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 4;
+    unsigned int number;
+    const __m128i first_mask = _mm_set1_epi32((int)(1U << first_bit));
+    const __m128i second_mask = _mm_set1_epi32((int)(2U << first_bit));
+    const __m128 plus = _mm_set1_ps(amplitude);
+    const __m128 minus = _mm_set1_ps(-amplitude);
+    __m128i packed_val;
+    __m128 first_set, second_set, first, second;
+    const uint32_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            packed_val = _mm_loadu_si128((const __m128i*)packed_ptr);
+            first_set = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(packed_val, first_mask), first_mask));
+            second_set = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(packed_val, second_mask), second_mask));
+            first = _mm_or_ps(_mm_and_ps(first_set, plus), _mm_andnot_ps(first_set, minus));
+            second = _mm_or_ps(_mm_and_ps(second_set, plus), _mm_andnot_ps(second_set, minus));
+            _mm_storeu_ps(result_ptr, _mm_unpacklo_ps(first, second));
+            _mm_storeu_ps(result_ptr + 4, _mm_unpackhi_ps(first, second));
+
+            packed_ptr += 4;
+            result_ptr += 8;
+        }
+
+    for (number = sse_iters * 4; number < num_points; number++)
+        {
+            *result_ptr++ = ((*packed_ptr >> first_bit) & 1) ? amplitude : -amplitude;
+            *result_ptr++ = ((*packed_ptr >> (first_bit + 1)) & 1) ? amplitude : -amplitude;
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32u_unpack_onebit_32f_u_avx2(float* result, const uint32_t* packed, float amplitude, unsigned int first_bit, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 8;
+    unsigned int number;
+    const __m256i first_mask = _mm256_set1_epi32((int)(1U << first_bit));
+    const __m256i second_mask = _mm256_set1_epi32((int)(2U << first_bit));
+    const __m256 plus = _mm256_set1_ps(amplitude);
+    const __m256 minus = _mm256_set1_ps(-amplitude);
+    __m256i packed_val;
+    __m256 first, second, a, b;
+    const uint32_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            packed_val = _mm256_loadu_si256((const __m256i*)packed_ptr);
+            first = _mm256_blendv_ps(minus, plus, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(packed_val, first_mask), first_mask)));
+            second = _mm256_blendv_ps(minus, plus, _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(packed_val, second_mask), second_mask)));
+            // Interleaving works within each 128-bit lane, so the lanes are put back in order before storing
+            a = _mm256_unpacklo_ps(first, second);  // words 0-1 | 4-5
+            b = _mm256_unpackhi_ps(first, second);  // words 2-3 | 6-7
+            _mm256_storeu_ps(result_ptr, _mm256_permute2f128_ps(a, b, 0x20));
+            _mm256_storeu_ps(result_ptr + 8, _mm256_permute2f128_ps(a, b, 0x31));
+
+            packed_ptr += 8;
+            result_ptr += 16;
+        }
+
+    for (number = avx_iters * 8; number < num_points; number++)
+        {
+            *result_ptr++ = ((*packed_ptr >> first_bit) & 1) ? amplitude : -amplitude;
+            *result_ptr++ = ((*packed_ptr >> (first_bit + 1)) & 1) ? amplitude : -amplitude;
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32u_unpack_onebit_32f_neon(float* result, const uint32_t* packed, float amplitude, unsigned int first_bit, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    unsigned int number;
+    const uint32x4_t first_mask = vdupq_n_u32(1U << first_bit);
+    const uint32x4_t second_mask = vdupq_n_u32(2U << first_bit);
+    const float32x4_t plus = vdupq_n_f32(amplitude);
+    const float32x4_t minus = vdupq_n_f32(-amplitude);
+    uint32x4_t packed_val;
+    float32x4x2_t unpacked;
+    const uint32_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            packed_val = vld1q_u32(packed_ptr);
+            __VOLK_GNSSSDR_PREFETCH(packed_ptr + 4);
+            unpacked.val[0] = vbslq_f32(vtstq_u32(packed_val, first_mask), plus, minus);
+            unpacked.val[1] = vbslq_f32(vtstq_u32(packed_val, second_mask), plus, minus);
+            vst2q_f32(result_ptr, unpacked);
+
+            packed_ptr += 4;
+            result_ptr += 8;
+        }
+
+    for (number = neon_iters * 4; number < num_points; number++)
+        {
+            *result_ptr++ = ((*packed_ptr >> first_bit) & 1) ? amplitude : -amplitude;
+            *result_ptr++ = ((*packed_ptr >> (first_bit + 1)) & 1) ? amplitude : -amplitude;
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32u_unpack_onebit_32f_H */
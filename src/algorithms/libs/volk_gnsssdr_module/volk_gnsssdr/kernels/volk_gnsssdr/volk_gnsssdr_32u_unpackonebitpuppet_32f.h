@@ -0,0 +1,60 @@
+/*!
+ * \file volk_gnsssdr_32u_unpackonebitpuppet_32f.h
+ * \brief VOLK_GNSSSDR puppet for the 1-bit to float unpacker kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the 1-bit to float unpacker into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32u_unpackonebitpuppet_32f_H
+#define INCLUDED_volk_gnsssdr_32u_unpackonebitpuppet_32f_H
+
+#include "volk_gnsssdr/volk_gnsssdr_32u_unpack_onebit_32f.h"
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_32u_unpackonebitpuppet_32f_generic(float* result, const uint32_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_32u_unpack_onebit_32f_generic(result, packed, 32767.0F, 0, num_points / 2);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+static inline void volk_gnsssdr_32u_unpackonebitpuppet_32f_u_sse2(float* result, const uint32_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_32u_unpack_onebit_32f_u_sse2(result, packed, 32767.0F, 0, num_points / 2);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_32u_unpackonebitpuppet_32f_u_avx2(float* result, const uint32_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_32u_unpack_onebit_32f_u_avx2(result, packed, 32767.0F, 0, num_points / 2);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_32u_unpackonebitpuppet_32f_neon(float* result, const uint32_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_32u_unpack_onebit_32f_neon(result, packed, 32767.0F, 0, num_points / 2);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_gnsssdr_32u_unpackonebitpuppet_32f_H */
@@ -0,0 +1,235 @@
+/*!
+ * \file volk_gnsssdr_8ic_32f_fir_decimate_32fc.h
+ * \brief VOLK_GNSSSDR kernel: decimating FIR filter with 8-bit integer
+ * complex input, float taps and 32-bit float complex output.
+ *
+ * VOLK_GNSSSDR kernel that filters an 8-bit integer complex vector with real
+ * taps, computing only one output every \p decimation input samples.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8ic_32f_fir_decimate_32fc
+ *
+ * \b Overview
+ *
+ * Decimating FIR filter. The n-th output sample is the dot product of
+ * \p num_taps input samples, starting at in[n * decimation], and the taps:
+ *
+ * result[n] = sum_k in[n * decimation + k] * taps[k]
+ *
+ * Only the outputs that survive the decimation are computed, which is the
+ * cost of a polyphase decimator. The taps are given in the order they
+ * multiply the input, that is, the impulse response reversed. The input
+ * samples are converted to float without scaling.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8ic_32f_fir_decimate_32fc(lv_32fc_t* result, const lv_8sc_t* in, const float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li in:         Input samples, (num_points - 1) * decimation + num_taps of them.
+ * \li taps:       Filter taps.
+ * \li num_taps:   Number of taps.
+ * \li decimation: Input samples per output sample.
+ * \li num_points: Number of output samples.
+ *
+ * \b Outputs
+ * \li result:     Filtered samples.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8ic_32f_fir_decimate_32fc_H
+#define INCLUDED_volk_gnsssdr_8ic_32f_fir_decimate_32fc_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8ic_32f_fir_decimate_32fc_generic(lv_32fc_t* result, const lv_8sc_t* in, const float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+{
+    unsigned int n;
+    unsigned int k;
+    float real;
+    float imag;
+    const lv_8sc_t* in_ptr;
+    for (n = 0; n < num_points; n++)
+        {
+            in_ptr = in + n * decimation;
+            real = 0.0F;
+            imag = 0.0F;
+            for (k = 0; k < num_taps; k++)
+                {
+                    real += (float)lv_creal(in_ptr[k]) * taps[k];
+                    imag += (float)lv_cimag(in_ptr[k]) * taps[k];
+                }
+            result[n] = lv_cmake(real, imag);
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8ic_32f_fir_decimate_32fc_u_sse4_1(lv_32fc_t* result, const lv_8sc_t* in, const float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_taps / 4;
+    unsigned int n;
+    unsigned int k;
+    float real;
+    float imag;
+    __VOLK_ATTR_ALIGNED(16)
+    float sum[4];
+    __m128i samples;
+    __m128 taps_val, acc0, acc1;
+    const int8_t* in_ptr;
+    const float* taps_ptr;
+
+    for (n = 0; n < num_points; n++)
+        {
+            in_ptr = (const int8_t*)(in + n * decimation);
+            taps_ptr = taps;
+            acc0 = _mm_setzero_ps();
+            acc1 = _mm_setzero_ps();
+            for (k = 0; k < sse_iters; k++)
+                {
+                    // four complex samples, each one multiplied by its tap in both parts
+                    samples = _mm_loadl_epi64((const __m128i*)in_ptr);
+                    taps_val = _mm_loadu_ps(taps_ptr);
+                    acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(samples)), _mm_unpacklo_ps(taps_val, taps_val)));
+                    acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(samples, 4))), _mm_unpackhi_ps(taps_val, taps_val)));
+                    in_ptr += 8;
+                    taps_ptr += 4;
+                }
+            _mm_store_ps(sum, _mm_add_ps(acc0, acc1));
+            real = sum[0] + sum[2];
+            imag = sum[1] + sum[3];
+            for (k = sse_iters * 4; k < num_taps; k++)
+                {
+                    real += (float)(*in_ptr++) * (*taps_ptr);
+                    imag += (float)(*in_ptr++) * (*taps_ptr++);
+                }
+            result[n] = lv_cmake(real, imag);
+        }
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8ic_32f_fir_decimate_32fc_u_avx2(lv_32fc_t* result, const lv_8sc_t* in, const float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_taps / 8;
+    unsigned int n;
+    unsigned int k;
+    float real;
+    float imag;
+    __VOLK_ATTR_ALIGNED(16)
+    float sum[4];
+    __m128i samples;
+    __m256 taps_val, acc0, acc1;
+    __m128 acc;
+    const __m256i duplicate_low = _mm256_set_epi32(3, 3, 2, 2, 1, 1, 0, 0);
+    const __m256i duplicate_high = _mm256_set_epi32(7, 7, 6, 6, 5, 5, 4, 4);
+    const int8_t* in_ptr;
+    const float* taps_ptr;
+
+    for (n = 0; n < num_points; n++)
+        {
+            in_ptr = (const int8_t*)(in + n * decimation);
+            taps_ptr = taps;
+            acc0 = _mm256_setzero_ps();
+            acc1 = _mm256_setzero_ps();
+            for (k = 0; k < avx_iters; k++)
+                {
+                    // eight complex samples, each one multiplied by its tap in both parts
+                    samples = _mm_loadu_si128((const __m128i*)in_ptr);
+                    taps_val = _mm256_loadu_ps(taps_ptr);
+                    acc0 = _mm256_add_ps(acc0, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(samples)), _mm256_permutevar8x32_ps(taps_val, duplicate_low)));
+                    acc1 = _mm256_add_ps(acc1, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(samples, 8))), _mm256_permutevar8x32_ps(taps_val, duplicate_high)));
+                    in_ptr += 16;
+                    taps_ptr += 8;
+                }
+            acc0 = _mm256_add_ps(acc0, acc1);
+            acc = _mm_add_ps(_mm256_castps256_ps128(acc0), _mm256_extractf128_ps(acc0, 1));
+            _mm_store_ps(sum, acc);
+            real = sum[0] + sum[2];
+            imag = sum[1] + sum[3];
+            for (k = avx_iters * 8; k < num_taps; k++)
+                {
+                    real += (float)(*in_ptr++) * (*taps_ptr);
+                    imag += (float)(*in_ptr++) * (*taps_ptr++);
+                }
+            result[n] = lv_cmake(real, imag);
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8ic_32f_fir_decimate_32fc_neon(lv_32fc_t* result, const lv_8sc_t* in, const float* taps, unsigned int num_taps, unsigned int decimation, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_taps / 4;
+    unsigned int n;
+    unsigned int k;
+    float real;
+    float imag;
+    int16x8_t samples;
+    float32x4_t taps_val, acc0, acc1;
+    float32x4x2_t taps_dup;
+    float32x2_t acc;
+    const int8_t* in_ptr;
+    const float* taps_ptr;
+
+    for (n = 0; n < num_points; n++)
+        {
+            in_ptr = (const int8_t*)(in + n * decimation);
+            taps_ptr = taps;
+            acc0 = vdupq_n_f32(0.0F);
+            acc1 = vdupq_n_f32(0.0F);
+            for (k = 0; k < neon_iters; k++)
+                {
+                    samples = vmovl_s8(vld1_s8(in_ptr));
+                    taps_val = vld1q_f32(taps_ptr);
+                    __VOLK_GNSSSDR_PREFETCH(in_ptr + 8);
+                    taps_dup = vzipq_f32(taps_val, taps_val);
+                    acc0 = vmlaq_f32(acc0, vcvtq_f32_s32(vmovl_s16(vget_low_s16(samples))), taps_dup.val[0]);
+                    acc1 = vmlaq_f32(acc1, vcvtq_f32_s32(vmovl_s16(vget_high_s16(samples))), taps_dup.val[1]);
+                    in_ptr += 8;
+                    taps_ptr += 4;
+                }
+            acc0 = vaddq_f32(acc0, acc1);
+            acc = vadd_f32(vget_low_f32(acc0), vget_high_f32(acc0));
+            real = vget_lane_f32(acc, 0);
+            imag = vget_lane_f32(acc, 1);
+            for (k = neon_iters * 4; k < num_taps; k++)
+                {
+                    real += (float)(*in_ptr++) * (*taps_ptr);
+                    imag += (float)(*in_ptr++) * (*taps_ptr++);
+                }
+            result[n] = lv_cmake(real, imag);
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8ic_32f_fir_decimate_32fc_H */
@@ -0,0 +1,206 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_fourbit_32f.h
+ * \brief VOLK_GNSSSDR kernel: unpacks bytes holding two 4-bit samples into
+ * 32-bit floating point samples.
+ *
+ * VOLK_GNSSSDR kernel that unpacks bytes holding two 4-bit samples into
+ * 32-bit floating point samples, using a look-up table for the sample values.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_fourbit_32f
+ *
+ * \b Overview
+ *
+ * Unpacks a vector of bytes, each one holding two 4-bit samples, into a
+ * vector of floats. The value of each nibble is the index into
+ * \p levels, and the low nibble of each byte is written first unless
+ * \p high_nibble_first is not zero.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_fourbit_32f(float* result, const uint8_t* packed, const int8_t* levels, unsigned int high_nibble_first, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed:            Bytes to unpack.
+ * \li levels:            The sixteen sample values, indexed by the 4-bit code.
+ * \li high_nibble_first: Writes the high nibble of each byte first if not zero.
+ * \li num_points:        Number of bytes in \p packed.
+ *
+ * \b Outputs
+ * \li result:            Unpacked samples, 2 * \p num_points values.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_fourbit_32f_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_fourbit_32f_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_fourbit_32f_generic(float* result, const uint8_t* packed, const int8_t* levels, unsigned int high_nibble_first, unsigned int num_points)
+{
+    const unsigned int first_shift = high_nibble_first ? 4 : 0;
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            *result++ = (float)levels[(packed[n] >> first_shift) & 0x0F];
+            *result++ = (float)levels[(packed[n] >> (4 - first_shift)) & 0x0F];
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_fourbit_32f_u_sse4_1(float* result, const uint8_t* packed, const int8_t* levels, unsigned int high_nibble_first, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 16;
+    const unsigned int first_shift = high_nibble_first ? 4 : 0;
+    unsigned int number;
+    const __m128i lut = _mm_loadu_si128((const __m128i*)levels);
+    const __m128i first_count = _mm_cvtsi32_si128((int)first_shift);
+    const __m128i second_count = _mm_cvtsi32_si128((int)(4 - first_shift));
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i packed_val, first, second, a, b;
+    const uint8_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            packed_val = _mm_loadu_si128((const __m128i*)packed_ptr);
+            first = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srl_epi16(packed_val, first_count), nibble_mask));
+            second = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srl_epi16(packed_val, second_count), nibble_mask));
+            a = _mm_unpacklo_epi8(first, second);
+            b = _mm_unpackhi_epi8(first, second);
+            _mm_storeu_ps(result_ptr, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(a)));
+            _mm_storeu_ps(result_ptr + 4, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(a, 4))));
+            _mm_storeu_ps(result_ptr + 8, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(a, 8))));
+            _mm_storeu_ps(result_ptr + 12, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(a, 12))));
+            _mm_storeu_ps(result_ptr + 16, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(b)));
+            _mm_storeu_ps(result_ptr + 20, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(b, 4))));
+            _mm_storeu_ps(result_ptr + 24, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(b, 8))));
+            _mm_storeu_ps(result_ptr + 28, _mm_cvtepi32_ps(_mm_cvtepi8_epi32(_mm_srli_si128(b, 12))));
+
+            packed_ptr += 16;
+            result_ptr += 32;
+        }
+
+    for (number = sse_iters * 16; number < num_points; number++)
+        {
+            *result_ptr++ = (float)levels[(*packed_ptr >> first_shift) & 0x0F];
+            *result_ptr++ = (float)levels[(*packed_ptr >> (4 - first_shift)) & 0x0F];
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_fourbit_32f_u_avx2(float* result, const uint8_t* packed, const int8_t* levels, unsigned int high_nibble_first, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 16;
+    const unsigned int first_shift = high_nibble_first ? 4 : 0;
+    unsigned int number;
+    const __m128i lut = _mm_loadu_si128((const __m128i*)levels);
+    const __m128i first_count = _mm_cvtsi32_si128((int)first_shift);
+    const __m128i second_count = _mm_cvtsi32_si128((int)(4 - first_shift));
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    __m128i packed_val, first, second, a, b;
+    const uint8_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            packed_val = _mm_loadu_si128((const __m128i*)packed_ptr);
+            first = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srl_epi16(packed_val, first_count), nibble_mask));
+            second = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srl_epi16(packed_val, second_count), nibble_mask));
+            a = _mm_unpacklo_epi8(first, second);
+            b = _mm_unpackhi_epi8(first, second);
+            _mm256_storeu_ps(result_ptr, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(a)));
+            _mm256_storeu_ps(result_ptr + 8, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(a, 8))));
+            _mm256_storeu_ps(result_ptr + 16, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(b)));
+            _mm256_storeu_ps(result_ptr + 24, _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(_mm_srli_si128(b, 8))));
+
+            packed_ptr += 16;
+            result_ptr += 32;
+        }
+
+    for (number = avx_iters * 16; number < num_points; number++)
+        {
+            *result_ptr++ = (float)levels[(*packed_ptr >> first_shift) & 0x0F];
+            *result_ptr++ = (float)levels[(*packed_ptr >> (4 - first_shift)) & 0x0F];
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_fourbit_32f_neon(float* result, const uint8_t* packed, const int8_t* levels, unsigned int high_nibble_first, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 8;
+    const unsigned int first_shift = high_nibble_first ? 4 : 0;
+    unsigned int number;
+    int8x8x2_t lut;
+    int16x8_t first, second;
+    float32x4x2_t unpacked;
+    uint8x8_t packed_val;
+    const int8x8_t first_count = vdup_n_s8(-(int8_t)first_shift);  // negative counts shift right
+    const int8x8_t second_count = vdup_n_s8((int8_t)first_shift - 4);
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    const uint8_t* packed_ptr = packed;
+    float* result_ptr = result;
+
+    lut.val[0] = vld1_s8(levels);
+    lut.val[1] = vld1_s8(levels + 8);
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            packed_val = vld1_u8(packed_ptr);
+            __VOLK_GNSSSDR_PREFETCH(packed_ptr + 8);
+            first = vmovl_s8(vtbl2_s8(lut, vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, first_count), nibble_mask))));
+            second = vmovl_s8(vtbl2_s8(lut, vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, second_count), nibble_mask))));
+            unpacked.val[0] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(first)));
+            unpacked.val[1] = vcvtq_f32_s32(vmovl_s16(vget_low_s16(second)));
+            vst2q_f32(result_ptr, unpacked);
+            unpacked.val[0] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(first)));
+            unpacked.val[1] = vcvtq_f32_s32(vmovl_s16(vget_high_s16(second)));
+            vst2q_f32(result_ptr + 8, unpacked);
+
+            packed_ptr += 8;
+            result_ptr += 16;
+        }
+
+    for (number = neon_iters * 8; number < num_points; number++)
+        {
+            *result_ptr++ = (float)levels[(*packed_ptr >> first_shift) & 0x0F];
+            *result_ptr++ = (float)levels[(*packed_ptr >> (4 - first_shift)) & 0x0F];
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_fourbit_32f_H */
@@ -0,0 +1,261 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_twobit_16i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks bytes holding four 2-bit samples into
+ * 16-bit integer samples.
+ *
+ * VOLK_GNSSSDR kernel that unpacks bytes holding four 2-bit samples into
+ * 16-bit integer samples, using a look-up table for the sample values.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_twobit_16i
+ *
+ * \b Overview
+ *
+ * Unpacks a vector of bytes, each one holding four 2-bit samples, into a
+ * vector of 16-bit integers. The fields of each byte are read as in
+ * volk_gnsssdr_8u_unpack_twobit_8i.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_twobit_16i(int16_t* result, const uint8_t* packed, const int8_t* levels, unsigned int order, unsigned int num_points)
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed:     Bytes to unpack.
+ * \li levels:     The four sample values, indexed by the 2-bit code.
+ * \li order:      Order of the 2-bit fields in the output: bits 2k and 2k+1
+ *                 are the field that goes to the k-th output sample of each byte.
+ * \li num_points: Number of bytes in \p packed.
+ *
+ * \b Outputs
+ * \li result:     Unpacked samples, 4 * \p num_points values.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_twobit_16i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_twobit_16i_H
+
+#include <inttypes.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_twobit_16i_generic(int16_t* result, const uint8_t* packed, const int8_t* levels, unsigned int order, unsigned int num_points)
+{
+    unsigned int n;
+    unsigned int k;
+    for (n = 0; n < num_points; n++)
+        {
+            for (k = 0; k < 4; k++)
+                {
+                    *result++ = (int16_t)levels[(packed[n] >> (2 * ((order >> (2 * k)) & 3))) & 3];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE4_1
+#include <smmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_twobit_16i_u_sse4_1(int16_t* result, const uint8_t* packed, const int8_t* levels, unsigned int order, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 16;
+    unsigned int number;
+    unsigned int k;
+    unsigned int field;
+    int8_t lut[4][16];
+    __m128i luts[4], shifts[4], fields[4], unpacked[4];
+    __m128i packed_val, a, b;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const uint8_t* packed_ptr = packed;
+    int16_t* result_ptr = result;
+
+    // The k-th output field is looked up in a 16-entry table with the nibble that holds it
+    for (k = 0; k < 4; k++)
+        {
+            field = (order >> (2 * k)) & 3;
+            for (number = 0; number < 16; number++)
+                {
+                    lut[k][number] = levels[(number >> (2 * (field & 1))) & 3];
+                }
+            luts[k] = _mm_loadu_si128((const __m128i*)lut[k]);
+            shifts[k] = _mm_cvtsi32_si128((int)(4 * (field >> 1)));
+        }
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            packed_val = _mm_loadu_si128((const __m128i*)packed_ptr);
+            fields[0] = _mm_shuffle_epi8(luts[0], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[0]), nibble_mask));
+            fields[1] = _mm_shuffle_epi8(luts[1], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[1]), nibble_mask));
+            fields[2] = _mm_shuffle_epi8(luts[2], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[2]), nibble_mask));
+            fields[3] = _mm_shuffle_epi8(luts[3], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[3]), nibble_mask));
+
+            a = _mm_unpacklo_epi8(fields[0], fields[1]);
+            b = _mm_unpacklo_epi8(fields[2], fields[3]);
+            unpacked[0] = _mm_unpacklo_epi16(a, b);
+            unpacked[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(fields[0], fields[1]);
+            b = _mm_unpackhi_epi8(fields[2], fields[3]);
+            unpacked[2] = _mm_unpacklo_epi16(a, b);
+            unpacked[3] = _mm_unpackhi_epi16(a, b);
+            _mm_storeu_si128((__m128i*)result_ptr, _mm_cvtepi8_epi16(unpacked[0]));
+            _mm_storeu_si128((__m128i*)(result_ptr + 8), _mm_cvtepi8_epi16(_mm_srli_si128(unpacked[0], 8)));
+            _mm_storeu_si128((__m128i*)(result_ptr + 16), _mm_cvtepi8_epi16(unpacked[1]));
+            _mm_storeu_si128((__m128i*)(result_ptr + 24), _mm_cvtepi8_epi16(_mm_srli_si128(unpacked[1], 8)));
+            _mm_storeu_si128((__m128i*)(result_ptr + 32), _mm_cvtepi8_epi16(unpacked[2]));
+            _mm_storeu_si128((__m128i*)(result_ptr + 40), _mm_cvtepi8_epi16(_mm_srli_si128(unpacked[2], 8)));
+            _mm_storeu_si128((__m128i*)(result_ptr + 48), _mm_cvtepi8_epi16(unpacked[3]));
+            _mm_storeu_si128((__m128i*)(result_ptr + 56), _mm_cvtepi8_epi16(_mm_srli_si128(unpacked[3], 8)));
+
+            packed_ptr += 16;
+            result_ptr += 64;
+        }
+
+    for (number = sse_iters * 16; number < num_points; number++)
+        {
+            for (k = 0; k < 4; k++)
+                {
+                    *result_ptr++ = (int16_t)levels[(*packed_ptr >> (2 * ((order >> (2 * k)) & 3))) & 3];
+                }
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_SSE4_1 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_twobit_16i_u_avx2(int16_t* result, const uint8_t* packed, const int8_t* levels, unsigned int order, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 16;
+    unsigned int number;
+    unsigned int k;
+    unsigned int field;
+    int8_t lut[4][16];
+    __m128i luts[4], shifts[4], fields[4], unpacked[4];
+    __m128i packed_val, a, b;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const uint8_t* packed_ptr = packed;
+    int16_t* result_ptr = result;
+
+    for (k = 0; k < 4; k++)
+        {
+            field = (order >> (2 * k)) & 3;
+            for (number = 0; number < 16; number++)
+                {
+                    lut[k][number] = levels[(number >> (2 * (field & 1))) & 3];
+                }
+            luts[k] = _mm_loadu_si128((const __m128i*)lut[k]);
+            shifts[k] = _mm_cvtsi32_si128((int)(4 * (field >> 1)));
+        }
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            packed_val = _mm_loadu_si128((const __m128i*)packed_ptr);
+            fields[0] = _mm_shuffle_epi8(luts[0], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[0]), nibble_mask));
+            fields[1] = _mm_shuffle_epi8(luts[1], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[1]), nibble_mask));
+            fields[2] = _mm_shuffle_epi8(luts[2], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[2]), nibble_mask));
+            fields[3] = _mm_shuffle_epi8(luts[3], _mm_and_si128(_mm_srl_epi16(packed_val, shifts[3]), nibble_mask));
+
+            a = _mm_unpacklo_epi8(fields[0], fields[1]);
+            b = _mm_unpacklo_epi8(fields[2], fields[3]);
+            unpacked[0] = _mm_unpacklo_epi16(a, b);
+            unpacked[1] = _mm_unpackhi_epi16(a, b);
+            a = _mm_unpackhi_epi8(fields[0], fields[1]);
+            b = _mm_unpackhi_epi8(fields[2], fields[3]);
+            unpacked[2] = _mm_unpacklo_epi16(a, b);
+            unpacked[3] = _mm_unpackhi_epi16(a, b);
+            _mm256_storeu_si256((__m256i*)result_ptr, _mm256_cvtepi8_epi16(unpacked[0]));
+            _mm256_storeu_si256((__m256i*)(result_ptr + 16), _mm256_cvtepi8_epi16(unpacked[1]));
+            _mm256_storeu_si256((__m256i*)(result_ptr + 32), _mm256_cvtepi8_epi16(unpacked[2]));
+            _mm256_storeu_si256((__m256i*)(result_ptr + 48), _mm256_cvtepi8_epi16(unpacked[3]));
+
+            packed_ptr += 16;
+            result_ptr += 64;
+        }
+
+    for (number = avx_iters * 16; number < num_points; number++)
+        {
+            for (k = 0; k < 4; k++)
+                {
+                    *result_ptr++ = (int16_t)levels[(*packed_ptr >> (2 * ((order >> (2 * k)) & 3))) & 3];
+                }
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_twobit_16i_neon(int16_t* result, const uint8_t* packed, const int8_t* levels, unsigned int order, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 8;
+    unsigned int number;
+    unsigned int k;
+    unsigned int field;
+    int8_t lut[4][16];
+    int8x8x2_t luts[4];
+    int8x8_t shifts[4];
+    int16x8x4_t fields;
+    uint8x8_t packed_val;
+    const uint8x8_t nibble_mask = vdup_n_u8(0x0F);
+    const uint8_t* packed_ptr = packed;
+    int16_t* result_ptr = result;
+
+    for (k = 0; k < 4; k++)
+        {
+            field = (order >> (2 * k)) & 3;
+            for (number = 0; number < 16; number++)
+                {
+                    lut[k][number] = levels[(number >> (2 * (field & 1))) & 3];
+                }
+            luts[k].val[0] = vld1_s8(lut[k]);
+            luts[k].val[1] = vld1_s8(lut[k] + 8);
+            shifts[k] = vdup_n_s8(-4 * (int8_t)(field >> 1));  // negative counts shift right
+        }
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            packed_val = vld1_u8(packed_ptr);
+            __VOLK_GNSSSDR_PREFETCH(packed_ptr + 8);
+            fields.val[0] = vmovl_s8(vtbl2_s8(luts[0], vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, shifts[0]), nibble_mask))));
+            fields.val[1] = vmovl_s8(vtbl2_s8(luts[1], vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, shifts[1]), nibble_mask))));
+            fields.val[2] = vmovl_s8(vtbl2_s8(luts[2], vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, shifts[2]), nibble_mask))));
+            fields.val[3] = vmovl_s8(vtbl2_s8(luts[3], vreinterpret_s8_u8(vand_u8(vshl_u8(packed_val, shifts[3]), nibble_mask))));
+            vst4q_s16(result_ptr, fields);
+
+            packed_ptr += 8;
+            result_ptr += 32;
+        }
+
+    for (number = neon_iters * 8; number < num_points; number++)
+        {
+            for (k = 0; k < 4; k++)
+                {
+                    *result_ptr++ = (int16_t)levels[(*packed_ptr >> (2 * ((order >> (2 * k)) & 3))) & 3];
+                }
+            packed_ptr++;
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_twobit_16i_H */
@@ -0,0 +1,64 @@
+/*!
+ * \file volk_gnsssdr_8u_unpacktwobitpuppet_8i.h
+ * \brief VOLK_GNSSSDR puppet for the 2-bit to 8-bit integer unpacker kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the 2-bit to 8-bit integer unpacker into the test system
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpacktwobitpuppet_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpacktwobitpuppet_8i_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_unpack_twobit_8i.h"
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_8u_unpacktwobitpuppet_8i_generic(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const int8_t levels[4] = {1, 3, -3, -1};
+    volk_gnsssdr_8u_unpack_twobit_8i_generic(result, packed, levels, 0x1B, num_points / 4);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSSE3
+static inline void volk_gnsssdr_8u_unpacktwobitpuppet_8i_u_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const int8_t levels[4] = {1, 3, -3, -1};
+    volk_gnsssdr_8u_unpack_twobit_8i_u_ssse3(result, packed, levels, 0x1B, num_points / 4);
+}
+
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_8u_unpacktwobitpuppet_8i_u_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const int8_t levels[4] = {1, 3, -3, -1};
+    volk_gnsssdr_8u_unpack_twobit_8i_u_avx2(result, packed, levels, 0x1B, num_points / 4);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_8u_unpacktwobitpuppet_8i_neon(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const int8_t levels[4] = {1, 3, -3, -1};
+    volk_gnsssdr_8u_unpack_twobit_8i_neon(result, packed, levels, 0x1B, num_points / 4);
+}
+
+#endif /* LV_HAVE_NEON */
+
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpacktwobitpuppet_8i_H */
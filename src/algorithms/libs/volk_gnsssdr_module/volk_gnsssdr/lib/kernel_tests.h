@@ -87,6 +87,16 @@ std::vector<volk_gnsssdr_test_case_t> init_test_list(volk_gnsssdr_test_params_t
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_x2_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_x2_rotator_dot_prod_32fc_xn, test_params_inacc))
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_rotator_dot_prod_32fc_xn, test_params_inacc));
     QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_32f_high_dynamic_rotator_dotprodxnpuppet_32fc, volk_gnsssdr_32fc_32f_high_dynamic_rotator_dot_prod_32fc_xn, test_params_inacc));
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpacktwobitpuppet_8i, volk_gnsssdr_8u_unpack_twobit_8i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpacktwobitpuppet_16i, volk_gnsssdr_8u_unpack_twobit_16i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpacktwobitpuppet_32f, volk_gnsssdr_8u_unpack_twobit_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpackfourbitpuppet_8i, volk_gnsssdr_8u_unpack_fourbit_8i, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8u_unpackfourbitpuppet_32f, volk_gnsssdr_8u_unpack_fourbit_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32u_unpackonebitpuppet_32f, volk_gnsssdr_32u_unpack_onebit_32f, test_params))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_16ic_32f_firdecimatepuppet_32fc, volk_gnsssdr_16ic_32f_fir_decimate_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_8ic_32f_firdecimatepuppet_32fc, volk_gnsssdr_8ic_32f_fir_decimate_32fc, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_segmentenergypuppet_32f, volk_gnsssdr_32fc_segment_energy_32f, test_params_inacc))
+    QA(VOLK_INIT_PUPP(volk_gnsssdr_32fc_weightedsumxnpuppet_32fc, volk_gnsssdr_32fc_xn_weighted_sum_32fc, test_params_inacc))
 
     return test_cases;
 }
@@ -17,9 +17,7 @@
 
 #include "direct_resampler_conditioner.h"
 #include "configuration_interface.h"
-#include "direct_resampler_conditioner_cb.h"
-#include "direct_resampler_conditioner_cc.h"
-#include "direct_resampler_conditioner_cs.h"
+#include "interpolating_resampler.h"
 #include <glog/logging.h>
 #include <gnuradio/blocks/file_sink.h>
 #include <volk/volk.h>  // for lv_8sc_t
@@ -48,31 +46,31 @@ DirectResamplerConditioner::DirectResamplerConditioner(
     dump_ = configuration->property(role + ".dump", false);
     DLOG(INFO) << "dump_ is " << dump_;
     dump_filename_ = configuration->property(role + ".dump_filename", default_dump_file);
-
-    if (item_type_ == "gr_complex")
-        {
-            item_size_ = sizeof(gr_complex);
-            resampler_ = direct_resampler_make_conditioner_cc(sample_freq_in_, sample_freq_out_);
-            DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
-            DLOG(INFO) << "sample_freq_out" << sample_freq_out_;
-            DLOG(INFO) << "Item size " << item_size_;
-            DLOG(INFO) << "resampler(" << resampler_->unique_id() << ")";
-        }
-    else if (item_type_ == "cshort")
+    interpolation_ = configuration->property(role + ".interpolation", std::string("nearest"));
+    if (interpolation_ != "nearest" && interpolation_ != "linear" && interpolation_ != "cubic")
         {
-            item_size_ = sizeof(lv_16sc_t);
-            resampler_ = direct_resampler_make_conditioner_cs(sample_freq_in_, sample_freq_out_);
-            DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
-            DLOG(INFO) << "sample_freq_out" << sample_freq_out_;
-            DLOG(INFO) << "Item size " << item_size_;
-            DLOG(INFO) << "resampler(" << resampler_->unique_id() << ")";
+            LOG(WARNING) << interpolation_ << " unrecognized interpolation for resampler, using nearest";
+            interpolation_ = "nearest";
         }
-    else if (item_type_ == "cbyte")
+
+    if (item_type_ == "gr_complex" || item_type_ == "cshort" || item_type_ == "cbyte")
         {
-            item_size_ = sizeof(lv_8sc_t);
-            resampler_ = direct_resampler_make_conditioner_cb(sample_freq_in_, sample_freq_out_);
+            if (item_type_ == "gr_complex")
+                {
+                    item_size_ = sizeof(gr_complex);
+                }
+            else if (item_type_ == "cshort")
+                {
+                    item_size_ = sizeof(lv_16sc_t);
+                }
+            else
+                {
+                    item_size_ = sizeof(lv_8sc_t);
+                }
+            resampler_ = make_interpolating_resampler(item_type_, sample_freq_in_, sample_freq_out_, interpolation_);
             DLOG(INFO) << "sample_freq_in " << sample_freq_in_;
             DLOG(INFO) << "sample_freq_out" << sample_freq_out_;
+            DLOG(INFO) << "interpolation " << interpolation_;
             DLOG(INFO) << "Item size " << item_size_;
             DLOG(INFO) << "resampler(" << resampler_->unique_id() << ")";
         }
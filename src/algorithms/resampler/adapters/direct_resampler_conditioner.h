@@ -34,6 +34,9 @@ class ConfigurationInterface;
 /*!
  * \brief Interface of an adapter of a direct resampler conditioner block
  * to a SignalConditionerInterface
+ *
+ * The "interpolation" property selects "nearest" (default, the samples of the
+ * direct resampler), "linear" or "cubic" interpolation.
  */
 class DirectResamplerConditioner : public GNSSBlockInterface
 {
@@ -71,6 +74,7 @@ private:
     std::string role_;
     std::string item_type_;
     std::string dump_filename_;
+    std::string interpolation_;
     double sample_freq_in_;
     double sample_freq_out_;
     size_t item_size_;
@@ -0,0 +1,330 @@
+/*!
+ * \file interpolating_resampler.cc
+ * \brief Resampler for gr_complex, cshort and cbyte samples that computes the
+ * input positions of a block of outputs at once, with nearest-neighbour,
+ * linear or cubic interpolation.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "interpolating_resampler.h"
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <algorithm>  // for std::min, std::max
+#include <cmath>      // for std::floor, std::ceil
+#include <stdexcept>  // for std::invalid_argument
+
+
+namespace
+{
+// Outputs whose positions are computed together. The position arrays and
+// the samples they point to stay in the cache.
+const int RESAMPLER_BLOCK_ITEMS = 2048;
+
+const double TWO_32 = 4294967296.0;
+
+
+template <typename T>
+void gather(const void* input, const int32_t* index, void* output, int noutput_items)
+{
+    const auto* in = reinterpret_cast<const T*>(input);
+    auto* out = reinterpret_cast<T*>(output);
+    for (int k = 0; k < noutput_items; k++)
+        {
+            out[k] = in[index[k]];
+        }
+}
+}  // namespace
+
+
+interpolating_resampler_sptr make_interpolating_resampler(
+    const std::string& item_type,
+    double sample_freq_in,
+    double sample_freq_out,
+    const std::string& interpolation)
+{
+    interpolating_resampler::Item_Kind item_kind;
+    size_t item_size;
+    if (item_type == "gr_complex")
+        {
+            item_kind = interpolating_resampler::Item_Kind::gr_complex;
+            item_size = sizeof(gr_complex);
+        }
+    else if (item_type == "cshort")
+        {
+            item_kind = interpolating_resampler::Item_Kind::cshort;
+            item_size = sizeof(lv_16sc_t);
+        }
+    else if (item_type == "cbyte")
+        {
+            item_kind = interpolating_resampler::Item_Kind::cbyte;
+            item_size = sizeof(lv_8sc_t);
+        }
+    else
+        {
+            throw std::invalid_argument("interpolating_resampler: unsupported item type " + item_type);
+        }
+
+    interpolating_resampler::Interpolation mode;
+    if (interpolation == "nearest")
+        {
+            mode = interpolating_resampler::Interpolation::nearest;
+        }
+    else if (interpolation == "linear")
+        {
+            mode = interpolating_resampler::Interpolation::linear;
+        }
+    else if (interpolation == "cubic")
+        {
+            mode = interpolating_resampler::Interpolation::cubic;
+        }
+    else
+        {
+            throw std::invalid_argument("interpolating_resampler: unsupported interpolation " + interpolation);
+        }
+
+    return interpolating_resampler_sptr(new interpolating_resampler(item_kind, item_size, sample_freq_in, sample_freq_out, mode));
+}
+
+
+interpolating_resampler::interpolating_resampler(Item_Kind item_kind,
+    size_t item_size,
+    double sample_freq_in,
+    double sample_freq_out,
+    Interpolation interpolation)
+    : gr::block("interpolating_resampler",
+          gr::io_signature::make(1, 1, item_size),
+          gr::io_signature::make(1, 1, item_size)),
+      d_index(RESAMPLER_BLOCK_ITEMS),
+      d_mu(RESAMPLER_BLOCK_ITEMS),
+      d_item_kind(item_kind),
+      d_interpolation(interpolation),
+      d_item_size(item_size),
+      d_sample_freq_in(sample_freq_in),
+      d_sample_freq_out(sample_freq_out),
+      d_ratio(sample_freq_in / sample_freq_out),
+      d_time(0.0),
+      d_before(interpolation == Interpolation::cubic ? 1 : 0),
+      d_after(interpolation == Interpolation::nearest ? 0 : (interpolation == Interpolation::linear ? 1 : 2)),
+      d_phase(0),
+      d_lphase(0)
+{
+    // Same phase step as direct_resampler_conditioner_cc, the ratio times
+    // 2^32. Equal rates wrap to a zero step, which outputs every sample.
+    if (d_sample_freq_in >= d_sample_freq_out)
+        {
+            d_phase_step = static_cast<uint32_t>(static_cast<uint64_t>(std::floor(TWO_32 * sample_freq_out / sample_freq_in)));
+        }
+    else
+        {
+            d_phase_step = static_cast<uint32_t>(static_cast<uint64_t>(std::floor(TWO_32 * sample_freq_in / sample_freq_out)));
+        }
+    d_time = static_cast<double>(d_before);
+    if (d_interpolation != Interpolation::nearest)
+        {
+            d_converted.resize(static_cast<size_t>(std::ceil(RESAMPLER_BLOCK_ITEMS * d_ratio)) + 4);
+            d_interpolated.resize(RESAMPLER_BLOCK_ITEMS);
+        }
+    set_relative_rate(sample_freq_out / sample_freq_in);
+}
+
+
+void interpolating_resampler::forecast(int noutput_items,
+    gr_vector_int& ninput_items_required)
+{
+    const int nreqd = std::max(1, static_cast<int>(std::ceil(d_time + static_cast<double>(noutput_items + 1) * d_ratio)) + d_after);
+    for (auto& ninput_items : ninput_items_required)
+        {
+            ninput_items = nreqd;
+        }
+}
+
+
+int interpolating_resampler::nearest_positions(int ninput_items, int noutput_items, int& consumed)
+{
+    int noutputs = noutput_items;
+    if (d_phase_step == 0)
+        {
+            noutputs = std::min(noutput_items, ninput_items);
+            for (int k = 0; k < noutputs; k++)
+                {
+                    d_index[k] = k;
+                }
+            consumed = noutputs;
+            return noutputs;
+        }
+    if (d_sample_freq_in >= d_sample_freq_out)
+        {
+            // An input sample is output when the phase accumulator wraps. The
+            // j-th wrap from now happens at the input sample
+            // ceil((j * 2^32 - phase) / phase_step), and the quotient is exact
+            // in double precision for the block sizes used here
+            const double phase = d_phase;
+            const double step = d_phase_step;
+            const int first_wrap = (d_phase <= d_lphase) ? 0 : 1;
+            for (int k = 0; k < noutputs; k++)
+                {
+                    d_index[k] = static_cast<int32_t>((static_cast<double>(k + first_wrap) * TWO_32 - phase + step - 1.0) / step);
+                }
+            if (first_wrap == 0)
+                {
+                    d_index[0] = 0;
+                }
+            while (noutputs > 0 && d_index[noutputs - 1] >= ninput_items)
+                {
+                    noutputs--;
+                }
+            // Without more outputs in this input, all of it is consumed
+            consumed = (noutputs == noutput_items) ? d_index[noutputs - 1] + 1 : ninput_items;
+            if (consumed > 0)
+                {
+                    d_lphase = d_phase + static_cast<uint32_t>(consumed - 1) * d_phase_step;
+                    d_phase += static_cast<uint32_t>(consumed) * d_phase_step;
+                }
+            return noutputs;
+        }
+
+    // The input sample advances each time the phase accumulator wraps
+    for (int k = 0; k < noutputs; k++)
+        {
+            d_index[k] = static_cast<int32_t>((static_cast<uint64_t>(d_phase) + static_cast<uint64_t>(k + 1) * d_phase_step) >> 32);
+        }
+    while (noutputs > 0 && d_index[noutputs - 1] >= ninput_items)
+        {
+            noutputs--;
+        }
+    consumed = (noutputs > 0) ? d_index[noutputs - 1] : 0;
+    d_phase += static_cast<uint32_t>(noutputs) * d_phase_step;
+    return noutputs;
+}
+
+
+int interpolating_resampler::fractional_positions(int ninput_items, int noutput_items, int& consumed)
+{
+    int noutputs = noutput_items;
+    for (int k = 0; k < noutputs; k++)
+        {
+            const double position = d_time + static_cast<double>(k) * d_ratio;
+            d_index[k] = static_cast<int32_t>(position);
+            d_mu[k] = static_cast<float>(position - static_cast<double>(d_index[k]));
+        }
+    while (noutputs > 0 && d_index[noutputs - 1] + d_after >= ninput_items)
+        {
+            noutputs--;
+        }
+
+    // Keep the samples that the next output needs before its position
+    const double next_time = d_time + static_cast<double>(noutputs) * d_ratio;
+    consumed = std::min(ninput_items, std::max(0, static_cast<int>(next_time) - d_before));
+    d_time = next_time - static_cast<double>(consumed);
+    return noutputs;
+}
+
+
+void interpolating_resampler::interpolate(const gr_complex* in, int first, gr_complex* out, int noutput_items) const
+{
+    if (d_interpolation == Interpolation::linear)
+        {
+            for (int k = 0; k < noutput_items; k++)
+                {
+                    const gr_complex* x = in + (d_index[k] - first);
+                    out[k] = x[0] + d_mu[k] * (x[1] - x[0]);
+                }
+            return;
+        }
+
+    // Farrow structure of the cubic Lagrange interpolator on x[-1] ... x[2]
+    for (int k = 0; k < noutput_items; k++)
+        {
+            const gr_complex* x = in + (d_index[k] - first);
+            const float mu = d_mu[k];
+            const gr_complex c1 = x[1] - x[-1] * (1.0F / 3.0F) - x[0] * 0.5F - x[2] * (1.0F / 6.0F);
+            const gr_complex c2 = (x[-1] + x[1]) * 0.5F - x[0];
+            const gr_complex c3 = (x[2] - x[-1]) * (1.0F / 6.0F) + (x[0] - x[1]) * 0.5F;
+            out[k] = ((c3 * mu + c2) * mu + c1) * mu + x[0];
+        }
+}
+
+
+int interpolating_resampler::general_work(int noutput_items,
+    gr_vector_int& ninput_items,
+    gr_vector_const_void_star& input_items,
+    gr_vector_void_star& output_items)
+{
+    const auto* in = reinterpret_cast<const uint8_t*>(input_items[0]);
+    auto* out = reinterpret_cast<uint8_t*>(output_items[0]);
+    int start = 0;  // first input sample of the current block
+    int produced = 0;
+    while (produced < noutput_items)
+        {
+            const int nblock = std::min(RESAMPLER_BLOCK_ITEMS, noutput_items - produced);
+            int consumed = 0;
+            int noutputs = 0;
+            const void* block_in = in + start * d_item_size;
+            void* block_out = out + produced * d_item_size;
+            if (d_interpolation == Interpolation::nearest)
+                {
+                    noutputs = nearest_positions(ninput_items[0] - start, nblock, consumed);
+                    switch (d_item_kind)
+                        {
+                        case Item_Kind::cshort:
+                            gather<lv_16sc_t>(block_in, d_index.data(), block_out, noutputs);
+                            break;
+                        case Item_Kind::cbyte:
+                            gather<lv_8sc_t>(block_in, d_index.data(), block_out, noutputs);
+                            break;
+                        default:
+                            gather<gr_complex>(block_in, d_index.data(), block_out, noutputs);
+                            break;
+                        }
+                }
+            else
+                {
+                    noutputs = fractional_positions(ninput_items[0] - start, nblock, consumed);
+                    if (noutputs > 0)
+                        {
+                            if (d_item_kind == Item_Kind::gr_complex)
+                                {
+                                    interpolate(reinterpret_cast<const gr_complex*>(block_in), 0, reinterpret_cast<gr_complex*>(block_out), noutputs);
+                                }
+                            else
+                                {
+                                    // Only the input samples of this block are converted to float
+                                    const int first = d_index[0] - d_before;
+                                    const int nitems = d_index[noutputs - 1] + d_after + 1 - first;
+                                    const auto* first_in = reinterpret_cast<const uint8_t*>(block_in) + first * d_item_size;
+                                    d_converted.resize(std::max(d_converted.size(), static_cast<size_t>(nitems)));
+                                    if (d_item_kind == Item_Kind::cshort)
+                                        {
+                                            volk_16i_s32f_convert_32f(reinterpret_cast<float*>(d_converted.data()), reinterpret_cast<const int16_t*>(first_in), 1.0F, 2 * nitems);
+                                            interpolate(d_converted.data(), first, d_interpolated.data(), noutputs);
+                                            volk_32f_s32f_convert_16i(reinterpret_cast<int16_t*>(block_out), reinterpret_cast<const float*>(d_interpolated.data()), 1.0F, 2 * noutputs);
+                                        }
+                                    else
+                                        {
+                                            volk_8i_s32f_convert_32f(reinterpret_cast<float*>(d_converted.data()), reinterpret_cast<const int8_t*>(first_in), 1.0F, 2 * nitems);
+                                            interpolate(d_converted.data(), first, d_interpolated.data(), noutputs);
+                                            volk_32f_s32f_convert_8i(reinterpret_cast<int8_t*>(block_out), reinterpret_cast<const float*>(d_interpolated.data()), 1.0F, 2 * noutputs);
+                                        }
+                                }
+                        }
+                }
+            start += consumed;
+            produced += noutputs;
+            if (noutputs < nblock)
+                {
+                    break;  // wait for more input
+                }
+        }
+
+    consume_each(start);
+    return produced;
+}
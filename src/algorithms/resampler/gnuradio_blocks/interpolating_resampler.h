@@ -0,0 +1,122 @@
+/*!
+ * \file interpolating_resampler.h
+ * \brief Resampler for gr_complex, cshort and cbyte samples that computes the
+ * input positions of a block of outputs at once, with nearest-neighbour,
+ * linear or cubic interpolation.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_INTERPOLATING_RESAMPLER_H
+#define GNSS_SDR_INTERPOLATING_RESAMPLER_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/block.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Resampler
+ * \{ */
+/** \addtogroup Resampler_gnuradio_blocks
+ * \{ */
+
+
+class interpolating_resampler;
+
+using interpolating_resampler_sptr = gnss_shared_ptr<interpolating_resampler>;
+
+interpolating_resampler_sptr make_interpolating_resampler(
+    const std::string& item_type,
+    double sample_freq_in,
+    double sample_freq_out,
+    const std::string& interpolation);
+
+/*!
+ * \brief Resamples "gr_complex", "cshort" or "cbyte" samples, with the same
+ * output item type. Instead of a loop that decides sample by sample whether
+ * to output, the input positions of a block of outputs are computed in
+ * arrays, and the samples are then gathered from those positions.
+ *
+ * The \p interpolation can be:
+ * - "nearest": outputs the same samples as direct_resampler_conditioner_cc
+ *   and its cshort and cbyte versions, which use a 32-bit phase accumulator.
+ * - "linear": linear interpolation between the two neighbour samples.
+ * - "cubic": cubic Lagrange interpolation in Farrow form, with two samples on
+ *   each side. It delays the output by one input sample.
+ *
+ * Throws std::invalid_argument on unknown item types or interpolations.
+ */
+class interpolating_resampler : public gr::block
+{
+public:
+    ~interpolating_resampler() = default;
+
+    void forecast(int noutput_items, gr_vector_int& ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int& ninput_items,
+        gr_vector_const_void_star& input_items,
+        gr_vector_void_star& output_items);
+
+private:
+    friend interpolating_resampler_sptr make_interpolating_resampler(
+        const std::string& item_type,
+        double sample_freq_in,
+        double sample_freq_out,
+        const std::string& interpolation);
+
+    enum class Item_Kind
+    {
+        gr_complex,
+        cshort,
+        cbyte
+    };
+
+    enum class Interpolation
+    {
+        nearest,
+        linear,
+        cubic
+    };
+
+    interpolating_resampler(Item_Kind item_kind,
+        size_t item_size,
+        double sample_freq_in,
+        double sample_freq_out,
+        Interpolation interpolation);
+
+    int nearest_positions(int ninput_items, int noutput_items, int& consumed);
+    int fractional_positions(int ninput_items, int noutput_items, int& consumed);
+    void interpolate(const gr_complex* in, int first, gr_complex* out, int noutput_items) const;
+
+    volk_gnsssdr::vector<int32_t> d_index;  // input sample of each output, from the start of the block
+    volk_gnsssdr::vector<float> d_mu;       // fractional part of each input position
+    volk_gnsssdr::vector<gr_complex> d_converted;
+    volk_gnsssdr::vector<gr_complex> d_interpolated;
+    Item_Kind d_item_kind;
+    Interpolation d_interpolation;
+    size_t d_item_size;
+    double d_sample_freq_in;
+    double d_sample_freq_out;
+    double d_ratio;  // input samples per output sample
+    double d_time;   // input position of the next output, from the first input sample not consumed
+    int d_before;    // input samples needed before and after the position
+    int d_after;
+    uint32_t d_phase;
+    uint32_t d_lphase;
+    uint32_t d_phase_step;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_INTERPOLATING_RESAMPLER_H
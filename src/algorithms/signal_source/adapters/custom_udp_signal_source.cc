@@ -55,6 +55,12 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
     const std::string sample_type = configuration->property(role + ".sample_type", default_sample_type);
     item_type_ = configuration->property(role + ".item_type", default_item_type);
 
+    // "pcap" captures from the network device, "recvmmsg" reads batches of
+    // datagrams from a socket bound to the port
+    const std::string default_capture_backend("pcap");
+    const std::string capture_backend = configuration->property(role + ".capture_backend", default_capture_backend);
+    const bool sequence_header = configuration->property(role + ".sequence_header", false);
+
     udp_gnss_rx_source_ = Gr_Complex_Ip_Packet_Source::make(capture_device,
         address,
         port,
@@ -62,7 +68,9 @@ CustomUDPSignalSource::CustomUDPSignalSource(const ConfigurationInterface* confi
         channels_in_udp_,
         sample_type,
         item_size_,
-        IQ_swap_);
+        IQ_swap_,
+        capture_backend,
+        sequence_header);
 
     if (channels_in_udp_ >= RF_channels_)
         {
@@ -37,10 +37,11 @@ class ConfigurationInterface;
 //!
 //! This class supports the following properties:
 //!
-//!   .filename - the path to the input file
+//!   .filename - the path to the input file, or "-" for the standard input
 //!             - may be overridden by the -signal_source or -s command-line arguments
 //!
 //!   .sample_type - data type read out from the FIFO. default ishort ;
+//!                - gr_complex, ishort, cshort, ibyte, cbyte, float, short or byte
 //!                - note: not output format. that is always gr_complex
 //!
 //!   .dump     - whether to archive input data
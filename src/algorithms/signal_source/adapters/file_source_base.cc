@@ -29,6 +29,7 @@
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_string_literals.h"
 #include "gnss_sdr_valve.h"
+#include "mmap_file_source.h"
 #include <glog/logging.h>
 #include <algorithm>  // for std::max
 #include <cmath>      // for ceil, floor
@@ -56,7 +57,8 @@ FileSourceBase::FileSourceBase(ConfigurationInterface const* configuration, std:
       is_complex_(false),
       repeat_(configuration->property(role_ + ".repeat"s, false)),
       enable_throttle_control_(configuration->property(role_ + ".enable_throttle_control"s, false)),
-      dump_(configuration->property(role_ + ".dump"s, false))
+      dump_(configuration->property(role_ + ".dump"s, false)),
+      use_mmap_(configuration->property(role_ + ".use_mmap"s, false))
 {
     minimum_tail_s_ = std::max(configuration->property("Acquisition_1C.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
     minimum_tail_s_ = std::max(configuration->property("Acquisition_2S.coherent_integration_time_ms", 0.0) * 0.001 * 2.0, minimum_tail_s_);
@@ -135,6 +137,7 @@ void FileSourceBase::init()
     DLOG(INFO) << "Item type " << item_type_;
     DLOG(INFO) << "Item size " << item_size_;
     DLOG(INFO) << "Repeat " << repeat_;
+    DLOG(INFO) << "Use mmap " << use_mmap_;
 
     DLOG(INFO) << "Dump " << dump_;
     DLOG(INFO) << "Dump filename " << dump_filename_;
@@ -465,7 +468,7 @@ gnss_shared_ptr<gr::block> FileSourceBase::throttle() const { return throttle_;
 gnss_shared_ptr<gr::block> FileSourceBase::sink() const { return sink_; }
 
 
-gr::blocks::file_source::sptr FileSourceBase::create_file_source()
+gnss_shared_ptr<gr::block> FileSourceBase::create_file_source()
 {
     auto item_tuple = itemTypeToSize();
     item_size_ = std::get<0>(item_tuple);
@@ -476,12 +479,24 @@ gr::blocks::file_source::sptr FileSourceBase::create_file_source()
             // TODO: why are we manually seeking, instead of passing the samples_to_skip to the file_source factory?
             auto samples_to_skip = samplesToSkip();
 
-            file_source_ = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
+            auto seek_ok = true;
+            if (use_mmap_)
+                {
+                    auto mmap_source = make_mmap_file_source(item_size(), filename(), repeat());
+                    seek_ok = samples_to_skip == 0 || mmap_source->seek(samples_to_skip, SEEK_SET);
+                    file_source_ = mmap_source;
+                }
+            else
+                {
+                    auto gr_source = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
+                    seek_ok = samples_to_skip == 0 || gr_source->seek(samples_to_skip, SEEK_SET);
+                    file_source_ = gr_source;
+                }
 
             if (samples_to_skip > 0)
                 {
                     LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
-                    if (!file_source_->seek(samples_to_skip, SEEK_SET))
+                    if (!seek_ok)
                         {
                             LOG(ERROR) << "Error skipping bytes!";
                         }
@@ -517,10 +532,11 @@ gr::blocks::file_source::sptr FileSourceBase::create_file_source()
 
 gr::blocks::throttle::sptr FileSourceBase::create_throttle()
 {
-    if (enable_throttle_control_)
+    if (enable_throttle_control_ || FLAGS_replay_speed > 0.0)
         {
-            // if we are throttling...
-            throttle_ = gr::blocks::throttle::make(source_item_size(), sampling_frequency());
+            // if we are throttling... In replay mode, the throttle caps the speed to a multiple of real time
+            const double speed = FLAGS_replay_speed > 0.0 ? FLAGS_replay_speed : 1.0;
+            throttle_ = gr::blocks::throttle::make(source_item_size(), speed * sampling_frequency());
             DLOG(INFO) << "throttle(" << throttle_->unique_id() << ")";
 
             // enable subclass hooks
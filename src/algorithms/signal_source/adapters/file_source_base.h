@@ -55,9 +55,12 @@ class ConfigurationInterface;
 //!   .seconds_to_skip - number of seconds of lead-in data to skip over (default 0)
 //!
 //!   .enable_throttle_control - whether to stop reading if the upstream buffer is full (default false)
+//!                            - the --replay_speed command-line argument enables it, at that multiple of the sampling frequency
 //!
 //!   .repeat   - whether to rewind and continue at end of file (default false)
 //!
+//!   .use_mmap - whether to map the file into memory instead of reading it with fread (default false)
+//!
 //! (probably abstracted to the base class)
 //!
 //!   .dump     - whether to archive input data
@@ -134,7 +137,7 @@ protected:
 
     // The methods create the various blocks, if enabled, and return access to them. The created
     // object is also held in this class
-    gr::blocks::file_source::sptr create_file_source();
+    gnss_shared_ptr<gr::block> create_file_source();
     gr::blocks::throttle::sptr create_throttle();
     gnss_shared_ptr<gr::block> create_valve();
     gr::blocks::file_sink::sptr create_sink();
@@ -152,11 +155,13 @@ protected:
     virtual void post_disconnect_hook(gr::top_block_sptr top_block);
 
 private:
-    gr::blocks::file_source::sptr file_source_;
+    gnss_shared_ptr<gr::block> file_source_;
     gr::blocks::throttle::sptr throttle_;
     gr::blocks::file_sink::sptr sink_;
 
-    // The valve allows only the configured number of samples through, then it closes.
+    // The valve allows only the configured number of samples through, then it closes. It stays
+    // in the data path, since its end of stream is what stops flowgraphs run without a control
+    // thread, as in the tests.
 
     // The framework passes the queue as a naked pointer, rather than a shared pointer, so this
     // class has two choices: construct the valve in the ctor, or hold onto the pointer, possibly
@@ -179,6 +184,7 @@ private:
     bool repeat_;
     bool enable_throttle_control_;
     bool dump_;
+    bool use_mmap_;
 };
 
 /** \} */
@@ -16,7 +16,14 @@
  */
 
 #include "fifo_reader.h"
+#include "item_type_helpers.h"
 #include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <volk/volk.h>
+#include <cerrno>
+#include <cstring>   // for memcpy, memmove, strerror
+#include <fcntl.h>   // for open, fcntl
+#include <unistd.h>  // for read, close
 
 // initial construction; pass to private constructor
 FifoReader::sptr FifoReader::make(const std::string &file_name, const std::string &sample_type)
@@ -30,24 +37,68 @@ FifoReader::FifoReader(const std::string &file_name, const std::string &sample_t
           gr::io_signature::make(0, 0, 0),                    // no input
           gr::io_signature::make(1, 1, sizeof(gr_complex))),  // <+MIN_OUT+>, <+MAX_OUT+>, sizeof(<+OTYPE+>)
       file_name_(file_name),
-      sample_type_(sample_type)
+      sample_type_(sample_type),
+      sample_size_(sizeof(gr_complex)),
+      buffered_bytes_(0),
+      items_per_sample_(1),
+      fd_(-1),
+      is_real_(false)
 {
     DLOG(INFO) << "Starting FifoReader";
+    if (!item_type_valid(sample_type_))
+        {
+            LOG(ERROR) << sample_type_ << " is not a valid sample type, using gr_complex";
+        }
+    else if (sample_type_ != "gr_complex")
+        {
+            is_real_ = !item_type_is_complex(sample_type_);
+            // ibyte and ishort items are single components, the other ones whole samples
+            items_per_sample_ = (sample_type_ == "ibyte" || sample_type_ == "ishort") ? 2 : 1;
+            sample_size_ = item_type_size(sample_type_) * items_per_sample_;
+            converter_ = make_vector_converter(sample_type_, is_real_ ? "float" : "gr_complex");
+        }
+    // the incomplete sample left by a read is kept at the beginning of buffer_
+    buffer_.resize(sample_size_);
+}
+
+
+FifoReader::~FifoReader()
+{
+    if (fd_ > STDIN_FILENO)
+        {
+            close(fd_);
+        }
 }
 
+
 bool FifoReader::start()
 {
-    fifo_.open(file_name_, std::ios::binary);
-    if (!fifo_.is_open())
+    fd_ = file_name_ == "-" ? STDIN_FILENO : open(file_name_.c_str(), O_RDONLY);
+    if (fd_ < 0)
         {
-            LOG(ERROR) << "Error opening FIFO";
+            LOG(ERROR) << "Error opening FIFO " << file_name_ << ": " << std::strerror(errno);
             return false;
         }
+#if defined(F_SETPIPE_SZ)
+    // a larger pipe lets the writer hand over bigger chunks per read
+    fcntl(fd_, F_SETPIPE_SZ, 1024 * 1024);
+#endif
+    return true;
+}
+
+
+bool FifoReader::stop()
+{
+    if (fd_ > STDIN_FILENO)
+        {
+            close(fd_);
+        }
+    fd_ = -1;
     return true;
 }
 
+
 // work loop
-// taken from here: https://stackoverflow.com/questions/25546619/work-with-fifo-in-c-blocking-read
 int FifoReader::work(int noutput_items,
     __attribute__((unused)) gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
@@ -57,64 +108,67 @@ int FifoReader::work(int noutput_items,
             LOG(ERROR) << "FifoReader connected to too many outputs";
         }
 
-    // read samples out
+    auto *out = static_cast<gr_complex *>(output_items[0]);
+    const size_t max_bytes = static_cast<size_t>(noutput_items) * sample_size_;
     size_t items_retrieved = 0;
-    if (sample_type_ == "ishort")
-        {
-            // ishort == int16_t
-            items_retrieved = read_interleaved<int16_t>(noutput_items, output_items);
-        }
-    else if (sample_type_ == "ibyte")  // Does this also work with cbyte?
+    if (!converter_)
         {
-            // ibyte == int8_t
-            items_retrieved = read_interleaved<int8_t>(noutput_items, output_items);
-        }
-    else if (sample_type_ == "gr_complex")
-        {
-            // gr_complex == complex<float>
-            items_retrieved = read_gr_complex(noutput_items, output_items);
+            // gr_complex, straight into the output buffer
+            items_retrieved = read_samples(reinterpret_cast<char *>(out), max_bytes) / sample_size_;
         }
     else
         {
-            // please see gr_complex_ip_packet_source for inspiration on how to implement other sample types
-            LOG(ERROR) << sample_type_ << " is unfortunately not yet implemented as sample type";
-        }
-
-    // we return varying number of data -> call produce & return flag
-    produce(0, items_retrieved);
-    return this->WORK_CALLED_PRODUCE;
-}
-
-
-// read gr_complex items from fifo
-// this fct has duplicate code with the templated read_interleaved fct in header
-size_t FifoReader::read_gr_complex(int noutput_items, gr_vector_void_star &output_items)
-{
-    size_t items_retrieved = 0;
-    for (int n = 0; n < noutput_items; n++)
-        {
-            gr_complex sample;
-            fifo_.read(reinterpret_cast<char *>(&sample), sizeof(sample));
-            if (fifo_.good())
+            if (buffer_.size() < max_bytes)
                 {
-                    static_cast<gr_complex *>(output_items.at(0))[n] = sample;
-                    items_retrieved++;
+                    buffer_.resize(max_bytes);
                 }
-            else if (fifo_.eof())
+            items_retrieved = read_samples(buffer_.data(), max_bytes) / sample_size_;
+            const auto num_items = static_cast<uint32_t>(items_retrieved) * items_per_sample_;
+            if (is_real_)
                 {
-                    fifo_.clear();
-                    break;
+                    if (real_buffer_.size() < items_retrieved)
+                        {
+                            real_buffer_.resize(noutput_items);
+                            zeros_.resize(noutput_items);  // value-initialized to zero
+                        }
+                    converter_(real_buffer_.data(), buffer_.data(), num_items);
+                    volk_32f_x2_interleave_32fc(out, real_buffer_.data(), zeros_.data(), items_retrieved);
                 }
             else
                 {
-                    fifo_error_output();
-                    break;
+                    converter_(out, buffer_.data(), num_items);
                 }
+            // move the incomplete sample to the beginning of the buffer
+            std::memmove(buffer_.data(), buffer_.data() + items_retrieved * sample_size_, buffered_bytes_);
         }
-    return items_retrieved;
+
+    // we return varying number of data -> call produce & return flag
+    produce(0, items_retrieved);
+    return this->WORK_CALLED_PRODUCE;
 }
 
-void FifoReader::fifo_error_output() const
+
+size_t FifoReader::read_samples(char *dest, size_t max_bytes)
 {
-    LOG(ERROR) << "unhandled FIFO event";
+    if (dest != buffer_.data())
+        {
+            std::memcpy(dest, buffer_.data(), buffered_bytes_);
+        }
+    size_t available = buffered_bytes_;
+    const ssize_t bytes_read = read(fd_, dest + available, max_bytes - available);
+    if (bytes_read > 0)
+        {
+            available += static_cast<size_t>(bytes_read);
+        }
+    else if (bytes_read < 0 && errno != EINTR && errno != EAGAIN)
+        {
+            LOG(ERROR) << "Error reading FIFO " << file_name_ << ": " << std::strerror(errno);
+        }
+    // bytes_read == 0 means that there is no writer, keep waiting for one
+    buffered_bytes_ = available % sample_size_;
+    if (dest != buffer_.data())
+        {
+            std::memcpy(buffer_.data(), dest + available - buffered_bytes_, buffered_bytes_);
+        }
+    return available - buffered_bytes_;
 }
@@ -20,13 +20,28 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_block.h>
-#include <fstream>  // std::ifstream
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <string>
 
 /** \addtogroup Signal_Source
  * \{ */
 /** \addtogroup Signal_Source_gnuradio_blocks
  * \{ */
+
+/*!
+ * \brief Reads samples from a Unix FIFO, or from the standard input if the
+ * file name is "-", and delivers them as gr_complex.
+ *
+ * The sample type is one of the item types of the file sources: "gr_complex",
+ * "ishort" or "cshort", "ibyte" or "cbyte" for interleaved complex samples,
+ * and "float", "short" or "byte" for real samples. The conversion is resolved
+ * once, at construction, and done with VOLK kernels on the whole chunk read
+ * by each work() call. gr_complex samples are read directly into the output
+ * buffer.
+ */
 class FifoReader : virtual public gr::sync_block
 {
 public:
@@ -34,11 +49,14 @@ public:
     using sptr = gnss_shared_ptr<FifoReader>;
     static sptr make(const std::string &file_name, const std::string &sample_type);
 
-    ~FifoReader() = default;
+    ~FifoReader();
 
-    //! initialize istream resource for FIFO
+    //! opens the FIFO
     bool start();
 
+    //! closes the FIFO
+    bool stop();
+
     // gnu radio work cycle function
     int work(int noutput_items,
         gr_vector_const_void_star &input_items,
@@ -50,50 +68,21 @@ private:
     //! (gr handles this with public and private header pair)
     FifoReader(const std::string &file_name, const std::string &sample_type);
 
-    size_t read_gr_complex(int noutput_items, gr_vector_void_star &output_items);
-
-    //! function to read data out of FIFO which is stored as interleaved I/Q stream.
-    //! template argument determines sample_type
-    // Note: template definition necessary in header file
-    // See also: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
-    template <typename Type>
-    size_t read_interleaved(int noutput_items, gr_vector_void_star &output_items)
-    {
-        size_t items_retrieved = 0;
-        for (int n = 0; n < noutput_items; n++)
-            {
-                // TODO: try if performance increases if we copy larger chunks to vector.
-                // how to read from stream: https://en.cppreference.com/w/cpp/io/basic_ifstream
-                std::array<char, 2 * sizeof(Type)> buffer;
-                fifo_.read(reinterpret_cast<char *>(buffer.data()), buffer.size());
-                if (fifo_.good())
-                    {
-                        auto real = reinterpret_cast<Type const *>(&buffer[0]);
-                        auto imag = reinterpret_cast<Type const *>(&buffer[sizeof(Type)]);
-                        static_cast<gr_complex *>(output_items[0])[n] = gr_complex(*real, *imag);
-                        items_retrieved++;
-                    }
-                else if (fifo_.eof())
-                    {
-                        fifo_.clear();
-                        break;
-                    }
-                else
-                    {
-                        fifo_error_output();
-                        break;
-                    }
-            }
-        return items_retrieved;
-    }
-
-    //! this function moves logging output from this header into the source file
-    //! thereby eliminating the need to include glog/logging.h in this header
-    void fifo_error_output() const;
+    //! reads up to max_bytes after the incomplete sample kept from the
+    //! previous call, and returns the number of bytes available at dest
+    size_t read_samples(char *dest, size_t max_bytes);
 
     const std::string file_name_;
     const std::string sample_type_;
-    std::ifstream fifo_;
+    std::function<void(void *, const void *, uint32_t)> converter_;  // input items to gr_complex, or to float for real samples
+    volk_gnsssdr::vector<char> buffer_;                              // raw samples read from the FIFO
+    volk_gnsssdr::vector<float> real_buffer_;                        // real samples converted to float
+    volk_gnsssdr::vector<float> zeros_;                              // imaginary part of real samples
+    size_t sample_size_;                                             // bytes per output sample in the FIFO
+    size_t buffered_bytes_;                                          // incomplete sample left by the last read
+    uint32_t items_per_sample_;                                      // input items per output sample
+    int fd_;
+    bool is_real_;
 };
 
 /** \} */
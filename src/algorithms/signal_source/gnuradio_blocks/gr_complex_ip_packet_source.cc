@@ -2,7 +2,8 @@
  * \file gr_complex_ip_packet_source.cc
  *
  * \brief Receives ip frames containing samples in UDP frame encapsulation
- * using a high performance packet capture library (libpcap)
+ * using a high performance packet capture library (libpcap), or batches of
+ * datagrams from a UDP socket
  * \author Javier Arribas jarribas (at) cttc.es
  *
  * -----------------------------------------------------------------------------
@@ -19,15 +20,48 @@
 
 #include "gr_complex_ip_packet_source.h"
 #include <gnuradio/io_signature.h>
+#include <sys/socket.h>  // for recvmmsg, setsockopt
+#include <sys/time.h>    // for timeval
+#include <sys/uio.h>     // for iovec
+#include <unistd.h>      // for close
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstring>
 #include <utility>
 #if HAS_GENERIC_LAMBDA
 #else
 #include <boost/bind/bind.hpp>
 #endif
 
-const int FIFO_SIZE = 1472000;
+// A multiple of every sample size (up to four channels of cfloat samples),
+// so that samples never wrap around the end of the FIFO
+const int FIFO_SIZE = 1474560;
+
+// Room for a jumbo frame payload in each recvmmsg() slot
+const int MAX_DATAGRAM_SIZE = 9000;
+
+// Datagrams per recvmmsg() call
+const int DATAGRAM_BATCH_SIZE = 64;
+
+// Sample values of the 4-bit codes, indexed by code
+const std::array<int8_t, 16> FOURBIT_LEVELS{{1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1}};
+
+
+// Copies the samples of one channel, sizeof(T) bytes each, out of the
+// interleaved samples of all the channels
+template <typename T>
+void gather_channel(char *out, const char *in, int stride_bytes, int num_samples)
+{
+    T sample;
+    for (int n = 0; n < num_samples; n++)
+        {
+            memcpy(&sample, in + static_cast<size_t>(n) * stride_bytes, sizeof(T));
+            memcpy(out + static_cast<size_t>(n) * sizeof(T), &sample, sizeof(T));
+        }
+}
 
 
 /* 4 bytes IP address */
@@ -75,7 +109,9 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    const std::string &capture_backend,
+    bool sequence_header)
 {
     return gnuradio::get_initial_sptr(new Gr_Complex_Ip_Packet_Source(std::move(src_device),
         origin_address,
@@ -84,7 +120,9 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
         n_baseband_channels,
         wire_sample_type,
         item_size,
-        IQ_swap_));
+        IQ_swap_,
+        capture_backend,
+        sequence_header));
 }
 
 
@@ -94,11 +132,13 @@ Gr_Complex_Ip_Packet_Source::make(std::string src_device,
 Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
     __attribute__((unused)) const std::string &origin_address,
     int udp_port,
-    int udp_packet_size __attribute__((unused)),
+    int udp_packet_size,
     int n_baseband_channels,
     const std::string &wire_sample_type,
     size_t item_size,
-    bool IQ_swap_)
+    bool IQ_swap_,
+    const std::string &capture_backend,
+    bool sequence_header)
     : gr::sync_block("gr_complex_ip_packet_source",
           gr::io_signature::make(0, 0, 0),
           gr::io_signature::make(1, 4, item_size)),  // 1 to 4 baseband complex channels
@@ -106,13 +146,22 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
       d_src_device(std::move(src_device)),
       descr(nullptr),
       fifo_buff(new char[FIFO_SIZE]),
+      d_received_packets(0),
+      d_lost_packets(0),
+      d_out_of_order_packets(0),
+      d_overflows(0),
+      d_expected_sequence(0),
       fifo_read_ptr(0),
       fifo_write_ptr(0),
       fifo_items(0),
-      d_sock_raw(0),
+      d_sock_raw(-1),
       d_udp_port(udp_port),
+      d_datagram_size(std::max(udp_packet_size, MAX_DATAGRAM_SIZE)),
       d_n_baseband_channels(n_baseband_channels),
-      d_IQ_swap(IQ_swap_)
+      d_stop_capture(false),
+      d_IQ_swap(IQ_swap_),
+      d_socket_capture(capture_backend == "recvmmsg"),
+      d_sequence_header(sequence_header)
 {
     memset(reinterpret_cast<char *>(&si_me), 0, sizeof(si_me));
     if (wire_sample_type == "cbyte")
@@ -140,6 +189,14 @@ Gr_Complex_Ip_Packet_Source::Gr_Complex_Ip_Packet_Source(std::string src_device,
             std::cout << "Unknown wire sample type\n";
             exit(0);
         }
+    if (!d_socket_capture && capture_backend != "pcap")
+        {
+            std::cout << "Unknown capture backend " << capture_backend << ", using pcap\n";
+        }
+    if (d_socket_capture)
+        {
+            d_datagram_buffer.resize(static_cast<size_t>(DATAGRAM_BATCH_SIZE) * d_datagram_size);
+        }
     std::cout << "Start Ethernet packet capture\n";
     std::cout << "Overflow events will be indicated by o's\n";
     std::cout << "d_wire_sample_type:" << d_wire_sample_type << '\n';
@@ -153,6 +210,18 @@ bool Gr_Complex_Ip_Packet_Source::start()
     // open the ethernet device
     if (open() == true)
         {
+            d_stop_capture = false;
+            if (d_socket_capture)
+                {
+                    // start socket capture thread
+                    d_pcap_thread = new boost::thread(
+#if HAS_GENERIC_LAMBDA
+                        [this] { my_socket_loop_thread(); });
+#else
+                        boost::bind(&Gr_Complex_Ip_Packet_Source::my_socket_loop_thread, this));
+#endif
+                    return true;
+                }
             // start pcap capture thread
             d_pcap_thread = new boost::thread(
 #if HAS_GENERIC_LAMBDA
@@ -175,7 +244,26 @@ bool Gr_Complex_Ip_Packet_Source::stop()
             pcap_breakloop(descr);
             d_pcap_thread->join();
             pcap_close(descr);
+            descr = nullptr;
+        }
+    else if (d_pcap_thread != nullptr)
+        {
+            // the socket has a receive timeout, so the thread checks the flag periodically
+            d_stop_capture = true;
+            d_pcap_thread->join();
+        }
+    if (d_sock_raw != -1)
+        {
+            close(d_sock_raw);
+            d_sock_raw = -1;
         }
+    boost::mutex::scoped_lock lock(d_mutex);
+    std::cout << "Received " << d_received_packets << " UDP packets";
+    if (d_sequence_header)
+        {
+            std::cout << ", " << d_lost_packets << " lost and " << d_out_of_order_packets << " out of order";
+        }
+    std::cout << ", " << d_overflows << " overflows\n";
     return true;
 }
 
@@ -184,13 +272,29 @@ bool Gr_Complex_Ip_Packet_Source::open()
 {
     std::array<char, PCAP_ERRBUF_SIZE> errbuf{};
     boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-    // open device for reading
-    descr = pcap_open_live(d_src_device.c_str(), 1500, 1, 1000, errbuf.data());
-    if (descr == nullptr)
+    if (!d_socket_capture)
         {
-            std::cout << "Error opening Ethernet device " << d_src_device << '\n';
-            std::cout << "Fatal Error in pcap_open_live(): " << std::string(errbuf.data()) << '\n';
-            return false;
+            // open device for reading, with room for jumbo frames and a large
+            // kernel ring buffer (TPACKET_V3 on Linux) to absorb bursts
+            descr = pcap_create(d_src_device.c_str(), errbuf.data());
+            if (descr == nullptr)
+                {
+                    std::cout << "Error opening Ethernet device " << d_src_device << '\n';
+                    std::cout << "Fatal Error in pcap_create(): " << std::string(errbuf.data()) << '\n';
+                    return false;
+                }
+            pcap_set_snaplen(descr, 65535);
+            pcap_set_promisc(descr, 1);
+            pcap_set_timeout(descr, 1000);
+            pcap_set_buffer_size(descr, 64 * 1024 * 1024);
+            if (pcap_activate(descr) < 0)
+                {
+                    std::cout << "Error opening Ethernet device " << d_src_device << '\n';
+                    std::cout << "Fatal Error in pcap_activate(): " << std::string(pcap_geterr(descr)) << '\n';
+                    pcap_close(descr);
+                    descr = nullptr;
+                    return false;
+                }
         }
     // bind UDP port to avoid automatic reply with ICMP port unreachable packets from kernel
     d_sock_raw = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
@@ -213,6 +317,18 @@ bool Gr_Complex_Ip_Packet_Source::open()
             std::cout << "Error opening UDP socket\n";
             return false;
         }
+    if (d_socket_capture)
+        {
+            // a large receive buffer absorbs the bursts while work() is busy,
+            // and a timeout lets the capture thread check the stop flag
+            const int rcvbuf_size = 64 * 1024 * 1024;
+            setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVBUF, &rcvbuf_size, sizeof(rcvbuf_size));
+            struct timeval timeout
+            {
+            };
+            timeout.tv_usec = 100000;
+            setsockopt(d_sock_raw, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+        }
     return true;
 }
 
@@ -236,11 +352,9 @@ void Gr_Complex_Ip_Packet_Source::static_pcap_callback(u_char *args, const struc
 }
 
 
-void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *args, __attribute__((unused)) const struct pcap_pkthdr *pkthdr,
+void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *args, const struct pcap_pkthdr *pkthdr,
     const u_char *packet)
 {
-    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-
     const gr_ip_header *ih;
     const gr_udp_header *uh;
 
@@ -257,59 +371,84 @@ void Gr_Complex_Ip_Packet_Source::pcap_callback(__attribute__((unused)) u_char *
             uh = reinterpret_cast<const gr_udp_header *>(reinterpret_cast<const u_char *>(ih) + ip_len);
 
             // convert from network byte order to host byte order
-            // u_short sport;
             u_short dport;
             dport = ntohs(uh->dport);
-            // sport = ntohs(uh->sport);
             if (dport == d_udp_port)
                 {
-                    // print ip addresses and udp ports
-                    //            printf("%d.%d.%d.%d.%d -> %d.%d.%d.%d.%d\n",
-                    //                   ih->saddr.byte1,
-                    //                   ih->saddr.byte2,
-                    //                   ih->saddr.byte3,
-                    //                   ih->saddr.byte4,
-                    //                   sport,
-                    //                   ih->daddr.byte1,
-                    //                   ih->daddr.byte2,
-                    //                   ih->daddr.byte3,
-                    //                   ih->daddr.byte4,
-                    //                   dport);
-                    //            std::cout<<"uh->len:"<<ntohs(uh->len)<< '\n';
-
-                    int payload_length_bytes = ntohs(uh->len) - 8;  // total udp packet length minus the header length
                     // read the payload bytes and insert them into the shared circular buffer
                     const u_char *udp_payload = (reinterpret_cast<const u_char *>(uh) + sizeof(gr_udp_header));
-                    if (fifo_items <= (FIFO_SIZE - payload_length_bytes))
+                    const int captured_bytes = static_cast<int>(pkthdr->caplen) - static_cast<int>(udp_payload - packet);
+                    int payload_length_bytes = ntohs(uh->len) - 8;  // total udp packet length minus the header length
+                    payload_length_bytes = std::min(payload_length_bytes, captured_bytes);
+                    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex while writing into the FIFO
+                    push_payload(udp_payload, payload_length_bytes);
+                }
+        }
+}
+
+
+void Gr_Complex_Ip_Packet_Source::push_payload(const u_char *payload, int payload_length_bytes)
+{
+    // the caller holds d_mutex
+    if (payload_length_bytes <= 0)
+        {
+            return;
+        }
+    if (d_sequence_header)
+        {
+            if (payload_length_bytes < 4)
+                {
+                    return;
+                }
+            const uint32_t sequence = (static_cast<uint32_t>(payload[0]) << 24) | (static_cast<uint32_t>(payload[1]) << 16) |
+                                      (static_cast<uint32_t>(payload[2]) << 8) | static_cast<uint32_t>(payload[3]);
+            if (d_received_packets > 0)
+                {
+                    // the counter wraps around, so compare the difference as a signed number
+                    const auto gap = static_cast<int32_t>(sequence - d_expected_sequence);
+                    if (gap < 0)
                         {
-                            int aligned_write_items = FIFO_SIZE - fifo_write_ptr;
-                            if (aligned_write_items >= payload_length_bytes)
-                                {
-                                    // write all in a single memcpy
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], payload_length_bytes);  // size in bytes
-                                    fifo_write_ptr += payload_length_bytes;
-                                    if (fifo_write_ptr == FIFO_SIZE)
-                                        {
-                                            fifo_write_ptr = 0;
-                                        }
-                                    fifo_items += payload_length_bytes;
-                                }
-                            else
-                                {
-                                    // two step wrap write
-                                    memcpy(&fifo_buff[fifo_write_ptr], &udp_payload[0], aligned_write_items);  // size in bytes
-                                    fifo_write_ptr = payload_length_bytes - aligned_write_items;
-                                    memcpy(&fifo_buff[0], &udp_payload[aligned_write_items], fifo_write_ptr);  // size in bytes
-                                    fifo_items += payload_length_bytes;
-                                }
+                            // too late, its place in the sample stream is already taken
+                            d_received_packets++;
+                            d_out_of_order_packets++;
+                            return;
                         }
-                    else
+                    d_lost_packets += static_cast<uint64_t>(gap);
+                }
+            d_expected_sequence = sequence + 1;
+            payload += 4;
+            payload_length_bytes -= 4;
+        }
+    d_received_packets++;
+    if (fifo_items <= (FIFO_SIZE - payload_length_bytes))
+        {
+            int aligned_write_items = FIFO_SIZE - fifo_write_ptr;
+            if (aligned_write_items >= payload_length_bytes)
+                {
+                    // write all in a single memcpy
+                    memcpy(&fifo_buff[fifo_write_ptr], &payload[0], payload_length_bytes);  // size in bytes
+                    fifo_write_ptr += payload_length_bytes;
+                    if (fifo_write_ptr == FIFO_SIZE)
                         {
-                            // notify overflow
-                            std::cout << "o" << std::flush;
+                            fifo_write_ptr = 0;
                         }
+                    fifo_items += payload_length_bytes;
+                }
+            else
+                {
+                    // two step wrap write
+                    memcpy(&fifo_buff[fifo_write_ptr], &payload[0], aligned_write_items);  // size in bytes
+                    fifo_write_ptr = payload_length_bytes - aligned_write_items;
+                    memcpy(&fifo_buff[0], &payload[aligned_write_items], fifo_write_ptr);  // size in bytes
+                    fifo_items += payload_length_bytes;
                 }
         }
+    else
+        {
+            // notify overflow
+            d_overflows++;
+            std::cout << "o" << std::flush;
+        }
 }
 
 
@@ -319,109 +458,126 @@ void Gr_Complex_Ip_Packet_Source::my_pcap_loop_thread(pcap_t *pcap_handle)
 }
 
 
+void Gr_Complex_Ip_Packet_Source::my_socket_loop_thread()
+{
+#if defined(__linux__)
+    // receive up to DATAGRAM_BATCH_SIZE datagrams per system call, and write
+    // them into the FIFO with a single lock
+    std::array<struct mmsghdr, DATAGRAM_BATCH_SIZE> msgs{};
+    std::array<struct iovec, DATAGRAM_BATCH_SIZE> iovecs{};
+    for (int i = 0; i < DATAGRAM_BATCH_SIZE; i++)
+        {
+            iovecs[i].iov_base = &d_datagram_buffer[static_cast<size_t>(i) * d_datagram_size];
+            iovecs[i].iov_len = d_datagram_size;
+            msgs[i].msg_hdr.msg_iov = &iovecs[i];
+            msgs[i].msg_hdr.msg_iovlen = 1;
+        }
+    while (!d_stop_capture)
+        {
+            const int received = recvmmsg(d_sock_raw, msgs.data(), DATAGRAM_BATCH_SIZE, MSG_WAITFORONE, nullptr);
+            if (received <= 0)
+                {
+                    continue;  // timeout, check the stop flag
+                }
+            boost::mutex::scoped_lock lock(d_mutex);
+            for (int i = 0; i < received; i++)
+                {
+                    push_payload(reinterpret_cast<const u_char *>(iovecs[i].iov_base), static_cast<int>(msgs[i].msg_len));
+                }
+        }
+#else
+    while (!d_stop_capture)
+        {
+            const ssize_t received = recv(d_sock_raw, d_datagram_buffer.data(), d_datagram_size, 0);
+            if (received <= 0)
+                {
+                    continue;  // timeout, check the stop flag
+                }
+            boost::mutex::scoped_lock lock(d_mutex);
+            push_payload(reinterpret_cast<const u_char *>(d_datagram_buffer.data()), static_cast<int>(received));
+        }
+#endif
+}
+
+
 void Gr_Complex_Ip_Packet_Source::demux_samples(const gr_vector_void_star &output_items, int num_samples_readed)
 {
-    for (int n = 0; n < num_samples_readed; n++)
+    // The FIFO size is a multiple of the sample size, so a wrap around
+    // splits the samples in at most two contiguous runs
+    int done = 0;
+    while (done < num_samples_readed)
         {
-            switch (d_wire_sample_type)
+            const int contiguous = std::min(num_samples_readed - done, (FIFO_SIZE - fifo_read_ptr) / d_bytes_per_sample);
+            for (size_t ch = 0; ch < output_items.size(); ch++)
                 {
-                case 1:  // interleaved byte samples
-                    for (const auto &output_item : output_items)
-                        {
-                            int8_t real;
-                            int8_t imag;
-                            real = fifo_buff[fifo_read_ptr++];
-                            imag = fifo_buff[fifo_read_ptr++];
-                            if (d_IQ_swap)
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(real, imag);
-                                }
-                            else
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(imag, real);
-                                }
-                        }
-                    break;
-                case 2:  // 4-bit samples
-                    for (const auto &output_item : output_items)
-                        {
-                            int8_t real;
-                            int8_t imag;
-                            uint8_t tmp_char2;
-                            tmp_char2 = fifo_buff[fifo_read_ptr] & 0x0F;
-                            if (tmp_char2 >= 8)
-                                {
-                                    real = 2 * (tmp_char2 - 16) + 1;
-                                }
-                            else
-                                {
-                                    real = 2 * tmp_char2 + 1;
-                                }
-                            tmp_char2 = fifo_buff[fifo_read_ptr++] >> 4;
-                            tmp_char2 = tmp_char2 & 0x0F;
-                            if (tmp_char2 >= 8)
-                                {
-                                    imag = 2 * (tmp_char2 - 16) + 1;
-                                }
-                            else
-                                {
-                                    imag = 2 * tmp_char2 + 1;
-                                }
-                            if (d_IQ_swap)
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(imag, real);
-                                }
-                            else
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(real, imag);
-                                }
-                        }
+                    convert_samples(static_cast<gr_complex *>(output_items[ch]) + done, &fifo_buff[fifo_read_ptr], static_cast<int>(ch), contiguous);
+                }
+            fifo_read_ptr += contiguous * d_bytes_per_sample;
+            if (fifo_read_ptr == FIFO_SIZE)
+                {
+                    fifo_read_ptr = 0;
+                }
+            done += contiguous;
+        }
+}
+
+
+void Gr_Complex_Ip_Packet_Source::convert_samples(gr_complex *out, const char *in, int channel, int num_samples)
+{
+    // samples of the channels are interleaved in the wire, so gather the
+    // ones of this channel before converting them
+    const int channel_bytes = d_bytes_per_sample / d_n_baseband_channels;
+    const char *samples = in + channel * channel_bytes;
+    if (d_n_baseband_channels > 1)
+        {
+            const size_t needed = static_cast<size_t>(num_samples) * channel_bytes;
+            if (d_channel_buffer.size() < needed)
+                {
+                    d_channel_buffer.resize(needed);
+                }
+            switch (channel_bytes)
+                {
+                case 1:
+                    gather_channel<uint8_t>(d_channel_buffer.data(), samples, d_bytes_per_sample, num_samples);
                     break;
-                case 3:  // interleaved float samples
-                    for (const auto &output_item : output_items)
-                        {
-                            float real;
-                            float imag;
-                            memcpy(&real, &fifo_buff[fifo_read_ptr], sizeof(real));
-                            fifo_read_ptr += 4;  // Four bytes in float
-                            memcpy(&imag, &fifo_buff[fifo_read_ptr], sizeof(imag));
-                            fifo_read_ptr += 4;  // Four bytes in float
-                            if (d_IQ_swap)
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(real, imag);
-                                }
-                            else
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(imag, real);
-                                }
-                        }
+                case 2:
+                    gather_channel<uint16_t>(d_channel_buffer.data(), samples, d_bytes_per_sample, num_samples);
                     break;
-                case 4:  // interleaved short samples
-                    for (const auto &output_item : output_items)
-                        {
-                            int16_t real;
-                            int16_t imag;
-                            memcpy(&real, &fifo_buff[fifo_read_ptr], sizeof(real));
-                            fifo_read_ptr += 2;  // two bytes in short
-                            memcpy(&imag, &fifo_buff[fifo_read_ptr], sizeof(imag));
-                            fifo_read_ptr += 2;  // two bytes in short
-                            if (d_IQ_swap)
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(real, imag);
-                                }
-                            else
-                                {
-                                    static_cast<gr_complex *>(output_item)[n] = gr_complex(imag, real);
-                                }
-                        }
+                case 4:
+                    gather_channel<uint32_t>(d_channel_buffer.data(), samples, d_bytes_per_sample, num_samples);
                     break;
                 default:
-                    std::cout << "Unknown wire sample type\n";
-                    exit(0);
+                    gather_channel<uint64_t>(d_channel_buffer.data(), samples, d_bytes_per_sample, num_samples);
                 }
-            if (fifo_read_ptr == FIFO_SIZE)
+            samples = d_channel_buffer.data();
+        }
+
+    auto *out_float = reinterpret_cast<float *>(out);
+    bool swap_components = !d_IQ_swap;  // the first component in the wire is the imaginary part
+    switch (d_wire_sample_type)
+        {
+        case 1:  // interleaved byte samples
+            volk_8i_s32f_convert_32f(out_float, reinterpret_cast<const int8_t *>(samples), 1.0, 2 * num_samples);
+            break;
+        case 2:  // 4-bit samples, the low nibble holds the real part
+            volk_gnsssdr_8u_unpack_fourbit_32f(out_float, reinterpret_cast<const uint8_t *>(samples), FOURBIT_LEVELS.data(), d_IQ_swap ? 1 : 0, num_samples);
+            swap_components = false;
+            break;
+        case 3:  // interleaved float samples
+            memcpy(out_float, samples, sizeof(gr_complex) * num_samples);
+            break;
+        case 4:  // interleaved short samples
+            volk_16i_s32f_convert_32f(out_float, reinterpret_cast<const int16_t *>(samples), 1.0, 2 * num_samples);
+            break;
+        default:
+            std::cout << "Unknown wire sample type\n";
+            exit(0);
+        }
+    if (swap_components)
+        {
+            for (int n = 0; n < num_samples; n++)
                 {
-                    fifo_read_ptr = 0;
+                    std::swap(out_float[2 * n], out_float[2 * n + 1]);
                 }
         }
 }
@@ -432,8 +588,12 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
     gr_vector_void_star &output_items)
 {
     // send samples to next GNU Radio block
-    boost::mutex::scoped_lock lock(d_mutex);  // hold mutex for duration of this function
-    if (fifo_items == 0)
+    int available_bytes;
+    {
+        boost::mutex::scoped_lock lock(d_mutex);
+        available_bytes = fifo_items;
+    }
+    if (available_bytes == 0)
         {
             return 0;
         }
@@ -447,20 +607,24 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
     int bytes_requested;
 
     bytes_requested = noutput_items * d_bytes_per_sample;
-    if (bytes_requested < fifo_items)
+    if (bytes_requested < available_bytes)
         {
             num_samples_readed = noutput_items;  // read all
         }
     else
         {
-            num_samples_readed = fifo_items / d_bytes_per_sample;  // read what we have
+            num_samples_readed = available_bytes / d_bytes_per_sample;  // read what we have
         }
 
     bytes_requested = num_samples_readed * d_bytes_per_sample;
-    // read all in a single loop
+    // the capture thread only writes after the available bytes, so the
+    // conversion does not need to hold the mutex
     demux_samples(output_items, num_samples_readed);  // it also increases the fifo read pointer
     // update fifo items
-    fifo_items = fifo_items - bytes_requested;
+    {
+        boost::mutex::scoped_lock lock(d_mutex);
+        fifo_items = fifo_items - bytes_requested;
+    }
 
     for (uint64_t n = 0; n < output_items.size(); n++)
         {
@@ -468,3 +632,31 @@ int Gr_Complex_Ip_Packet_Source::work(int noutput_items,
         }
     return this->WORK_CALLED_PRODUCE;
 }
+
+
+uint64_t Gr_Complex_Ip_Packet_Source::received_packets()
+{
+    boost::mutex::scoped_lock lock(d_mutex);
+    return d_received_packets;
+}
+
+
+uint64_t Gr_Complex_Ip_Packet_Source::lost_packets()
+{
+    boost::mutex::scoped_lock lock(d_mutex);
+    return d_lost_packets;
+}
+
+
+uint64_t Gr_Complex_Ip_Packet_Source::out_of_order_packets()
+{
+    boost::mutex::scoped_lock lock(d_mutex);
+    return d_out_of_order_packets;
+}
+
+
+uint64_t Gr_Complex_Ip_Packet_Source::overflows()
+{
+    boost::mutex::scoped_lock lock(d_mutex);
+    return d_overflows;
+}
@@ -2,7 +2,8 @@
  * \file gr_complex_ip_packet_source.h
  *
  * \brief Receives ip frames containing samples in UDP frame encapsulation
- * using a high performance packet capture library (libpcap)
+ * using a high performance packet capture library (libpcap), or batches of
+ * datagrams from a UDP socket
  * \author Javier Arribas jarribas (at) cttc.es
  *
  * -----------------------------------------------------------------------------
@@ -28,8 +29,11 @@
 #include <net/if.h>
 #include <netinet/if_ether.h>
 #include <pcap.h>
+#include <atomic>
+#include <cstdint>
 #include <string>
 #include <sys/ioctl.h>
+#include <vector>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -38,6 +42,16 @@
  * \{ */
 
 
+/*!
+ * \brief Receives samples in UDP datagrams and demultiplexes them into up to
+ * four baseband channels.
+ *
+ * The datagrams are either captured from the network device with libpcap
+ * (\p capture_backend = "pcap") or read in batches from a socket bound to
+ * the UDP port (\p capture_backend = "recvmmsg"), which needs no special
+ * privileges. If \p sequence_header is true, each payload starts with a
+ * 32-bit big-endian packet counter, used to count lost and late packets.
+ */
 class Gr_Complex_Ip_Packet_Source : virtual public gr::sync_block
 {
 public:
@@ -49,7 +63,9 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        const std::string &capture_backend,
+        bool sequence_header);
     Gr_Complex_Ip_Packet_Source(std::string src_device,
         const std::string &origin_address,
         int udp_port,
@@ -57,7 +73,9 @@ public:
         int n_baseband_channels,
         const std::string &wire_sample_type,
         size_t item_size,
-        bool IQ_swap_);
+        bool IQ_swap_,
+        const std::string &capture_backend,
+        bool sequence_header);
     ~Gr_Complex_Ip_Packet_Source();
 
     // Called by gnuradio to enable drivers, etc for i/o devices.
@@ -71,9 +89,17 @@ public:
         gr_vector_const_void_star &input_items,
         gr_vector_void_star &output_items);
 
+    uint64_t received_packets();      //!< Datagrams received on the UDP port
+    uint64_t lost_packets();          //!< Missing packet counter values, if sequence_header is true
+    uint64_t out_of_order_packets();  //!< Late datagrams, dropped, if sequence_header is true
+    uint64_t overflows();             //!< Datagrams dropped because the FIFO was full
+
 private:
     void demux_samples(const gr_vector_void_star &output_items, int num_samples_readed);
+    void convert_samples(gr_complex *out, const char *in, int channel, int num_samples);
+    void push_payload(const u_char *payload, int payload_length_bytes);
     void my_pcap_loop_thread(pcap_t *pcap_handle);
+    void my_socket_loop_thread();
     void pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
     static void static_pcap_callback(u_char *args, const struct pcap_pkthdr *pkthdr, const u_char *packet);
     /*
@@ -84,6 +110,8 @@ private:
 
     boost::thread *d_pcap_thread;
     boost::mutex d_mutex;
+    std::vector<char> d_datagram_buffer;  // recvmmsg() batch, one slot per datagram
+    std::vector<char> d_channel_buffer;   // samples of one channel, gathered before conversion
     struct sockaddr_in si_me
     {
     };
@@ -91,15 +119,24 @@ private:
     std::string d_origin_address;
     pcap_t *descr;  // ethernet pcap device descriptor
     char *fifo_buff;
+    uint64_t d_received_packets;
+    uint64_t d_lost_packets;
+    uint64_t d_out_of_order_packets;
+    uint64_t d_overflows;
+    uint32_t d_expected_sequence;
     int fifo_read_ptr;
     int fifo_write_ptr;
     int fifo_items;
     int d_sock_raw;
     int d_udp_port;
+    int d_datagram_size;
     int d_n_baseband_channels;
     int d_wire_sample_type;
     int d_bytes_per_sample;
+    std::atomic<bool> d_stop_capture;
     bool d_IQ_swap;
+    bool d_socket_capture;
+    bool d_sequence_header;
 };
 
 
@@ -325,6 +325,7 @@ int labsat23_source::parse_header()
 
                     // end of header
                     d_header_parsed = true;
+                    make_decoding_table();
                     // seek file to the first signal sample
                     binary_input_file.clear();
                     binary_input_file.seekg(header_bytes, binary_input_file.beg);
@@ -357,77 +358,43 @@ int labsat23_source::parse_header()
 }
 
 
-void labsat23_source::decode_samples_one_channel(int16_t input_short, gr_complex *out, int type)
+void labsat23_source::make_decoding_table()
 {
-    std::bitset<16> bs(input_short);
-    switch (type)
+    // Each int16 register is stored as little-endian, and its most significant
+    // bits hold the first samples, so the samples in the second byte come first
+    d_samples_per_byte = (d_bits_per_sample == 2) ? 4 : 2;
+    d_decoding_table.resize(256 * d_samples_per_byte);
+    const std::array<float, 4> levels{1.0, 2.0, -2.0, -1.0};
+    for (int byte = 0; byte < 256; byte++)
         {
-        case 2:
-            // two bits per sample, 8 samples per int16
-            for (int i = 0; i < 8; i++)
-                {
-                    out[i] = gr_complex(static_cast<float>(bs[15 - (2 * i)]),
-                        static_cast<float>(bs[14 - (2 * i)]));
-                    out[i] = out[i] * gr_complex(2, 0) - gr_complex(1, 1);
-                }
-            break;
-        case 4:
-            //  bits per sample, 4 samples per int16
-            for (int i = 0; i < 4; i++)
+            std::bitset<8> bs(byte);
+            gr_complex *out = &d_decoding_table[byte * d_samples_per_byte];
+            for (int i = 0; i < d_samples_per_byte; i++)
                 {
-                    // out[i] = gr_complex(0.0, 0.0);
-                    // In-Phase
-                    if (bs[15 - 4 * i])
-                        {
-                            if (bs[13 - 4 * i])  // 11
-                                {
-                                    out[i] = gr_complex(-1, 0);
-                                }
-                            else  // 10
-                                {
-                                    out[i] = gr_complex(-2, 0);
-                                }
-                        }
-                    else
-                        {
-                            if (bs[13 - 4 * i])  // 01
-                                {
-                                    out[i] = gr_complex(2, 0);
-                                }
-                            else
-                                {
-                                    out[i] = gr_complex(1, 0);
-                                }
-                        }
-
-                    // Quadrature
-                    if (bs[14 - 4 * i])
+                    if (d_bits_per_sample == 2)
                         {
-                            if (bs[12 - 4 * i])  // 11
-                                {
-                                    out[i] += gr_complex(0, -1);
-                                }
-                            else  // 10
-                                {
-                                    out[i] += gr_complex(0, -2);
-                                }
+                            // 1 bit I + 1 bit Q
+                            out[i] = gr_complex(bs[7 - 2 * i] ? 1.0 : -1.0, bs[6 - 2 * i] ? 1.0 : -1.0);
                         }
                     else
                         {
-                            if (bs[12 - 4 * i])  // 01
-                                {
-                                    out[i] += gr_complex(0, 2);
-                                }
-                            else
-                                {
-                                    out[i] += gr_complex(0, 1);
-                                }
+                            // 2 bit I + 2 bit Q: 00 -> 1, 01 -> 2, 10 -> -2, 11 -> -1
+                            out[i] = gr_complex(levels[bs[7 - 4 * i] * 2 + bs[5 - 4 * i]],
+                                levels[bs[6 - 4 * i] * 2 + bs[4 - 4 * i]]);
                         }
-                    // out[i] += gr_complex(0.5, 0.5);
                 }
-            break;
-        default:
-            break;
+        }
+}
+
+
+void labsat23_source::decode_samples_one_channel(const uint8_t *input, std::size_t n_int16, gr_complex *out) const
+{
+    const auto samples_per_byte = static_cast<std::size_t>(d_samples_per_byte);
+    for (std::size_t n = 0; n < n_int16; n++)
+        {
+            std::copy_n(&d_decoding_table[input[2 * n + 1] * samples_per_byte], samples_per_byte, out);
+            std::copy_n(&d_decoding_table[input[2 * n] * samples_per_byte], samples_per_byte, out + samples_per_byte);
+            out += 2 * samples_per_byte;
         }
 }
 
@@ -641,11 +608,12 @@ int labsat23_source::read_ls3w_ini(const std::string &filename)
     std::cout << '\n';
 
     d_ls3w_samples_per_register = this->number_of_samples_per_ls3w_register();
-    d_ls3w_spare_bits = 64 - d_ls3w_samples_per_register * d_ls3w_QUA * 2;
+    d_ls3w_spare_bits = 64 - d_ls3w_samples_per_register * d_ls3w_CHN * d_ls3w_QUA * 2;
     for (auto ch_select : d_channel_selector_config)
         {
             d_ls3w_selected_channel_offset.push_back((ch_select - 1) * d_ls3w_QUA * 2);
         }
+    make_ls3w_decoding_table();
     return 0;
 }
 
@@ -733,191 +701,57 @@ int labsat23_source::number_of_samples_per_ls3w_register() const
 }
 
 
-void labsat23_source::decode_ls3w_register(uint64_t input, std::vector<gr_complex *> &out, size_t output_pointer) const
+void labsat23_source::make_ls3w_decoding_table()
 {
-    std::bitset<64> bs(input);
+    // Levels of each quantization, indexed by the bits of I or Q
+    const std::array<float, 2> levels_1bit{1.0, -1.0};
+    const std::array<float, 4> levels_2bit{0.5, 1.0, -1.0, -0.5};
+    const std::array<float, 8> levels_3bit{0.25, 0.5, 0.75, 1.0, -1.0, -0.75, -0.5, -0.25};
+    const float *levels = levels_1bit.data();
+    if (d_ls3w_QUA == 2)
+        {
+            levels = levels_2bit.data();
+        }
+    if (d_ls3w_QUA == 3)
+        {
+            levels = levels_3bit.data();
+        }
 
-    // Reverse, since register are written to file as 64-bit little endian words
-    for (std::size_t i = 0; i < 32; ++i)
+    const int component_mask = (1 << d_ls3w_QUA) - 1;
+    d_ls3w_decoding_table.resize(1U << (2 * d_ls3w_QUA));
+    for (std::size_t field = 0; field < d_ls3w_decoding_table.size(); field++)
         {
-            bool t = bs[i];
-            bs[i] = bs[64 - i - 1];
-            bs[64 - i - 1] = t;
+            d_ls3w_decoding_table[field] = gr_complex(levels[(field >> d_ls3w_QUA) & component_mask], levels[field & component_mask]);
         }
+}
+
 
-    int output_chan = 0;
-    for (auto channel_offset : d_ls3w_selected_channel_offset)
+void labsat23_source::decode_ls3w_registers(const uint8_t *input, std::size_t n_registers, std::vector<gr_complex *> &out) const
+{
+    // Registers are written to file as 64-bit little endian words, and the
+    // samples are packed from the most significant bit downwards
+    const int field_bits = 2 * d_ls3w_QUA;
+    const uint64_t field_mask = (1ULL << field_bits) - 1ULL;
+    const auto samples_per_register = static_cast<std::size_t>(d_ls3w_samples_per_register);
+    for (std::size_t r = 0; r < n_registers; r++)
         {
-            for (int i = 0; i < d_ls3w_samples_per_register; i++)
+            uint64_t read_register = 0ULL;
+            for (int k = 7; k >= 0; --k)
                 {
-                    float sampleI = 0.0;
-                    float sampleQ = 0.0;
+                    read_register <<= 8;
+                    read_register |= static_cast<uint64_t>(input[8 * r + k]);
+                }
 
-                    const int bit_offset = d_ls3w_spare_bits + i * d_ls3w_SFT + channel_offset;
-                    switch (d_ls3w_QUA)
+            for (std::size_t chan = 0; chan < d_ls3w_selected_channel_offset.size(); chan++)
+                {
+                    gr_complex *aux = out[chan] + r * samples_per_register;
+                    int shift = 64 - d_ls3w_spare_bits - d_ls3w_selected_channel_offset[chan] - field_bits;
+                    for (std::size_t i = 0; i < samples_per_register; i++)
                         {
-                        case 1:
-                            sampleI = bs[bit_offset] ? -1.0 : 1.0;
-                            sampleQ = bs[bit_offset + 1] ? -1.0 : 1.0;
-                            break;
-                        case 2:
-                            if (bs[bit_offset])
-                                {
-                                    if (bs[bit_offset + 1])  // 11
-                                        {
-                                            sampleI = -0.5;
-                                        }
-                                    else  // 10
-                                        {
-                                            sampleI = -1.0;
-                                        }
-                                }
-                            else
-                                {
-                                    if (bs[bit_offset + 1])  // 01
-                                        {
-                                            sampleI = 1.0;
-                                        }
-                                    else  // 00
-                                        {
-                                            sampleI = 0.5;
-                                        }
-                                }
-                            if (bs[bit_offset + 2])
-                                {
-                                    if (bs[bit_offset + 3])  // 11
-                                        {
-                                            sampleQ = -0.5;
-                                        }
-                                    else  // 10
-                                        {
-                                            sampleQ = -1.0;
-                                        }
-                                }
-                            else
-                                {
-                                    if (bs[bit_offset + 3])  // 01
-                                        {
-                                            sampleQ = 1.0;
-                                        }
-                                    else  // 00
-                                        {
-                                            sampleQ = 0.5;
-                                        }
-                                }
-                            break;
-
-                        case 3:
-                            if (bs[bit_offset])
-                                {
-                                    if (bs[bit_offset + 1])
-                                        {
-                                            if (bs[bit_offset + 2])  // 111
-                                                {
-                                                    sampleI = -0.25;
-                                                }
-                                            else  // 110
-                                                {
-                                                    sampleI = -0.5;
-                                                }
-                                        }
-                                    else
-                                        {
-                                            if (bs[bit_offset + 2])  // 101
-                                                {
-                                                    sampleI = -0.75;
-                                                }
-                                            else  // 100
-                                                {
-                                                    sampleI = -1.0;
-                                                }
-                                        }
-                                }
-                            else
-                                {
-                                    if (bs[bit_offset + 1])
-                                        {
-                                            if (bs[bit_offset + 2])  // 011
-                                                {
-                                                    sampleI = 1;
-                                                }
-                                            else  // 010
-                                                {
-                                                    sampleI = 0.75;
-                                                }
-                                        }
-                                    else
-                                        {
-                                            if (bs[bit_offset + 2])  // 001
-                                                {
-                                                    sampleI = 0.5;
-                                                }
-                                            else  // 000
-                                                {
-                                                    sampleI = 0.25;
-                                                }
-                                        }
-                                }
-                            if (bs[bit_offset + 3])
-                                {
-                                    if (bs[bit_offset + 4])
-                                        {
-                                            if (bs[bit_offset + 5])  // 111
-                                                {
-                                                    sampleQ = -0.25;
-                                                }
-                                            else  // 110
-                                                {
-                                                    sampleQ = -0.5;
-                                                }
-                                        }
-                                    else
-                                        {
-                                            if (bs[bit_offset + 5])  // 101
-                                                {
-                                                    sampleQ = -0.75;
-                                                }
-                                            else  // 100
-                                                {
-                                                    sampleQ = -1.0;
-                                                }
-                                        }
-                                }
-                            else
-                                {
-                                    if (bs[bit_offset + 4])
-                                        {
-                                            if (bs[bit_offset + 5])  // 011
-                                                {
-                                                    sampleQ = 1;
-                                                }
-                                            else  // 010
-                                                {
-                                                    sampleQ = 0.75;
-                                                }
-                                        }
-                                    else
-                                        {
-                                            if (bs[bit_offset + 5])  // 001
-                                                {
-                                                    sampleQ = 0.5;
-                                                }
-                                            else  // 000
-                                                {
-                                                    sampleQ = 0.25;
-                                                }
-                                        }
-                                }
-
-                            break;
-
-                        default:
-                            break;
+                            aux[i] = d_ls3w_decoding_table[(read_register >> shift) & field_mask];
+                            shift -= d_ls3w_SFT;
                         }
-                    gr_complex *aux = out[output_chan];
-                    aux[output_pointer + i] = gr_complex(sampleI, sampleQ);
                 }
-            output_chan++;
         }
 }
 
@@ -940,126 +774,55 @@ int labsat23_source::general_work(int noutput_items,
                 }
 
             // ready to start reading samples
-            switch (d_bits_per_sample)
+            if (d_channel_selector == 0)
                 {
-                case 2:
-                    switch (d_channel_selector)
+                    // dual channel
+                    // todo: implement dual channel reader
+                    return 0;
+                }
+
+            // single channel, 2 bits (1 bit I + 1 bit Q, 8 samples per int16)
+            // or 4 bits (2 bit I + 2 bit Q, 4 samples per int16) per complex sample
+            const int samples_per_int16 = 2 * d_samples_per_byte;
+            int n_int16_to_read = noutput_items / samples_per_int16;
+            if (n_int16_to_read > 0)
+                {
+                    d_read_buffer.resize(n_int16_to_read * 2);
+                    binary_input_file.read(reinterpret_cast<char *>(d_read_buffer.data()), n_int16_to_read * 2);
+                    n_int16_to_read = static_cast<int>(binary_input_file.gcount()) / 2;  // from bytes to int16
+                    if (n_int16_to_read > 0)
                         {
-                        case 0:
-                            // dual channel 2 bits per complex sample
-                            // todo: implement dual channel reader
-                            break;
-                        default:
-                            // single channel 2 bits per complex sample (1 bit I + 1 bit Q, 8 samples per int16)
-                            int n_int16_to_read = noutput_items / 8;
-                            if (n_int16_to_read > 0)
-                                {
-                                    std::vector<int16_t> memblock(n_int16_to_read);
-                                    binary_input_file.read(reinterpret_cast<char *>(memblock.data()), n_int16_to_read * 2);
-                                    n_int16_to_read = static_cast<int>(binary_input_file.gcount()) / 2;  // from bytes to int16
-                                    if (n_int16_to_read > 0)
-                                        {
-                                            int output_pointer = 0;
-                                            for (int i = 0; i < n_int16_to_read; i++)
-                                                {
-                                                    decode_samples_one_channel(memblock[i], out[0] + output_pointer, d_bits_per_sample);
-                                                    output_pointer += 8;
-                                                }
-                                            return output_pointer;
-                                        }
-
-                                    // trigger the read of the next file in the sequence
-                                    d_current_file_number++;
-                                    if (d_labsat_version == 3)
-                                        {
-                                            std::cout << "End of current file, reading the next LabSat file in sequence: " << generate_filename() << '\n';
-                                        }
-                                    binary_input_file.close();
-                                    binary_input_file.open(generate_filename().c_str(), std::ios::in | std::ios::binary);
-                                    if (binary_input_file.is_open())
-                                        {
-                                            std::cout << "LabSat file source is reading samples from " << generate_filename() << '\n';
-                                            return 0;
-                                        }
-
-                                    if (d_labsat_version == 3)
-                                        {
-                                            std::cout << "Last file reached, LabSat source stop\n";
-                                        }
-                                    else
-                                        {
-                                            std::cout << "End of file reached, LabSat source stop\n";
-                                        }
-
-                                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
-                                    return -1;
-                                }
-                            else
-                                {
-                                    return 0;
-                                }
+                            decode_samples_one_channel(d_read_buffer.data(), n_int16_to_read, out[0]);
+                            return n_int16_to_read * samples_per_int16;
                         }
-                    break;
-                case 4:
-                    switch (d_channel_selector)
+
+                    // trigger the read of the next file in the sequence
+                    d_current_file_number++;
+                    if (d_labsat_version == 3)
                         {
-                        case 0:
-                            // dual channel
-                            // todo: implement dual channel reader
-                            break;
-                        default:
-                            // single channel 4 bits per complex sample (2 bit I + 2 bit Q, 4 samples per int16)
-                            int n_int16_to_read = noutput_items / 4;
-                            if (n_int16_to_read > 0)
-                                {
-                                    std::vector<int16_t> memblock(n_int16_to_read);
-                                    binary_input_file.read(reinterpret_cast<char *>(memblock.data()), n_int16_to_read * 2);
-                                    n_int16_to_read = static_cast<int>(binary_input_file.gcount()) / 2;  // from bytes to int16
-                                    if (n_int16_to_read > 0)
-                                        {
-                                            int output_pointer = 0;
-                                            for (int i = 0; i < n_int16_to_read; i++)
-                                                {
-                                                    decode_samples_one_channel(memblock[i], out[0] + output_pointer, d_bits_per_sample);
-                                                    output_pointer += 4;
-                                                }
-                                            return output_pointer;
-                                        }
-
-                                    // trigger the read of the next file in the sequence
-                                    d_current_file_number++;
-                                    if (d_labsat_version == 3)
-                                        {
-                                            std::cout << "End of current file, reading the next Labsat file in sequence: " << generate_filename() << '\n';
-                                        }
-                                    binary_input_file.close();
-                                    binary_input_file.open(generate_filename().c_str(), std::ios::in | std::ios::binary);
-                                    if (binary_input_file.is_open())
-                                        {
-                                            std::cout << "Labsat file source is reading samples from " << generate_filename() << '\n';
-                                            return 0;
-                                        }
-
-                                    if (d_labsat_version == 3)
-                                        {
-                                            std::cout << "Last file reached, LabSat source stop\n";
-                                        }
-                                    else
-                                        {
-                                            std::cout << "End of file reached, LabSat source stop\n";
-                                        }
-                                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
-                                    return -1;
-                                }
-                            else
-                                {
-                                    return 0;
-                                }
+                            std::cout << "End of current file, reading the next LabSat file in sequence: " << generate_filename() << '\n';
+                        }
+                    binary_input_file.close();
+                    binary_input_file.open(generate_filename().c_str(), std::ios::in | std::ios::binary);
+                    if (binary_input_file.is_open())
+                        {
+                            std::cout << "LabSat file source is reading samples from " << generate_filename() << '\n';
+                            return 0;
                         }
-                    break;
-                default:
+
+                    if (d_labsat_version == 3)
+                        {
+                            std::cout << "Last file reached, LabSat source stop\n";
+                        }
+                    else
+                        {
+                            std::cout << "End of file reached, LabSat source stop\n";
+                        }
+
+                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
                     return -1;
                 }
+            return 0;
         }
     else  // Labsat 3 Wideband
         {
@@ -1071,40 +834,17 @@ int labsat23_source::general_work(int noutput_items,
                         {
                             return 0;
                         }
-                    std::size_t output_pointer = 0;
-                    for (int i = 0; i < registers_to_read; i++)
+                    d_read_buffer.resize(registers_to_read * 8);
+                    binary_input_file.read(reinterpret_cast<char *>(d_read_buffer.data()), registers_to_read * 8);
+                    registers_to_read = static_cast<int>(binary_input_file.gcount()) / 8;
+                    if (registers_to_read > 0)
                         {
-                            std::array<char, 8> memory_block{};
-                            binary_input_file.read(memory_block.data(), 8);
-                            uint64_t read_register = 0ULL;
-                            for (int k = 7; k >= 0; --k)
-                                {
-                                    read_register <<= 8;
-                                    read_register |= uint64_t(memory_block[k]);
-                                }
-
-                            if (binary_input_file.gcount() == 8)
-                                {
-                                    decode_ls3w_register(read_register, out, output_pointer);
-                                    output_pointer += d_ls3w_samples_per_register;
-                                }
-                            else
-                                {
-                                    std::cout << "End of file reached, LabSat source stop.\n";
-                                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
-                                    return -1;
-                                }
+                            decode_ls3w_registers(d_read_buffer.data(), registers_to_read, out);
+                            return registers_to_read * d_ls3w_samples_per_register;
                         }
-                    return output_pointer;
-                }
-            else
-                {
-                    std::cout << "End of file reached, LabSat source stop.\n";
-                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
-                    return -1;
                 }
+            std::cout << "End of file reached, LabSat source stop.\n";
+            d_queue->push(pmt::make_any(command_event_make(200, 0)));
+            return -1;
         }
-
-    std::cout << "Warning!!\n";
-    return 0;
 }
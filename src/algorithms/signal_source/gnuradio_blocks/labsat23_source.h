@@ -78,10 +78,14 @@ private:
     int read_ls3w_ini(const std::string &filename);
     int number_of_samples_per_ls3w_register() const;
 
-    void decode_samples_one_channel(int16_t input_short, gr_complex *out, int type);
-    void decode_ls3w_register(uint64_t input, std::vector<gr_complex *> &out, std::size_t output_pointer) const;
+    void make_decoding_table();
+    void make_ls3w_decoding_table();
+    void decode_samples_one_channel(const uint8_t *input, std::size_t n_int16, gr_complex *out) const;
+    void decode_ls3w_registers(const uint8_t *input, std::size_t n_registers, std::vector<gr_complex *> &out) const;
 
     std::ifstream binary_input_file;
+    std::vector<uint8_t> d_read_buffer;
+    std::vector<gr_complex> d_decoding_table;  // samples encoded in each byte, for LabSat 2 and 3
     std::string d_signal_file_basename;
     Concurrent_Queue<pmt::pmt_t> *d_queue;
     std::vector<int> d_channel_selector_config;
@@ -90,11 +94,13 @@ private:
     uint8_t d_channel_selector;
     uint8_t d_ref_clock;
     uint8_t d_bits_per_sample;
+    int d_samples_per_byte{};
     bool d_header_parsed;
 
     // Data members for Labsat 3 Wideband
     std::string d_ls3w_OSC;
     std::vector<int> d_ls3w_selected_channel_offset;
+    std::vector<gr_complex> d_ls3w_decoding_table;  // sample encoded in each I/Q bit field
     int64_t d_ls3w_SMP{};
     int32_t d_ls3w_QUA{};
     int32_t d_ls3w_CHN{};
@@ -0,0 +1,237 @@
+/*!
+ * \file mmap_file_source.cc
+ *
+ * \brief Reads samples from a file through sliding memory-mapped windows
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <cerrno>
+#include <cstdio>      // for SEEK_SET, SEEK_CUR, SEEK_END
+#include <cstring>     // for memcpy, strerror
+#include <fcntl.h>     // for open, posix_fadvise
+#include <stdexcept>   // for std::runtime_error
+#include <sys/mman.h>  // for mmap, madvise
+#include <sys/stat.h>  // for fstat
+#include <unistd.h>    // for close, sysconf
+
+
+mmap_file_source_sptr make_mmap_file_source(size_t item_size,
+    const std::string &filename,
+    bool repeat,
+    size_t window_size)
+{
+    return mmap_file_source_sptr(new mmap_file_source(item_size, filename, repeat, window_size));
+}
+
+
+mmap_file_source::mmap_file_source(size_t item_size,
+    const std::string &filename,
+    bool repeat,
+    size_t window_size) : gr::sync_block("mmap_file_source",
+                              gr::io_signature::make(0, 0, 0),
+                              gr::io_signature::make(1, 1, item_size)),
+                          d_filename(filename),
+                          d_window(nullptr),
+                          d_item_size(item_size),
+                          d_window_size(window_size),
+                          d_file_size(0),
+                          d_data_end(0),
+                          d_position(0),
+                          d_window_start(0),
+                          d_window_length(0),
+                          d_readahead_end(0),
+                          d_fd(-1),
+                          d_repeat(repeat)
+{
+    // mmap() offsets must be multiples of the page size
+    const auto page_size = static_cast<uint64_t>(::sysconf(_SC_PAGESIZE));
+    d_window_size = d_window_size < page_size ? page_size : d_window_size + (page_size - d_window_size % page_size) % page_size;
+    d_fd = ::open(filename.c_str(), O_RDONLY);
+    if (d_fd < 0)
+        {
+            throw std::runtime_error("mmap_file_source: cannot open " + filename + ": " + std::strerror(errno));
+        }
+    struct stat file_status = {};
+    if (::fstat(d_fd, &file_status) != 0)
+        {
+            const std::string error(std::strerror(errno));
+            ::close(d_fd);
+            throw std::runtime_error("mmap_file_source: cannot stat " + filename + ": " + error);
+        }
+    d_file_size = static_cast<uint64_t>(file_status.st_size);
+    d_data_end = d_file_size - d_file_size % d_item_size;
+    if (d_data_end < d_file_size)
+        {
+            LOG(WARNING) << filename << " is not a multiple of the item size (" << d_item_size
+                         << " bytes). The last " << d_file_size - d_data_end << " bytes will be ignored.";
+        }
+#if defined(POSIX_FADV_SEQUENTIAL)
+    ::posix_fadvise(d_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+    DLOG(INFO) << "mmap_file_source reading " << filename << " (" << d_file_size << " bytes)";
+}
+
+
+mmap_file_source::~mmap_file_source()
+{
+    unmap_window();
+    if (d_fd >= 0)
+        {
+            ::close(d_fd);
+        }
+}
+
+
+bool mmap_file_source::seek(int64_t seek_point, int whence)
+{
+    int64_t position = seek_point;
+    switch (whence)
+        {
+        case SEEK_SET:
+            break;
+        case SEEK_CUR:
+            position += static_cast<int64_t>(d_position / d_item_size);
+            break;
+        case SEEK_END:
+            position += static_cast<int64_t>(d_data_end / d_item_size);
+            break;
+        default:
+            return false;
+        }
+    if (position < 0 || static_cast<uint64_t>(position) * d_item_size > d_data_end)
+        {
+            LOG(WARNING) << "mmap_file_source: seek to item " << position << " is outside of " << d_filename;
+            return false;
+        }
+    d_position = static_cast<uint64_t>(position) * d_item_size;
+    d_readahead_end = d_position;
+    return true;
+}
+
+
+const uint8_t *mmap_file_source::map_window(uint64_t position)
+{
+    if (d_window != nullptr && position >= d_window_start && position < d_window_start + d_window_length)
+        {
+            return d_window + (position - d_window_start);
+        }
+    unmap_window();
+
+    // d_window_size is a multiple of the page size, so is the offset
+    const uint64_t start = position - position % d_window_size;
+    const uint64_t remaining = d_file_size - start;
+    const uint64_t length = remaining < d_window_size ? remaining : d_window_size;
+    void *addr = ::mmap(nullptr, length, PROT_READ, MAP_SHARED, d_fd, static_cast<off_t>(start));
+    if (addr == MAP_FAILED)
+        {
+            LOG(ERROR) << "mmap_file_source: cannot map " << d_filename << " at offset " << start << ": " << std::strerror(errno);
+            return nullptr;
+        }
+    ::madvise(addr, length, MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+    // Only honored by filesystems that support huge pages in the page cache
+    ::madvise(addr, length, MADV_HUGEPAGE);
+#endif
+#if !defined(POSIX_FADV_WILLNEED)
+    ::madvise(addr, length, MADV_WILLNEED);
+#endif
+    d_window = static_cast<const uint8_t *>(addr);
+    d_window_start = start;
+    d_window_length = length;
+    return d_window + (position - d_window_start);
+}
+
+
+void mmap_file_source::unmap_window()
+{
+    if (d_window != nullptr)
+        {
+            ::munmap(const_cast<uint8_t *>(d_window), d_window_length);
+            d_window = nullptr;
+            d_window_length = 0;
+        }
+}
+
+
+void mmap_file_source::read_ahead()
+{
+#if defined(POSIX_FADV_WILLNEED)
+    // Ask for the next readahead_size bytes once half of the previous request has been consumed
+    if (d_readahead_end >= d_data_end || (d_readahead_end > d_position && d_readahead_end - d_position > readahead_size / 2))
+        {
+            return;
+        }
+    const uint64_t start = d_readahead_end > d_position ? d_readahead_end : d_position;
+    uint64_t end = d_position + readahead_size;
+    if (end > d_data_end)
+        {
+            end = d_data_end;
+        }
+    ::posix_fadvise(d_fd, static_cast<off_t>(start), static_cast<off_t>(end - start), POSIX_FADV_WILLNEED);
+    d_readahead_end = end;
+#endif
+}
+
+
+int mmap_file_source::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<uint8_t *>(output_items[0]);
+    const uint64_t requested = static_cast<uint64_t>(noutput_items) * d_item_size;
+    uint64_t copied = 0;
+    while (copied < requested)
+        {
+            if (d_position >= d_data_end)
+                {
+                    if (!d_repeat || d_data_end == 0)
+                        {
+                            break;
+                        }
+                    d_position = 0;
+                    d_readahead_end = 0;
+                }
+            read_ahead();
+            const uint8_t *in = map_window(d_position);
+            if (in == nullptr)
+                {
+                    d_position -= copied % d_item_size;
+                    copied -= copied % d_item_size;
+                    break;
+                }
+            uint64_t n = requested - copied;
+            const uint64_t in_window = d_window_start + d_window_length - d_position;
+            const uint64_t in_data = d_data_end - d_position;
+            if (n > in_window)
+                {
+                    n = in_window;
+                }
+            if (n > in_data)
+                {
+                    n = in_data;
+                }
+            std::memcpy(out + copied, in, n);
+            copied += n;
+            d_position += n;
+        }
+
+    // Items may straddle two windows, but never the end of the data
+    const auto items = static_cast<int>(copied / d_item_size);
+    if (items == 0)
+        {
+            return WORK_DONE;
+        }
+    return items;
+}
@@ -0,0 +1,105 @@
+/*!
+ * \file mmap_file_source.h
+ *
+ * \brief Reads samples from a file through sliding memory-mapped windows
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MMAP_FILE_SOURCE_H
+#define GNSS_SDR_MMAP_FILE_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+class mmap_file_source;
+
+using mmap_file_source_sptr = gnss_shared_ptr<mmap_file_source>;
+
+mmap_file_source_sptr make_mmap_file_source(size_t item_size,
+    const std::string &filename,
+    bool repeat,
+    size_t window_size = 64 * 1024 * 1024);
+
+/*!
+ * \brief Drop-in replacement of gr::blocks::file_source that maps the file
+ * into memory instead of reading it with fread.
+ *
+ * The file is mapped in windows of window_size bytes, 64 MiB by default, which
+ * is rounded up to a multiple of the page size. The default is a multiple of
+ * 2 MiB, so the kernel can back the windows with huge pages where the
+ * filesystem supports it. The kernel is told that the access is sequential, and the next
+ * readahead_size bytes ahead of the read position are requested in advance, so
+ * work() only copies from the page cache into the output buffer and does not
+ * make a system call per chunk.
+ *
+ * As with gr::blocks::file_source, seek() positions are in items and, when
+ * repeat is set, reading restarts at the beginning of the file.
+ */
+class mmap_file_source : public gr::sync_block
+{
+public:
+    static constexpr size_t readahead_size = 16 * 1024 * 1024;  //!< Bytes requested ahead of the read position
+
+    ~mmap_file_source();
+
+    /*!
+     * \brief Moves the read position, in items, as fseek does. Returns false
+     * if the position is outside of the file.
+     */
+    bool seek(int64_t seek_point, int whence);
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend mmap_file_source_sptr make_mmap_file_source(size_t item_size,
+        const std::string &filename,
+        bool repeat,
+        size_t window_size);
+
+    mmap_file_source(size_t item_size,
+        const std::string &filename,
+        bool repeat,
+        size_t window_size);
+
+    const uint8_t *map_window(uint64_t position);
+    void unmap_window();
+    void read_ahead();
+
+    std::string d_filename;
+    const uint8_t *d_window;
+    size_t d_item_size;
+    uint64_t d_window_size;  // bytes mapped at a time, a multiple of the page size
+    uint64_t d_file_size;
+    uint64_t d_data_end;  // end of the last complete item
+    uint64_t d_position;
+    uint64_t d_window_start;
+    uint64_t d_window_length;
+    uint64_t d_readahead_end;
+    int d_fd;
+    bool d_repeat;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MMAP_FILE_SOURCE_H
@@ -18,21 +18,16 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
-
-struct byte_2bit_struct
-{
-    signed sample_0 : 2;  // <- 2 bits wide only
-    signed sample_1 : 2;  // <- 2 bits wide only
-    signed sample_2 : 2;  // <- 2 bits wide only
-    signed sample_3 : 2;  // <- 2 bits wide only
-};
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <array>
 
 
-union byte_and_samples
+namespace
 {
-    int8_t byte;
-    byte_2bit_struct samples;
-};
+// Values of the 2-bit codes 00, 01, 10 and 11: 2 * x + 1, x being the
+// two's complement interpretation of the code
+const std::array<int8_t, 4> TWO_BIT_LEVELS = {1, 3, -3, -1};
+}  // namespace
 
 
 bool systemIsBigEndian()
@@ -47,19 +42,6 @@ bool systemIsBigEndian()
 }
 
 
-bool systemBytesAreBigEndian()
-{
-    byte_and_samples b{};
-    b.byte = static_cast<int8_t>(0x01);
-    if (*reinterpret_cast<char *>(&b.byte) == 1)
-        {
-            return false;
-        }
-
-    return true;
-}
-
-
 void swapEndianness(int8_t const *in, std::vector<int8_t> &out, size_t item_size, unsigned int ninput_items)
 {
     unsigned int i;
@@ -104,6 +86,7 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
       item_size_(item_size),
       big_endian_bytes_(big_endian_bytes),
       big_endian_items_(big_endian_items),
+      sample_order_(0),
       swap_endian_items_(false),
       reverse_interleaving_(reverse_interleaving)
 {
@@ -114,9 +97,17 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     swap_endian_items_ = (item_size_ > 1) &&
                          (big_endian_system != big_endian_items);
 
-    bool big_endian_bytes_system = systemBytesAreBigEndian();
-
-    swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
+    // Order of the 2-bit fields of each byte in the output, as the
+    // volk_gnsssdr_8u_unpack_twobit_8i kernel expects it (field 0 holds the
+    // least significant bits of the byte)
+    if (!reverse_interleaving_)
+        {
+            sample_order_ = big_endian_bytes_ ? 0x1B : 0xE4;  // 3 2 1 0 : 0 1 2 3
+        }
+    else
+        {
+            sample_order_ = big_endian_bytes_ ? 0x4E : 0xB1;  // 2 3 0 1 : 1 0 3 2
+        }
 }
 
 
@@ -133,78 +124,18 @@ int unpack_2bit_samples::work(int noutput_items,
     // Handle endian swap if needed
     if (swap_endian_items_)
         {
-            work_buffer_.reserve(ninput_bytes);
+            if (work_buffer_.size() < ninput_bytes)
+                {
+                    work_buffer_.resize(ninput_bytes);
+                }
             swapEndianness(in, work_buffer_, item_size_, ninput_items);
 
             in = const_cast<signed char const *>(&work_buffer_[0]);
         }
 
     // Here the in pointer can be interpreted as a stream of bytes to be
-    // converted. But we now have two possibilities:
-    // 1) The samples in a byte are in big endian order
-    // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
-                }
-        }
-    else
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
-                }
-        }
+    // converted, in the order of samples given by sample_order_
+    volk_gnsssdr_8u_unpack_twobit_8i(out, reinterpret_cast<const uint8_t *>(in), TWO_BIT_LEVELS.data(), sample_order_, ninput_bytes);
 
     return noutput_items;
 }
@@ -106,8 +106,8 @@ private:
     size_t item_size_;
     bool big_endian_bytes_;
     bool big_endian_items_;
+    unsigned int sample_order_;
     bool swap_endian_items_;
-    bool swap_endian_bytes_;
     bool reverse_interleaving_;
 };
 
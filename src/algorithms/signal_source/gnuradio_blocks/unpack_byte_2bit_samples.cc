@@ -17,11 +17,15 @@
 
 #include "unpack_byte_2bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <array>
+#include <cstdint>
 
-struct byte_2bit_struct
+namespace
 {
-    signed two_bit_sample : 2;  // <- 2 bits wide only
-};
+// Values of the 2-bit codes 00, 01, 10 and 11 (two's complement)
+const std::array<int8_t, 4> TWO_BIT_LEVELS = {0, 1, -2, -1};
+}  // namespace
 
 
 unpack_byte_2bit_samples_sptr make_unpack_byte_2bit_samples()
@@ -42,26 +46,10 @@ int unpack_byte_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const signed char *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    byte_2bit_struct sample{};
-    int n = 0;
-    for (int i = 0; i < noutput_items / 4; i++)
-        {
-            // Read packed input sample (1 byte = 4 samples)
-            signed char c = in[i];
-            sample.two_bit_sample = c & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 2) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 4) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 6) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-        }
+    // 1 byte = 4 samples, starting from the least significant bits
+    volk_gnsssdr_8u_unpack_twobit_32f(out, in, TWO_BIT_LEVELS.data(), 0xE4, noutput_items / 4);
     return noutput_items;
 }
@@ -18,7 +18,24 @@
 
 #include "unpack_spir_gss6450_samples.h"
 #include <gnuradio/io_signature.h>
-#include <cmath>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <array>
+
+namespace
+{
+// Values of the 2-bit and 4-bit codes (two's complement)
+const std::array<int8_t, 4> TWO_BIT_LEVELS = {0, 1, -2, -1};
+const std::array<int8_t, 16> FOUR_BIT_LEVELS = {0, 1, 2, 3, 4, 5, 6, 7, -8, -7, -6, -5, -4, -3, -2, -1};
+
+bool systemIsLittleEndian()
+{
+    const uint32_t test_int = 1;
+    return *reinterpret_cast<const uint8_t*>(&test_int) == 1;
+}
+}  // namespace
+
 
 unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples(int adc_nbit_)
 {
@@ -31,92 +48,46 @@ unpack_spir_gss6450_samples::unpack_spir_gss6450_samples(int adc_nbit)
           gr::io_signature::make(1, 1, sizeof(int32_t)),
           gr::io_signature::make(1, 1, sizeof(gr_complex)), 16 / adc_nbit),
       adc_bits(adc_nbit),
-      samples_per_int(16 / adc_bits)
+      samples_per_int(16 / adc_bits),
+      little_endian_(systemIsLittleEndian())
 {
 }
 
 
-void unpack_spir_gss6450_samples::decode_4bits_word(uint32_t input_uint32, gr_complex* out, int adc_bits_)
+int unpack_spir_gss6450_samples::work(int noutput_items,
+    gr_vector_const_void_star& input_items, gr_vector_void_star& output_items)
 {
-    int8_t tmp_char;
-    float Q;
-    float I;
-    switch (adc_bits_)
+    const auto* in = reinterpret_cast<const uint32_t*>(input_items[0]);
+    auto* out = reinterpret_cast<float*>(output_items[0]);
+    const auto nwords = static_cast<unsigned int>(noutput_items / samples_per_int);
+
+    // The first sample of each word is in its most significant bits, so the
+    // bytes of the words are read from the most significant one
+    const auto* bytes = reinterpret_cast<const uint8_t*>(in);
+    if (little_endian_)
         {
-        case 2:
-            // four bits per complex sample (2 I + 2 Q), 8 samples per int32[s0,s1,s2,s3,s4,s5,s6,s7]
-            for (int i = 0; i < 8; i++)
+            if (words_.size() < nwords)
                 {
-                    tmp_char = input_uint32 & 3;
-
-                    if (tmp_char >= 2)
-                        {
-                            I = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-                    tmp_char = input_uint32 & 3;
-                    if (tmp_char >= 2)
-                        {
-                            Q = static_cast<float>(tmp_char - 4);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 2;
-
-                    out[7 - i] = gr_complex(I, Q);
+                    words_.resize(nwords);
                 }
+            std::copy(in, in + nwords, words_.begin());
+            volk_32u_byteswap(words_.data(), nwords);
+            bytes = reinterpret_cast<const uint8_t*>(words_.data());
+        }
+
+    switch (adc_bits)
+        {
+        case 2:
+            // four bits per complex sample (2 I + 2 Q), 8 samples per int32[s0,s1,s2,s3,s4,s5,s6,s7]
+            // Each byte holds I (bits 4-5), Q (bits 6-7) of a sample and I (bits 0-1), Q (bits 2-3) of the next one
+            volk_gnsssdr_8u_unpack_twobit_32f(out, bytes, TWO_BIT_LEVELS.data(), 0x4E, 4 * nwords);
             break;
         case 4:
             // eight bits per complex sample (4 I + 4 Q), 4 samples per int32= [s0,s1,s2,s3]
-            for (int i = 0; i < 4; i++)
-                {
-                    tmp_char = input_uint32 & 0x0F;
-
-                    if (tmp_char >= 8)
-                        {
-                            I = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            I = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-                    tmp_char = input_uint32 & 0x0F;
-                    if (tmp_char >= 8)
-                        {
-                            Q = static_cast<float>(tmp_char - 16);
-                        }
-                    else
-                        {
-                            Q = static_cast<float>(tmp_char);
-                        }
-                    input_uint32 = input_uint32 >> 4;
-
-                    out[3 - i] = gr_complex(I, Q);
-                }
+            // Each byte holds I (low nibble) and Q (high nibble) of a sample
+            volk_gnsssdr_8u_unpack_fourbit_32f(out, bytes, FOUR_BIT_LEVELS.data(), 0, 4 * nwords);
             break;
         }
-}
-
-int unpack_spir_gss6450_samples::work(int noutput_items,
-    gr_vector_const_void_star& input_items, gr_vector_void_star& output_items)
-{
-    const auto* in = reinterpret_cast<const int32_t*>(input_items[0]);
-    auto* out = reinterpret_cast<gr_complex*>(output_items[0]);
-    int n_sample = 0;
-    int in_counter = 0;
-    do
-        {
-            decode_4bits_word(in[in_counter++], &out[n_sample], adc_bits);
-            n_sample += samples_per_int;
-        }
-    while (n_sample < noutput_items);
 
     return noutput_items;
 }
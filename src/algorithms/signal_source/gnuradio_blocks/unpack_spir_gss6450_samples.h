@@ -20,6 +20,8 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -39,14 +41,15 @@ class unpack_spir_gss6450_samples : public gr::sync_interpolator
 public:
     explicit unpack_spir_gss6450_samples(int adc_nbit);
     ~unpack_spir_gss6450_samples() = default;
-    void decode_4bits_word(uint32_t input_uint32, gr_complex *out, int adc_bits_);
     int work(int noutput_items,
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
 private:
     friend unpack_spir_gss6450_samples_sptr make_unpack_spir_gss6450_samples_sptr(int adc_nbit);
+    volk_gnsssdr::vector<uint32_t> words_;
     int adc_bits;
     int samples_per_int;
+    bool little_endian_;
 };
 
 
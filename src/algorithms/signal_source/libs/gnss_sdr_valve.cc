@@ -27,28 +27,44 @@
 Gnss_Sdr_Valve::Gnss_Sdr_Valve(size_t sizeof_stream_item,
     uint64_t nitems,
     Concurrent_Queue<pmt::pmt_t>* queue,
-    bool stop_flowgraph) : gr::sync_block("valve",
-                               gr::io_signature::make(1, 20, sizeof_stream_item),
-                               gr::io_signature::make(1, 20, sizeof_stream_item)),
-                           d_nitems(nitems),
-                           d_ncopied_items(0),
-                           d_queue(queue),
-                           d_stop_flowgraph(stop_flowgraph),
-                           d_open_valve(false)
+    bool stop_flowgraph,
+    bool tap) : gr::sync_block("valve",
+                    gr::io_signature::make(1, 20, sizeof_stream_item),
+                    tap ? gr::io_signature::make(0, 0, 0) : gr::io_signature::make(1, 20, sizeof_stream_item)),
+                d_nitems(nitems),
+                d_ncopied_items(0),
+                d_queue(queue),
+                d_stop_flowgraph(stop_flowgraph),
+                d_open_valve(false),
+                d_tap(tap)
 {
 }
 
 
 gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve(size_t sizeof_stream_item, uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue, bool stop_flowgraph)
 {
-    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, stop_flowgraph));
+    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, stop_flowgraph, false));
     return valve_;
 }
 
 
 gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve(size_t sizeof_stream_item, uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue)
 {
-    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, true));
+    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, true, false));
+    return valve_;
+}
+
+
+gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(size_t sizeof_stream_item, uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue)
+{
+    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, false, true));
+    return valve_;
+}
+
+
+gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(size_t sizeof_stream_item, uint64_t nitems, Concurrent_Queue<pmt::pmt_t>* queue, bool stop_flowgraph)
+{
+    gnss_shared_ptr<Gnss_Sdr_Valve> valve_(new Gnss_Sdr_Valve(sizeof_stream_item, nitems, queue, stop_flowgraph, true));
     return valve_;
 }
 
@@ -63,6 +79,10 @@ int Gnss_Sdr_Valve::work(int noutput_items,
     gr_vector_const_void_star& input_items,
     gr_vector_void_star& output_items)
 {
+    if (d_tap)
+        {
+            return tap_work(noutput_items);
+        }
     if (d_open_valve == false)
         {
             if (d_ncopied_items >= d_nitems)
@@ -94,3 +114,24 @@ int Gnss_Sdr_Valve::work(int noutput_items,
         }
     return noutput_items;
 }
+
+
+int Gnss_Sdr_Valve::tap_work(int noutput_items)
+{
+    // Samples are always consumed: a tap that stopped reading would block the
+    // source, since it shares the source output buffer with the data path
+    if (d_open_valve == false && d_ncopied_items < d_nitems)
+        {
+            d_ncopied_items += static_cast<uint64_t>(noutput_items);
+            if (d_ncopied_items >= d_nitems)
+                {
+                    LOG(INFO) << "Stopping receiver, " << d_nitems << " samples processed";
+                    d_queue->push(pmt::make_any(command_event_make(200, 0)));
+                    if (d_stop_flowgraph)
+                        {
+                            return WORK_DONE;
+                        }
+                }
+        }
+    return noutput_items;
+}
@@ -47,6 +47,28 @@ gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve(
     Concurrent_Queue<pmt::pmt_t>* queue,
     bool stop_flowgraph);
 
+/*!
+ * \brief Makes a valve with no outputs, to be connected next to the data path
+ * instead of in it. It counts the samples it gets and sends the STOP message
+ * once, after nitems of them, but it never copies nor holds back samples, so
+ * the blocks after the source keep getting them until the receiver stops.
+ *
+ * With \p stop_flowgraph, the tap also returns WORK_DONE after nitems
+ * samples. That only ends its own branch: the blocks of the data path keep
+ * running until the control thread stops the flowgraph on the STOP message.
+ * Flowgraphs run without a control thread need the in-line valve instead.
+ */
+gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(
+    size_t sizeof_stream_item,
+    uint64_t nitems,
+    Concurrent_Queue<pmt::pmt_t>* queue);
+
+gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(
+    size_t sizeof_stream_item,
+    uint64_t nitems,
+    Concurrent_Queue<pmt::pmt_t>* queue,
+    bool stop_flowgraph);
+
 /*!
  * \brief Implementation of a GNU Radio block that sends a STOP message to the
  * control queue right after a specific number of samples have passed through it.
@@ -72,15 +94,29 @@ private:
         Concurrent_Queue<pmt::pmt_t>* queue,
         bool stop_flowgraph);
 
+    friend gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(
+        size_t sizeof_stream_item,
+        uint64_t nitems,
+        Concurrent_Queue<pmt::pmt_t>* queue);
+
+    friend gnss_shared_ptr<Gnss_Sdr_Valve> gnss_sdr_make_valve_tap(
+        size_t sizeof_stream_item,
+        uint64_t nitems,
+        Concurrent_Queue<pmt::pmt_t>* queue,
+        bool stop_flowgraph);
+
     Gnss_Sdr_Valve(size_t sizeof_stream_item,
         uint64_t nitems,
-        Concurrent_Queue<pmt::pmt_t>* queue, bool stop_flowgraph);
+        Concurrent_Queue<pmt::pmt_t>* queue, bool stop_flowgraph, bool tap);
+
+    int tap_work(int noutput_items);
 
     uint64_t d_nitems;
     uint64_t d_ncopied_items;
     Concurrent_Queue<pmt::pmt_t>* d_queue;
     bool d_stop_flowgraph;
     bool d_open_valve;
+    bool d_tap;
 };
 
 
@@ -27,6 +27,7 @@
 #include <gnuradio/block.h>        // for gr::block
 #include <pmt/pmt.h>               // for pmt::pmt_t
 #include <bitset>
+#include <cstddef>
 #include <cstdint>
 #include <memory>  // for std::unique_ptr
 #include <string>
@@ -68,6 +69,13 @@ private:
     void read_MT1_body(const std::string& message_body);
 
     int decode_message_type1(uint8_t message_id, uint8_t message_size);
+    void reset_C_matrix(uint8_t message_id);
+
+    // Position of element (message_id, pid - 1, octet) in the flat d_C_matrix
+    size_t c_matrix_index(uint8_t message_id, int pid_minus_one, int octet) const
+    {
+        return static_cast<size_t>(message_id) * C_MATRIX_SIZE + static_cast<size_t>(pid_minus_one) * GALILEO_CNAV_OCTETS_IN_SUBPAGE + octet;
+    }
 
     uint16_t read_has_message_header_parameter_uint16(const std::bitset<GALILEO_CNAV_MT1_HEADER_BITS>& bits, const std::pair<int32_t, int32_t>& parameter) const;
     uint8_t read_has_message_header_parameter_uint8(const std::bitset<GALILEO_CNAV_MT1_HEADER_BITS>& bits, const std::pair<int32_t, int32_t>& parameter) const;
@@ -84,13 +92,19 @@ private:
     template <class T>
     std::string debug_print_matrix(const std::string& title, const std::vector<std::vector<T>>& mat) const;  // only for debug purposes
 
+    template <class T>
+    std::string debug_print_matrix(const std::string& title, const T* mat, size_t rows, size_t cols) const;  // only for debug purposes
+
+    static constexpr size_t C_MATRIX_SIZE = GALILEO_CNAV_MAX_NUMBER_SYMBOLS_ENCODED_BLOCK * GALILEO_CNAV_OCTETS_IN_SUBPAGE;  // 255 x 53
+
     std::unique_ptr<ReedSolomon> d_rs;
     Galileo_HAS_data d_HAS_data{};
     Nav_Message_Packet d_nav_msg_packet;
 
     // Store decoding matrices and received PIDs
-    std::vector<std::vector<std::vector<uint8_t>>> d_C_matrix;
-    std::vector<std::vector<uint8_t>> d_M_matrix;
+    std::vector<uint8_t> d_C_matrix;  // 32 x 255 x 53, contiguous
+    std::vector<uint8_t> d_M_matrix;  // 32 x 53, contiguous
+    std::vector<uint8_t> d_C_column;  // decoding buffer
     std::vector<std::vector<uint8_t>> d_received_pids;
 
     // Store masks
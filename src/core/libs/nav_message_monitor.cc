@@ -35,13 +35,13 @@ namespace wht = boost;
 namespace wht = std;
 #endif
 
-nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port)
+nav_message_monitor_sptr nav_message_monitor_make(const std::vector<std::string>& addresses, uint16_t port, bool sender_thread)
 {
-    return nav_message_monitor_sptr(new nav_message_monitor(addresses, port));
+    return nav_message_monitor_sptr(new nav_message_monitor(addresses, port, sender_thread));
 }
 
 
-nav_message_monitor::nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port) : gr::block("nav_message_monitor", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0))
+nav_message_monitor::nav_message_monitor(const std::vector<std::string>& addresses, uint16_t port, bool sender_thread) : gr::block("nav_message_monitor", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0))
 {
     // register Nav_msg_from_TLM input message port from telemetry blocks
     this->message_port_register_in(pmt::mp("Nav_msg_from_TLM"));
@@ -55,7 +55,7 @@ nav_message_monitor::nav_message_monitor(const std::vector<std::string>& address
         boost::bind(&nav_message_monitor::msg_handler_nav_message, this, _1));
 #endif
 #endif
-    nav_message_udp_sink_ = std::make_unique<Nav_Message_Udp_Sink>(addresses, port);
+    nav_message_udp_sink_ = std::make_unique<Nav_Message_Udp_Sink>(addresses, port, sender_thread);
 }
 
 
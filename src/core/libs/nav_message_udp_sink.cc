@@ -16,41 +16,17 @@
  */
 
 #include "nav_message_udp_sink.h"
-#include <iostream>
-#include <sstream>
 
 
-Nav_Message_Udp_Sink::Nav_Message_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port) : socket{io_context}
+Nav_Message_Udp_Sink::Nav_Message_Udp_Sink(const std::vector<std::string>& addresses,
+    const uint16_t& port,
+    bool sender_thread) : sender(addresses, port, sender_thread)
 {
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
-    serdes_nav = Serdes_Nav_Message();
 }
 
 
 bool Nav_Message_Udp_Sink::write_nav_message(const std::shared_ptr<Nav_Message_Packet>& nav_meg_packet)
 {
-    std::string outbound_data = serdes_nav.createProtobuffer(nav_meg_packet);
-
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            return false;
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
-        }
-    return true;
+    serdes_nav.appendProtobuffer(nav_meg_packet, sender.buffer());
+    return sender.send();
 }
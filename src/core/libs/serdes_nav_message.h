@@ -77,8 +77,14 @@ public:
 
     inline std::string createProtobuffer(const std::shared_ptr<Nav_Message_Packet> nav_msg_packet)  //!< Serialization into a string
     {
-        navmsg_.Clear();
         std::string data;
+        appendProtobuffer(nav_msg_packet, data);
+        return data;
+    }
+
+    inline void appendProtobuffer(const std::shared_ptr<Nav_Message_Packet> nav_msg_packet, std::string& data)  //!< Serialization appended to a reusable string
+    {
+        navmsg_.Clear();
 
         navmsg_.set_system(nav_msg_packet->system);
         navmsg_.set_signal(nav_msg_packet->signal);
@@ -86,9 +92,7 @@ public:
         navmsg_.set_tow_at_current_symbol_ms(nav_msg_packet->tow_at_current_symbol_ms);
         navmsg_.set_nav_message(nav_msg_packet->nav_message);
 
-        navmsg_.SerializeToString(&data);
-
-        return data;
+        navmsg_.AppendToString(&data);
     }
 
     inline Nav_Message_Packet readProtobuffer(const gnss_sdr::navMsg& msg) const  //!< Deserialization
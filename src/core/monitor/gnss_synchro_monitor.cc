@@ -28,13 +28,17 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    bool udp_sender_thread,
+    bool enable_fixed_format)
 {
     return gnss_synchro_monitor_sptr(new gnss_synchro_monitor(n_channels,
         decimation_factor,
         udp_port,
         udp_addresses,
-        enable_protobuf));
+        enable_protobuf,
+        udp_sender_thread,
+        enable_fixed_format));
 }
 
 
@@ -42,14 +46,17 @@ gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf)
+    bool enable_protobuf,
+    bool udp_sender_thread,
+    bool enable_fixed_format)
     : gr::block("gnss_synchro_monitor",
           gr::io_signature::make(n_channels, n_channels, sizeof(Gnss_Synchro)),
           gr::io_signature::make(0, 0, 0)),
       d_nchannels(n_channels),
       d_decimation_factor(decimation_factor)
 {
-    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf);
+    udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf, udp_sender_thread, enable_fixed_format);
+    d_stocks.resize(1);
 }
 
 
@@ -80,10 +87,9 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                     count++;
                     if (count >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
-                            std::vector<Gnss_Synchro> stocks;
-                            stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            // Queue for the UDP sink
+                            d_stocks[0] = in[channel_index][item_index];
+                            udp_sink_ptr->queue_gnss_synchro(d_stocks);
                             // Reset count variable
                             count = 0;
                             // Consume the number of items for the input stream channel
@@ -92,6 +98,9 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
                 }
         }
 
+    // Send everything queued in this call, one syscall per endpoint
+    udp_sink_ptr->flush();
+
     // Not producing any outputs
     return 0;
 }
@@ -43,7 +43,9 @@ gnss_synchro_monitor_sptr gnss_synchro_make_monitor(int n_channels,
     int decimation_factor,
     int udp_port,
     const std::vector<std::string>& udp_addresses,
-    bool enable_protobuf);
+    bool enable_protobuf,
+    bool udp_sender_thread = false,
+    bool enable_fixed_format = false);
 
 /*!
  * \brief This class implements a monitoring block which allows sending
@@ -63,17 +65,22 @@ private:
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        bool udp_sender_thread,
+        bool enable_fixed_format);
 
     gnss_synchro_monitor(int n_channels,
         int decimation_factor,
         int udp_port,
         const std::vector<std::string>& udp_addresses,
-        bool enable_protobuf);
+        bool enable_protobuf,
+        bool udp_sender_thread,
+        bool enable_fixed_format);
 
     int d_nchannels;
     int d_decimation_factor;
     std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
+    std::vector<Gnss_Synchro> d_stocks;
 };
 
 
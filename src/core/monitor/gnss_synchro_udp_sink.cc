@@ -18,58 +18,113 @@
 #include "gnss_synchro_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/vector.hpp>
-#include <iostream>
-#include <sstream>
+
 
 Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses,
     const uint16_t& port,
-    bool enable_protobuf)
-    : socket{io_context},
-      use_protobuf(enable_protobuf)
+    bool enable_protobuf,
+    bool sender_thread,
+    bool enable_fixed_format)
+    : sender(addresses, port, sender_thread),
+      fixed_writer(FIXED_FORMAT_GNSS_SYNCHRO),
+      use_protobuf(enable_protobuf),
+      use_fixed_format(enable_fixed_format)
 {
-    if (enable_protobuf)
-        {
-            serdes = Serdes_Gnss_Synchro();
-        }
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
 }
 
 
-bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+void Gnss_Synchro_Udp_Sink::serialize(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
+            boost::archive::binary_oarchive oa{sender.stream()};
             oa << stocks;
-            outbound_data = archive_stream.str();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(stocks);
+            serdes.appendProtobuffer(stocks, sender.buffer());
         }
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
+}
 
-            try
+
+bool Gnss_Synchro_Udp_Sink::append_fixed_records(const std::vector<Gnss_Synchro>& stocks)
+{
+    bool queued = true;
+    for (const auto& gs : stocks)
+        {
+            if (!fixed_writer.is_open())
                 {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            std::cerr << "Gnss_Synchro_Udp_Sink sent 0 bytes\n";
-                        }
+                    fixed_writer.begin(sender.buffer());
                 }
-            catch (boost::system::system_error const& e)
+            Gnss_Synchro_Record r{};
+            r.System = gs.System;
+            r.Signal[0] = gs.Signal[0];
+            r.Signal[1] = gs.Signal[1];
+            r.flags = static_cast<uint8_t>((gs.Flag_valid_acquisition ? 1U : 0U) |
+                                           (gs.Flag_valid_symbol_output ? 2U : 0U) |
+                                           (gs.Flag_valid_word ? 4U : 0U) |
+                                           (gs.Flag_valid_pseudorange ? 8U : 0U) |
+                                           (gs.Flag_PLL_180_deg_phase_locked ? 16U : 0U));
+            r.PRN = gs.PRN;
+            r.Channel_ID = gs.Channel_ID;
+            r.Acq_doppler_step = gs.Acq_doppler_step;
+            r.Acq_delay_samples = gs.Acq_delay_samples;
+            r.Acq_doppler_hz = gs.Acq_doppler_hz;
+            r.Acq_samplestamp_samples = gs.Acq_samplestamp_samples;
+            r.fs = gs.fs;
+            r.Prompt_I = gs.Prompt_I;
+            r.Prompt_Q = gs.Prompt_Q;
+            r.CN0_dB_hz = gs.CN0_dB_hz;
+            r.Carrier_Doppler_hz = gs.Carrier_Doppler_hz;
+            r.Carrier_phase_rads = gs.Carrier_phase_rads;
+            r.Code_phase_samples = gs.Code_phase_samples;
+            r.Tracking_sample_counter = gs.Tracking_sample_counter;
+            r.correlation_length_ms = gs.correlation_length_ms;
+            r.TOW_at_current_symbol_ms = gs.TOW_at_current_symbol_ms;
+            r.Pseudorange_m = gs.Pseudorange_m;
+            r.RX_time = gs.RX_time;
+            r.interp_TOW_ms = gs.interp_TOW_ms;
+            fixed_writer.append(r);
+            if (fixed_writer.full())
                 {
-                    std::cerr << e.what() << '\n';
-                    return false;
+                    fixed_writer.end();
+                    queued = sender.queue() && queued;
                 }
         }
-    return true;
+    return queued;
+}
+
+
+bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+{
+    if (use_fixed_format)
+        {
+            const bool queued = append_fixed_records(stocks);
+            return flush() && queued;
+        }
+    serialize(stocks);
+    return sender.send();
+}
+
+
+bool Gnss_Synchro_Udp_Sink::queue_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+{
+    if (use_fixed_format)
+        {
+            return append_fixed_records(stocks);
+        }
+    serialize(stocks);
+    return sender.queue();
+}
+
+
+bool Gnss_Synchro_Udp_Sink::flush()
+{
+    bool queued = true;
+    if (fixed_writer.is_open())
+        {
+            fixed_writer.end();
+            queued = sender.queue();
+        }
+    return sender.flush() && queued;
 }
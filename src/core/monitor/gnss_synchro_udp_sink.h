@@ -19,9 +19,9 @@
 #define GNSS_SDR_GNSS_SYNCHRO_UDP_SINK_H
 
 #include "gnss_synchro.h"
+#include "monitor_fixed_format.h"
 #include "serdes_gnss_synchro.h"
-#include <boost/asio.hpp>
-#include <boost/system/error_code.hpp>
+#include "udp_datagram_sender.h"
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -32,29 +32,30 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
+ *
+ * With the fixed format (see monitor_fixed_format.h), the objects queued
+ * between two flush() calls are packed together into as few datagrams as
+ * possible.
  */
 class Gnss_Synchro_Udp_Sink
 {
 public:
-    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
-    bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
+    Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf, bool sender_thread = false, bool enable_fixed_format = false);
+    bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);  //!< Sends right away
+    bool queue_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);  //!< Sent at the next flush()
+    bool flush();
 
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    void serialize(const std::vector<Gnss_Synchro>& stocks);
+    bool append_fixed_records(const std::vector<Gnss_Synchro>& stocks);
+    Udp_Datagram_Sender sender;
     Serdes_Gnss_Synchro serdes;
+    Fixed_Format_Writer<Gnss_Synchro_Record> fixed_writer;
     bool use_protobuf;
+    bool use_fixed_format;
 };
 
 
@@ -71,9 +71,15 @@ public:
 
     inline std::string createProtobuffer(const std::vector<Gnss_Synchro>& vgs)  //!< Serialization into a string
     {
-        observables.Clear();
         std::string data;
-        for (auto gs : vgs)
+        appendProtobuffer(vgs, data);
+        return data;
+    }
+
+    inline void appendProtobuffer(const std::vector<Gnss_Synchro>& vgs, std::string& data)  //!< Serialization appended to a reusable string
+    {
+        observables.Clear();
+        for (const auto& gs : vgs)
             {
                 gnss_sdr::GnssSynchro* obs = observables.add_observable();
                 char c = gs.System;
@@ -115,8 +121,7 @@ public:
                 obs->set_flag_pll_180_deg_phase_locked(gs.Flag_PLL_180_deg_phase_locked);
                 obs->set_interp_tow_ms(gs.interp_TOW_ms);
             }
-        observables.SerializeToString(&data);
-        return data;
+        observables.AppendToString(&data);
     }
 
     inline std::vector<Gnss_Synchro> readProtobuffer(const gnss_sdr::Observables& obs) const  //!< Deserialization
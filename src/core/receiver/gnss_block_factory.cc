@@ -42,6 +42,7 @@
 #include "file_timestamp_signal_source.h"
 #include "fir_filter.h"
 #include "freq_xlating_fir_filter.h"
+#include "fused_signal_conditioner.h"
 #include "galileo_e1_dll_pll_veml_tracking.h"
 #include "galileo_e1_pcps_8ms_ambiguous_acquisition.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
@@ -101,6 +102,7 @@
 #include "notch_filter_lite.h"
 #include "nsr_file_signal_source.h"
 #include "pass_through.h"
+#include "polyphase_fir_filter.h"
 #include "pulse_blanking_filter.h"
 #include "rtklib_pvt.h"
 #include "rtl_tcp_signal_source.h"
@@ -287,7 +289,19 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetSignalConditioner(
             return conditioner_;
         }
 
-    if (signal_conditioner != "Signal_Conditioner")
+    if (signal_conditioner == "Fused_Signal_Conditioner")
+        {
+            // single block doing the work of the whole chain, if it supports the configured stages
+            auto fused_conditioner = std::make_unique<FusedSignalConditioner>(configuration,
+                role_conditioner, role_datatypeadapter, role_inputfilter, role_resampler);
+            if (fused_conditioner->is_supported())
+                {
+                    std::unique_ptr<GNSSBlockInterface> conditioner_ = std::move(fused_conditioner);
+                    return conditioner_;
+                }
+            LOG(WARNING) << "Using Signal_Conditioner instead of Fused_Signal_Conditioner for " << role_conditioner;
+        }
+    else if (signal_conditioner != "Signal_Conditioner")
         {
             std::cerr << "Error in configuration file: SignalConditioner.implementation=" << signal_conditioner << " is not a valid value.\n";
             return nullptr;
@@ -874,6 +888,12 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams);
                     block = std::move(block_);
                 }
+            else if (implementation == "Polyphase_Fir_Filter")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<PolyphaseFirFilter>(configuration, role, in_streams,
+                        out_streams);
+                    block = std::move(block_);
+                }
 
             // RESAMPLER ---------------------------------------------------------------
             else if (implementation == "Direct_Resampler")
@@ -34,30 +34,35 @@
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
 #include "gnss_satellite.h"
+#include "gnss_sdr_flags.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
 #include "nav_message_monitor.h"
 #include "signal_source_interface.h"
-#include <boost/lexical_cast.hpp>    // for boost::lexical_cast
-#include <boost/tokenizer.hpp>       // for boost::tokenizer
-#include <glog/logging.h>            // for LOG
-#include <gnuradio/basic_block.h>    // for basic_block
-#include <gnuradio/filter/firdes.h>  // for gr::filter::firdes
-#include <gnuradio/io_signature.h>   // for io_signature
-#include <gnuradio/top_block.h>      // for top_block, make_top_block
-#include <pmt/pmt_sugar.h>           // for mp
-#include <algorithm>                 // for transform, sort, unique
-#include <cmath>                     // for floor
-#include <cstddef>                   // for size_t
-#include <exception>                 // for exception
-#include <iostream>                  // for operator<<
-#include <iterator>                  // for insert_iterator, inserter
-#include <memory>                    // for std::shared_ptr
-#include <set>                       // for set
-#include <sstream>                   // for std::stringstream
-#include <stdexcept>                 // for invalid_argument
-#include <thread>                    // for std::thread
-#include <utility>                   // for std::move
+#include <boost/lexical_cast.hpp>     // for boost::lexical_cast
+#include <boost/tokenizer.hpp>        // for boost::tokenizer
+#include <glog/logging.h>             // for LOG
+#include <gnuradio/basic_block.h>     // for basic_block
+#include <gnuradio/block.h>           // for block, cast_to_block_sptr
+#include <gnuradio/filter/firdes.h>   // for gr::filter::firdes
+#include <gnuradio/high_res_timer.h>  // for high_res_timer_tps
+#include <gnuradio/io_signature.h>    // for io_signature
+#include <gnuradio/prefs.h>           // for prefs
+#include <gnuradio/top_block.h>       // for top_block, make_top_block
+#include <pmt/pmt_sugar.h>            // for mp
+#include <algorithm>                  // for transform, sort, unique
+#include <cmath>                      // for floor
+#include <cstddef>                    // for size_t
+#include <exception>                  // for exception
+#include <functional>                 // for std::greater
+#include <iostream>                   // for operator<<
+#include <iterator>                   // for insert_iterator, inserter
+#include <memory>                     // for std::shared_ptr
+#include <set>                        // for set
+#include <sstream>                    // for std::stringstream
+#include <stdexcept>                  // for invalid_argument
+#include <thread>                     // for std::thread
+#include <utility>                    // for std::move
 
 #ifdef GR_GREATER_38
 #include <gnuradio/filter/fir_filter_blk.h>
@@ -79,6 +84,7 @@ GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configurati
       enable_e6_has_rx_(false)
 {
     enable_fpga_offloading_ = configuration_->property("GNSS-SDR.enable_FPGA", false);
+    replay_ = FLAGS_replay || FLAGS_replay_speed > 0.0 || configuration_->property("GNSS-SDR.replay", false);
     init();
 }
 
@@ -199,7 +205,9 @@ void GNSSFlowgraph::init()
             GnssSynchroMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("Monitor.decimation_factor", 1),
                 configuration_->property("Monitor.udp_port", 1234),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("Monitor.udp_sender_thread", false),
+                configuration_->property("Monitor.enable_fixed_format", false));
         }
 
     /*
@@ -222,7 +230,9 @@ void GNSSFlowgraph::init()
             GnssSynchroAcquisitionMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("AcquisitionMonitor.decimation_factor", 1),
                 configuration_->property("AcquisitionMonitor.udp_port", 1235),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("AcquisitionMonitor.udp_sender_thread", false),
+                configuration_->property("AcquisitionMonitor.enable_fixed_format", false));
         }
 
     /*
@@ -245,7 +255,9 @@ void GNSSFlowgraph::init()
             GnssSynchroTrackingMonitor_ = gnss_synchro_make_monitor(channels_count_,
                 configuration_->property("TrackingMonitor.decimation_factor", 1),
                 configuration_->property("TrackingMonitor.udp_port", 1236),
-                udp_addr_vec, enable_protobuf);
+                udp_addr_vec, enable_protobuf,
+                configuration_->property("TrackingMonitor.udp_sender_thread", false),
+                configuration_->property("TrackingMonitor.enable_fixed_format", false));
         }
 
     /*
@@ -259,7 +271,7 @@ void GNSSFlowgraph::init()
             std::vector<std::string> udp_addr_vec = split_string(address_string, '_');
             std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
-            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
+            NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237), configuration_->property("NavDataMonitor.udp_sender_thread", false));
         }
 }
 
@@ -272,6 +284,11 @@ void GNSSFlowgraph::start()
             return;
         }
 
+    if (replay_ && !enable_fpga_offloading_)
+        {
+            configure_replay();
+        }
+
     try
         {
             top_block_->start();
@@ -282,6 +299,7 @@ void GNSSFlowgraph::start()
             print_help();
             return;
         }
+    start_time_ = std::chrono::steady_clock::now();
 
     if (enable_fpga_offloading_ == true)
         {
@@ -307,6 +325,10 @@ void GNSSFlowgraph::stop()
     if (enable_fpga_offloading_ == false)
         {
             top_block_->wait();
+            if (replay_ && running_)
+                {
+                    print_replay_report();
+                }
         }
 
     running_ = false;
@@ -326,6 +348,131 @@ void GNSSFlowgraph::wait()
 }
 
 
+void GNSSFlowgraph::configure_replay()
+{
+    // The block executors read this setting when the flowgraph starts
+    gr::prefs::singleton()->set_bool("PerfCounters", "on", true);
+
+    // Fixed-size buffers at the output of the sources and the signal conditioners, large enough
+    // for the source to read big chunks, while keeping the memory of the flowgraph bounded
+    const auto buffer_items = configuration_->property("GNSS-SDR.replay_buffer_items", int64_t(262144));
+    std::vector<gr::block_sptr> sources;
+    std::vector<gr::block_sptr> conditioners;
+    for (const auto& src : sig_source_)
+        {
+            auto block = gr::cast_to_block_sptr(src->get_right_block());
+            if (block)
+                {
+                    sources.push_back(block);
+                }
+        }
+    for (const auto& cond : sig_conditioner_)
+        {
+            auto block = gr::cast_to_block_sptr(cond->get_right_block());
+            if (block)
+                {
+                    conditioners.push_back(block);
+                }
+        }
+    for (const auto& block : sources)
+        {
+            block->set_min_output_buffer(buffer_items);
+            block->set_max_output_buffer(buffer_items);
+        }
+    for (const auto& block : conditioners)
+        {
+            block->set_min_output_buffer(buffer_items);
+            block->set_max_output_buffer(buffer_items);
+        }
+
+    // Sources on core 0, signal conditioners on core 1, and the channels spread over the rest
+    const auto cores = static_cast<int>(std::thread::hardware_concurrency());
+    if (!configuration_->property("GNSS-SDR.replay_pin_cores", true) || cores < 4)
+        {
+            return;
+        }
+    for (const auto& block : sources)
+        {
+            block->set_processor_affinity(std::vector<int>{0});
+        }
+    for (const auto& block : conditioners)
+        {
+            block->set_processor_affinity(std::vector<int>{1});
+        }
+    int core = 2;
+    for (const auto& chan : channels_)
+        {
+            for (const auto& basic_block : {chan->get_left_block_acq(), chan->get_left_block_trk()})
+                {
+                    auto block = gr::cast_to_block_sptr(basic_block);
+                    if (block)
+                        {
+                            block->set_processor_affinity(std::vector<int>{core});
+                        }
+                }
+            core = core + 1 < cores ? core + 1 : 2;
+        }
+    LOG(INFO) << "Replay mode: buffers of " << buffer_items << " items, blocks pinned to " << cores << " cores";
+}
+
+
+void GNSSFlowgraph::print_replay_report() const
+{
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time_).count();
+    const auto fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0.0);
+    uint64_t samples = 0;
+    if (!sig_conditioner_.empty())
+        {
+            auto block = gr::cast_to_block_sptr(sig_conditioner_.at(0)->get_right_block());
+            if (block)
+                {
+                    samples = block->nitems_written(0);
+                }
+        }
+    const double signal_s = fs > 0.0 ? static_cast<double>(samples) / fs : 0.0;
+    std::cout << "Replay: processed " << signal_s << " [s] of signal in " << elapsed_s << " [s] ("
+              << (elapsed_s > 0.0 ? signal_s / elapsed_s : 0.0) << " times real time)\n";
+
+    // Each block runs in its own thread, so the one that spends most time in work() bounds the speed
+    std::vector<std::pair<double, std::string>> busy;
+    const auto add_block = [&busy](const gr::basic_block_sptr& basic_block) {
+        auto block = gr::cast_to_block_sptr(basic_block);
+        if (block)
+            {
+                busy.emplace_back(block->pc_work_time_total() / static_cast<double>(gr::high_res_timer_tps()), block->identifier());
+            }
+    };
+    for (const auto& src : sig_source_)
+        {
+            add_block(src->get_right_block());
+        }
+    for (const auto& cond : sig_conditioner_)
+        {
+            add_block(cond->get_right_block());
+        }
+    for (const auto& chan : channels_)
+        {
+            add_block(chan->get_left_block_acq());
+            add_block(chan->get_left_block_trk());
+        }
+    add_block(observables_->get_left_block());
+    add_block(pvt_->get_left_block());
+    std::sort(busy.begin(), busy.end(), std::greater<std::pair<double, std::string>>());
+    if (busy.empty() || busy.front().first == 0.0)
+        {
+            std::cout << "  Time per block not available: GNU Radio was built without performance counters\n";
+            return;
+        }
+    const size_t n = busy.size() < 5 ? busy.size() : 5;
+    for (size_t i = 0; i < n; i++)
+        {
+            std::cout << "  " << busy[i].second << ": " << busy[i].first << " [s] in work() ("
+                      << (elapsed_s > 0.0 ? 100.0 * busy[i].first / elapsed_s : 0.0) << " % of the run time)\n";
+            LOG(INFO) << "Replay: " << busy[i].second << " spent " << busy[i].first << " [s] in work()";
+        }
+}
+
+
 void GNSSFlowgraph::connect()
 {
     // Connects the blocks in the flow graph
@@ -33,6 +33,7 @@
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
+#include <chrono>                       // for steady_clock
 #include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
@@ -204,6 +205,8 @@ private:
     void remove_signal(const Gnss_Signal& gs);
     void print_help();
     void check_desktop_conf_in_fpga_env();
+    void configure_replay();
+    void print_replay_report() const;
 
     double project_doppler(const std::string& searched_signal, double primary_freq_doppler_hz);
     bool is_multiband() const;
@@ -274,6 +277,8 @@ private:
 
     std::mutex signal_list_mutex_;
 
+    std::chrono::steady_clock::time_point start_time_;
+
     int sources_count_;
     int channels_count_;
     int acq_channels_count_;
@@ -288,6 +293,7 @@ private:
     bool enable_navdata_monitor_;
     bool enable_fpga_offloading_;
     bool enable_e6_has_rx_;
+    bool replay_;
 };
 
 
@@ -664,6 +664,13 @@ void ReedSolomon::init_alpha_tables()
             sr &= d_symbols_per_block;
         }
 
+    // alpha_to table extended to two periods, so the sum of two exponents
+    // in index form can be looked up without a modulo reduction
+    for (int i = 0; i < 2 * d_symbols_per_block; i++)
+        {
+            d_alpha_to_ext[i] = d_alpha_to[i % d_symbols_per_block];
+        }
+
     if (sr != 1)
         {
             std::cerr << "Reed Solomon wrong configuration: Field generator polynomial is not primitive!\n";
@@ -792,7 +799,7 @@ int ReedSolomon::decode(std::vector<uint8_t>& data_to_decode, const std::vector<
     else
         {
             // Create unshortened code vector
-            std::vector<uint8_t> unshortened_code_vector(d_symbols_per_block, 0);
+            std::array<uint8_t, d_symbols_per_block> unshortened_code_vector{};
             std::copy(data_to_decode.begin(), data_to_decode.begin() + d_info_symbols_shortened, unshortened_code_vector.begin());
             std::copy(data_to_decode.begin() + d_info_symbols_shortened, data_to_decode.begin() + d_data_symbols_shortened, unshortened_code_vector.begin() + d_data_in_block);
 
@@ -801,7 +808,7 @@ int ReedSolomon::decode(std::vector<uint8_t>& data_to_decode, const std::vector<
                 {
                     // Store decoded result into the shortened code vector
                     std::copy(unshortened_code_vector.begin(), unshortened_code_vector.begin() + d_info_symbols_shortened, data_to_decode.begin());
-                    std::copy(unshortened_code_vector.begin() + d_data_in_block, unshortened_code_vector.begin() + d_symbols_per_block, data_to_decode.begin() + d_info_symbols_shortened);
+                    std::copy(unshortened_code_vector.begin() + d_data_in_block, unshortened_code_vector.end(), data_to_decode.begin() + d_info_symbols_shortened);
                 }
         }
     return result;
@@ -828,33 +835,39 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
     uint8_t den;
     uint8_t discr_r;
 
-    std::vector<uint8_t> lambda(d_nroots + 1);  // Err+Eras Locator poly
-    std::vector<uint8_t> s(d_nroots);           // syndrome poly
-    std::vector<uint8_t> b(d_nroots + 1);
-    std::vector<uint8_t> t(d_nroots + 1);
-    std::vector<uint8_t> omega(d_nroots + 1);
-    std::vector<uint8_t> root(d_nroots);
-    std::vector<uint8_t> reg(d_nroots + 1);
-    std::vector<uint8_t> loc(d_nroots);
+    // Work buffers live on the stack, so decoding does not touch the heap.
+    // nroots < 255, so all of them fit in d_symbols_per_block + 1 elements.
+    std::array<uint8_t, d_symbols_per_block + 1> lambda{};  // Err+Eras Locator poly
+    std::array<uint8_t, d_symbols_per_block + 1> s{};       // syndrome poly
+    std::array<uint8_t, d_symbols_per_block + 1> b{};
+    std::array<uint8_t, d_symbols_per_block + 1> t{};
+    std::array<uint8_t, d_symbols_per_block + 1> omega{};
+    std::array<uint8_t, d_symbols_per_block + 1> root{};
+    std::array<uint8_t, d_symbols_per_block + 1> reg{};
+    std::array<uint8_t, d_symbols_per_block + 1> loc{};
 
     // Syndrome computation
-    // form the syndromes; i.e., evaluate data(x) at roots of g(x)
-    for (i = 0; i < d_nroots; i++)
-        {
-            s[i] = data[0];
-        }
-
-    for (j = 1; j < d_symbols_per_block - d_pad; j++)
+    // form the syndromes; i.e., evaluate data(x) at roots of g(x).
+    // Instead of Horner's rule over all the symbols, the contribution of each
+    // non-zero symbol is accumulated for all the roots at once. Zeroed
+    // symbols (shortened positions and erasures) are skipped, which saves
+    // most of the work when decoding mainly from erasures, as in HAS.
+    const int n_symbols = d_symbols_per_block - d_pad;
+    for (j = 0; j < n_symbols; j++)
         {
+            if (data[j] == 0)
+                {
+                    continue;
+                }
+            const int step = mod255(d_prim * (n_symbols - 1 - j));
+            int exponent = mod255(d_index_of[data[j]] + d_fcr * step);
             for (i = 0; i < d_nroots; i++)
                 {
-                    if (s[i] == 0)
+                    s[i] ^= d_alpha_to_ext[exponent];
+                    exponent += step;
+                    if (exponent >= d_symbols_per_block)
                         {
-                            s[i] = data[j];
-                        }
-                    else
-                        {
-                            s[i] = data[j] ^ d_alpha_to[mod255(d_index_of[s[i]] + (d_fcr + i) * d_prim)];
+                            exponent -= d_symbols_per_block;
                         }
                 }
         }
@@ -888,7 +901,7 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                             tmp = d_index_of[lambda[j - 1]];
                             if (tmp != d_a0)
                                 {
-                                    lambda[j] ^= d_alpha_to[mod255(u + tmp)];
+                                    lambda[j] ^= d_alpha_to_ext[u + tmp];
                                 }
                         }
                 }
@@ -911,14 +924,15 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                 {
                     if ((lambda[i] != 0) && (s[r - i - 1] != d_a0))
                         {
-                            discr_r ^= d_alpha_to[mod255(d_index_of[lambda[i]] + s[r - i - 1])];
+                            discr_r ^= d_alpha_to_ext[d_index_of[lambda[i]] + s[r - i - 1]];
                         }
                 }
             discr_r = d_index_of[discr_r];  // Index form
             if (discr_r == d_a0)
                 {
-                    // line below: B(x) <-- x*B(x)
-                    b.insert(b.begin(), d_a0);
+                    // 2 lines below: B(x) <-- x*B(x)
+                    memmove(&b[1], &b[0], d_nroots * sizeof(b[0]));
+                    b[0] = d_a0;
                 }
             else
                 {
@@ -928,7 +942,7 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                         {
                             if (b[i] != d_a0)
                                 {
-                                    t[i + 1] = lambda[i + 1] ^ d_alpha_to[mod255(discr_r + b[i])];
+                                    t[i + 1] = lambda[i + 1] ^ d_alpha_to_ext[discr_r + b[i]];
                                 }
                             else
                                 {
@@ -946,10 +960,11 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                         }
                     else
                         {
-                            // line below: B(x) <-- x*B(x)
-                            b.insert(b.begin(), d_a0);
+                            // 2 lines below: B(x) <-- x*B(x)
+                            memmove(&b[1], &b[0], d_nroots * sizeof(b[0]));
+                            b[0] = d_a0;
                         }
-                    memcpy(&lambda[0], t.data(), (d_nroots + 1) * sizeof(t[0]));
+                    memcpy(lambda.data(), t.data(), (d_nroots + 1) * sizeof(t[0]));
                 }
         }
 
@@ -974,8 +989,13 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                 {
                     if (reg[j] != d_a0)
                         {
-                            reg[j] = mod255(reg[j] + j);
-                            q ^= d_alpha_to[reg[j]];
+                            int exponent = reg[j] + j;
+                            if (exponent >= d_symbols_per_block)
+                                {
+                                    exponent -= d_symbols_per_block;
+                                }
+                            reg[j] = exponent;
+                            q ^= d_alpha_to[exponent];
                         }
                 }
             if (q != 0)
@@ -1012,33 +1032,50 @@ int ReedSolomon::decode_rs_8(uint8_t* data, const int* eras_pos, int no_eras) co
                 {
                     if ((s[i - j] != d_a0) && (lambda[j] != d_a0))
                         {
-                            tmp ^= d_alpha_to[mod255(s[i - j] + lambda[j])];
+                            tmp ^= d_alpha_to_ext[s[i - j] + lambda[j]];
                         }
                 }
             omega[i] = d_index_of[tmp];
         }
 
     // Compute error values in poly-form. num1 = omega(inv(X(l))),
-    // num2 = inv(X(l))**(d_fcr-1) and den = lambda_pr(inv(X(l))) all in poly-form
+    // num2 = inv(X(l))**(d_fcr-1) and den = lambda_pr(inv(X(l))) all in poly-form.
+    // The exponents i * root[j] are updated incrementally instead of being
+    // reduced modulo 255 at each term.
     for (j = count - 1; j >= 0; j--)
         {
+            const int root_j = mod255(root[j]);
             num1 = 0;
+            int exponent = (deg_omega * root_j) % d_symbols_per_block;
             for (i = deg_omega; i >= 0; i--)
                 {
                     if (omega[i] != d_a0)
                         {
-                            num1 ^= d_alpha_to[mod255(omega[i] + i * root[j])];
+                            num1 ^= d_alpha_to_ext[omega[i] + exponent];
+                        }
+                    exponent -= root_j;
+                    if (exponent < 0)
+                        {
+                            exponent += d_symbols_per_block;
                         }
                 }
             num2 = d_alpha_to[mod255(root[j] * (d_fcr - 1) + d_symbols_per_block)];
             den = 0;
 
             // lambda[i+1] for i even is the formal derivative lambda_pr of lambda[i]
-            for (i = rs_min(deg_lambda, d_nroots - 1) & ~1; i >= 0; i -= 2)
+            i = rs_min(deg_lambda, d_nroots - 1) & ~1;
+            exponent = (i * root_j) % d_symbols_per_block;
+            const int root_j_times_2 = mod255(2 * root_j);
+            for (; i >= 0; i -= 2)
                 {
                     if (lambda[i + 1] != d_a0)
                         {
-                            den ^= d_alpha_to[mod255(lambda[i + 1] + i * root[j])];
+                            den ^= d_alpha_to_ext[lambda[i + 1] + exponent];
+                        }
+                    exponent -= root_j_times_2;
+                    if (exponent < 0)
+                        {
+                            exponent += d_symbols_per_block;
                         }
                 }
 
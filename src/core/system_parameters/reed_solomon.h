@@ -133,10 +133,11 @@ private:
     void init_log_tables();    // initialize d_log_table and d_antilog
     void init_alpha_tables();  // initialize d_alpha_to, d_index_of
 
-    std::array<uint8_t, 256> d_alpha_to{};   // used for decoding
-    std::array<uint8_t, 256> d_index_of{};   // used for decoding
-    std::array<uint8_t, 256> d_log_table{};  // used for encoding
-    std::array<uint8_t, 255> d_antilog{};    // used for encoding
+    std::array<uint8_t, 256> d_alpha_to{};                          // used for decoding
+    std::array<uint8_t, 256> d_index_of{};                          // used for decoding
+    std::array<uint8_t, 2 * d_symbols_per_block> d_alpha_to_ext{};  // used for decoding, avoids mod255
+    std::array<uint8_t, 256> d_log_table{};                         // used for encoding
+    std::array<uint8_t, 255> d_antilog{};                           // used for encoding
 
     std::vector<std::vector<uint8_t>> d_genmatrix;  // used for encoding
     std::vector<uint8_t> d_genpoly_coeff;           // used for encoding
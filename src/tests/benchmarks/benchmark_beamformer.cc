@@ -0,0 +1,110 @@
+/*!
+ * \file benchmark_beamformer.cc
+ * \brief Benchmark for the beamformer of an eight-element array
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beamformer.h"
+#include <benchmark/benchmark.h>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Samples per call, as a scheduler would pass them
+constexpr int NSAMPLES = 8192;
+constexpr int NCHANNELS = GNSS_SDR_BEAMFORMER_CHANNELS;
+
+
+std::vector<std::vector<gr_complex>> array_samples()
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<std::vector<gr_complex>> samples(NCHANNELS, std::vector<gr_complex>(NSAMPLES));
+    for (auto& channel : samples)
+        {
+            for (auto& sample : channel)
+                {
+                    sample = gr_complex(dist(gen), dist(gen));
+                }
+        }
+    return samples;
+}
+
+
+// Previous work loop, sample by sample and channel by channel
+void bm_beamformer_scalar(benchmark::State& state)
+{
+    const auto samples = array_samples();
+    const std::vector<gr_complex> weight_vector(NCHANNELS, gr_complex(0.5, -0.5));
+    std::vector<gr_complex> out(NSAMPLES);
+    for (auto _ : state)
+        {
+            gr_complex sum;
+            for (int n = 0; n < NSAMPLES; n++)
+                {
+                    sum = gr_complex(0, 0);
+                    for (size_t i = 0; i < weight_vector.size(); i++)
+                        {
+                            sum = sum + samples[i][n] * weight_vector[i];
+                        }
+                    out[n] = sum;
+                }
+            benchmark::DoNotOptimize(out.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void run_block(benchmark::State& state, bool adaptive)
+{
+    const auto samples = array_samples();
+    auto block = make_beamformer_sptr(NCHANNELS, adaptive, 16, 4096, 0.01);
+    std::vector<gr_complex> out(NSAMPLES);
+    gr_vector_const_void_star input_items(NCHANNELS);
+    for (int i = 0; i < NCHANNELS; i++)
+        {
+            input_items[i] = samples[i].data();
+        }
+    gr_vector_void_star output_items(1, out.data());
+    block->start();
+    for (auto _ : state)
+        {
+            block->work(NSAMPLES, input_items, output_items);
+            benchmark::DoNotOptimize(out.data());
+        }
+    block->stop();
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void bm_beamformer_block(benchmark::State& state)
+{
+    run_block(state, false);
+}
+
+
+// Including the decimated covariance and the estimator thread
+void bm_beamformer_block_adaptive(benchmark::State& state)
+{
+    run_block(state, true);
+}
+}  // namespace
+
+
+BENCHMARK(bm_beamformer_scalar);
+BENCHMARK(bm_beamformer_block);
+BENCHMARK(bm_beamformer_block_adaptive);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,185 @@
+/*!
+ * \file benchmark_fused_conditioner.cc
+ * \brief Benchmark for the fused signal conditioner against the chain of
+ * data type adapter, input filter and resampler
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_block_factory.h"
+#include "gnss_block_interface.h"
+#include "in_memory_configuration.h"
+#include <benchmark/benchmark.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/gr_complex.h>
+#include <gnuradio/top_block.h>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+namespace
+{
+// Input samples per run, enough for the flowgraph start-up to be negligible
+constexpr int NSAMPLES = 1 << 21;
+
+// Data type adapter configurations: implementation, item type of the signal
+// source, bytes per source item and source items per sample
+struct Adapter
+{
+    std::string implementation;
+    std::string item_type;
+    size_t item_size;
+    int items_per_sample;
+};
+
+const std::vector<Adapter> ADAPTERS = {
+    {"Pass_Through", "gr_complex", 8, 1},
+    {"Ishort_To_Complex", "ishort", 2, 2},
+    {"Ibyte_To_Complex", "ibyte", 1, 2},
+    {"Pass_Through", "cshort", 4, 1},
+    {"Pass_Through", "cbyte", 2, 1}};
+
+const std::vector<std::string> FILTERS = {"Pass_Through", "Fir_Filter", "Freq_Xlating_Fir_Filter"};
+
+const std::vector<std::string> RESAMPLERS = {"Pass_Through", "Direct_Resampler"};
+
+
+struct Combination
+{
+    Adapter adapter;
+    std::string filter;
+    std::string resampler;
+};
+
+
+// Every combination that Fused_Signal_Conditioner supports. The "cshort" and
+// "cbyte" streams need a Fir_Filter to turn them into gr_complex.
+std::vector<Combination> supported_combinations()
+{
+    std::vector<Combination> combinations;
+    for (const auto& adapter : ADAPTERS)
+        {
+            const bool complex_stream = adapter.item_type != "cshort" && adapter.item_type != "cbyte";
+            for (const auto& filter : FILTERS)
+                {
+                    if (!complex_stream && filter != "Fir_Filter")
+                        {
+                            continue;
+                        }
+                    for (const auto& resampler : RESAMPLERS)
+                        {
+                            combinations.push_back({adapter, filter, resampler});
+                        }
+                }
+        }
+    return combinations;
+}
+
+
+const std::vector<Combination> COMBINATIONS = supported_combinations();
+
+
+std::shared_ptr<InMemoryConfiguration> make_configuration(const Combination& c, const std::string& implementation)
+{
+    const bool complex_stream = c.adapter.item_type != "cshort" && c.adapter.item_type != "cbyte";
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "3000000");
+    config->set_property("SignalConditioner.implementation", implementation);
+    config->set_property("DataTypeAdapter.implementation", c.adapter.implementation);
+    config->set_property("DataTypeAdapter.item_type", c.adapter.item_type);
+    config->set_property("InputFilter.implementation", c.filter);
+    config->set_property("InputFilter.item_type", "gr_complex");
+    config->set_property("InputFilter.input_item_type", complex_stream ? "gr_complex" : c.adapter.item_type);
+    config->set_property("InputFilter.output_item_type", "gr_complex");
+    config->set_property("InputFilter.taps_item_type", "float");
+    config->set_property("InputFilter.number_of_taps", "31");
+    config->set_property("InputFilter.number_of_bands", "2");
+    config->set_property("InputFilter.band1_begin", "0.0");
+    config->set_property("InputFilter.band1_end", "0.45");
+    config->set_property("InputFilter.band2_begin", "0.55");
+    config->set_property("InputFilter.band2_end", "1.0");
+    config->set_property("InputFilter.ampl1_begin", "1.0");
+    config->set_property("InputFilter.ampl1_end", "1.0");
+    config->set_property("InputFilter.ampl2_begin", "0.0");
+    config->set_property("InputFilter.ampl2_end", "0.0");
+    config->set_property("InputFilter.band1_error", "1.0");
+    config->set_property("InputFilter.band2_error", "1.0");
+    config->set_property("InputFilter.filter_type", "bandpass");
+    config->set_property("InputFilter.grid_density", "16");
+    config->set_property("InputFilter.IF", "1250000");
+    config->set_property("InputFilter.sampling_frequency", "4000000");
+    config->set_property("InputFilter.decimation_factor", "2");
+    config->set_property("Resampler.implementation", c.resampler);
+    config->set_property("Resampler.item_type", "gr_complex");
+    config->set_property("Resampler.sample_freq_in", c.filter == "Freq_Xlating_Fir_Filter" ? "2000000" : "4000000");
+    config->set_property("Resampler.sample_freq_out", "1500000");
+    return config;
+}
+
+
+void bm_conditioner(benchmark::State& state, const std::string& implementation)
+{
+    const Combination& c = COMBINATIONS[state.range(0)];
+    const auto config = make_configuration(c, implementation);
+    std::vector<unsigned char> input(NSAMPLES * c.adapter.item_size * c.adapter.items_per_sample);
+    for (size_t i = 0; i < input.size(); i++)
+        {
+            input[i] = static_cast<unsigned char>(i * 7919U);
+        }
+    GNSSBlockFactory factory;
+    for (auto _ : state)
+        {
+            state.PauseTiming();
+            auto conditioner = factory.GetSignalConditioner(config.get());
+            if (conditioner == nullptr || conditioner->implementation() != implementation)
+                {
+                    state.SkipWithError("the factory did not build the requested conditioner");
+                    break;
+                }
+            auto top_block = gr::make_top_block("benchmark_fused_conditioner");
+            auto source = gr::blocks::vector_source_b::make(input, false, c.adapter.item_size);
+            auto sink = gr::blocks::null_sink::make(sizeof(gr_complex));
+            conditioner->connect(top_block);
+            top_block->connect(source, 0, conditioner->get_left_block(), 0);
+            top_block->connect(conditioner->get_right_block(), 0, sink, 0);
+            state.ResumeTiming();
+
+            top_block->run();
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+    state.SetLabel(c.adapter.implementation + "(" + c.adapter.item_type + ")+" + c.filter + "+" + c.resampler);
+}
+}  // namespace
+
+
+void bm_chain(benchmark::State& state)
+{
+    bm_conditioner(state, "Signal_Conditioner");
+}
+
+
+void bm_fused(benchmark::State& state)
+{
+    bm_conditioner(state, "Fused_Signal_Conditioner");
+}
+
+
+BENCHMARK(bm_chain)->DenseRange(0, static_cast<int>(COMBINATIONS.size()) - 1)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(bm_fused)->DenseRange(0, static_cast<int>(COMBINATIONS.size()) - 1)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK_MAIN();
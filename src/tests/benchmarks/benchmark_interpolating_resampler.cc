@@ -0,0 +1,132 @@
+/*!
+ * \file benchmark_interpolating_resampler.cc
+ * \brief Benchmark for the resampler that computes the input positions of a
+ * block of outputs at once, against the per-sample loop of the direct
+ * resampler
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "interpolating_resampler.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Input samples per run
+constexpr int NSAMPLES = 1 << 18;
+constexpr double FS_IN = 4e6;
+constexpr double FS_OUT = 2.5e6;
+
+
+template <typename T>
+std::vector<T> random_samples(size_t n)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    std::vector<T> samples(n);
+    for (auto& sample : samples)
+        {
+            sample = T(dist(gen), dist(gen));
+        }
+    return samples;
+}
+
+
+// Loop of direct_resampler_conditioner_cs, deciding sample by sample
+void bm_cshort_direct_loop(benchmark::State& state)
+{
+    const auto input = random_samples<lv_16sc_t>(NSAMPLES);
+    std::vector<lv_16sc_t> output(NSAMPLES);
+    const auto phase_step = static_cast<uint32_t>(std::floor(4294967296.0 * FS_OUT / FS_IN));
+    for (auto _ : state)
+        {
+            uint32_t phase = 0;
+            uint32_t lphase = 0;
+            int count = 0;
+            for (int i = 0; i < NSAMPLES; i++)
+                {
+                    if (phase <= lphase)
+                        {
+                            output[count++] = input[i];
+                        }
+                    lphase = phase;
+                    phase += phase_step;
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+template <typename T>
+void run_resampler(benchmark::State& state, const std::string& item_type, const std::string& interpolation)
+{
+    const auto input = random_samples<T>(NSAMPLES);
+    std::vector<T> output(NSAMPLES);
+    gr_vector_int ninput_items(1, NSAMPLES);
+    gr_vector_const_void_star input_items(1, input.data());
+    gr_vector_void_star output_items(1, output.data());
+    for (auto _ : state)
+        {
+            auto resampler = make_interpolating_resampler(item_type, FS_IN, FS_OUT, interpolation);
+            resampler->general_work(NSAMPLES, ninput_items, input_items, output_items);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void bm_cshort_nearest(benchmark::State& state)
+{
+    run_resampler<lv_16sc_t>(state, "cshort", "nearest");
+}
+
+
+void bm_cshort_linear(benchmark::State& state)
+{
+    run_resampler<lv_16sc_t>(state, "cshort", "linear");
+}
+
+
+void bm_cshort_cubic(benchmark::State& state)
+{
+    run_resampler<lv_16sc_t>(state, "cshort", "cubic");
+}
+
+
+void bm_gr_complex_nearest(benchmark::State& state)
+{
+    run_resampler<gr_complex>(state, "gr_complex", "nearest");
+}
+
+
+void bm_gr_complex_cubic(benchmark::State& state)
+{
+    run_resampler<gr_complex>(state, "gr_complex", "cubic");
+}
+}  // namespace
+
+
+BENCHMARK(bm_cshort_direct_loop);
+BENCHMARK(bm_cshort_nearest);
+BENCHMARK(bm_cshort_linear);
+BENCHMARK(bm_cshort_cubic);
+BENCHMARK(bm_gr_complex_nearest);
+BENCHMARK(bm_gr_complex_cubic);
+
+BENCHMARK_MAIN();
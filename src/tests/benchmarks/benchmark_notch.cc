@@ -0,0 +1,146 @@
+/*!
+ * \file benchmark_notch.cc
+ * \brief Benchmark for the notch filters under a continuous wave jammer
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "notch_cc.h"
+#include "notch_lite_cc.h"
+#include "notch_section.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <cmath>
+#include <complex>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Samples per run
+constexpr int NSAMPLES = 1 << 18;
+constexpr int LENGTH = 32;
+constexpr float P_C_FACTOR = 0.9;
+
+
+// Noise with one or two jammers much stronger than it
+std::vector<gr_complex> jammed_samples(int nsamples, bool two_jammers)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<gr_complex> samples(nsamples);
+    for (int n = 0; n < nsamples; n++)
+        {
+            samples[n] = gr_complex(dist(gen), dist(gen)) + std::polar(20.0F, 0.31F * static_cast<float>(n));
+            if (two_jammers)
+                {
+                    samples[n] += std::polar(10.0F, -0.83F * static_cast<float>(n));
+                }
+        }
+    return samples;
+}
+
+
+// Filtering loop of the notch filter with a phasor computed sample by sample
+void bm_notch_per_sample(benchmark::State& state)
+{
+    const auto input = jammed_samples(NSAMPLES + 1, false);
+    std::vector<gr_complex> output(NSAMPLES);
+    std::vector<gr_complex> c_samples(LENGTH);
+    std::vector<float> angle(LENGTH);
+    const gr_complex p_c_factor(P_C_FACTOR, 0.0);
+    for (auto _ : state)
+        {
+            gr_complex last_out(0.0, 0.0);
+            for (int start = 0; start + LENGTH <= NSAMPLES; start += LENGTH)
+                {
+                    const gr_complex* in = &input[start + 1];
+                    gr_complex* out = &output[start];
+                    volk_32fc_x2_multiply_conjugate_32fc(c_samples.data(), in, in - 1, LENGTH);
+                    volk_32fc_s32f_atan2_32f(angle.data(), c_samples.data(), 1.0, LENGTH);
+                    for (int n = 0; n < LENGTH; n++)
+                        {
+                            const gr_complex z_0 = std::exp(gr_complex(0.0, 1.0) * angle[n]);
+                            out[n] = in[n] - z_0 * in[n - 1] + p_c_factor * z_0 * last_out;
+                            last_out = out[n];
+                        }
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void bm_notch_section(benchmark::State& state)
+{
+    const auto input = jammed_samples(NSAMPLES + 1, false);
+    std::vector<gr_complex> output(NSAMPLES);
+    std::vector<gr_complex> phasors(LENGTH);
+    Notch_Section section(LENGTH);
+    for (auto _ : state)
+        {
+            for (int start = 0; start + LENGTH <= NSAMPLES; start += LENGTH)
+                {
+                    Notch_Section::phasors(&input[start + 1], phasors.data(), LENGTH);
+                    section.filter(&input[start + 1], phasors.data(), P_C_FACTOR, &output[start]);
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+// Whole block, once the noise floor is estimated and the jammer detected
+template <typename Block>
+void run_block(benchmark::State& state, const Block& block, bool two_jammers)
+{
+    const auto input = jammed_samples(NSAMPLES + 1, two_jammers);
+    std::vector<gr_complex> output(NSAMPLES);
+    gr_vector_int ninput_items(1, NSAMPLES);
+    gr_vector_const_void_star input_items(1, input.data());
+    gr_vector_void_star output_items(1, output.data());
+    block->general_work(NSAMPLES, ninput_items, input_items, output_items);
+    for (auto _ : state)
+        {
+            block->general_work(NSAMPLES, ninput_items, input_items, output_items);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void bm_notch_block(benchmark::State& state)
+{
+    run_block(state, make_notch_filter(0.001, P_C_FACTOR, LENGTH, 1, 5000000), false);
+}
+
+
+void bm_notch_lite_block(benchmark::State& state)
+{
+    run_block(state, make_notch_filter_lite(P_C_FACTOR, 0.001, LENGTH, 1, 5000000, 1, 1), false);
+}
+
+
+void bm_notch_lite_block_two_notches(benchmark::State& state)
+{
+    run_block(state, make_notch_filter_lite(P_C_FACTOR, 0.001, LENGTH, 1, 5000000, 1, 2), true);
+}
+}  // namespace
+
+
+BENCHMARK(bm_notch_per_sample);
+BENCHMARK(bm_notch_section);
+BENCHMARK(bm_notch_block);
+BENCHMARK(bm_notch_lite_block);
+BENCHMARK(bm_notch_lite_block_two_notches);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,163 @@
+/*!
+ * \file benchmark_polyphase_fir.cc
+ * \brief Benchmark for the decimating FIR kernels on integer samples and for
+ * the half-band cascade of the polyphase FIR decimator
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "polyphase_fir_decimator.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Output samples per run
+constexpr int NOUTPUTS = 1 << 14;
+constexpr int NTAPS = 31;
+constexpr unsigned int DECIMATION = 4;
+constexpr int NINPUTS = (NOUTPUTS - 1) * DECIMATION + NTAPS;
+
+
+template <typename T>
+volk_gnsssdr::vector<T> random_samples(size_t n)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(-100, 100);
+    volk_gnsssdr::vector<T> samples(n);
+    for (auto& sample : samples)
+        {
+            sample = T(dist(gen), dist(gen));
+        }
+    return samples;
+}
+
+
+const volk_gnsssdr::vector<float> TAPS(NTAPS, 1.0F / static_cast<float>(NTAPS));
+
+
+// Filter of the converted samples, one dot product per output
+void bm_cshort_convert_and_filter(benchmark::State& state)
+{
+    const auto input = random_samples<lv_16sc_t>(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> converted(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    for (auto _ : state)
+        {
+            volk_16i_s32f_convert_32f(reinterpret_cast<float*>(converted.data()), reinterpret_cast<const int16_t*>(input.data()), 1.0F, 2 * NINPUTS);
+            for (int n = 0; n < NOUTPUTS; n++)
+                {
+                    volk_32fc_32f_dot_prod_32fc(&output[n], &converted[n * DECIMATION], TAPS.data(), NTAPS);
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NINPUTS);
+}
+
+
+void bm_cshort_fir_decimate_generic(benchmark::State& state)
+{
+    const auto input = random_samples<lv_16sc_t>(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    for (auto _ : state)
+        {
+            volk_gnsssdr_16ic_32f_fir_decimate_32fc_manual(output.data(), input.data(), TAPS.data(), NTAPS, DECIMATION, NOUTPUTS, "generic");
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NINPUTS);
+}
+
+
+void bm_cshort_fir_decimate(benchmark::State& state)
+{
+    const auto input = random_samples<lv_16sc_t>(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    for (auto _ : state)
+        {
+            volk_gnsssdr_16ic_32f_fir_decimate_32fc(output.data(), input.data(), TAPS.data(), NTAPS, DECIMATION, NOUTPUTS);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NINPUTS);
+}
+
+
+void bm_cbyte_fir_decimate_generic(benchmark::State& state)
+{
+    const auto input = random_samples<lv_8sc_t>(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    for (auto _ : state)
+        {
+            volk_gnsssdr_8ic_32f_fir_decimate_32fc_manual(output.data(), input.data(), TAPS.data(), NTAPS, DECIMATION, NOUTPUTS, "generic");
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NINPUTS);
+}
+
+
+void bm_cbyte_fir_decimate(benchmark::State& state)
+{
+    const auto input = random_samples<lv_8sc_t>(NINPUTS);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    for (auto _ : state)
+        {
+            volk_gnsssdr_8ic_32f_fir_decimate_32fc(output.data(), input.data(), TAPS.data(), NTAPS, DECIMATION, NOUTPUTS);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NINPUTS);
+}
+
+
+// Decimation by 8 of cshort samples, in one filter or in a half-band cascade
+void run_decimator(benchmark::State& state, const polyphase_fir_decimator_sptr& decimator)
+{
+    const int ninputs = (NOUTPUTS - 1) * static_cast<int>(decimator->decimation()) + static_cast<int>(decimator->history());
+    const auto input = random_samples<lv_16sc_t>(ninputs);
+    volk_gnsssdr::vector<lv_32fc_t> output(NOUTPUTS);
+    gr_vector_const_void_star input_items(1, input.data());
+    gr_vector_void_star output_items(1, output.data());
+    for (auto _ : state)
+        {
+            decimator->work(NOUTPUTS, input_items, output_items);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * ninputs);
+}
+
+
+void bm_cshort_decimate_by_8_direct(benchmark::State& state)
+{
+    run_decimator(state, make_polyphase_fir_decimator("cshort", std::vector<float>(8 * NTAPS, 1.0F / (8 * NTAPS)), 8, std::vector<float>(), 0));
+}
+
+
+void bm_cshort_decimate_by_8_halfband(benchmark::State& state)
+{
+    const std::vector<float> halfband = {-0.01F, 0.0F, 0.02F, 0.0F, -0.05F, 0.0F, 0.3F, 0.5F, 0.3F, 0.0F, -0.05F, 0.0F, 0.02F, 0.0F, -0.01F};
+    run_decimator(state, make_polyphase_fir_decimator("cshort", std::vector<float>(TAPS.begin(), TAPS.end()), 1, halfband, 3));
+}
+}  // namespace
+
+
+BENCHMARK(bm_cshort_convert_and_filter);
+BENCHMARK(bm_cshort_fir_decimate_generic);
+BENCHMARK(bm_cshort_fir_decimate);
+BENCHMARK(bm_cbyte_fir_decimate_generic);
+BENCHMARK(bm_cbyte_fir_decimate);
+BENCHMARK(bm_cshort_decimate_by_8_direct);
+BENCHMARK(bm_cshort_decimate_by_8_halfband);
+
+BENCHMARK_MAIN();
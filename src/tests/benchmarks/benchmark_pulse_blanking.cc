@@ -0,0 +1,130 @@
+/*!
+ * \file benchmark_pulse_blanking.cc
+ * \brief Benchmark for the pulse blanking filter
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pulse_blanking_cc.h"
+#include <benchmark/benchmark.h>
+#include <volk/volk.h>
+#include <complex>
+#include <cstring>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Samples per call, as a scheduler would pass them
+constexpr int NSAMPLES = 8192;
+constexpr int LENGTH = 32;
+
+
+// Noise with a pulse of 25 samples every 997 samples
+std::vector<gr_complex> pulsed_samples(int nsamples)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<gr_complex> samples(nsamples);
+    for (int n = 0; n < nsamples; n++)
+        {
+            samples[n] = gr_complex(dist(gen), dist(gen));
+        }
+    for (int start = 0; start + 25 < nsamples; start += 997)
+        {
+            for (int k = 0; k < 25; k++)
+                {
+                    samples[start + k] += std::polar(30.0F, 0.4F * static_cast<float>(k));
+                }
+        }
+    return samples;
+}
+
+
+// Previous work loop, with a magnitude vector allocated on every call and
+// accumulated segment by segment
+void bm_pulse_blanking_allocating(benchmark::State& state)
+{
+    const auto input = pulsed_samples(NSAMPLES);
+    std::vector<gr_complex> output(NSAMPLES);
+    const volk_gnsssdr::vector<gr_complex> zeros(LENGTH);
+    const float noise_power = 1.0;
+    const float thres = 100.0;
+    for (auto _ : state)
+        {
+            auto magnitude = volk_gnsssdr::vector<float>(NSAMPLES);
+            volk_32fc_magnitude_squared_32f(magnitude.data(), input.data(), NSAMPLES);
+            int32_t sample_index = 0;
+            float segment_energy;
+            while ((sample_index + LENGTH) < NSAMPLES)
+                {
+                    volk_32f_accumulator_s32f(&segment_energy, (magnitude.data() + sample_index), LENGTH);
+                    if ((segment_energy / noise_power) > thres)
+                        {
+                            memcpy(&output[sample_index], zeros.data(), sizeof(gr_complex) * LENGTH);
+                        }
+                    else
+                        {
+                            memcpy(&output[sample_index], &input[sample_index], sizeof(gr_complex) * LENGTH);
+                        }
+                    sample_index += LENGTH;
+                }
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+// Whole block, once the noise floor is estimated
+void run_block(benchmark::State& state, int32_t overlap, bool frequency_domain)
+{
+    auto block = make_pulse_blanking_cc(0.0001, LENGTH, 10, 5000000, overlap, frequency_domain);
+    const auto input = pulsed_samples(NSAMPLES + LENGTH);
+    std::vector<gr_complex> output(NSAMPLES);
+    gr_vector_int ninput_items(1, NSAMPLES + LENGTH);
+    gr_vector_const_void_star input_items(1, input.data());
+    gr_vector_void_star output_items(1, output.data());
+    block->general_work(NSAMPLES, ninput_items, input_items, output_items);
+    for (auto _ : state)
+        {
+            block->general_work(NSAMPLES, ninput_items, input_items, output_items);
+            benchmark::DoNotOptimize(output.data());
+        }
+    state.SetItemsProcessed(state.iterations() * NSAMPLES);
+}
+
+
+void bm_pulse_blanking_segment(benchmark::State& state)
+{
+    run_block(state, 0, false);
+}
+
+
+void bm_pulse_blanking_sliding(benchmark::State& state)
+{
+    run_block(state, LENGTH / 2, false);
+}
+
+
+void bm_pulse_blanking_frequency(benchmark::State& state)
+{
+    run_block(state, 0, true);
+}
+}  // namespace
+
+
+BENCHMARK(bm_pulse_blanking_allocating);
+BENCHMARK(bm_pulse_blanking_segment);
+BENCHMARK(bm_pulse_blanking_sliding);
+BENCHMARK(bm_pulse_blanking_frequency);
+
+BENCHMARK_MAIN();
@@ -19,6 +19,7 @@
 #include "reed_solomon.h"
 #include <benchmark/benchmark.h>
 #include <memory>
+#include <random>
 #include <vector>
 
 void bm_e1b_erasurecorrection_shortened(benchmark::State& state)
@@ -294,9 +295,64 @@ void bm_e6b_erasure(benchmark::State& state)
         }
 }
 
+void bm_e6b_has_message(benchmark::State& state)
+{
+    // Full decoding of a HAS message of 32 pages (53 octets per page),
+    // as done by the galileo_e6_has_msg_receiver block.
+    constexpr int octets_in_subpage = 53;
+    constexpr int information_vector_length = 32;
+    constexpr int symbols_encoded_block = 255;
+
+    auto rs = std::make_unique<ReedSolomon>();
+
+    std::mt19937 gen(1);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<std::vector<uint8_t>> C_matrix(octets_in_subpage);
+    for (auto& column : C_matrix)
+        {
+            std::vector<uint8_t> information(information_vector_length);
+            for (auto& octet : information)
+                {
+                    octet = static_cast<uint8_t>(dist(gen));
+                }
+            column = rs->encode_with_generator_matrix(information);
+        }
+
+    // Received PIDs: 1 to 10 and 41 to 62. The rest are erasures.
+    std::vector<int> erasure_positions;
+    erasure_positions.reserve(symbols_encoded_block - information_vector_length);
+    for (int i = 0; i < symbols_encoded_block; i++)
+        {
+            if (i >= 10 && (i < 40 || i >= 62))
+                {
+                    erasure_positions.push_back(i);
+                    for (auto& column : C_matrix)
+                        {
+                            column[i] = 0;
+                        }
+                }
+        }
+
+    std::vector<uint8_t> C_column(symbols_encoded_block);
+    while (state.KeepRunning())
+        {
+            for (const auto& column : C_matrix)
+                {
+                    C_column = column;
+                    int result = rs->decode(C_column, erasure_positions);
+                    if (result < 0)
+                        {
+                            state.SkipWithError("Failed to decode data!");
+                            break;
+                        }
+                }
+        }
+}
+
 
 BENCHMARK(bm_e1b_erasurecorrection_shortened);
 BENCHMARK(bm_e1b_erasurecorrection_unshortened);
 BENCHMARK(bm_e6b_correction);
 BENCHMARK(bm_e6b_erasure);
+BENCHMARK(bm_e6b_has_message);
 BENCHMARK_MAIN();
@@ -0,0 +1,152 @@
+/*!
+ * \file benchmark_rtcm.cc
+ * \brief Benchmark for the generation and parsing of RTCM 3 messages
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtcm.h"
+#include "rtcm_bit_stream.h"
+#include <benchmark/benchmark.h>
+#include <bitset>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <random>
+#include <string>
+
+namespace
+{
+constexpr int NUM_SATS = 16;  // per constellation
+
+std::map<int32_t, Gnss_Synchro> make_observables(char system, const char* signal_1, const char* signal_2)
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> pseudorange(2.0e7, 2.5e7);
+    std::uniform_real_distribution<double> doppler(-4000.0, 4000.0);
+    std::map<int32_t, Gnss_Synchro> observables;
+    int32_t channel = 0;
+    for (uint32_t prn = 1; prn <= NUM_SATS; prn++)
+        {
+            for (const char* signal : {signal_1, signal_2})
+                {
+                    Gnss_Synchro gnss_synchro{};
+                    gnss_synchro.System = system;
+                    std::memcpy(static_cast<void*>(gnss_synchro.Signal), signal, 3);
+                    gnss_synchro.PRN = prn;
+                    gnss_synchro.Channel_ID = channel;
+                    gnss_synchro.Pseudorange_m = pseudorange(gen);
+                    gnss_synchro.Carrier_phase_rads = pseudorange(gen);
+                    gnss_synchro.Carrier_Doppler_hz = doppler(gen);
+                    gnss_synchro.CN0_dB_hz = 45.0;
+                    gnss_synchro.Flag_valid_pseudorange = true;
+                    observables[channel++] = gnss_synchro;
+                }
+        }
+    return observables;
+}
+}  // namespace
+
+
+void bm_msm7(benchmark::State& state)
+{
+    Rtcm rtcm;
+    const Gps_Ephemeris gps_eph{};
+    const Gps_CNAV_Ephemeris gps_cnav_eph{};
+    const Galileo_Ephemeris gal_eph{};
+    const Glonass_Gnav_Ephemeris glo_eph{};
+    const std::map<int32_t, Gnss_Synchro> observables[3] = {
+        make_observables('G', "1C", "2S"),
+        make_observables('E', "1B", "5X"),
+        make_observables('R', "1C", "2C")};
+    size_t bytes = 0;
+    for (auto _ : state)
+        {
+            for (const auto& obs : observables)
+                {
+                    const std::string msg = rtcm.print_MSM_7(gps_eph, gps_cnav_eph, gal_eph, glo_eph, 100.0, obs, 1234, 0, 0, 0, false, false);
+                    bytes += msg.size();
+                    benchmark::DoNotOptimize(msg.data());
+                }
+        }
+    state.SetBytesProcessed(static_cast<int64_t>(bytes));
+}
+
+
+void bm_mt1019(benchmark::State& state)
+{
+    Rtcm rtcm;
+    Gps_Ephemeris gps_eph{};
+    gps_eph.PRN = 5;
+    gps_eph.sqrtA = 5153.7;
+    gps_eph.ecc = 0.01;
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(rtcm.print_MT1019(gps_eph));
+        }
+}
+
+
+void bm_read_mt1019(benchmark::State& state)
+{
+    Rtcm rtcm;
+    Gps_Ephemeris gps_eph{};
+    gps_eph.PRN = 5;
+    gps_eph.sqrtA = 5153.7;
+    const std::string msg = rtcm.print_MT1019(gps_eph);
+    Gps_Ephemeris read{};
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(rtcm.read_MT1019(msg, read));
+        }
+}
+
+
+// Appending data fields as text, as the message builder used to do, and
+// converting the result to bytes
+void bm_fields_as_text(benchmark::State& state)
+{
+    Rtcm rtcm;
+    for (auto _ : state)
+        {
+            std::string bits;
+            for (int i = 0; i < NUM_SATS * 2; i++)
+                {
+                    bits += std::bitset<20>(i).to_string() + std::bitset<24>(i).to_string() + std::bitset<10>(i).to_string() + std::bitset<1>(1).to_string();
+                }
+            benchmark::DoNotOptimize(rtcm.bin_to_binary_data(bits));
+        }
+}
+
+
+void bm_fields_as_bits(benchmark::State& state)
+{
+    Rtcm_Bit_Writer bits;
+    for (auto _ : state)
+        {
+            bits.clear();
+            for (int i = 0; i < NUM_SATS * 2; i++)
+                {
+                    bits << std::bitset<20>(i) << std::bitset<24>(i) << std::bitset<10>(i) << std::bitset<1>(1);
+                }
+            benchmark::DoNotOptimize(bits.data());
+        }
+}
+
+
+BENCHMARK(bm_msm7);
+BENCHMARK(bm_mt1019);
+BENCHMARK(bm_read_mt1019);
+BENCHMARK(bm_fields_as_text);
+BENCHMARK(bm_fields_as_bits);
+
+BENCHMARK_MAIN();
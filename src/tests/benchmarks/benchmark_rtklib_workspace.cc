@@ -0,0 +1,150 @@
+/*!
+ * \file benchmark_rtklib_workspace.cc
+ * \brief Benchmark for the RTKLIB matrix workspace
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib.h"
+#include "rtklib_rtkcmn.h"
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+namespace
+{
+// Kalman filter update of a float RTK-like state (position + ambiguities)
+constexpr int NX = 9 + 3 * 16;
+constexpr int NV = 2 * 16;
+
+// Least squares of a single point solution
+constexpr int NP = 7;
+constexpr int NOBS = 16;
+
+struct Problem
+{
+    Problem(int n, int m) : x(n), P(n * n), H(n * m), v(m), R(m * m)
+    {
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<double> u(-1.0, 1.0);
+        for (int i = 0; i < n; i++)
+            {
+                x[i] = u(gen);
+                P[i + i * n] = 10.0;
+            }
+        for (int j = 0; j < m; j++)
+            {
+                for (int i = 0; i < n; i++)
+                    {
+                        H[i + j * n] = u(gen);
+                    }
+                v[j] = u(gen);
+                R[j + j * m] = 0.01;
+            }
+    }
+    std::vector<double> x;
+    std::vector<double> P;
+    std::vector<double> H;
+    std::vector<double> v;
+    std::vector<double> R;
+};
+
+
+void run_filter(benchmark::State& state, wksp_t* ws)
+{
+    const Problem p(NX, NV);
+    std::vector<double> x(p.x);
+    std::vector<double> P(p.P);
+    unsigned int heap_mode_allocs = 0;
+    if (ws)
+        {
+            // the first epoch on an empty workspace allocates everything on the heap
+            filter(x.data(), P.data(), p.H.data(), p.v.data(), p.R.data(), NX, NV, ws);
+            heap_mode_allocs = ws->nheap;
+        }
+    const unsigned int nheap0 = ws ? ws->nheap : 0;
+    for (auto _ : state)
+        {
+            x = p.x;
+            P = p.P;
+            benchmark::DoNotOptimize(filter(x.data(), P.data(), p.H.data(), p.v.data(), p.R.data(), NX, NV, ws));
+        }
+    if (ws)
+        {
+            state.counters["heap_mode_allocs"] = heap_mode_allocs;
+            state.counters["allocs_per_epoch"] = benchmark::Counter(ws->nheap - nheap0, benchmark::Counter::kAvgIterations);
+        }
+}
+
+
+void run_lsq(benchmark::State& state, wksp_t* ws)
+{
+    const Problem p(NP, NOBS);
+    std::vector<double> dx(NP);
+    std::vector<double> Q(NP * NP);
+    unsigned int heap_mode_allocs = 0;
+    if (ws)
+        {
+            lsq(p.H.data(), p.v.data(), NP, NOBS, dx.data(), Q.data(), ws);
+            heap_mode_allocs = ws->nheap;
+        }
+    const unsigned int nheap0 = ws ? ws->nheap : 0;
+    for (auto _ : state)
+        {
+            benchmark::DoNotOptimize(lsq(p.H.data(), p.v.data(), NP, NOBS, dx.data(), Q.data(), ws));
+        }
+    if (ws)
+        {
+            state.counters["heap_mode_allocs"] = heap_mode_allocs;
+            state.counters["allocs_per_epoch"] = benchmark::Counter(ws->nheap - nheap0, benchmark::Counter::kAvgIterations);
+        }
+}
+}  // namespace
+
+
+void bm_filter_heap(benchmark::State& state)
+{
+    run_filter(state, nullptr);
+}
+
+
+void bm_filter_workspace(benchmark::State& state)
+{
+    wksp_t ws{};
+    wsinit(&ws, 0);
+    run_filter(state, &ws);
+    wsfree(&ws);
+}
+
+
+void bm_lsq_heap(benchmark::State& state)
+{
+    run_lsq(state, nullptr);
+}
+
+
+void bm_lsq_workspace(benchmark::State& state)
+{
+    wksp_t ws{};
+    wsinit(&ws, 0);
+    run_lsq(state, &ws);
+    wsfree(&ws);
+}
+
+
+BENCHMARK(bm_filter_heap);
+BENCHMARK(bm_filter_workspace);
+BENCHMARK(bm_lsq_heap);
+BENCHMARK(bm_lsq_workspace);
+
+BENCHMARK_MAIN();
@@ -35,5 +35,6 @@ DEFINE_double(precision_SEP, 15.0, "Static scenario 3D (East, North, Up) precisi
 DEFINE_double(dynamic_3D_position_RMSE, 10.0, "Dynamic scenario 3D (ECEF) accuracy RMSE threshold [meters]");
 DEFINE_double(dynamic_3D_velocity_RMSE, 5.0, "Dynamic scenario 3D (ECEF) velocity accuracy RMSE threshold [meters/second]");
 DEFINE_bool(enable_carrier_smoothing, false, "Activates carrier smoothing of pseudoranges");
+DEFINE_bool(sat_position_cache, false, "Interpolates satellite positions and clocks from cached broadcast orbit nodes");
 
 #endif
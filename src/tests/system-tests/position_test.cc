@@ -30,6 +30,8 @@
 #include "gnuplot_i.h"
 #include "in_memory_configuration.h"
 #include "position_test_flags.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
 #include "rtklib_solver_dump_reader.h"
 #include "signal_generator_flags.h"
 #include "spirent_motion_csv_dump_reader.h"
@@ -48,6 +50,7 @@
 #include <fstream>
 #include <numeric>
 #include <thread>
+#include <vector>
 
 #if GFLAGS_OLD_NAMESPACE
 namespace gflags
@@ -327,6 +330,7 @@ int PositionSystemTest::configure_receiver()
             config->set_property("PVT.trop_model", "OFF");
             config->set_property("PVT.AR_GPS", "PPP-AR");
             config->set_property("PVT.elevation_mask", std::to_string(5));
+            config->set_property("PVT.sat_position_cache", FLAGS_sat_position_cache ? "true" : "false");
 
             config_f = nullptr;
         }
@@ -977,6 +981,169 @@ TEST_F(PositionSystemTest /*unused*/, Position_system_test /*unused*/)
 }
 
 
+TEST(SatPositionCacheTest /*unused*/, InterpolationAccuracy /*unused*/)
+{
+    // Satellite states interpolated from the cache must match the ones
+    // propagated from the broadcast ephemeris at every observation epoch
+    const gtime_t toe = gpst2time(2200, 345600.0);
+    std::vector<eph_t> eph(2);
+    eph[0].sat = satno(SYS_GPS, 5);
+    eph[0].iode = 33;
+    eph[0].A = 2.656e7;
+    eph[0].e = 0.012;
+    eph[0].i0 = 0.96;
+    eph[0].OMG0 = 1.2;
+    eph[0].omg = 0.7;
+    eph[0].M0 = 2.1;
+    eph[0].deln = 4.5e-9;
+    eph[0].OMGd = -8.1e-9;
+    eph[0].idot = 1e-10;
+    eph[0].crc = 200.0;
+    eph[0].crs = 50.0;
+    eph[0].cuc = 2e-6;
+    eph[0].cus = 8e-6;
+    eph[0].cic = 1e-7;
+    eph[0].cis = -5e-8;
+    eph[0].toes = 345600.0;
+    eph[0].toe = toe;
+    eph[0].toc = toe;
+    eph[0].f0 = 1.2e-4;
+    eph[0].f1 = 3e-12;
+    eph[0].week = 2200;
+    eph[1] = eph[0];
+    eph[1].sat = satno(SYS_GAL, 11);
+    eph[1].iode = 90;
+    eph[1].A = 2.96e7;
+    eph[1].M0 = -1.0;
+    std::vector<geph_t> geph(1);
+    geph[0].sat = satno(SYS_GLO, 7);
+    geph[0].iode = 40;
+    geph[0].toe = toe;
+    geph[0].tof = toe;
+    geph[0].pos[0] = 1.2e7;
+    geph[0].pos[1] = -1.5e7;
+    geph[0].pos[2] = 1.6e7;
+    geph[0].vel[0] = 1500.0;
+    geph[0].vel[1] = 2200.0;
+    geph[0].vel[2] = 1000.0;
+    geph[0].acc[0] = 1e-6;
+    geph[0].taun = 5e-5;
+    geph[0].gamn = 1e-12;
+
+    nav_t nav{};
+    nav.eph = eph.data();
+    nav.n = nav.nmax = static_cast<int>(eph.size());
+    nav.geph = geph.data();
+    nav.ng = nav.ngmax = static_cast<int>(geph.size());
+    std::vector<satcache_t> satcache(MAXSAT);
+    nav.satcache = satcache.data();
+
+    const std::array<int, 3> sats = {eph[0].sat, eph[1].sat, geph[0].sat};
+    for (int sat : sats)
+        {
+            double max_pos_error_m = 0.0;
+            double max_vel_error_mps = 0.0;
+            double max_clk_error_m = 0.0;
+            // 100 Hz PVT rate, 15 minutes around toe
+            for (int k = -90000; k < 90000; k++)
+                {
+                    const gtime_t t = timeadd(toe, k * 0.01 + 0.0037);
+                    std::array<double, 6> rs{};
+                    std::array<double, 6> rs_cache{};
+                    std::array<double, 2> dts{};
+                    std::array<double, 2> dts_cache{};
+                    double var = 0.0;
+                    double var_cache = 0.0;
+                    int svh = 0;
+                    int svh_cache = 0;
+                    ASSERT_EQ(satpos(t, toe, sat, EPHOPT_BRDC, &nav, rs.data(), dts.data(), &var, &svh), 1);
+                    ASSERT_EQ(satpos(t, toe, sat, EPHOPT_BRDCCACHE, &nav, rs_cache.data(), dts_cache.data(), &var_cache, &svh_cache), 1);
+                    ASSERT_EQ(var, var_cache);
+                    ASSERT_EQ(svh, svh_cache);
+                    for (int i = 0; i < 3; i++)
+                        {
+                            max_pos_error_m = std::max(max_pos_error_m, std::fabs(rs[i] - rs_cache[i]));
+                            max_vel_error_mps = std::max(max_vel_error_mps, std::fabs(rs[i + 3] - rs_cache[i + 3]));
+                        }
+                    max_clk_error_m = std::max(max_clk_error_m, std::fabs(dts[0] - dts_cache[0]) * SPEED_OF_LIGHT_M_S);
+                }
+            std::cout << "Satellite " << sat << ": max position error " << max_pos_error_m
+                      << " m, max velocity error " << max_vel_error_mps
+                      << " m/s, max clock error " << max_clk_error_m << " m\n";
+            EXPECT_LT(max_pos_error_m, 1e-3);
+            EXPECT_LT(max_vel_error_mps, 1e-3);
+            EXPECT_LT(max_clk_error_m, 1e-3);
+        }
+
+    // An ephemeris update that keeps IODE and toe must not reuse the nodes
+    eph[0].M0 += 1e-3;
+    const gtime_t t = timeadd(toe, 0.0037);
+    std::array<double, 6> rs{};
+    std::array<double, 6> rs_cache{};
+    std::array<double, 2> dts{};
+    std::array<double, 2> dts_cache{};
+    double var = 0.0;
+    int svh = 0;
+    ASSERT_EQ(satpos(t, toe, eph[0].sat, EPHOPT_BRDC, &nav, rs.data(), dts.data(), &var, &svh), 1);
+    ASSERT_EQ(satpos(t, toe, eph[0].sat, EPHOPT_BRDCCACHE, &nav, rs_cache.data(), dts_cache.data(), &var, &svh), 1);
+    for (int i = 0; i < 3; i++)
+        {
+            EXPECT_LT(std::fabs(rs[i] - rs_cache[i]), 1e-3);
+        }
+}
+
+
+TEST(EphemerisIndexTest /*unused*/, SameSelectionAsTheSearch /*unused*/)
+{
+    // With at most one ephemeris per satellite, seleph() and selgeph() must
+    // pick the same entry through nav.ephidx as through the linear search
+    const gtime_t toe = gpst2time(2200, 345600.0);
+    std::vector<eph_t> eph(3);
+    eph[0].sat = satno(SYS_GPS, 5);
+    eph[0].iode = 33;
+    eph[0].toe = toe;
+    eph[1].sat = satno(SYS_GAL, 11);
+    eph[1].iode = 90;
+    eph[1].toe = timeadd(toe, 3000.0);
+    eph[2].sat = satno(SYS_BDS, 21);
+    eph[2].iode = 2;
+    eph[2].toe = timeadd(toe, -4000.0);
+    std::vector<geph_t> geph(1);
+    geph[0].sat = satno(SYS_GLO, 7);
+    geph[0].iode = 40;
+    geph[0].toe = toe;
+
+    nav_t nav{};
+    nav.eph = eph.data();
+    nav.n = nav.nmax = static_cast<int>(eph.size());
+    nav.geph = geph.data();
+    nav.ng = nav.ngmax = static_cast<int>(geph.size());
+    std::vector<int> ephidx(MAXSAT, 0);
+    for (int i = 0; i < nav.n; i++)
+        {
+            ephidx[eph[i].sat - 1] = i + 1;
+        }
+    ephidx[geph[0].sat - 1] = 1;
+
+    for (int sat = 1; sat <= MAXSAT; sat++)
+        {
+            for (int iode : {-1, 2, 33, 40, 90})
+                {
+                    for (double dt : {-9000.0, -2000.0, 0.0, 1500.0, 7300.0})
+                        {
+                            const gtime_t t = timeadd(toe, dt);
+                            nav.ephidx = nullptr;
+                            const eph_t* eph_search = seleph(t, sat, iode, &nav);
+                            const geph_t* geph_search = selgeph(t, sat, iode, &nav);
+                            nav.ephidx = ephidx.data();
+                            EXPECT_EQ(seleph(t, sat, iode, &nav), eph_search);
+                            EXPECT_EQ(selgeph(t, sat, iode, &nav), geph_search);
+                        }
+                }
+        }
+}
+
+
 int main(int argc, char** argv)
 {
     std::cout << "Running Position precision test...\n";
@@ -0,0 +1,162 @@
+/*!
+ * \file batch_runner_test.cc
+ * \brief This file implements tests for the gnss-sdr-batch job runner, using
+ * a shell script in place of gnss-sdr.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_runner.h"
+#include "gnss_sdr_filesystem.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+
+class BatchRunnerTest : public ::testing::Test
+{
+protected:
+    BatchRunnerTest()
+    {
+        fs::remove_all(work_dir);
+        fs::create_directories(work_dir);
+    }
+
+    ~BatchRunnerTest() override
+    {
+        errorlib::error_code ec;
+        fs::remove_all(work_dir, ec);
+    }
+
+    // Writes an executable script that stands for gnss-sdr
+    std::string write_script(const std::string& name, const std::string& body) const
+    {
+        const std::string filename = work_dir + "/" + name;
+        std::ofstream script(filename);
+        script << "#!/bin/sh\n"
+               << body;
+        script.close();
+        chmod(filename.c_str(), S_IRWXU);
+        return filename;
+    }
+
+    static std::string read_file(const std::string& filename)
+    {
+        std::ifstream file(filename);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    const std::string work_dir = "./batch_runner_test";
+};
+
+
+TEST_F(BatchRunnerTest, ReadJobs)
+{
+    std::ofstream list(work_dir + "/jobs.txt");
+    list << "# config signal name\n"
+         << "\n"
+         << "a.conf  a.dat  first\n"
+         << "b.conf  -\n"
+         << "c.conf\n";
+    list.close();
+
+    const auto jobs = read_batch_jobs(work_dir + "/jobs.txt");
+    ASSERT_EQ(jobs.size(), 3U);
+    EXPECT_EQ(jobs[0].config_file, "a.conf");
+    EXPECT_EQ(jobs[0].signal_file, "a.dat");
+    EXPECT_EQ(jobs[0].name, "first");
+    EXPECT_TRUE(jobs[1].signal_file.empty());
+    EXPECT_EQ(jobs[1].name, "job_4");
+    EXPECT_EQ(jobs[2].name, "job_5");
+
+    std::ofstream duplicated(work_dir + "/duplicated.txt");
+    duplicated << "a.conf - same\nb.conf - same\n";
+    duplicated.close();
+    EXPECT_THROW(read_batch_jobs(work_dir + "/duplicated.txt"), std::runtime_error);
+    EXPECT_THROW(read_batch_jobs(work_dir + "/missing.txt"), std::runtime_error);
+}
+
+
+TEST_F(BatchRunnerTest, InputPathsAreResolvedFromTheCurrentFolder)
+{
+    // The script prints its folder and the configuration file it gets
+    const std::string gnss_sdr = write_script("fake-gnss-sdr",
+        "for arg in \"$@\"; do case $arg in --c=*) cat \"${arg#--c=}\";; esac; done\n"
+        "pwd\n");
+    std::ofstream(work_dir + "/signal.dat") << "samples";
+    std::ofstream config(work_dir + "/receiver.conf");
+    config << "; comment with " << work_dir << "/signal.dat\n"
+           << "SignalSource.filename=" << work_dir << "/signal.dat\n"
+           << "SignalSource.dump_filename=" << work_dir << "/signal.dat\n"
+           << "PVT.output_path=.\n"
+           << "SignalSource.item_type=gr_complex\n";
+    config.close();
+
+    const Batch_Runner runner(gnss_sdr, work_dir + "/out", {}, 1, 0.0);
+    const auto results = runner.run({{"job", work_dir + "/receiver.conf", ""}});
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_TRUE(results[0].ok());
+
+    const std::string output = read_file(work_dir + "/out/job/gnss-sdr.out");
+    const std::string signal = fs::absolute(work_dir + "/signal.dat").string();
+    EXPECT_NE(output.find("; comment with " + work_dir + "/signal.dat\n"), std::string::npos);
+    EXPECT_NE(output.find("SignalSource.filename=" + signal + "\n"), std::string::npos);
+    EXPECT_NE(output.find("SignalSource.dump_filename=" + work_dir + "/signal.dat\n"), std::string::npos);
+    EXPECT_NE(output.find("PVT.output_path=.\n"), std::string::npos);
+    EXPECT_NE(output.find("SignalSource.item_type=gr_complex\n"), std::string::npos);
+    EXPECT_NE(output.find("/out/job\n"), std::string::npos);
+}
+
+
+TEST_F(BatchRunnerTest, FailuresAreReported)
+{
+    const std::string gnss_sdr = write_script("fake-gnss-sdr", "echo data > result.txt\nexit 3\n");
+    std::ofstream(work_dir + "/receiver.conf") << "GNSS-SDR.internal_fs_sps=4000000\n";
+
+    const Batch_Runner runner(gnss_sdr, work_dir + "/out", {}, 2, 0.0);
+    const auto results = runner.run({{"one", work_dir + "/receiver.conf", ""},
+        {"two", work_dir + "/missing.conf", ""}});
+    ASSERT_EQ(results.size(), 2U);
+    EXPECT_EQ(results[0].exit_code, 3);
+    EXPECT_FALSE(results[0].ok());
+    ASSERT_EQ(results[0].outputs.size(), 1U);
+    EXPECT_EQ(results[0].outputs[0], "result.txt");
+    EXPECT_FALSE(results[1].ok());
+
+    std::ostringstream summary;
+    Batch_Runner::write_summary(results, summary);
+    EXPECT_EQ(summary.str().find("name,status,exit_code,elapsed_s,outputs\none,failed,3,"), 0U);
+    EXPECT_NE(summary.str().find(",result.txt\ntwo,failed,-1,"), std::string::npos);
+}
+
+
+TEST_F(BatchRunnerTest, TimedOutJobsAreKilled)
+{
+    // The script ignores SIGTERM
+    const std::string gnss_sdr = write_script("fake-gnss-sdr", "trap '' TERM\nsleep 30\n");
+    std::ofstream(work_dir + "/receiver.conf") << "GNSS-SDR.internal_fs_sps=4000000\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    const Batch_Runner runner(gnss_sdr, work_dir + "/out", {}, 1, 0.3, 0.3);
+    const auto results = runner.run({{"stuck", work_dir + "/receiver.conf", ""}});
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(results.size(), 1U);
+    EXPECT_TRUE(results[0].timed_out);
+    EXPECT_EQ(results[0].signal, SIGKILL);
+    EXPECT_LT(elapsed.count(), 10.0);
+}
@@ -0,0 +1,149 @@
+/*!
+ * \file monitor_fixed_format_test.cc
+ * \brief This file implements tests for the fixed-layout monitoring format
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "monitor_fixed_format.h"
+#include <string>
+
+
+TEST(MonitorFixedFormat, GnssSynchroRoundTrip)
+{
+    Fixed_Format_Writer<Gnss_Synchro_Record> writer(FIXED_FORMAT_GNSS_SYNCHRO);
+    std::string datagram;
+    writer.begin(datagram);
+    for (uint32_t prn = 1; prn <= 3; prn++)
+        {
+            Gnss_Synchro_Record r{};
+            r.System = 'G';
+            r.Signal[0] = '1';
+            r.Signal[1] = 'C';
+            r.flags = 0x1F;
+            r.PRN = prn;
+            r.Channel_ID = static_cast<int32_t>(prn) - 1;
+            r.Pseudorange_m = 22000002.1;
+            r.Tracking_sample_counter = 0x0102030405060708ULL;
+            r.interp_TOW_ms = 20.5;
+            writer.append(r);
+        }
+    writer.end();
+    EXPECT_EQ(datagram.size(), sizeof(Fixed_Format_Header) + 3 * sizeof(Gnss_Synchro_Record));
+
+    Fixed_Format_Reader reader;
+    ASSERT_TRUE(reader.parse(datagram));
+    EXPECT_EQ(reader.version(), FIXED_FORMAT_VERSION);
+    EXPECT_EQ(reader.record_type(), FIXED_FORMAT_GNSS_SYNCHRO);
+    ASSERT_EQ(reader.record_count(), 3U);
+    for (uint32_t i = 0; i < 3; i++)
+        {
+            Gnss_Synchro_Record r;
+            ASSERT_TRUE(reader.get(i, r));
+            EXPECT_EQ(r.System, 'G');
+            EXPECT_EQ(r.Signal[1], 'C');
+            EXPECT_EQ(r.flags, 0x1F);
+            EXPECT_EQ(r.PRN, i + 1);
+            EXPECT_EQ(r.Channel_ID, static_cast<int32_t>(i));
+            EXPECT_DOUBLE_EQ(r.Pseudorange_m, 22000002.1);
+            EXPECT_EQ(r.Tracking_sample_counter, 0x0102030405060708ULL);
+            EXPECT_DOUBLE_EQ(r.interp_TOW_ms, 20.5);
+        }
+    Gnss_Synchro_Record r;
+    EXPECT_FALSE(reader.get(3, r));
+    Monitor_Pvt_Record pvt;
+    EXPECT_FALSE(reader.get(0, pvt));
+
+    // Little-endian fields at fixed offsets
+    EXPECT_EQ(datagram.substr(0, 4), "GSMF");
+    EXPECT_EQ(static_cast<uint8_t>(datagram[sizeof(Fixed_Format_Header) + offsetof(Gnss_Synchro_Record, PRN)]), 1);
+    EXPECT_EQ(static_cast<uint8_t>(datagram[sizeof(Fixed_Format_Header) + offsetof(Gnss_Synchro_Record, Tracking_sample_counter)]), 0x08);
+}
+
+
+TEST(MonitorFixedFormat, WriterSplitsDatagrams)
+{
+    Fixed_Format_Writer<Monitor_Pvt_Record> writer(FIXED_FORMAT_MONITOR_PVT);
+    std::string datagram;
+    writer.begin(datagram);
+    Monitor_Pvt_Record r{};
+    r.latitude = 41.275;
+    int appended = 0;
+    while (!writer.full())
+        {
+            writer.append(r);
+            appended++;
+        }
+    EXPECT_EQ(appended, static_cast<int>((FIXED_FORMAT_MAX_DATAGRAM_SIZE - sizeof(Fixed_Format_Header)) / sizeof(Monitor_Pvt_Record)));
+    EXPECT_LE(datagram.size(), FIXED_FORMAT_MAX_DATAGRAM_SIZE);
+
+    Fixed_Format_Reader reader;
+    ASSERT_TRUE(reader.parse(datagram));
+    ASSERT_EQ(reader.record_count(), static_cast<size_t>(appended));
+    Monitor_Pvt_Record read;
+    ASSERT_TRUE(reader.get(appended - 1, read));
+    EXPECT_DOUBLE_EQ(read.latitude, 41.275);
+}
+
+
+TEST(MonitorFixedFormat, RejectsInvalidDatagrams)
+{
+    Fixed_Format_Writer<Monitor_Pvt_Record> writer(FIXED_FORMAT_MONITOR_PVT);
+    std::string datagram;
+    writer.begin(datagram);
+    writer.append(Monitor_Pvt_Record{});
+    writer.append(Monitor_Pvt_Record{});
+    writer.end();
+
+    Fixed_Format_Reader reader;
+    EXPECT_FALSE(reader.parse(datagram.substr(0, datagram.size() - 1)));
+    EXPECT_FALSE(reader.parse(datagram.substr(0, 8)));
+    EXPECT_EQ(reader.record_count(), 0U);
+    std::string protobuf_like = datagram;
+    protobuf_like[0] = 0x0a;
+    EXPECT_FALSE(reader.parse(protobuf_like));
+    EXPECT_TRUE(reader.parse(datagram));
+}
+
+
+TEST(MonitorFixedFormat, ReadsNewerRecords)
+{
+    // A newer version with 8 more bytes in each record and in the header
+    const uint16_t record_size = sizeof(Monitor_Pvt_Record) + 8;
+    Fixed_Format_Header header{};
+    std::memcpy(header.magic, FIXED_FORMAT_MAGIC, 4);
+    header.version = FIXED_FORMAT_VERSION + 1;
+    header.record_type = FIXED_FORMAT_MONITOR_PVT;
+    header.header_size = sizeof(Fixed_Format_Header) + 8;
+    header.record_size = record_size;
+    header.record_count = 2;
+    Fixed_Format_Byte_Order::swap(header);
+    std::string datagram(reinterpret_cast<const char*>(&header), sizeof(header));
+    datagram.append(8, '\xff');
+    for (uint32_t week = 2300; week < 2302; week++)
+        {
+            Monitor_Pvt_Record r{};
+            r.week = week;
+            r.user_clk_drift_ppm = 0.25;
+            Fixed_Format_Byte_Order::swap(r);
+            datagram.append(reinterpret_cast<const char*>(&r), sizeof(r));
+            datagram.append(8, '\xff');
+        }
+
+    Fixed_Format_Reader reader;
+    ASSERT_TRUE(reader.parse(datagram));
+    ASSERT_EQ(reader.record_count(), 2U);
+    Monitor_Pvt_Record r;
+    ASSERT_TRUE(reader.get(1, r));
+    EXPECT_EQ(r.week, 2301U);
+    EXPECT_DOUBLE_EQ(r.user_clk_drift_ppm, 0.25);
+}
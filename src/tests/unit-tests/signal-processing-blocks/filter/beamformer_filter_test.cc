@@ -0,0 +1,161 @@
+/*!
+ * \file beamformer_filter_test.cc
+ * \brief Implements Unit Tests for the beamformer and its adapter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "beamformer.h"
+#include "beamformer_filter.h"
+#include "in_memory_configuration.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <complex>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+namespace
+{
+// Noise on every element, plus a jammer with a random phase at each element
+std::vector<std::vector<gr_complex>> beamformer_array_samples(int n_channels, int n_samples, float jammer_amplitude)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 0.7071);
+    std::uniform_real_distribution<float> phase(-3.14159, 3.14159);
+    std::vector<gr_complex> steering(n_channels, gr_complex(1.0, 0.0));
+    for (int i = 1; i < n_channels; i++)
+        {
+            steering[i] = std::polar(1.0F, phase(gen));
+        }
+    std::vector<std::vector<gr_complex>> samples(n_channels, std::vector<gr_complex>(n_samples));
+    for (int n = 0; n < n_samples; n++)
+        {
+            const gr_complex jammer = std::polar(jammer_amplitude, phase(gen));
+            for (int i = 0; i < n_channels; i++)
+                {
+                    samples[i][n] = gr_complex(dist(gen), dist(gen)) + jammer * steering[i];
+                }
+        }
+    return samples;
+}
+}  // namespace
+
+
+TEST(BeamformerFilterTest, WeightsFromMessagePort)
+{
+    const int n_channels = 8;
+    const int n_samples = 10000;
+    const auto samples = beamformer_array_samples(n_channels, n_samples, 0.0);
+    std::vector<gr_complex> weights(n_channels);
+    for (int i = 0; i < n_channels; i++)
+        {
+            weights[i] = std::polar(1.0F / static_cast<float>(i + 1), 0.7F * static_cast<float>(i));
+        }
+
+    auto top_block = gr::make_top_block("Beamformer test");
+    auto beamformer = make_beamformer_sptr(n_channels, false, 16, 4096, 0.01);
+    auto sink = gr::blocks::vector_sink_c::make();
+    for (int i = 0; i < n_channels; i++)
+        {
+            top_block->connect(gr::blocks::vector_source_c::make(samples[i]), 0, beamformer, i);
+        }
+    top_block->connect(beamformer, 0, sink, 0);
+    // Used from the first call to work()
+    beamformer->set_weights(weights);
+    top_block->run();
+
+    const std::vector<gr_complex> out = sink->data();
+    ASSERT_EQ(out.size(), static_cast<size_t>(n_samples));
+    for (int n = 0; n < n_samples; n++)
+        {
+            gr_complex expected(0.0, 0.0);
+            for (int i = 0; i < n_channels; i++)
+                {
+                    expected += samples[i][n] * weights[i];
+                }
+            ASSERT_NEAR(std::abs(out[n] - expected), 0.0, 1e-4);
+        }
+}
+
+
+TEST(BeamformerFilterTest, AdapterBuildsTheAdaptiveBeamformer)
+{
+    const int n_channels = 8;
+    const int n_samples = 10000;
+    const auto samples = beamformer_array_samples(n_channels, n_samples, 0.0);
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("InputFilter.item_type", "gr_complex");
+    config->set_property("InputFilter.channels", std::to_string(n_channels));
+    config->set_property("InputFilter.adaptive", "true");
+    config->set_property("InputFilter.decimation", "4");
+    config->set_property("InputFilter.snapshots", "512");
+    config->set_property("InputFilter.diagonal_loading", "0.001");
+
+    auto top_block = gr::make_top_block("Beamformer test");
+    auto filter = std::make_shared<BeamformerFilter>(config.get(), "InputFilter", 1, 1);
+    auto sink = gr::blocks::vector_sink_c::make();
+    ASSERT_NO_THROW({
+        filter->connect(top_block);
+        for (int i = 0; i < n_channels; i++)
+            {
+                top_block->connect(gr::blocks::vector_source_c::make(samples[i]), 0, filter->get_left_block(), i);
+            }
+        top_block->connect(filter->get_right_block(), 0, sink, 0);
+    }) << "Failure connecting the top_block.";
+    top_block->run();
+    EXPECT_EQ(filter->implementation(), "Beamformer_Filter");
+    EXPECT_EQ(sink->data().size(), static_cast<size_t>(n_samples));
+}
+
+
+TEST(BeamformerFilterTest, AdaptiveWeightsCancelJammer)
+{
+    const int n_channels = 8;
+    const int n_samples = 100000;
+    const auto samples = beamformer_array_samples(n_channels, n_samples, 31.6);
+
+    // Without the estimator thread, the weights of the first block of
+    // snapshots are used from the next call to work()
+    auto top_block = gr::make_top_block("Beamformer test");
+    auto beamformer = make_beamformer_sptr(n_channels, true, 4, 512, 0.001, false);
+    auto sink = gr::blocks::vector_sink_c::make();
+    for (int i = 0; i < n_channels; i++)
+        {
+            top_block->connect(gr::blocks::vector_source_c::make(samples[i]), 0, beamformer, i);
+        }
+    top_block->connect(beamformer, 0, sink, 0);
+    top_block->run();
+
+    const std::vector<gr_complex> out = sink->data();
+    ASSERT_EQ(out.size(), static_cast<size_t>(n_samples));
+    EXPECT_NE(beamformer->weights(), std::vector<gr_complex>(n_channels, gr_complex(1.0, 0.0)));
+    double power_in = 0.0;
+    double power_out = 0.0;
+    for (int n = n_samples / 2; n < n_samples; n++)
+        {
+            power_in += std::norm(samples[0][n]);
+            power_out += std::norm(out[n]);
+        }
+    // A jammer 30 dB above the noise of the reference element is cancelled
+    // down to a few times that noise
+    EXPECT_GT(power_in, 500.0 * n_samples / 2);
+    EXPECT_LT(power_out, 5.0 * n_samples / 2);
+}
@@ -0,0 +1,377 @@
+/*!
+ * \file fused_conditioner_test.cc
+ * \brief Implements unit tests for the fused signal conditioner, checking it
+ * against the chain of data type adapter, filter and resampler.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "fused_conditioner.h"
+#include "gnss_block_factory.h"
+#include "gnss_block_interface.h"
+#include "in_memory_configuration.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#endif
+
+
+namespace
+{
+// Samples of each stage, as the blocks of the chain compute them
+
+std::vector<std::complex<float>> chain_convert(const std::string& item_type, const std::vector<int8_t>& bytes, bool inverted_spectrum)
+{
+    std::vector<std::complex<float>> x;
+    if (item_type == "ibyte")
+        {
+            for (size_t i = 0; i + 1 < bytes.size(); i += 2)
+                {
+                    x.emplace_back(bytes[i], bytes[i + 1]);
+                }
+        }
+    else
+        {
+            for (size_t i = 0; i + 3 < bytes.size(); i += 4)
+                {
+                    const auto re = static_cast<int16_t>(static_cast<uint8_t>(bytes[i]) | (static_cast<uint8_t>(bytes[i + 1]) << 8));
+                    const auto im = static_cast<int16_t>(static_cast<uint8_t>(bytes[i + 2]) | (static_cast<uint8_t>(bytes[i + 3]) << 8));
+                    x.emplace_back(re, im);
+                }
+        }
+    if (inverted_spectrum)
+        {
+            for (auto& sample : x)
+                {
+                    sample = std::conj(sample);
+                }
+        }
+    return x;
+}
+
+
+std::vector<std::complex<float>> chain_filter(const std::vector<std::complex<float>>& x, const std::vector<float>& taps,
+    int decimation, double intermediate_freq, double sampling_freq)
+{
+    const int ntaps = static_cast<int>(taps.size());
+    const double w = TWO_PI * intermediate_freq / sampling_freq;
+    std::vector<std::complex<float>> padded(ntaps - 1);
+    padded.insert(padded.end(), x.begin(), x.end());
+    std::vector<std::complex<float>> y;
+    std::complex<double> phasor(1.0, 0.0);
+    for (size_t start = 0; start + ntaps <= padded.size(); start += decimation)
+        {
+            std::complex<double> acc(0.0, 0.0);
+            for (int i = 0; i < ntaps; i++)
+                {
+                    const int k = ntaps - 1 - i;
+                    acc += std::complex<double>(padded[start + i]) * static_cast<double>(taps[k]) * std::exp(std::complex<double>(0.0, w * k));
+                }
+            y.emplace_back(acc * phasor);
+            phasor *= std::exp(std::complex<double>(0.0, -w * decimation));
+        }
+    return y;
+}
+
+
+std::vector<std::complex<float>> chain_resample(const std::vector<std::complex<float>>& y, double fs_in, double fs_out)
+{
+    const double two_32 = 4294967296.0;
+    std::vector<std::complex<float>> out;
+    uint32_t phase = 0;
+    uint32_t lphase = 0;
+    if (fs_in >= fs_out)
+        {
+            const auto phase_step = static_cast<uint32_t>(std::floor(two_32 * fs_out / fs_in));
+            for (const auto& sample : y)
+                {
+                    if (phase <= lphase)
+                        {
+                            out.push_back(sample);
+                        }
+                    lphase = phase;
+                    phase += phase_step;
+                }
+            return out;
+        }
+    const auto phase_step = static_cast<uint32_t>(std::floor(two_32 * fs_in / fs_out));
+    size_t n = 0;
+    while (true)
+        {
+            lphase = phase;
+            phase += phase_step;
+            if (phase <= lphase)
+                {
+                    n++;
+                }
+            if (n == y.size())
+                {
+                    break;
+                }
+            out.push_back(y[n]);
+        }
+    return out;
+}
+
+
+std::vector<int8_t> random_input(size_t nbytes)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(-128, 127);
+    std::vector<int8_t> bytes(nbytes);
+    for (auto& byte : bytes)
+        {
+            byte = static_cast<int8_t>(dist(gen));
+        }
+    return bytes;
+}
+
+
+std::vector<float> random_taps(int ntaps)
+{
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> dist(-0.5F, 0.5F);
+    std::vector<float> taps(ntaps);
+    for (auto& tap : taps)
+        {
+            tap = dist(gen);
+        }
+    return taps;
+}
+
+
+// Runs the fused conditioner with input and output blocks of random sizes
+std::vector<std::complex<float>> run_fused(Fused_Conditioner& conditioner, const std::vector<int8_t>& bytes)
+{
+    std::mt19937 gen(99);
+    std::uniform_int_distribution<int> block_size(1, 10000);
+    const int nitems = static_cast<int>(bytes.size() / conditioner.input_item_size());
+    std::vector<std::complex<float>> out;
+    int pos = 0;
+    int idle = 0;
+    while (idle < 3)
+        {
+            const int ninput = std::min(nitems - pos, block_size(gen));
+            std::vector<std::complex<float>> buffer(block_size(gen));
+            int consumed = 0;
+            const int produced = conditioner.process(bytes.data() + pos * conditioner.input_item_size(), ninput, buffer.data(), static_cast<int>(buffer.size()), consumed);
+            out.insert(out.end(), buffer.begin(), buffer.begin() + produced);
+            pos += consumed;
+            idle = (produced == 0 && consumed == 0) ? idle + 1 : 0;
+        }
+    EXPECT_EQ(pos, nitems);
+    return out;
+}
+
+
+// Builds the signal conditioner with the factory, as the receiver does, and
+// runs it on the input with a GNU Radio flowgraph
+std::vector<std::complex<float>> run_factory_conditioner(const std::map<std::string, std::string>& properties,
+    const std::string& implementation, const std::vector<int8_t>& bytes, size_t input_item_size)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    for (const auto& property : properties)
+        {
+            config->set_property(property.first, property.second);
+        }
+    config->set_property("SignalConditioner.implementation", implementation);
+    GNSSBlockFactory factory;
+    auto conditioner = factory.GetSignalConditioner(config.get());
+    EXPECT_EQ(conditioner->implementation(), implementation);
+    EXPECT_EQ(conditioner->get_left_block()->input_signature()->sizeof_stream_item(0), static_cast<int>(input_item_size));
+
+    auto top_block = gr::make_top_block("FusedConditionerFactoryTest");
+    auto source = gr::blocks::vector_source_b::make(std::vector<unsigned char>(bytes.begin(), bytes.end()), false, input_item_size);
+    auto sink = gr::blocks::vector_sink_c::make();
+    conditioner->connect(top_block);
+    top_block->connect(source, 0, conditioner->get_left_block(), 0);
+    top_block->connect(conditioner->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+// The fused conditioner and the chain of blocks, configured with the same
+// properties, give the same output (but maybe for the last sample, when the
+// input ends)
+void expect_factory_conditioners_match(const std::map<std::string, std::string>& properties,
+    const std::vector<int8_t>& bytes, size_t input_item_size)
+{
+    const auto chain = run_factory_conditioner(properties, "Signal_Conditioner", bytes, input_item_size);
+    const auto fused = run_factory_conditioner(properties, "Fused_Signal_Conditioner", bytes, input_item_size);
+    ASSERT_GT(chain.size(), 1000U);
+    ASSERT_LE(std::max(chain.size(), fused.size()) - std::min(chain.size(), fused.size()), 1U);
+    for (size_t i = 0; i < std::min(chain.size(), fused.size()); i++)
+        {
+            const float tolerance = 1e-3F * (std::abs(chain[i]) + 1.0F);
+            ASSERT_NEAR(chain[i].real(), fused[i].real(), tolerance) << "at sample " << i;
+            ASSERT_NEAR(chain[i].imag(), fused[i].imag(), tolerance) << "at sample " << i;
+        }
+}
+
+
+const std::map<std::string, std::string> FUSED_TEST_BANDPASS_FILTER = {
+    {"InputFilter.taps_item_type", "float"},
+    {"InputFilter.number_of_taps", "31"},
+    {"InputFilter.number_of_bands", "2"},
+    {"InputFilter.band1_begin", "0.0"},
+    {"InputFilter.band1_end", "0.45"},
+    {"InputFilter.band2_begin", "0.55"},
+    {"InputFilter.band2_end", "1.0"},
+    {"InputFilter.ampl1_begin", "1.0"},
+    {"InputFilter.ampl1_end", "1.0"},
+    {"InputFilter.ampl2_begin", "0.0"},
+    {"InputFilter.ampl2_end", "0.0"},
+    {"InputFilter.band1_error", "1.0"},
+    {"InputFilter.band2_error", "1.0"},
+    {"InputFilter.filter_type", "bandpass"},
+    {"InputFilter.grid_density", "16"}};
+
+
+void expect_same_samples(const std::vector<std::complex<float>>& expected, const std::vector<std::complex<float>>& actual, float tolerance)
+{
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        {
+            ASSERT_NEAR(expected[i].real(), actual[i].real(), tolerance) << "at sample " << i;
+            ASSERT_NEAR(expected[i].imag(), actual[i].imag(), tolerance) << "at sample " << i;
+        }
+}
+}  // namespace
+
+
+TEST(FusedConditionerTest, IshortFirFilter)
+{
+    const std::vector<int8_t> bytes = random_input(4 * 50000);
+    const std::vector<float> taps = random_taps(31);
+    Fused_Conditioner conditioner("ishort", false, taps, 1, 0.0, 4e6, 0.0, 0.0);
+
+    const auto expected = chain_filter(chain_convert("ishort", bytes, false), taps, 1, 0.0, 4e6);
+    expect_same_samples(expected, run_fused(conditioner, bytes), 1.0F);
+}
+
+
+TEST(FusedConditionerTest, IbyteFreqXlatingDecimationAndResampler)
+{
+    const std::vector<int8_t> bytes = random_input(2 * 80000);
+    const std::vector<float> taps = random_taps(24);
+    Fused_Conditioner conditioner("ibyte", true, taps, 4, 1.25e6, 8e6, 2e6, 1.5e6);
+    EXPECT_DOUBLE_EQ(conditioner.relative_rate(), 0.25 * 0.75);
+
+    const auto filtered = chain_filter(chain_convert("ibyte", bytes, true), taps, 4, 1.25e6, 8e6);
+    expect_same_samples(chain_resample(filtered, 2e6, 1.5e6), run_fused(conditioner, bytes), 0.1F);
+}
+
+
+TEST(FusedConditionerTest, CshortUpsamplingWithoutFilter)
+{
+    const std::vector<int8_t> bytes = random_input(4 * 30000);
+    Fused_Conditioner conditioner("cshort", false, std::vector<float>(), 1, 0.0, 4e6, 4e6, 5e6);
+
+    const auto expected = chain_resample(chain_convert("cshort", bytes, false), 4e6, 5e6);
+    expect_same_samples(expected, run_fused(conditioner, bytes), 0.0F);
+}
+
+
+TEST(FusedConditionerTest, DecimationLargerThanTheFilter)
+{
+    const std::vector<int8_t> bytes = random_input(2 * 50000);
+    const std::vector<float> taps = random_taps(5);
+    Fused_Conditioner conditioner("cbyte", false, taps, 8, -0.5e6, 4e6, 0.0, 0.0);
+
+    const auto expected = chain_filter(chain_convert("ibyte", bytes, false), taps, 8, -0.5e6, 4e6);
+    expect_same_samples(expected, run_fused(conditioner, bytes), 0.1F);
+}
+
+
+TEST(FusedConditionerTest, UnknownInputType)
+{
+    EXPECT_THROW(Fused_Conditioner("float", false, std::vector<float>(), 1, 0.0, 4e6, 0.0, 0.0), std::invalid_argument);
+}
+
+
+TEST(FusedConditionerTest, FactoryIshortFirFilterAndResampler)
+{
+    auto properties = FUSED_TEST_BANDPASS_FILTER;
+    properties["GNSS-SDR.internal_fs_sps"] = "3000000";
+    properties["DataTypeAdapter.implementation"] = "Ishort_To_Complex";
+    properties["InputFilter.implementation"] = "Fir_Filter";
+    properties["InputFilter.input_item_type"] = "gr_complex";
+    properties["InputFilter.output_item_type"] = "gr_complex";
+    properties["Resampler.implementation"] = "Direct_Resampler";
+    properties["Resampler.item_type"] = "gr_complex";
+    properties["Resampler.sample_freq_in"] = "4000000";
+    properties["Resampler.sample_freq_out"] = "3000000";
+    expect_factory_conditioners_match(properties, random_input(4 * 40000), sizeof(int16_t));
+}
+
+
+TEST(FusedConditionerTest, FactoryIbyteFreqXlatingFilter)
+{
+    auto properties = FUSED_TEST_BANDPASS_FILTER;
+    properties["DataTypeAdapter.implementation"] = "Ibyte_To_Complex";
+    properties["DataTypeAdapter.inverted_spectrum"] = "true";
+    properties["InputFilter.implementation"] = "Freq_Xlating_Fir_Filter";
+    properties["InputFilter.input_item_type"] = "gr_complex";
+    properties["InputFilter.output_item_type"] = "gr_complex";
+    properties["InputFilter.IF"] = "1250000";
+    properties["InputFilter.sampling_frequency"] = "8000000";
+    properties["InputFilter.decimation_factor"] = "2";
+    properties["Resampler.implementation"] = "Pass_Through";
+    properties["Resampler.item_type"] = "gr_complex";
+    expect_factory_conditioners_match(properties, random_input(2 * 40000), sizeof(int8_t));
+}
+
+
+TEST(FusedConditionerTest, FactoryCshortFirFilter)
+{
+    auto properties = FUSED_TEST_BANDPASS_FILTER;
+    properties["DataTypeAdapter.implementation"] = "Pass_Through";
+    properties["DataTypeAdapter.item_type"] = "cshort";
+    properties["InputFilter.implementation"] = "Fir_Filter";
+    properties["InputFilter.input_item_type"] = "cshort";
+    properties["InputFilter.output_item_type"] = "gr_complex";
+    properties["Resampler.implementation"] = "Pass_Through";
+    properties["Resampler.item_type"] = "gr_complex";
+    expect_factory_conditioners_match(properties, random_input(4 * 40000), 2 * sizeof(int16_t));
+}
+
+
+TEST(FusedConditionerTest, FactoryFallsBackToTheChain)
+{
+    // Notch filters have no fused form
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("SignalConditioner.implementation", "Fused_Signal_Conditioner");
+    config->set_property("DataTypeAdapter.implementation", "Pass_Through");
+    config->set_property("DataTypeAdapter.item_type", "gr_complex");
+    config->set_property("InputFilter.implementation", "Notch_Filter");
+    config->set_property("InputFilter.item_type", "gr_complex");
+    config->set_property("Resampler.implementation", "Pass_Through");
+    config->set_property("Resampler.item_type", "gr_complex");
+    GNSSBlockFactory factory;
+    const auto conditioner = factory.GetSignalConditioner(config.get());
+    ASSERT_NE(conditioner, nullptr);
+    EXPECT_EQ(conditioner->implementation(), "Signal_Conditioner");
+}
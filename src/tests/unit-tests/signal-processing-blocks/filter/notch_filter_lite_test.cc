@@ -26,6 +26,7 @@
 #else
 #include <gnuradio/analog/sig_source_c.h>
 #endif
+#include "MATH_CONSTANTS.h"
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
 #include "gnss_block_factory.h"
@@ -36,6 +37,15 @@
 #include "notch_filter_lite.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
 
 
 DEFINE_int32(notch_filter_lite_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
@@ -205,3 +215,54 @@ TEST_F(NotchFilterLiteTest, ConnectAndRunGrcomplex)
     ch_thread.join();
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+// Amplitude of the tone of normalized frequency f in the second half of x
+double notch_lite_tone_amplitude(const std::vector<gr_complex>& x, double f)
+{
+    std::complex<double> sum(0.0, 0.0);
+    const size_t start = x.size() / 2;
+    for (size_t n = start; n < x.size(); n++)
+        {
+            sum += std::complex<double>(x[n]) * std::polar(1.0, -2.0 * GNSS_PI * f * static_cast<double>(n));
+        }
+    return std::abs(sum) / static_cast<double>(x.size() - start);
+}
+
+
+TEST_F(NotchFilterLiteTest, TwoJammersTwoNotches)
+{
+    const int n_samples = 400000;
+    const double f1 = 0.05;
+    const double f2 = -0.13;
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<gr_complex> samples(n_samples);
+    for (int n = 0; n < n_samples; n++)
+        {
+            samples[n] = gr_complex(dist(gen), dist(gen)) +
+                         gr_complex(std::polar(20.0, 2.0 * GNSS_PI * f1 * n)) +
+                         gr_complex(std::polar(10.0, 2.0 * GNSS_PI * f2 * n));
+        }
+
+    init();
+    configure_gr_complex_gr_complex();
+    config->set_property("InputFilter.pfa", "0.001");
+    config->set_property("InputFilter.segments_est", "100");
+    config->set_property("InputFilter.notches", "2");
+    top_block = gr::make_top_block("Notch filter lite test");
+    auto filter = std::make_shared<NotchFilterLite>(config.get(), "InputFilter", 1, 1);
+    auto sink = gr::blocks::vector_sink_c::make();
+    ASSERT_NO_THROW({
+        filter->connect(top_block);
+        top_block->connect(gr::blocks::vector_source_c::make(samples), 0, filter->get_left_block(), 0);
+        top_block->connect(filter->get_right_block(), 0, sink, 0);
+    }) << "Failure connecting the top_block.";
+    top_block->run();
+
+    const std::vector<gr_complex> filtered = sink->data();
+    ASSERT_GT(filtered.size(), static_cast<size_t>(n_samples / 2));
+    // Both jammers attenuated by more than 20 dB
+    EXPECT_LT(notch_lite_tone_amplitude(filtered, f1), 0.1 * notch_lite_tone_amplitude(samples, f1));
+    EXPECT_LT(notch_lite_tone_amplitude(filtered, f2), 0.1 * notch_lite_tone_amplitude(samples, f2));
+}
@@ -34,8 +34,11 @@
 #include "gnss_sdr_valve.h"
 #include "in_memory_configuration.h"
 #include "notch_filter.h"
+#include "notch_section.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
 
 
 DEFINE_int32(notch_filter_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
@@ -203,3 +206,39 @@ TEST_F(NotchFilterTest, ConnectAndRunGrcomplex)
     ch_thread.join();
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+// The section solves the recursion by chunks. Its output must be the one of
+// the sample by sample recursion with phasors exp(j atan2()).
+TEST(NotchSectionTest, SameAsPerSampleRecursion)
+{
+    const float p_c_factor = 0.9;
+    for (int32_t length : {32, 30, 17, 8})
+        {
+            std::mt19937 gen(length);
+            std::normal_distribution<float> dist(0.0, 1.0);
+            const int32_t n_segments = 50;
+            std::vector<gr_complex> in(length * n_segments + 1);
+            for (auto& sample : in)
+                {
+                    sample = gr_complex(dist(gen), dist(gen));
+                }
+            std::vector<gr_complex> phasors(length);
+            std::vector<gr_complex> out(length);
+            Notch_Section section(length);
+            gr_complex last_out(0.0, 0.0);
+            for (int32_t segment = 0; segment < n_segments; segment++)
+                {
+                    const gr_complex* x = &in[segment * length + 1];
+                    Notch_Section::phasors(x, phasors.data(), length);
+                    section.filter(x, phasors.data(), p_c_factor, out.data());
+                    for (int32_t n = 0; n < length; n++)
+                        {
+                            const gr_complex z_0 = std::exp(gr_complex(0.0, 1.0) * std::arg(x[n] * std::conj(x[n - 1])));
+                            last_out = x[n] - z_0 * x[n - 1] + p_c_factor * z_0 * last_out;
+                            ASSERT_NEAR(out[n].real(), last_out.real(), 1e-4) << "length " << length << ", segment " << segment << ", sample " << n;
+                            ASSERT_NEAR(out[n].imag(), last_out.imag(), 1e-4) << "length " << length << ", segment " << segment << ", sample " << n;
+                        }
+                }
+        }
+}
@@ -0,0 +1,259 @@
+/*!
+ * \file polyphase_fir_filter_test.cc
+ * \brief Implements unit tests for the polyphase FIR decimator, checking it
+ * against a direct FIR filter, and for its adapter.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "in_memory_configuration.h"
+#include "polyphase_fir_decimator.h"
+#include "polyphase_fir_filter.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+
+
+namespace
+{
+const int POLYPHASE_TEST_SAMPLES = 60000;
+
+
+std::vector<float> polyphase_test_taps(int ntaps)
+{
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<float> dist(-0.5F, 0.5F);
+    std::vector<float> taps(ntaps);
+    for (auto& tap : taps)
+        {
+            tap = dist(gen);
+        }
+    return taps;
+}
+
+
+// Samples with integer values in [-max_value, max_value]
+std::vector<gr_complex> polyphase_test_samples(int nsamples, int max_value)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(-max_value, max_value);
+    std::vector<gr_complex> x(nsamples);
+    for (auto& sample : x)
+        {
+            sample = gr_complex(static_cast<float>(dist(gen)), static_cast<float>(dist(gen)));
+        }
+    return x;
+}
+
+
+// Outputs of a FIR filter starting at x[0], as gr::filter::fir_filter_ccf computes them
+std::vector<gr_complex> direct_fir(const std::vector<gr_complex>& x, const std::vector<float>& taps, int decimation)
+{
+    const int ntaps = static_cast<int>(taps.size());
+    std::vector<gr_complex> y;
+    for (size_t start = 0; start + ntaps <= x.size(); start += decimation)
+        {
+            std::complex<double> acc(0.0, 0.0);
+            for (int k = 0; k < ntaps; k++)
+                {
+                    acc += std::complex<double>(x[start + k]) * static_cast<double>(taps[ntaps - 1 - k]);
+                }
+            y.emplace_back(acc);
+        }
+    return y;
+}
+
+
+std::vector<gr_complex> run_decimator(const std::string& item_type, const std::vector<gr_complex>& x, const polyphase_fir_decimator_sptr& decimator)
+{
+    auto top_block = gr::make_top_block("PolyphaseFirFilterTest");
+    auto sink = gr::blocks::vector_sink_c::make();
+    // "ishort" and "ibyte" streams have one item per component
+    const int vlen = item_type[0] == 'i' ? 1 : 2;
+    if (item_type == "cshort" || item_type == "ishort")
+        {
+            std::vector<int16_t> samples;
+            for (const auto& sample : x)
+                {
+                    samples.push_back(static_cast<int16_t>(sample.real()));
+                    samples.push_back(static_cast<int16_t>(sample.imag()));
+                }
+            top_block->connect(gr::blocks::vector_source_s::make(samples, false, vlen), 0, decimator, 0);
+        }
+    else if (item_type == "cbyte" || item_type == "ibyte")
+        {
+            std::vector<uint8_t> samples;
+            for (const auto& sample : x)
+                {
+                    samples.push_back(static_cast<uint8_t>(static_cast<int8_t>(sample.real())));
+                    samples.push_back(static_cast<uint8_t>(static_cast<int8_t>(sample.imag())));
+                }
+            top_block->connect(gr::blocks::vector_source_b::make(samples, false, vlen), 0, decimator, 0);
+        }
+    else
+        {
+            top_block->connect(gr::blocks::vector_source_c::make(x), 0, decimator, 0);
+        }
+    top_block->connect(decimator, 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+void expect_close_samples(const std::vector<gr_complex>& expected, const std::vector<gr_complex>& actual, float tolerance)
+{
+    ASSERT_GE(expected.size(), actual.size());
+    ASSERT_GT(actual.size(), expected.size() * 9 / 10);
+    for (size_t i = 0; i < actual.size(); i++)
+        {
+            ASSERT_NEAR(expected[i].real(), actual[i].real(), tolerance) << "at sample " << i;
+            ASSERT_NEAR(expected[i].imag(), actual[i].imag(), tolerance) << "at sample " << i;
+        }
+}
+}  // namespace
+
+
+TEST(PolyphaseFirFilterTest, CshortDecimation)
+{
+    const std::vector<gr_complex> x = polyphase_test_samples(POLYPHASE_TEST_SAMPLES, 2000);
+    const std::vector<float> taps = polyphase_test_taps(31);
+    auto decimator = make_polyphase_fir_decimator("cshort", taps, 3, std::vector<float>(), 0);
+
+    // The block starts with history() - 1 zeros, as GNU Radio filters do
+    std::vector<gr_complex> padded(decimator->history() - 1);
+    padded.insert(padded.end(), x.begin(), x.end());
+    expect_close_samples(direct_fir(padded, taps, 3), run_decimator("cshort", x, decimator), 0.01F);
+}
+
+
+TEST(PolyphaseFirFilterTest, CbyteHalfbandCascade)
+{
+    const std::vector<gr_complex> x = polyphase_test_samples(POLYPHASE_TEST_SAMPLES, 127);
+    const std::vector<float> taps = polyphase_test_taps(17);
+    const std::vector<float> halfband = {0.03F, 0.0F, -0.09F, 0.0F, 0.31F, 0.5F, 0.31F, 0.0F, -0.09F, 0.0F, 0.03F};
+    auto decimator = make_polyphase_fir_decimator("cbyte", taps, 3, halfband, 2);
+    EXPECT_EQ(decimator->decimation(), 12U);
+
+    std::vector<gr_complex> expected(decimator->history() - 1);
+    expected.insert(expected.end(), x.begin(), x.end());
+    expected = direct_fir(direct_fir(direct_fir(expected, halfband, 2), halfband, 2), taps, 3);
+    expect_close_samples(expected, run_decimator("cbyte", x, decimator), 0.001F);
+}
+
+
+TEST(PolyphaseFirFilterTest, InterleavedSamples)
+{
+    const std::vector<gr_complex> x = polyphase_test_samples(POLYPHASE_TEST_SAMPLES, 127);
+    const std::vector<float> taps = polyphase_test_taps(16);
+    const std::vector<float> halfband = {0.03F, 0.0F, -0.09F, 0.0F, 0.31F, 0.5F, 0.31F, 0.0F, -0.09F, 0.0F, 0.03F};
+    for (const auto& item_type : {"ishort", "ibyte"})
+        {
+            // The same outputs as with one item per complex sample
+            auto pairs = make_polyphase_fir_decimator(item_type[1] == 's' ? "cshort" : "cbyte", taps, 3, std::vector<float>(), 0);
+            auto interleaved = make_polyphase_fir_decimator(item_type, taps, 3, std::vector<float>(), 0);
+            EXPECT_EQ(interleaved->decimation(), 6U);
+            const std::vector<gr_complex> expected = run_decimator(item_type[1] == 's' ? "cshort" : "cbyte", x, pairs);
+            expect_close_samples(expected, run_decimator(item_type, x, interleaved), 0.0F);
+
+            auto halfband_pairs = make_polyphase_fir_decimator(item_type[1] == 's' ? "cshort" : "cbyte", taps, 3, halfband, 1);
+            auto halfband_interleaved = make_polyphase_fir_decimator(item_type, taps, 3, halfband, 1);
+            const std::vector<gr_complex> halfband_expected = run_decimator(item_type[1] == 's' ? "cshort" : "cbyte", x, halfband_pairs);
+            expect_close_samples(halfband_expected, run_decimator(item_type, x, halfband_interleaved), 0.0F);
+        }
+}
+
+
+TEST(PolyphaseFirFilterTest, GrComplexWithoutTaps)
+{
+    const std::vector<gr_complex> x = polyphase_test_samples(POLYPHASE_TEST_SAMPLES, 2000);
+    auto decimator = make_polyphase_fir_decimator("gr_complex", std::vector<float>(), 5, std::vector<float>(), 0);
+    EXPECT_EQ(decimator->history(), 1U);
+
+    std::vector<gr_complex> expected;
+    for (size_t i = 0; i < x.size(); i += 5)
+        {
+            expected.push_back(x[i]);
+        }
+    expect_close_samples(expected, run_decimator("gr_complex", x, decimator), 0.0F);
+}
+
+
+TEST(PolyphaseFirFilterTest, AdapterHalfbandCascade)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("InputFilter.input_item_type", "cshort");
+    config->set_property("InputFilter.output_item_type", "gr_complex");
+    config->set_property("InputFilter.decimation_factor", "12");
+    config->set_property("InputFilter.halfband_cascade", "true");
+    config->set_property("InputFilter.filter_type", "lowpass");
+    config->set_property("InputFilter.sampling_frequency", "48000000");
+    config->set_property("InputFilter.bw", "1500000");
+    config->set_property("InputFilter.tw", "500000");
+    PolyphaseFirFilter filter(config.get(), "InputFilter", 1, 1);
+    EXPECT_EQ(filter.implementation(), "Polyphase_Fir_Filter");
+    EXPECT_EQ(filter.item_size(), sizeof(int16_t) * 2);
+
+    auto top_block = gr::make_top_block("PolyphaseFirFilterTest");
+    auto sink = gr::blocks::vector_sink_c::make();
+    const std::vector<int16_t> samples(2 * POLYPHASE_TEST_SAMPLES, 100);
+    top_block->connect(gr::blocks::vector_source_s::make(samples, false, 2), 0, filter.get_left_block(), 0);
+    filter.connect(top_block);
+    top_block->connect(filter.get_right_block(), 0, sink, 0);
+    top_block->run();
+
+    // A constant input ends up at the DC gain of the filters, close to one
+    const std::vector<gr_complex> y = sink->data();
+    ASSERT_GT(y.size(), POLYPHASE_TEST_SAMPLES / 12 - 10);
+    EXPECT_NEAR(y.back().real(), 100.0F, 5.0F);
+    EXPECT_NEAR(y.back().imag(), 100.0F, 5.0F);
+}
+
+
+TEST(PolyphaseFirFilterTest, AdapterItemSize)
+{
+    const std::vector<std::pair<std::string, size_t>> item_sizes = {
+        {"gr_complex", sizeof(gr_complex)}, {"cshort", 2 * sizeof(int16_t)}, {"ishort", sizeof(int16_t)},
+        {"cbyte", 2 * sizeof(int8_t)}, {"ibyte", sizeof(int8_t)}, {"float", 0}};
+    for (const auto& item_size : item_sizes)
+        {
+            auto config = std::make_shared<InMemoryConfiguration>();
+            config->set_property("InputFilter.input_item_type", item_size.first);
+            config->set_property("InputFilter.output_item_type", "gr_complex");
+            config->set_property("InputFilter.filter_type", "lowpass");
+            PolyphaseFirFilter filter(config.get(), "InputFilter", 1, 1);
+            EXPECT_EQ(filter.item_size(), item_size.second) << item_size.first;
+        }
+}
+
+
+TEST(PolyphaseFirFilterTest, AdapterUnsupportedOutput)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("InputFilter.input_item_type", "cshort");
+    config->set_property("InputFilter.output_item_type", "cshort");
+    PolyphaseFirFilter filter(config.get(), "InputFilter", 1, 1);
+    EXPECT_EQ(filter.item_size(), 0U);
+}
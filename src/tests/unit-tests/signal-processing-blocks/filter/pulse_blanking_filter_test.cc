@@ -26,6 +26,7 @@
 #else
 #include <gnuradio/analog/sig_source_c.h>
 #endif
+#include "MATH_CONSTANTS.h"
 #include "concurrent_queue.h"
 #include "file_signal_source.h"
 #include "gnss_block_factory.h"
@@ -36,6 +37,15 @@
 #include "pulse_blanking_filter.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
 
 
 DEFINE_int32(pb_filter_test_nsamples, 1000000, "Number of samples to filter in the tests (max: 2147483647)");
@@ -200,3 +210,116 @@ TEST_F(PulseBlankingFilterTest, ConnectAndRunGrcomplex)
     ch_thread.join();
     std::cout << "Filtered " << nsamples << " gr_complex samples in " << elapsed_seconds.count() * 1e6 << " microseconds\n";
 }
+
+
+// Noise with pulses of 25 samples every 997 samples after the first 20000
+std::vector<gr_complex> pulse_blanking_pulsed_samples(int n_samples)
+{
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<gr_complex> samples(n_samples);
+    for (int n = 0; n < n_samples; n++)
+        {
+            samples[n] = gr_complex(dist(gen), dist(gen));
+        }
+    for (int start = 20000; start + 25 < n_samples; start += 997)
+        {
+            for (int k = 0; k < 25; k++)
+                {
+                    samples[start + k] += std::polar(30.0F, 0.4F * static_cast<float>(k));
+                }
+        }
+    return samples;
+}
+
+
+std::vector<gr_complex> pulse_blanking_run(const std::shared_ptr<InMemoryConfiguration>& config, const std::vector<gr_complex>& samples)
+{
+    auto top_block = gr::make_top_block("Pulse Blanking filter test");
+    auto filter = std::make_shared<PulseBlankingFilter>(config.get(), "InputFilter", 1, 1);
+    auto sink = gr::blocks::vector_sink_c::make();
+    filter->connect(top_block);
+    top_block->connect(gr::blocks::vector_source_c::make(samples), 0, filter->get_left_block(), 0);
+    top_block->connect(filter->get_right_block(), 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+TEST_F(PulseBlankingFilterTest, SlidingWindowBlanksPulses)
+{
+    const int n_samples = 200000;
+    const auto samples = pulse_blanking_pulsed_samples(n_samples);
+    init();
+    configure_gr_complex_gr_complex();
+    config->set_property("InputFilter.pfa", "0.0001");
+    config->set_property("InputFilter.segments_est", "100");
+
+    const std::vector<gr_complex> segment_out = pulse_blanking_run(config, samples);
+    config->set_property("InputFilter.blanking", "sliding");
+    config->set_property("InputFilter.overlap", "16");
+    const std::vector<gr_complex> sliding_out = pulse_blanking_run(config, samples);
+    ASSERT_GT(segment_out.size(), static_cast<size_t>(n_samples - 1000));
+    ASSERT_GT(sliding_out.size(), static_cast<size_t>(n_samples - 1000));
+
+    // The sliding output is delayed by the look-ahead of the window
+    const int delay = 16;
+    double energy_in = 0.0;
+    double energy_segment = 0.0;
+    double energy_sliding = 0.0;
+    for (int start = 20000; start + 25 + delay < static_cast<int>(sliding_out.size()); start += 997)
+        {
+            for (int k = 0; k < 25; k++)
+                {
+                    energy_in += std::norm(samples[start + k]);
+                    energy_segment += std::norm(segment_out[start + k]);
+                    energy_sliding += std::norm(sliding_out[start + k + delay]);
+                }
+        }
+    EXPECT_LT(energy_segment, 0.01 * energy_in);
+    EXPECT_LT(energy_sliding, 0.01 * energy_in);
+    // Nothing is blanked while the noise floor is estimated
+    for (int n = 0; n < 1000; n++)
+        {
+            EXPECT_EQ(sliding_out[n + delay], samples[n]);
+        }
+}
+
+
+TEST_F(PulseBlankingFilterTest, FrequencyDomainRemovesTone)
+{
+    const int n_samples = 200000;
+    const double f = 4.0 / 32.0;
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    std::vector<gr_complex> samples(n_samples);
+    for (int n = 0; n < n_samples; n++)
+        {
+            samples[n] = gr_complex(dist(gen), dist(gen));
+            if (n >= n_samples / 4)
+                {
+                    samples[n] += gr_complex(std::polar(5.0, 2.0 * GNSS_PI * f * n));
+                }
+        }
+    init();
+    configure_gr_complex_gr_complex();
+    config->set_property("InputFilter.pfa", "0.001");
+    config->set_property("InputFilter.segments_est", "100");
+    config->set_property("InputFilter.blanking", "frequency");
+    const std::vector<gr_complex> filtered = pulse_blanking_run(config, samples);
+    ASSERT_GT(filtered.size(), static_cast<size_t>(n_samples - 1000));
+
+    std::complex<double> tone(0.0, 0.0);
+    double noise_power = 0.0;
+    const int start = n_samples / 2;
+    for (int n = start; n < static_cast<int>(filtered.size()); n++)
+        {
+            tone += std::complex<double>(filtered[n]) * std::polar(1.0, -2.0 * GNSS_PI * f * n);
+            noise_power += std::norm(filtered[n]);
+        }
+    const double n_out = static_cast<double>(filtered.size() - start);
+    // The tone is gone and most of the noise is kept
+    EXPECT_LT(std::abs(tone) / n_out, 0.05);
+    EXPECT_GT(noise_power / n_out, 1.5);
+    EXPECT_LT(noise_power / n_out, 2.5);
+}
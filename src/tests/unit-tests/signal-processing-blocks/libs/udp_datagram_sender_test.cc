@@ -0,0 +1,124 @@
+/*!
+ * \file udp_datagram_sender_test.cc
+ * \brief This file implements unit tests for the Udp_Datagram_Sender class,
+ * receiving its datagrams on the loopback interface.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include <boost/asio.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include <vector>
+
+
+class UdpDatagramSenderTest : public ::testing::Test
+{
+protected:
+    UdpDatagramSenderTest() : receiver(io_context)
+    {
+        const boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string("127.0.0.1"), 0);
+        receiver.open(endpoint.protocol());
+        receiver.set_option(boost::asio::socket_base::receive_buffer_size(1 << 20));
+        receiver.bind(endpoint);
+        port = receiver.local_endpoint().port();
+    }
+
+    // Returns the datagrams waiting in the receiver socket, in arrival order
+    std::vector<std::string> received()
+    {
+        std::vector<std::string> datagrams;
+        std::array<char, 1500> buf{};
+        receiver.non_blocking(true);
+        while (true)
+            {
+                boost::system::error_code error;
+                const size_t n = receiver.receive(boost::asio::buffer(buf), 0, error);
+                if (error)
+                    {
+                        break;
+                    }
+                datagrams.emplace_back(buf.data(), n);
+            }
+        return datagrams;
+    }
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+    boost::asio::io_context io_context;
+#else
+    boost::asio::io_service io_context;
+#endif
+    boost::asio::ip::udp::socket receiver;
+    uint16_t port{0};
+};
+
+
+TEST_F(UdpDatagramSenderTest, BatchesArriveInOrder)
+{
+    // More than two sendmmsg() batches, with an incomplete one at the end
+    const size_t n = 2 * Udp_Datagram_Sender::max_batch_size + 22;
+    {
+        Udp_Datagram_Sender sender({"127.0.0.1"}, port);
+        for (size_t i = 0; i < n; i++)
+            {
+                if (i % 2 == 0)
+                    {
+                        sender.stream() << "datagram " << i;
+                    }
+                else
+                    {
+                        sender.buffer() = "datagram " + std::to_string(i) + std::string(i, 'x');
+                    }
+                EXPECT_TRUE(sender.queue());
+            }
+        EXPECT_TRUE(sender.flush());
+        sender.stream() << "last";
+        EXPECT_TRUE(sender.send());
+    }
+
+    const auto datagrams = received();
+    ASSERT_EQ(datagrams.size(), n + 1);
+    for (size_t i = 0; i < n; i++)
+        {
+            const std::string expected = "datagram " + std::to_string(i) + (i % 2 == 0 ? std::string() : std::string(i, 'x'));
+            EXPECT_EQ(datagrams[i], expected);
+        }
+    EXPECT_EQ(datagrams[n], "last");
+}
+
+
+TEST_F(UdpDatagramSenderTest, SenderThreadKeepsTheOrder)
+{
+    const size_t n = 500;
+    {
+        Udp_Datagram_Sender sender({"127.0.0.1"}, port, true);
+        for (size_t i = 0; i < n; i++)
+            {
+                sender.stream() << i;
+                EXPECT_TRUE(sender.queue());
+                if (i % 10 == 9)
+                    {
+                        EXPECT_TRUE(sender.flush());
+                    }
+            }
+        EXPECT_EQ(sender.get_dropped(), 0U);
+        // the destructor sends what is still queued
+    }
+
+    const auto datagrams = received();
+    ASSERT_EQ(datagrams.size(), n);
+    for (size_t i = 0; i < n; i++)
+        {
+            EXPECT_EQ(datagrams[i], std::to_string(i));
+        }
+}
@@ -0,0 +1,82 @@
+/*!
+ * \file pvt_output_writer_test.cc
+ * \brief Implements Unit Tests for the Pvt_Output_Writer class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_writer.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+
+TEST(PvtOutputWriterTest, KeepsOrderAndDrainsOnDestruction)
+{
+    std::vector<int> written;
+    {
+        Pvt_Output_Writer writer(4, Pvt_Output_Writer::Policy::block);
+        const int sink = writer.add_sink("test");
+        for (int i = 0; i < 100; i++)
+            {
+                EXPECT_TRUE(writer.publish(sink, [&written, i]() { written.push_back(i); }));
+            }
+        writer.flush();
+        const Pvt_Output_Stats stats = writer.get_stats(sink);
+        EXPECT_EQ(stats.published, 100U);
+        EXPECT_EQ(stats.written, 100U);
+        EXPECT_EQ(stats.dropped, 0U);
+        EXPECT_EQ(stats.backlog, 0U);
+        EXPECT_LE(stats.max_backlog, 4U);
+        for (int i = 100; i < 110; i++)
+            {
+                writer.publish(sink, [&written, i]() { written.push_back(i); });
+            }
+    }
+    ASSERT_EQ(written.size(), 110U);
+    for (int i = 0; i < 110; i++)
+        {
+            EXPECT_EQ(written[i], i);
+        }
+}
+
+
+TEST(PvtOutputWriterTest, DropPolicy)
+{
+    std::atomic<bool> release{false};
+    std::atomic<int> count{0};
+    Pvt_Output_Writer writer(4, Pvt_Output_Writer::Policy::drop);
+    const int sink = writer.add_sink("slow");
+    // the first job stalls the writer thread, the next four fill the queue
+    int accepted = 0;
+    for (int i = 0; i < 20; i++)
+        {
+            if (writer.publish(sink, [&]() {
+                    while (!release.load())
+                        {
+                            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                        }
+                    count++;
+                }))
+                {
+                    accepted++;
+                }
+        }
+    release = true;
+    writer.flush();
+    const Pvt_Output_Stats stats = writer.get_stats(sink);
+    EXPECT_LE(accepted, 5);
+    EXPECT_EQ(count.load(), accepted);
+    EXPECT_EQ(stats.dropped, static_cast<uint64_t>(20 - accepted));
+    EXPECT_EQ(stats.written, static_cast<uint64_t>(accepted));
+    EXPECT_FALSE(writer.publish(sink + 1, []() {}));
+}
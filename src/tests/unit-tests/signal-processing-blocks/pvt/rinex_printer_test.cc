@@ -497,6 +497,82 @@ TEST_F(RinexPrinterTest, GalileoObsLog)
 }
 
 
+TEST_F(RinexPrinterTest, GalileoObsHeaderUpdate)
+{
+    auto eph = Galileo_Ephemeris();
+    eph.PRN = 1;
+    auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, "filename", false, false);
+    pvt_solution->galileo_ephemeris_map[1] = eph;
+    pvt_solution->galileo_utc_model.A0 = 1e-9;
+    pvt_solution->galileo_utc_model.Delta_tLS = 18;
+    pvt_solution->galileo_utc_model.Delta_tLSF = 18;
+    std::map<int, Gnss_Synchro> gnss_observables_map;
+
+    Gnss_Synchro gs = Gnss_Synchro();
+    std::string sys = "E";
+    gs.System = *sys.c_str();
+    std::string sig = "1B";
+    std::memcpy(static_cast<void*>(gs.Signal), sig.c_str(), 3);
+    gs.PRN = 22;
+    gs.Pseudorange_m = 22000000;
+    gs.Carrier_phase_rads = 23.4;
+    gs.Carrier_Doppler_hz = 1534;
+    gs.CN0_dB_hz = 42;
+    gnss_observables_map.insert(std::pair<int, Gnss_Synchro>(1, gs));
+
+    // The first call writes the header, logs an epoch and updates the header
+    // with the UTC model. The second one logs another epoch after the update.
+    auto rp = std::make_shared<Rinex_Printer>();
+    rp->print_rinex_annotation(pvt_solution.get(), gnss_observables_map, 0.0, 4, true);
+    rp->print_rinex_annotation(pvt_solution.get(), gnss_observables_map, 1.0, 4, true);
+
+    std::string obsfile = rp->get_obsfilename();
+    std::string navfile = rp->get_navfilename()[0];
+
+    rp = nullptr;  // close the RINEX files so we can inspect them
+
+    std::fstream fstr(obsfile.c_str(), std::fstream::in);
+    std::string line_str;
+    std::string previous_line;
+    std::string leap_line;
+    int blank_comments = 0;
+    int data_lines = 0;
+    bool in_header = true;
+    while (std::getline(fstr, line_str))
+        {
+            if (in_header)
+                {
+                    if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                        {
+                            leap_line = line_str;
+                            EXPECT_NE(std::string::npos, previous_line.find("TIME OF FIRST OBS", 59));
+                        }
+                    if (line_str == std::string(60, ' ') + "COMMENT             ")
+                        {
+                            blank_comments++;
+                        }
+                    if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                        {
+                            in_header = false;
+                        }
+                    previous_line = line_str;
+                }
+            else if (line_str.find("E22", 0) != std::string::npos)
+                {
+                    data_lines++;
+                }
+        }
+    std::string expected_str("    18    18     0     0                                    LEAP SECONDS        ");
+    EXPECT_EQ(0, expected_str.compare(leap_line));
+    EXPECT_EQ(0, blank_comments);
+    EXPECT_EQ(2, data_lines);
+    EXPECT_FALSE(in_header);
+    fstr.close();
+    fs::remove(obsfile);
+    fs::remove(navfile);
+}
+
+
 TEST_F(RinexPrinterTest, GlonassObsLog)
 {
     std::string line_aux;
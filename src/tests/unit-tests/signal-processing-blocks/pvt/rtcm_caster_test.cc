@@ -0,0 +1,200 @@
+/*!
+ * \file rtcm_caster_test.cc
+ * \brief This file implements unit tests for the Rtcm_Caster class
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#include "rtcm.h"
+#include "rtcm_caster.h"
+#include <boost/asio.hpp>
+#include <array>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+// Connects to the caster, optionally sends a request, and reads until
+// the expected number of bytes arrive or the timeout expires.
+std::string rtcm_caster_test_client(uint16_t port, const std::string& request, size_t bytes, std::chrono::milliseconds timeout)
+{
+    Rtcm_Caster::b_io_context io_context;
+    boost::asio::ip::tcp::socket socket(io_context);
+    socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), port));
+    if (!request.empty())
+        {
+            boost::asio::write(socket, boost::asio::buffer(request));
+        }
+    std::string received;
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    std::array<char, 4096> buf{};
+    while (received.size() < bytes && std::chrono::steady_clock::now() < deadline)
+        {
+            if (socket.available() == 0)
+                {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                    continue;
+                }
+            boost::system::error_code ec;
+            const size_t n = socket.read_some(boost::asio::buffer(buf), ec);
+            if (ec)
+                {
+                    break;
+                }
+            received.append(buf.data(), n);
+        }
+    return received;
+}
+
+
+std::string rtcm_caster_test_frame(Rtcm& rtcm, uint32_t type)
+{
+    // A minimal frame with the message number in the first 12 bits
+    std::string frame = rtcm.bin_to_binary_data(rtcm.hex_to_bin("D30002"));
+    frame.push_back(static_cast<char>(type >> 4));
+    frame.push_back(static_cast<char>((type & 0xF) << 4));
+    frame.append(3, '\0');
+    return frame;
+}
+}  // namespace
+
+
+TEST(RtcmCasterTest, MessageType)
+{
+    auto rtcm = std::make_shared<Rtcm>(2111);
+    EXPECT_EQ(1005U, Rtcm_Caster::message_type(rtcm->print_MT1005_test()));
+    EXPECT_EQ(1077U, Rtcm_Caster::message_type(rtcm_caster_test_frame(*rtcm, 1077)));
+    EXPECT_EQ(0U, Rtcm_Caster::message_type("Hello"));
+    EXPECT_EQ(0U, Rtcm_Caster::message_type(std::string()));
+}
+
+
+TEST(RtcmCasterTest, Mountpoints)
+{
+    Rtcm_Caster::b_io_context io_context;
+    Rtcm_Caster caster(io_context, 2112);
+    EXPECT_TRUE(caster.add_mountpoints("MSM7:1005,1077,1087;EPH:1019,1020;ALL"));
+    EXPECT_TRUE(caster.add_mountpoints(""));
+    EXPECT_FALSE(caster.add_mountpoints("BAD:1005,abc"));
+    EXPECT_FALSE(caster.add_mountpoints("BAD:5000"));
+    EXPECT_FALSE(caster.add_mountpoints(":1005"));
+}
+
+
+TEST(RtcmCasterTest, NtripMountpoint)
+{
+    Rtcm_Caster::b_io_context io_context;
+    Rtcm_Caster caster(io_context, 2113);
+    caster.add_mountpoints("EPH:1019,1020");
+    std::thread t([&] { io_context.run(); });
+
+    auto rtcm = std::make_shared<Rtcm>(2114);
+    const std::string mt1019 = rtcm_caster_test_frame(*rtcm, 1019);
+    const std::string mt1077 = rtcm_caster_test_frame(*rtcm, 1077);
+    const std::string ok("ICY 200 OK\r\n\r\n");
+    std::thread publisher([&] {
+        for (int i = 0; i < 40; i++)
+            {
+                caster.publish(mt1077);
+                caster.publish(mt1019);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+    });
+    const std::string received = rtcm_caster_test_client(2113, "GET /EPH HTTP/1.0\r\nUser-Agent: NTRIP test\r\n\r\n", ok.size() + 4 * mt1019.size(), std::chrono::milliseconds(2000));
+    publisher.join();
+
+    ASSERT_EQ(ok.size() + 4 * mt1019.size(), received.size());
+    EXPECT_EQ(ok, received.substr(0, ok.size()));
+    for (size_t i = ok.size(); i < received.size(); i += mt1019.size())
+        {
+            EXPECT_EQ(mt1019, received.substr(i, mt1019.size()));
+        }
+
+    const std::string table = rtcm_caster_test_client(2113, "GET / HTTP/1.0\r\n\r\n", 4096, std::chrono::milliseconds(500));
+    EXPECT_EQ(0U, table.find("SOURCETABLE 200 OK\r\n"));
+    EXPECT_NE(std::string::npos, table.find("STR;EPH;EPH;RTCM 3.2;1019,1020;"));
+    EXPECT_NE(std::string::npos, table.find("ENDSOURCETABLE\r\n"));
+
+    const Rtcm_Caster::Stats stats = caster.get_stats();
+    EXPECT_EQ(80U, stats.published_messages);
+    EXPECT_EQ(0U, stats.dropped_messages);
+    EXPECT_GE(stats.sent_messages, 5U);
+
+    io_context.stop();
+    t.join();
+    caster.close();
+}
+
+
+TEST(RtcmCasterTest, RawClient)
+{
+    auto rtcm = std::make_shared<Rtcm>(2115);
+    rtcm->run_server();
+    const std::string msg = rtcm->print_MT1005_test();
+    std::thread publisher([&] {
+        for (int i = 0; i < 200; i++)
+            {
+                rtcm->send_message(msg);
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+    });
+    // Clients that send no request get all the messages after request_timeout_ms
+    const std::string received = rtcm_caster_test_client(2115, std::string(), 3 * msg.size(), std::chrono::milliseconds(Rtcm_Caster::request_timeout_ms + 1000));
+    publisher.join();
+    ASSERT_EQ(3 * msg.size(), received.size());
+    EXPECT_EQ(msg + msg + msg, received);
+    EXPECT_TRUE(rtcm->check_CRC(received.substr(0, msg.size())));
+    rtcm->stop_server();
+}
+
+
+TEST(RtcmCasterTest, SlowClientIsBounded)
+{
+    Rtcm_Caster::b_io_context io_context;
+    Rtcm_Caster caster(io_context, 2116, 8);
+    std::thread t([&] { io_context.run(); });
+
+    // A client that never reads
+    Rtcm_Caster::b_io_context client_context;
+    boost::asio::ip::tcp::socket socket(client_context);
+    socket.connect(boost::asio::ip::tcp::endpoint(boost::asio::ip::address_v4::loopback(), 2116));
+    std::this_thread::sleep_for(std::chrono::milliseconds(Rtcm_Caster::request_timeout_ms + 200));
+
+    // Enough data to fill the socket buffers
+    const std::string frame(1024, 'x');
+    const int n = 50000;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < n; i++)
+        {
+            caster.publish(frame);
+        }
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_LT(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count(), 2000);
+
+    Rtcm_Caster::Stats stats{};
+    for (int i = 0; i < 200 && stats.published_messages < static_cast<uint64_t>(n); i++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            stats = caster.get_stats();
+        }
+    EXPECT_EQ(static_cast<uint64_t>(n), stats.published_messages);
+    EXPECT_EQ(1U, stats.clients);
+    EXPECT_GT(stats.dropped_messages, 0U);
+    EXPECT_LE(stats.sent_messages + stats.dropped_messages, static_cast<uint64_t>(n));
+    EXPECT_GE(stats.sent_messages + stats.dropped_messages + 8, static_cast<uint64_t>(n));
+
+    io_context.stop();
+    t.join();
+    caster.close();
+}
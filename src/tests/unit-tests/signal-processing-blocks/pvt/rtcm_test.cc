@@ -17,7 +17,9 @@
 
 
 #include "Galileo_INAV.h"
+#include "MATH_CONSTANTS.h"
 #include "rtcm.h"
+#include <bitset>
 #include <memory>
 #include <thread>
 
@@ -296,6 +298,85 @@ TEST(RtcmTest, MT1020)
 }
 
 
+TEST(RtcmTest, MT1020SignedFields)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    Glonass_Gnav_Ephemeris gnav_ephemeris = Glonass_Gnav_Ephemeris();
+    Glonass_Gnav_Utc_Model gnav_utc_model = Glonass_Gnav_Utc_Model();
+    Glonass_Gnav_Ephemeris gnav_ephemeris_read = Glonass_Gnav_Ephemeris();
+    Glonass_Gnav_Utc_Model gnav_utc_model_read = Glonass_Gnav_Utc_Model();
+
+    // GLONASS fields are sign-magnitude
+    gnav_ephemeris.d_Xn = -3700.684;
+    gnav_ephemeris.d_Yn = 12129.537;
+    gnav_ephemeris.d_VZn = -1.800687;
+    gnav_ephemeris.d_tau_n = -6.577745e-05;
+    gnav_ephemeris.d_gamma_n = -1.818989e-10;
+    // except tau_c, which is two's complement
+    gnav_utc_model.d_tau_c = -0.2368;
+    gnav_utc_model.d_tau_gps = -1.1920929e-04;
+    // 23 h 37 m, where the 5-bit hour field has its most significant bit set
+    gnav_ephemeris.d_t_k = 85020;
+
+    std::string tx_msg = rtcm->print_MT1020(gnav_ephemeris, gnav_utc_model);
+    EXPECT_EQ(0, rtcm->read_MT1020(tx_msg, gnav_ephemeris_read, gnav_utc_model_read));
+    EXPECT_NEAR(gnav_ephemeris.d_Xn, gnav_ephemeris_read.d_Xn, 1e-3);
+    EXPECT_NEAR(gnav_ephemeris.d_Yn, gnav_ephemeris_read.d_Yn, 1e-3);
+    EXPECT_NEAR(gnav_ephemeris.d_VZn, gnav_ephemeris_read.d_VZn, 1e-6);
+    EXPECT_NEAR(gnav_ephemeris.d_tau_n, gnav_ephemeris_read.d_tau_n, 1e-8);
+    EXPECT_NEAR(gnav_ephemeris.d_gamma_n, gnav_ephemeris_read.d_gamma_n, TWO_N40);
+    EXPECT_NEAR(gnav_utc_model.d_tau_c, gnav_utc_model_read.d_tau_c, TWO_N31);
+    EXPECT_NEAR(gnav_utc_model.d_tau_gps, gnav_utc_model_read.d_tau_gps, TWO_N30);
+    EXPECT_DOUBLE_EQ(gnav_ephemeris.d_t_k, gnav_ephemeris_read.d_t_k);
+}
+
+
+TEST(RtcmTest, BitStream)
+{
+    Rtcm_Bit_Writer writer;
+    writer.put(0x5, 3);
+    writer << std::bitset<12>(0xABC);
+    writer.put(0x1234567890ULL, 38);
+    writer << std::bitset<70>(std::string("1") + std::string(68, '0') + "1");
+    EXPECT_EQ(writer.size_bits(), 123U);
+    EXPECT_EQ(writer.size_bytes(), 16U);
+
+    Rtcm_Bit_Writer appended;
+    appended.put(1, 1);
+    appended << writer;
+    EXPECT_EQ(appended.size_bits(), 124U);
+
+    Rtcm_Bit_Reader reader(appended.data(), appended.size_bytes());
+    EXPECT_TRUE(reader.read_bool());
+    EXPECT_EQ(reader.read_uint(3), 0x5U);
+    EXPECT_EQ(reader.read_uint(12), 0xABCU);
+    EXPECT_EQ(reader.read_int(38), 0x1234567890LL);
+    EXPECT_EQ(reader.read_uint(1), 1U);
+    reader.skip(68);
+    EXPECT_EQ(reader.read_uint(1), 1U);
+    EXPECT_EQ(reader.remaining_bits(), 4U);
+    EXPECT_EQ(reader.read_uint(4), 0U);  // padding
+    EXPECT_TRUE(reader.ok());
+    EXPECT_EQ(reader.read_uint(1), 0U);
+    EXPECT_FALSE(reader.ok());
+
+    writer.clear();
+    writer.put(0x3FE, 10);  // -2 in two's complement
+    writer.put(0x202, 10);  // -2 in sign-magnitude
+    std::string bytes(reinterpret_cast<const char*>(writer.data()), writer.size_bytes());
+    Rtcm_Bit_Reader signed_reader(bytes);
+    EXPECT_EQ(signed_reader.read_int(10), -2);
+    EXPECT_EQ(signed_reader.read_sint(10), -2);
+}
+
+
+TEST(RtcmTest, MT1005Frame)
+{
+    auto rtcm = std::make_shared<Rtcm>();
+    EXPECT_EQ("D300133ED7D30202980EDEEF34B4BD62AC0941986F33360B98", rtcm->bin_to_hex(rtcm->binary_data_to_bin(rtcm->print_MT1005_test())));
+}
+
+
 TEST(RtcmTest, MT1029)
 {
     auto rtcm = std::make_shared<Rtcm>();
@@ -0,0 +1,190 @@
+/*!
+ * \file interpolating_resampler_test.cc
+ * \brief Tests for the resampler that computes the input positions of a block
+ * of outputs at once.
+ *
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "direct_resampler_conditioner.h"
+#include "direct_resampler_conditioner_cc.h"
+#include "direct_resampler_conditioner_cs.h"
+#include "in_memory_configuration.h"
+#include "interpolating_resampler.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <volk/volk.h>  // for lv_16sc_t
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_sink_s.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#include <gnuradio/blocks/vector_source_s.h>
+#endif
+
+
+namespace
+{
+const int RESAMPLER_TEST_SAMPLES = 100000;
+
+
+std::vector<gr_complex> resampler_test_noise(int nsamples)
+{
+    std::mt19937 gen(2468);
+    std::uniform_int_distribution<int> dist(-2000, 2000);
+    std::vector<gr_complex> x(nsamples);
+    for (auto& sample : x)
+        {
+            sample = gr_complex(static_cast<float>(dist(gen)), static_cast<float>(dist(gen)));
+        }
+    return x;
+}
+
+
+// Unit amplitude tone of normalized frequency f, evaluated at position t
+gr_complex resampler_test_tone(double f, double t)
+{
+    const double phase = 2.0 * M_PI * f * t;
+    return gr_complex(static_cast<float>(std::cos(phase)), static_cast<float>(std::sin(phase)));
+}
+
+
+std::vector<gr_complex> resampler_test_run_complex(gr::block_sptr resampler, const std::vector<gr_complex>& x)
+{
+    auto top_block = gr::make_top_block("interpolating_resampler_test");
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(gr::blocks::vector_source_c::make(x), 0, resampler, 0);
+    top_block->connect(resampler, 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+std::vector<int16_t> resampler_test_run_short(gr::block_sptr resampler, const std::vector<int16_t>& x)
+{
+    auto top_block = gr::make_top_block("interpolating_resampler_test");
+    auto sink = gr::blocks::vector_sink_s::make(2);
+    top_block->connect(gr::blocks::vector_source_s::make(x, false, 2), 0, resampler, 0);
+    top_block->connect(resampler, 0, sink, 0);
+    top_block->run();
+    return sink->data();
+}
+
+
+// The two resamplers may stop at slightly different points at the end of the
+// stream, so only the common part is compared
+template <typename T>
+void expect_same_resampled(const std::vector<T>& expected, const std::vector<T>& actual, size_t item_values)
+{
+    ASSERT_GT(expected.size(), 0U);
+    EXPECT_LE(std::max(expected.size(), actual.size()) - std::min(expected.size(), actual.size()), 2 * item_values);
+    const size_t n = std::min(expected.size(), actual.size());
+    for (size_t i = 0; i < n; i++)
+        {
+            ASSERT_EQ(expected[i], actual[i]) << "at value " << i;
+        }
+}
+
+
+void expect_tone_interpolated(const std::string& interpolation, double fs_in, double fs_out, float tolerance)
+{
+    const double f = 0.01;
+    const int delay = (interpolation == "cubic") ? 1 : 0;
+    std::vector<gr_complex> x(RESAMPLER_TEST_SAMPLES);
+    for (int i = 0; i < RESAMPLER_TEST_SAMPLES; i++)
+        {
+            x[i] = resampler_test_tone(f, i);
+        }
+    const std::vector<gr_complex> y = resampler_test_run_complex(make_interpolating_resampler("gr_complex", fs_in, fs_out, interpolation), x);
+    const double ratio = fs_in / fs_out;
+    EXPECT_NEAR(static_cast<double>(y.size()), RESAMPLER_TEST_SAMPLES / ratio, 4.0);
+    for (size_t k = 0; k < y.size(); k++)
+        {
+            const gr_complex expected = resampler_test_tone(f, delay + static_cast<double>(k) * ratio);
+            ASSERT_LT(std::abs(y[k] - expected), tolerance) << interpolation << " output " << k;
+        }
+}
+}  // namespace
+
+
+TEST(InterpolatingResamplerTest, NearestMatchesDirectResampler)
+{
+    const std::vector<gr_complex> x = resampler_test_noise(RESAMPLER_TEST_SAMPLES);
+    const double rates[][2] = {{4e6, 2.5e6}, {20e6, 2.046e6}, {2.046e6, 4e6}, {8e6, 4e6}};
+    for (const auto& rate : rates)
+        {
+            const std::vector<gr_complex> expected = resampler_test_run_complex(direct_resampler_make_conditioner_cc(rate[0], rate[1]), x);
+            const std::vector<gr_complex> actual = resampler_test_run_complex(make_interpolating_resampler("gr_complex", rate[0], rate[1], "nearest"), x);
+            expect_same_resampled(expected, actual, 1);
+        }
+}
+
+
+TEST(InterpolatingResamplerTest, CshortNearestMatchesDirectResampler)
+{
+    const std::vector<gr_complex> noise = resampler_test_noise(RESAMPLER_TEST_SAMPLES);
+    std::vector<int16_t> x;
+    for (const auto& sample : noise)
+        {
+            x.push_back(static_cast<int16_t>(sample.real()));
+            x.push_back(static_cast<int16_t>(sample.imag()));
+        }
+    const std::vector<int16_t> expected = resampler_test_run_short(direct_resampler_make_conditioner_cs(4e6, 2.5e6), x);
+    const std::vector<int16_t> actual = resampler_test_run_short(make_interpolating_resampler("cshort", 4e6, 2.5e6, "nearest"), x);
+    expect_same_resampled(expected, actual, 2);
+}
+
+
+TEST(InterpolatingResamplerTest, LinearInterpolation)
+{
+    expect_tone_interpolated("linear", 4e6, 2.5e6, 1e-3F);
+    expect_tone_interpolated("linear", 2.046e6, 4e6, 1e-3F);
+}
+
+
+TEST(InterpolatingResamplerTest, CubicInterpolation)
+{
+    expect_tone_interpolated("cubic", 4e6, 2.5e6, 2e-5F);
+    expect_tone_interpolated("cubic", 2.046e6, 4e6, 2e-5F);
+}
+
+
+TEST(InterpolatingResamplerTest, UnknownParameters)
+{
+    EXPECT_THROW(make_interpolating_resampler("ishort", 4e6, 2e6, "nearest"), std::invalid_argument);
+    EXPECT_THROW(make_interpolating_resampler("gr_complex", 4e6, 2e6, "sinc"), std::invalid_argument);
+}
+
+
+TEST(InterpolatingResamplerTest, AdapterInterpolation)
+{
+    auto config = std::make_shared<InMemoryConfiguration>();
+    config->set_property("GNSS-SDR.internal_fs_sps", "2500000");
+    config->set_property("Resampler.item_type", "cshort");
+    config->set_property("Resampler.sample_freq_in", "4000000");
+    config->set_property("Resampler.sample_freq_out", "2500000");
+    config->set_property("Resampler.interpolation", "cubic");
+    DirectResamplerConditioner resampler(config.get(), "Resampler", 1, 1);
+    EXPECT_EQ(resampler.item_size(), sizeof(lv_16sc_t));
+    EXPECT_EQ(resampler.get_left_block(), resampler.get_right_block());
+    EXPECT_TRUE(resampler.get_left_block() != nullptr);
+}
@@ -0,0 +1,116 @@
+/*!
+ * \file fifo_reader_test.cc
+ * \brief This file implements unit tests for the FifoReader custom block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fifo_reader.h"
+#include <gnuradio/blocks/head.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#endif
+
+
+class FifoReaderTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(mkfifo(fifo_name.c_str(), 0600), 0);
+    }
+
+    void TearDown() override
+    {
+        std::remove(fifo_name.c_str());
+    }
+
+    // Writes the bytes into the FIFO in chunks that split samples, and
+    // returns what the reader delivers
+    std::vector<gr_complex> run(const std::string& sample_type, const std::vector<char>& bytes, size_t items)
+    {
+        std::thread writer([&] {
+            const int fd = open(fifo_name.c_str(), O_WRONLY);
+            size_t written = 0;
+            while (written < bytes.size())
+                {
+                    const size_t chunk = std::min<size_t>(bytes.size() - written, 1001);
+                    const ssize_t result = write(fd, bytes.data() + written, chunk);
+                    if (result <= 0)
+                        {
+                            break;
+                        }
+                    written += static_cast<size_t>(result);
+                }
+            close(fd);
+        });
+        auto top_block = gr::make_top_block("FifoReaderTest");
+        auto source = FifoReader::make(fifo_name, sample_type);
+        auto head = gr::blocks::head::make(sizeof(gr_complex), items);
+        auto sink = gr::blocks::vector_sink_c::make();
+        top_block->connect(source, 0, head, 0);
+        top_block->connect(head, 0, sink, 0);
+        top_block->run();
+        writer.join();
+        return sink->data();
+    }
+
+    const std::string fifo_name = "./fifo_reader_test.fifo";
+};
+
+
+TEST_F(FifoReaderTest, InterleavedShortSamples)
+{
+    const size_t items = 10000;
+    std::vector<int16_t> samples(2 * items);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = static_cast<int16_t>(static_cast<int>(i % 2001) - 1000);
+        }
+    const auto* begin = reinterpret_cast<const char*>(samples.data());
+    const auto output = run("ishort", std::vector<char>(begin, begin + samples.size() * sizeof(int16_t)), items);
+    ASSERT_EQ(output.size(), items);
+    for (size_t n = 0; n < items; n++)
+        {
+            ASSERT_EQ(output[n], gr_complex(samples[2 * n], samples[2 * n + 1])) << "at sample " << n;
+        }
+}
+
+
+TEST_F(FifoReaderTest, RealByteSamples)
+{
+    const size_t items = 10000;
+    std::vector<char> samples(items);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = static_cast<char>(static_cast<int>(i % 255) - 127);
+        }
+    const auto output = run("byte", samples, items);
+    ASSERT_EQ(output.size(), items);
+    for (size_t n = 0; n < items; n++)
+        {
+            ASSERT_EQ(output[n], gr_complex(static_cast<int8_t>(samples[n]), 0.0)) << "at sample " << n;
+        }
+}
@@ -22,6 +22,11 @@
 #include <gnuradio/top_block.h>
 #include <gtest/gtest.h>
 #include <stdexcept>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#endif
 
 TEST(FileSignalSource, Instantiate)
 {
@@ -59,3 +64,39 @@ TEST(FileSignalSource, InstantiateFileNotExists)
     auto uptr = std::make_shared<FileSignalSource>(config.get(), "Test", 0, 1, queue.get());
     EXPECT_THROW({ uptr->connect(top); }, std::exception);
 }
+
+
+TEST(FileSignalSource, RepeatStopsAfterSamples)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    auto config = std::make_shared<InMemoryConfiguration>();
+
+    // The file has 8000 samples, so it is read two and a half times. A low
+    // sampling frequency keeps the tail excluded from the file short.
+    const uint64_t nsamples = 20000;
+    config->set_property("Test.samples", std::to_string(nsamples));
+    config->set_property("Test.sampling_frequency", "1000");
+    std::string path = std::string(TEST_PATH);
+    std::string filename = path + "signal_samples/GPS_L1_CA_ID_1_Fs_4Msps_2ms.dat";
+    config->set_property("Test.filename", filename);
+    config->set_property("Test.item_type", "gr_complex");
+    config->set_property("Test.repeat", "true");
+
+    auto top_block = gr::make_top_block("FileSignalSourceRepeatTest");
+    auto signal_source = std::make_shared<FileSignalSource>(config.get(), "Test", 0, 1, queue.get());
+    auto sink = gr::blocks::vector_sink_c::make();
+    signal_source->connect(top_block);
+    top_block->connect(signal_source->get_right_block(), 0, sink, 0);
+
+    // Without a control thread, run() only returns if the valve ends the stream
+    top_block->run();
+
+    const auto data = sink->data();
+    ASSERT_EQ(data.size(), nsamples);
+    for (size_t n = 8000; n < data.size(); n++)
+        {
+            ASSERT_EQ(data[n], data[n - 8000]) << "at sample " << n;
+        }
+    pmt::pmt_t msg;
+    EXPECT_TRUE(queue->timed_wait_and_pop(msg, 100));
+}
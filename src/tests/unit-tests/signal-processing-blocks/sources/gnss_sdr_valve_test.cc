@@ -26,7 +26,13 @@
 #endif
 #include "concurrent_queue.h"
 #include "gnss_sdr_valve.h"
+#include <gnuradio/blocks/head.h>
 #include <gnuradio/blocks/null_sink.h>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_f.h>
+#endif
 #include <pmt/pmt.h>
 
 TEST(ValveTest, CheckEventSentAfter100Samples)
@@ -52,3 +58,46 @@ TEST(ValveTest, CheckEventSentAfter100Samples)
     bool expected1 = true;
     EXPECT_EQ(expected1, queue->timed_wait_and_pop(msg, 100));
 }
+
+
+TEST(ValveTest, TapSendsEventAfter100SamplesWithoutStoppingTheData)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+
+    auto top_block = gr::make_top_block("gnss_sdr_valve_tap_test");
+
+    auto source = gr::analog::sig_source_f::make(100, gr::analog::GR_CONST_WAVE, 100, 1, 0);
+    auto head = gr::blocks::head::make(sizeof(float), 1000);
+    auto valve = gnss_sdr_make_valve_tap(sizeof(float), 100, queue.get());
+    auto sink = gr::blocks::vector_sink_f::make();
+
+    top_block->connect(source, 0, head, 0);
+    top_block->connect(head, 0, valve, 0);
+    top_block->connect(head, 0, sink, 0);
+
+    top_block->run();
+
+    // The event is sent once, and all the samples reach the sink
+    pmt::pmt_t msg;
+    EXPECT_TRUE(queue->timed_wait_and_pop(msg, 100));
+    EXPECT_FALSE(queue->timed_wait_and_pop(msg, 100));
+    EXPECT_EQ(sink->data().size(), 1000U);
+}
+
+
+TEST(ValveTest, TapWithStopFlowgraphEndsItsBranch)
+{
+    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+
+    auto top_block = gr::make_top_block("gnss_sdr_valve_tap_stop_test");
+
+    // The source never ends by itself, so run() only returns if the tap does
+    auto source = gr::analog::sig_source_f::make(100, gr::analog::GR_CONST_WAVE, 100, 1, 0);
+    auto valve = gnss_sdr_make_valve_tap(sizeof(float), 100, queue.get(), true);
+
+    top_block->connect(source, 0, valve, 0);
+    top_block->run();
+
+    pmt::pmt_t msg;
+    EXPECT_TRUE(queue->timed_wait_and_pop(msg, 100));
+}
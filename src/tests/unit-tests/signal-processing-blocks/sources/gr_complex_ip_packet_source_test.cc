@@ -0,0 +1,131 @@
+/*!
+ * \file gr_complex_ip_packet_source_test.cc
+ * \brief Implements Unit Tests for the UDP packet source, sending packets
+ * over the loopback interface.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gr_complex_ip_packet_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#endif
+
+
+namespace
+{
+// Sends the datagrams to the given port of the loopback interface
+void send_udp_packets(int port, const std::vector<std::vector<uint8_t>>& packets)
+{
+    const int sock = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    struct sockaddr_in destination
+    {
+    };
+    destination.sin_family = AF_INET;
+    destination.sin_port = htons(port);
+    destination.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    for (const auto& packet : packets)
+        {
+            sendto(sock, packet.data(), packet.size(), 0, reinterpret_cast<struct sockaddr*>(&destination), sizeof(destination));
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+    close(sock);
+}
+
+
+// Payload of a packet with two channels of interleaved byte samples,
+// starting with a big-endian sequence number
+std::vector<uint8_t> ip_packet_payload(uint32_t sequence, int samples_per_packet)
+{
+    std::vector<uint8_t> payload = {static_cast<uint8_t>(sequence >> 24), static_cast<uint8_t>(sequence >> 16),
+        static_cast<uint8_t>(sequence >> 8), static_cast<uint8_t>(sequence)};
+    for (int n = 0; n < samples_per_packet * 4; n++)
+        {
+            payload.push_back(static_cast<uint8_t>(sequence * 7 + n));
+        }
+    return payload;
+}
+}  // namespace
+
+
+TEST(GrComplexIpPacketSourceTest, BatchedCaptureWithSequenceGaps)
+{
+    const int port = 21234;
+    const int samples_per_packet = 256;
+    const int n_packets = 20;
+
+    // packet 5 is lost, and packet 2 arrives again at the end
+    std::vector<std::vector<uint8_t>> packets;
+    std::vector<std::vector<gr_complex>> expected(2);
+    for (int k = 0; k < n_packets; k++)
+        {
+            if (k == 5)
+                {
+                    continue;
+                }
+            packets.push_back(ip_packet_payload(k, samples_per_packet));
+            const auto* bytes = reinterpret_cast<const int8_t*>(packets.back().data() + 4);
+            for (int n = 0; n < samples_per_packet; n++)
+                {
+                    for (int ch = 0; ch < 2; ch++)
+                        {
+                            // without IQ_swap, the first byte of each sample is the imaginary part
+                            const int8_t first = bytes[4 * n + 2 * ch];
+                            const int8_t second = bytes[4 * n + 2 * ch + 1];
+                            expected[ch].emplace_back(second, first);
+                        }
+                }
+        }
+    packets.push_back(ip_packet_payload(2, samples_per_packet));
+
+    auto top_block = gr::make_top_block("GrComplexIpPacketSource test");
+    auto source = Gr_Complex_Ip_Packet_Source::make("lo", "127.0.0.1", port, 1028, 2, "cbyte", sizeof(gr_complex), false, "recvmmsg", true);
+    auto sink0 = gr::blocks::vector_sink_c::make();
+    auto sink1 = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, sink0, 0);
+    top_block->connect(source, 1, sink1, 0);
+
+    top_block->start();
+    send_udp_packets(port, packets);
+    const size_t total = expected[0].size();
+    for (int wait = 0; wait < 500 && (sink0->data().size() < total || sink1->data().size() < total); wait++)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+    top_block->stop();
+    top_block->wait();
+
+    EXPECT_EQ(source->received_packets(), static_cast<uint64_t>(n_packets));
+    EXPECT_EQ(source->lost_packets(), 1U);
+    EXPECT_EQ(source->out_of_order_packets(), 1U);
+    EXPECT_EQ(source->overflows(), 0U);
+    const auto out0 = sink0->data();
+    const auto out1 = sink1->data();
+    ASSERT_EQ(out0.size(), total);
+    ASSERT_EQ(out1.size(), total);
+    for (size_t n = 0; n < total; n++)
+        {
+            ASSERT_EQ(out0[n], expected[0][n]) << "at sample " << n;
+            ASSERT_EQ(out1[n], expected[1][n]) << "at sample " << n;
+        }
+}
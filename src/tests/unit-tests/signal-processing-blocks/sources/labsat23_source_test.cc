@@ -0,0 +1,156 @@
+/*!
+ * \file labsat23_source_test.cc
+ * \brief This file implements unit tests for the LabSat 2, 3 and 3 Wideband
+ * decoder, using small files written by the test.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "labsat23_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <pmt/pmt.h>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#endif
+
+
+namespace
+{
+std::vector<uint8_t> labsat23_random_bytes(size_t size)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(size);
+    for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+    return bytes;
+}
+
+
+// Runs the source until the end of the file, and returns the samples of each
+// selected channel
+std::vector<std::vector<gr_complex>> labsat23_run(const std::string& basename, const std::vector<int>& channel_selector)
+{
+    Concurrent_Queue<pmt::pmt_t> queue;
+    auto top_block = gr::make_top_block("Labsat23SourceTest");
+    auto source = labsat23_make_source_sptr(basename.c_str(), channel_selector, &queue, false);
+    std::vector<gr::blocks::vector_sink_c::sptr> sinks;
+    for (size_t ch = 0; ch < channel_selector.size(); ch++)
+        {
+            sinks.push_back(gr::blocks::vector_sink_c::make());
+            top_block->connect(source, ch, sinks.back(), 0);
+        }
+    top_block->run();
+    std::vector<std::vector<gr_complex>> output;
+    for (const auto& sink : sinks)
+        {
+            output.push_back(sink->data());
+        }
+    return output;
+}
+}  // namespace
+
+
+TEST(Labsat23SourceTest, Labsat3TwoBitSamples)
+{
+    const std::string basename = "./labsat23_source_test";
+    const std::string filename = basename + "_0000.LS3";
+
+    // Header: preamble, version, section 2 with 4 bits per sample on channel A
+    std::vector<uint8_t> header(1024, 0);
+    header[8] = 'L';
+    header[9] = 'S';
+    header[10] = '3';
+    header[13] = 0x04;  // header length, little-endian
+    header[16] = 2;     // section ID
+    header[23] = 4;     // bits per sample
+    header[24] = 3;     // channel A, 2 bit quantisation
+    header[27] = 255;   // no channel B
+    const auto samples = labsat23_random_bytes(2000);
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(header.data()), header.size());
+    file.write(reinterpret_cast<const char*>(samples.data()), samples.size());
+    file.close();
+
+    const auto output = labsat23_run(basename, {1});
+    std::remove(filename.c_str());
+
+    // Four samples per little-endian int16, from the most significant bits
+    const std::array<float, 4> levels{1.0, 2.0, -2.0, -1.0};
+    ASSERT_EQ(output[0].size(), samples.size() * 2);
+    for (size_t n = 0; n < output[0].size(); n++)
+        {
+            const unsigned int word = samples[2 * (n / 4)] | (samples[2 * (n / 4) + 1] << 8U);
+            const unsigned int bits = (word >> (12 - 4 * (n % 4))) & 0xFU;
+            const gr_complex expected(levels[((bits >> 2U) & 0x2U) | ((bits >> 1U) & 0x1U)],
+                levels[((bits >> 1U) & 0x2U) | (bits & 0x1U)]);
+            ASSERT_EQ(output[0][n], expected) << "at sample " << n;
+        }
+}
+
+
+TEST(Labsat23SourceTest, Labsat3WidebandThreeChannels)
+{
+    const std::string filename = "./labsat23_source_test.ls3w";
+    const std::string ini_filename = "./labsat23_source_test.ini";
+    const int registers = 1000;
+    const auto samples = labsat23_random_bytes(registers * 8);
+    std::ofstream file(filename, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(samples.data()), samples.size());
+    file.close();
+    std::ofstream ini_file(ini_filename);
+    ini_file << "[config]\nOSC=TCXO\nSMP=30000000\nQUA=2\nCHN=3\nSFT=12\n";
+    ini_file.close();
+
+    // Channels C and A, out of the three recorded ones
+    const auto output = labsat23_run(filename, {3, 1});
+    std::remove(filename.c_str());
+    std::remove(ini_filename.c_str());
+
+    // Five samples of the three channels in each little-endian 64-bit
+    // register, packed from the most significant bit after 4 spare bits
+    const std::array<float, 4> levels{0.5, 1.0, -1.0, -0.5};
+    const std::array<int, 2> channel_offsets{8, 0};
+    ASSERT_EQ(output.size(), 2U);
+    for (size_t ch = 0; ch < 2; ch++)
+        {
+            ASSERT_EQ(output[ch].size(), static_cast<size_t>(registers * 5));
+            for (int r = 0; r < registers; r++)
+                {
+                    uint64_t reg = 0;
+                    for (int k = 7; k >= 0; k--)
+                        {
+                            reg = (reg << 8U) | samples[8 * r + k];
+                        }
+                    for (int i = 0; i < 5; i++)
+                        {
+                            const int msb = 63 - 4 - i * 12 - channel_offsets[ch];
+                            const auto bits = static_cast<unsigned int>(reg >> (msb - 3)) & 0xFU;
+                            const gr_complex expected(levels[bits >> 2U], levels[bits & 0x3U]);
+                            ASSERT_EQ(output[ch][r * 5 + i], expected) << "at register " << r << ", sample " << i;
+                        }
+                }
+        }
+}
@@ -0,0 +1,158 @@
+/*!
+ * \file mmap_file_source_test.cc
+ * \brief This file implements unit tests for the mmap_file_source custom
+ * block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <gnuradio/blocks/head.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_i.h>
+#endif
+
+
+class MmapFileSourceTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        data.resize(1000);
+        for (size_t i = 0; i < data.size(); i++)
+            {
+                data[i] = static_cast<int32_t>(i);
+            }
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size() * sizeof(int32_t));
+        file.put(1);  // an incomplete item at the end
+    }
+
+    void TearDown() override
+    {
+        std::remove(filename.c_str());
+    }
+
+    // Items of vlen int32_t values
+    std::vector<int> run(const mmap_file_source_sptr& source, size_t items, int vlen = 1)
+    {
+        auto top_block = gr::make_top_block("MmapFileSourceTest");
+        auto sink = gr::blocks::vector_sink_i::make(vlen);
+        if (items > 0)
+            {
+                auto head = gr::blocks::head::make(sizeof(int32_t) * vlen, items);
+                top_block->connect(source, 0, head, 0);
+                top_block->connect(head, 0, sink, 0);
+            }
+        else
+            {
+                top_block->connect(source, 0, sink, 0);
+            }
+        top_block->run();
+        return sink->data();
+    }
+
+    static void write_counter(std::ofstream& file, int32_t first, int32_t count)
+    {
+        for (int32_t value = first; value < first + count; value++)
+            {
+                file.write(reinterpret_cast<const char*>(&value), sizeof(int32_t));
+            }
+    }
+
+    const std::string filename = "./mmap_file_source_test.dat";
+    std::vector<int32_t> data;
+};
+
+
+TEST_F(MmapFileSourceTest, ReadsWholeFile)
+{
+    const std::vector<int> read = run(make_mmap_file_source(sizeof(int32_t), filename, false), 0);
+    ASSERT_EQ(data.size(), read.size());
+    for (size_t i = 0; i < data.size(); i++)
+        {
+            EXPECT_EQ(data[i], read[i]);
+        }
+}
+
+
+TEST_F(MmapFileSourceTest, SeekAndRepeat)
+{
+    auto source = make_mmap_file_source(sizeof(int32_t), filename, true);
+    EXPECT_FALSE(source->seek(1001, SEEK_SET));
+    ASSERT_TRUE(source->seek(10, SEEK_SET));
+    const std::vector<int> read = run(source, 2500);
+    ASSERT_EQ(2500U, read.size());
+    // Repeating restarts from the beginning of the file, as gr::blocks::file_source does
+    for (size_t i = 0; i < read.size(); i++)
+        {
+            EXPECT_EQ(data[(i + 10) % data.size()], read[i]);
+        }
+}
+
+
+TEST_F(MmapFileSourceTest, ItemsAcrossSmallWindows)
+{
+    // Windows of one page, and 12-byte items, some of which straddle two windows
+    const std::string counter_filename = "./mmap_file_source_test_counter.dat";
+    const int32_t count = 3 * 12345;
+    {
+        std::ofstream file(counter_filename, std::ios::binary);
+        write_counter(file, 0, count);
+    }
+    const std::vector<int> read = run(make_mmap_file_source(3 * sizeof(int32_t), counter_filename, false, 1), 0, 3);
+    std::remove(counter_filename.c_str());
+    ASSERT_EQ(static_cast<size_t>(count), read.size());
+    for (int32_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(i, read[i]) << "at byte " << i * sizeof(int32_t);
+        }
+}
+
+
+TEST_F(MmapFileSourceTest, ItemsAcrossTheDefaultWindow)
+{
+    // Sparse file with a counter around the end of the first 64 MiB window
+    const std::string sparse_filename = "./mmap_file_source_test_sparse.dat";
+    const int64_t window_items = 64 * 1024 * 1024 / sizeof(int32_t);
+    const int32_t first = static_cast<int32_t>(window_items - 5000);
+    const int32_t count = 10000;
+    {
+        std::ofstream file(sparse_filename, std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(first) * sizeof(int32_t));
+        write_counter(file, first, count);
+    }
+    auto source = make_mmap_file_source(sizeof(int32_t), sparse_filename, false);
+    ASSERT_TRUE(source->seek(first, SEEK_SET));
+    const std::vector<int> read = run(source, 0);
+    std::remove(sparse_filename.c_str());
+    ASSERT_EQ(static_cast<size_t>(count), read.size());
+    for (int32_t i = 0; i < count; i++)
+        {
+            ASSERT_EQ(first + i, read[i]);
+        }
+}
+
+
+TEST_F(MmapFileSourceTest, FileNotExists)
+{
+    EXPECT_THROW({ make_mmap_file_source(sizeof(int32_t), "./i_dont_exist.dat", false); }, std::exception);
+}
@@ -0,0 +1,208 @@
+/*!
+ * \file unpack_samples_test.cc
+ * \brief This file implements unit tests for the blocks that unpack 1, 2 and
+ * 4-bit samples, checking them against a sample-by-sample decoding
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "unpack_2bit_samples.h"
+#include "unpack_byte_2bit_cpx_samples.h"
+#include "unpack_byte_2bit_samples.h"
+#include "unpack_byte_4bit_samples.h"
+#include "unpack_intspir_1bit_samples.h"
+#include "unpack_spir_gss6450_samples.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_b.h>
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_sink_f.h>
+#include <gnuradio/blocks/vector_sink_s.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#include <gnuradio/blocks/vector_source_i.h>
+#endif
+
+
+namespace
+{
+// Enough bytes to go through the vector code and its tail
+const size_t UNPACK_TEST_BYTES = 1003 * 4;
+
+
+std::vector<uint8_t> random_bytes(size_t n)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, 255);
+    std::vector<uint8_t> bytes(n);
+    for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+    return bytes;
+}
+
+
+std::vector<int> random_words(size_t n)
+{
+    const std::vector<uint8_t> bytes = random_bytes(4 * n);
+    std::vector<int> words(n);
+    for (size_t i = 0; i < n; i++)
+        {
+            words[i] = static_cast<int>(static_cast<uint32_t>(bytes[4 * i]) | (static_cast<uint32_t>(bytes[4 * i + 1]) << 8) |
+                                        (static_cast<uint32_t>(bytes[4 * i + 2]) << 16) | (static_cast<uint32_t>(bytes[4 * i + 3]) << 24));
+        }
+    return words;
+}
+
+
+// Two's complement value of the nbits-wide field at bit position shift
+int packed_field(uint32_t value, int shift, int nbits)
+{
+    const int code = static_cast<int>((value >> shift) & ((1U << nbits) - 1U));
+    return code >= (1 << (nbits - 1)) ? code - (1 << nbits) : code;
+}
+
+
+template <typename Source, typename Block, typename Sink>
+void run_flowgraph(const Source& source, const Block& block, const Sink& sink)
+{
+    auto top_block = gr::make_top_block("UnpackSamplesTest");
+    top_block->connect(source, 0, block, 0);
+    top_block->connect(block, 0, sink, 0);
+    top_block->run();
+}
+}  // namespace
+
+
+TEST(UnpackSamplesTest, Byte2bitSamples)
+{
+    const std::vector<uint8_t> packed = random_bytes(UNPACK_TEST_BYTES);
+    auto sink = gr::blocks::vector_sink_f::make();
+    run_flowgraph(gr::blocks::vector_source_b::make(packed), make_unpack_byte_2bit_samples(), sink);
+
+    const std::vector<float> unpacked = sink->data();
+    ASSERT_EQ(4 * packed.size(), unpacked.size());
+    for (size_t i = 0; i < packed.size(); i++)
+        {
+            for (int k = 0; k < 4; k++)
+                {
+                    EXPECT_EQ(static_cast<float>(packed_field(packed[i], 2 * k, 2)), unpacked[4 * i + k]);
+                }
+        }
+}
+
+
+TEST(UnpackSamplesTest, Byte2bitCpxSamples)
+{
+    const std::vector<uint8_t> packed = random_bytes(UNPACK_TEST_BYTES);
+    auto sink = gr::blocks::vector_sink_s::make();
+    run_flowgraph(gr::blocks::vector_source_b::make(packed), make_unpack_byte_2bit_cpx_samples(), sink);
+
+    const std::vector<int16_t> unpacked = sink->data();
+    const int shifts[4] = {4, 6, 0, 2};  // I[n], Q[n], I[n+1], Q[n+1]
+    ASSERT_EQ(4 * packed.size(), unpacked.size());
+    for (size_t i = 0; i < packed.size(); i++)
+        {
+            for (int k = 0; k < 4; k++)
+                {
+                    EXPECT_EQ(2 * packed_field(packed[i], shifts[k], 2) + 1, unpacked[4 * i + k]);
+                }
+        }
+}
+
+
+TEST(UnpackSamplesTest, Byte4bitSamples)
+{
+    const std::vector<uint8_t> packed = random_bytes(UNPACK_TEST_BYTES);
+    auto sink = gr::blocks::vector_sink_b::make();
+    run_flowgraph(gr::blocks::vector_source_b::make(packed), make_unpack_byte_4bit_samples(), sink);
+
+    const std::vector<uint8_t> unpacked = sink->data();
+    ASSERT_EQ(2 * packed.size(), unpacked.size());
+    for (size_t i = 0; i < packed.size(); i++)
+        {
+            EXPECT_EQ(2 * packed_field(packed[i], 0, 4) + 1, static_cast<int8_t>(unpacked[2 * i]));
+            EXPECT_EQ(2 * packed_field(packed[i], 4, 4) + 1, static_cast<int8_t>(unpacked[2 * i + 1]));
+        }
+}
+
+
+TEST(UnpackSamplesTest, ReverseInterleaving2bitSamples)
+{
+    const std::vector<uint8_t> packed = random_bytes(UNPACK_TEST_BYTES);
+    for (bool big_endian_bytes : {false, true})
+        {
+            auto sink = gr::blocks::vector_sink_b::make();
+            run_flowgraph(gr::blocks::vector_source_b::make(packed), make_unpack_2bit_samples(big_endian_bytes, 1, false, true), sink);
+
+            const std::vector<uint8_t> unpacked = sink->data();
+            const int little_endian_shifts[4] = {2, 0, 6, 4};
+            const int big_endian_shifts[4] = {4, 6, 0, 2};
+            const int* shifts = big_endian_bytes ? big_endian_shifts : little_endian_shifts;
+            ASSERT_EQ(4 * packed.size(), unpacked.size());
+            for (size_t i = 0; i < packed.size(); i++)
+                {
+                    for (int k = 0; k < 4; k++)
+                        {
+                            EXPECT_EQ(2 * packed_field(packed[i], shifts[k], 2) + 1, static_cast<int8_t>(unpacked[4 * i + k]));
+                        }
+                }
+        }
+}
+
+
+TEST(UnpackSamplesTest, Intspir1bitSamples)
+{
+    const std::vector<int> packed = random_words(UNPACK_TEST_BYTES / 4);
+    auto sink = gr::blocks::vector_sink_f::make();
+    run_flowgraph(gr::blocks::vector_source_i::make(packed), make_unpack_intspir_1bit_samples(), sink);
+
+    const std::vector<float> unpacked = sink->data();
+    ASSERT_EQ(2 * packed.size(), unpacked.size());
+    for (size_t i = 0; i < packed.size(); i++)
+        {
+            EXPECT_EQ((packed[i] & 1) ? 32767.0F : -32767.0F, unpacked[2 * i]);
+            EXPECT_EQ((packed[i] & 2) ? 32767.0F : -32767.0F, unpacked[2 * i + 1]);
+        }
+}
+
+
+TEST(UnpackSamplesTest, SpirGss6450Samples)
+{
+    const std::vector<int> packed = random_words(UNPACK_TEST_BYTES / 4);
+    for (int adc_bits : {2, 4})
+        {
+            auto sink = gr::blocks::vector_sink_c::make();
+            run_flowgraph(gr::blocks::vector_source_i::make(packed), make_unpack_spir_gss6450_samples(adc_bits), sink);
+
+            const std::vector<gr_complex> unpacked = sink->data();
+            const int samples_per_word = 16 / adc_bits;
+            ASSERT_EQ(samples_per_word * packed.size(), unpacked.size());
+            for (size_t i = 0; i < packed.size(); i++)
+                {
+                    // The first sample of each word is in its most significant bits
+                    for (int k = 0; k < samples_per_word; k++)
+                        {
+                            const int shift = 2 * adc_bits * (samples_per_word - 1 - k);
+                            const auto word = static_cast<uint32_t>(packed[i]);
+                            EXPECT_EQ(gr_complex(static_cast<float>(packed_field(word, shift, adc_bits)), static_cast<float>(packed_field(word, shift + adc_bits, adc_bits))), unpacked[samples_per_word * i + k]);
+                        }
+                }
+        }
+}
@@ -0,0 +1,346 @@
+/*!
+ * \file batch_runner.cc
+ * \brief Runs a list of GNSS-SDR post-processing jobs in parallel, each one
+ * in its own process and output folder
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_runner.h"
+#include "gnss_sdr_filesystem.h"
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <utility>
+
+
+namespace
+{
+// Name of the file that gets the standard output and error of each job
+const char* const BATCH_JOB_OUTPUT = "gnss-sdr.out";
+
+// Name of the copy of the configuration file that each job runs with
+const char* const BATCH_JOB_CONFIG = "gnss-sdr.conf";
+
+
+std::string absolute_path(const std::string& path)
+{
+    return fs::absolute(fs::path(path)).string();
+}
+
+
+// Copies the configuration file, making absolute the relative paths of
+// existing files, so that the job finds them as if it ran from the current
+// folder. Output files (properties with "dump" or "output" in their name)
+// keep their relative paths, and so are written to the job folder.
+bool write_job_config(const std::string& config_file, const std::string& job_config_file)
+{
+    std::ifstream in(config_file);
+    std::ofstream out(job_config_file);
+    if (!in.is_open() || !out.is_open())
+        {
+            return false;
+        }
+    std::string line;
+    while (std::getline(in, line))
+        {
+            const size_t equal = line.find('=');
+            const size_t first = line.find_first_not_of(" \t");
+            if (equal != std::string::npos && first != std::string::npos && line[first] != ';' && line[first] != '#')
+                {
+                    std::string key = line.substr(0, equal);
+                    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return std::tolower(c); });
+                    const size_t value_begin = line.find_first_not_of(" \t", equal + 1);
+                    const size_t value_end = line.find_last_not_of(" \t\r");
+                    if (value_begin != std::string::npos && key.find("dump") == std::string::npos && key.find("output") == std::string::npos)
+                        {
+                            const fs::path value(line.substr(value_begin, value_end - value_begin + 1));
+                            errorlib::error_code ec;
+                            if (value.is_relative() && fs::is_regular_file(value, ec))
+                                {
+                                    line = line.substr(0, value_begin) + fs::absolute(value).string();
+                                }
+                        }
+                }
+            out << line << '\n';
+        }
+    return !out.fail();
+}
+
+
+// A job that is running, and when it was started and asked to stop
+struct Running_Job
+{
+    size_t index;
+    std::chrono::steady_clock::time_point start;
+    std::chrono::steady_clock::time_point stop;
+    bool killed;
+};
+
+
+// Regular files in the job folder, except the console output and the
+// glog files, which are all named after the program
+std::vector<std::string> list_outputs(const fs::path& dir)
+{
+    std::vector<std::string> outputs;
+    errorlib::error_code ec;
+    for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec))
+        {
+            const std::string name = it->path().filename().string();
+            if (fs::is_regular_file(it->path()) && name.compare(0, 9, "gnss-sdr.") != 0)
+                {
+                    outputs.push_back(name);
+                }
+        }
+    std::sort(outputs.begin(), outputs.end());
+    return outputs;
+}
+}  // namespace
+
+
+std::vector<Batch_Job> read_batch_jobs(const std::string& filename)
+{
+    std::ifstream file(filename);
+    if (!file.is_open())
+        {
+            throw std::runtime_error("Cannot open the list of jobs " + filename);
+        }
+    std::vector<Batch_Job> jobs;
+    std::string line;
+    int line_number = 0;
+    while (std::getline(file, line))
+        {
+            line_number++;
+            std::istringstream fields(line);
+            Batch_Job job;
+            if (!(fields >> job.config_file) || job.config_file[0] == '#')
+                {
+                    continue;
+                }
+            fields >> job.signal_file >> job.name;
+            if (job.signal_file == "-")
+                {
+                    job.signal_file.clear();
+                }
+            if (job.name.empty())
+                {
+                    job.name = "job_" + std::to_string(line_number);
+                }
+            for (const auto& other : jobs)
+                {
+                    if (other.name == job.name)
+                        {
+                            throw std::runtime_error("Duplicated job name " + job.name + " in line " + std::to_string(line_number) + " of " + filename);
+                        }
+                }
+            jobs.push_back(job);
+        }
+    return jobs;
+}
+
+
+Batch_Runner::Batch_Runner(std::string gnss_sdr,
+    std::string output_dir,
+    std::vector<std::string> extra_args,
+    int parallel_jobs,
+    double timeout_s,
+    double kill_grace_s)
+    : d_gnss_sdr(std::move(gnss_sdr)),
+      d_output_dir(std::move(output_dir)),
+      d_extra_args(std::move(extra_args)),
+      d_parallel_jobs(parallel_jobs > 0 ? parallel_jobs : 1),
+      d_timeout_s(timeout_s),
+      d_kill_grace_s(kill_grace_s)
+{
+}
+
+
+int Batch_Runner::launch(const Batch_Job& job) const
+{
+    const fs::path dir = fs::absolute(fs::path(d_output_dir) / job.name);
+    errorlib::error_code ec;
+    fs::create_directories(dir, ec);
+    if (ec)
+        {
+            std::cerr << "Cannot create the folder " << dir.string() << ": " << ec.message() << '\n';
+            return -1;
+        }
+
+    // Everything the child needs is prepared before fork()
+    const std::string dir_name = dir.string();
+    const std::string output_name = (dir / BATCH_JOB_OUTPUT).string();
+    const std::string config_name = (dir / BATCH_JOB_CONFIG).string();
+    if (!write_job_config(job.config_file, config_name))
+        {
+            std::cerr << "Cannot copy the configuration file " << job.config_file << " to " << config_name << '\n';
+            return -1;
+        }
+    // A relative path to the executable would not be found from the job folder
+    std::vector<std::string> args = {d_gnss_sdr.find('/') == std::string::npos ? d_gnss_sdr : absolute_path(d_gnss_sdr),
+        "--c=" + config_name,
+        "--log_dir=" + dir_name,
+        "--keyboard=false"};
+    if (!job.signal_file.empty())
+        {
+            args.push_back("--s=" + absolute_path(job.signal_file));
+        }
+    args.insert(args.end(), d_extra_args.begin(), d_extra_args.end());
+    std::vector<char*> argv;
+    for (auto& arg : args)
+        {
+            argv.push_back(&arg[0]);
+        }
+    argv.push_back(nullptr);
+
+    const pid_t pid = fork();
+    if (pid == 0)
+        {
+            if (chdir(dir_name.c_str()) != 0)
+                {
+                    _exit(127);
+                }
+            const int output_fd = open(output_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+            if (output_fd >= 0)
+                {
+                    dup2(output_fd, STDOUT_FILENO);
+                    dup2(output_fd, STDERR_FILENO);
+                    close(output_fd);
+                }
+            const int input_fd = open("/dev/null", O_RDONLY);
+            if (input_fd >= 0)
+                {
+                    dup2(input_fd, STDIN_FILENO);
+                    close(input_fd);
+                }
+            execvp(argv[0], argv.data());
+            _exit(127);
+        }
+    if (pid < 0)
+        {
+            std::cerr << "Cannot start a process for job " << job.name << '\n';
+        }
+    return pid;
+}
+
+
+std::vector<Batch_Result> Batch_Runner::run(const std::vector<Batch_Job>& jobs) const
+{
+    std::vector<Batch_Result> results(jobs.size());
+    std::map<pid_t, Running_Job> running;
+    size_t next = 0;
+    while (next < jobs.size() || !running.empty())
+        {
+            while (next < jobs.size() && running.size() < static_cast<size_t>(d_parallel_jobs))
+                {
+                    results[next].job = jobs[next];
+                    const pid_t pid = launch(jobs[next]);
+                    if (pid > 0)
+                        {
+                            running[pid] = Running_Job{next, std::chrono::steady_clock::now(), {}, false};
+                            std::cout << "Started job " << jobs[next].name << '\n';
+                        }
+                    next++;
+                }
+            if (running.empty())
+                {
+                    continue;
+                }
+
+            int status = 0;
+            const pid_t pid = waitpid(-1, &status, WNOHANG);
+            if (pid < 0 && errno != EINTR)
+                {
+                    std::cerr << "Lost track of the running jobs\n";
+                    break;
+                }
+            const auto now = std::chrono::steady_clock::now();
+            const auto it = running.find(pid);
+            if (pid > 0 && it != running.end())
+                {
+                    Batch_Result& result = results[it->second.index];
+                    result.elapsed_s = std::chrono::duration<double>(now - it->second.start).count();
+                    if (WIFEXITED(status))
+                        {
+                            result.exit_code = WEXITSTATUS(status);
+                        }
+                    else if (WIFSIGNALED(status))
+                        {
+                            result.signal = WTERMSIG(status);
+                        }
+                    result.outputs = list_outputs(fs::path(d_output_dir) / result.job.name);
+                    running.erase(it);
+                    std::cout << (result.ok() ? "Finished" : "FAILED") << " job " << result.job.name
+                              << " in " << result.elapsed_s << " [s]\n";
+                    continue;
+                }
+
+            // Jobs that time out get SIGTERM, so that they can close their
+            // files, and SIGKILL if they are still running after the grace period
+            for (auto& job : running)
+                {
+                    Batch_Result& result = results[job.second.index];
+                    if (d_timeout_s > 0.0 && !result.timed_out && std::chrono::duration<double>(now - job.second.start).count() > d_timeout_s)
+                        {
+                            std::cout << "Job " << result.job.name << " timed out\n";
+                            kill(job.first, SIGTERM);
+                            result.timed_out = true;
+                            job.second.stop = now;
+                        }
+                    else if (result.timed_out && !job.second.killed && std::chrono::duration<double>(now - job.second.stop).count() > d_kill_grace_s)
+                        {
+                            std::cout << "Job " << result.job.name << " did not stop, killing it\n";
+                            kill(job.first, SIGKILL);
+                            job.second.killed = true;
+                        }
+                }
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        }
+    return results;
+}
+
+
+void Batch_Runner::write_summary(const std::vector<Batch_Result>& results, std::ostream& out)
+{
+    out << "name,status,exit_code,elapsed_s,outputs\n";
+    for (const auto& result : results)
+        {
+            std::string status = "ok";
+            if (result.timed_out)
+                {
+                    status = "timeout";
+                }
+            else if (result.signal != 0)
+                {
+                    status = "signal " + std::to_string(result.signal);
+                }
+            else if (result.exit_code != 0)
+                {
+                    status = "failed";
+                }
+            out << result.job.name << ',' << status << ',' << result.exit_code << ',' << result.elapsed_s << ',';
+            for (size_t i = 0; i < result.outputs.size(); i++)
+                {
+                    out << (i == 0 ? "" : ";") << result.outputs[i];
+                }
+            out << '\n';
+        }
+}
@@ -0,0 +1,105 @@
+/*!
+ * \file batch_runner.h
+ * \brief Runs a list of GNSS-SDR post-processing jobs in parallel, each one
+ * in its own process and output folder
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_BATCH_RUNNER_H
+#define GNSS_SDR_BATCH_RUNNER_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+
+/*!
+ * \brief A receiver configuration and the signal file it processes
+ */
+struct Batch_Job
+{
+    std::string name;         //!< Name of the output folder of the job
+    std::string config_file;  //!< Configuration file
+    std::string signal_file;  //!< Signal file. If empty, the one in the configuration file is used
+};
+
+
+struct Batch_Result
+{
+    Batch_Job job;
+    std::vector<std::string> outputs;  //!< Files written by the job, relative to its output folder
+    double elapsed_s = 0.0;
+    int exit_code = -1;  //!< Exit code of gnss-sdr, or -1 if it did not exit normally
+    int signal = 0;      //!< Signal that terminated gnss-sdr, if any
+    bool timed_out = false;
+
+    bool ok() const { return exit_code == 0 && !timed_out; }
+};
+
+
+/*!
+ * \brief Reads a list of jobs, one per line:
+ *
+ *     config_file [signal_file [name]]
+ *
+ * Empty lines and lines starting with '#' are ignored. A signal_file of "-"
+ * means the one in the configuration file. Names default to job_<line>.
+ * Throws std::runtime_error if the list cannot be read.
+ */
+std::vector<Batch_Job> read_batch_jobs(const std::string& filename);
+
+
+/*!
+ * \brief Runs gnss-sdr once per job, with up to parallel_jobs processes at a time.
+ *
+ * Each job runs in the folder output_dir/name, so the PVT, RINEX and dump
+ * files it writes with relative paths stay apart from those of the other
+ * jobs. Its standard output and error, and its logs, are written to that
+ * folder too. The job runs with a copy of its configuration file, written to
+ * that folder, where the relative paths of existing files (other than those
+ * of properties named *dump* or *output*) are made absolute, so that they
+ * are found as from the current folder.
+ *
+ * A job that crashes, fails, or exceeds timeout_s (if it is greater than
+ * zero) is reported as failed and does not affect the others. A job that
+ * times out gets SIGTERM, and SIGKILL if it is still running kill_grace_s
+ * seconds later.
+ */
+class Batch_Runner
+{
+public:
+    Batch_Runner(std::string gnss_sdr,
+        std::string output_dir,
+        std::vector<std::string> extra_args,
+        int parallel_jobs,
+        double timeout_s,
+        double kill_grace_s = 10.0);
+
+    std::vector<Batch_Result> run(const std::vector<Batch_Job>& jobs) const;
+
+    /*!
+     * \brief Writes one CSV line per job: name,status,exit_code,elapsed_s,outputs
+     */
+    static void write_summary(const std::vector<Batch_Result>& results, std::ostream& out);
+
+private:
+    int launch(const Batch_Job& job) const;
+
+    std::string d_gnss_sdr;
+    std::string d_output_dir;
+    std::vector<std::string> d_extra_args;
+    int d_parallel_jobs;
+    double d_timeout_s;
+    double d_kill_grace_s;
+};
+
+#endif  // GNSS_SDR_BATCH_RUNNER_H
@@ -0,0 +1,156 @@
+/*!
+ * \file main.cc
+ * \brief Runs a list of GNSS-SDR post-processing jobs in parallel and writes
+ * a summary of their results.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2024  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "batch_runner.h"
+#include "gnss_sdr_filesystem.h"
+#include <gflags/gflags.h>
+#include <chrono>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if GFLAGS_OLD_NAMESPACE
+namespace gflags
+{
+using namespace google;
+}
+#endif
+
+DEFINE_int32(jobs, 0, "Number of jobs that run at the same time (0 for one per processor core).");
+
+DEFINE_string(output_dir, "./batch", "Folder where each job gets its own output folder, and where the summary is written.");
+
+DEFINE_string(gnss_sdr, "", "Path to the gnss-sdr executable. If not set, the one next to this program, or else the one in the PATH, is used.");
+
+DEFINE_double(timeout_s, 0.0, "If greater than zero, jobs that run for longer than this number of seconds are stopped and reported as failed.");
+
+DEFINE_string(extra_args, "", "Additional command-line arguments for every gnss-sdr job, separated by spaces (e.g. \"--RINEX_version=2\").");
+
+
+namespace
+{
+// The VOLK_GNSSSDR profile and the FFTW wisdom are stored in files that all
+// the jobs share. Without a VOLK_GNSSSDR profile, each job runs the generic kernels.
+bool volk_gnsssdr_profile_found()
+{
+    std::vector<std::string> paths = {"/etc/volk_gnsssdr/volk_gnsssdr_config"};
+    for (const char* variable : {"VOLK_CONFIGPATH", "HOME"})
+        {
+            const char* dir = std::getenv(variable);
+            if (dir != nullptr)
+                {
+                    paths.push_back(std::string(dir) + "/.volk_gnsssdr/volk_gnsssdr_config");
+                    paths.push_back(std::string(dir) + "/volk_gnsssdr/volk_gnsssdr_config");
+                }
+        }
+    errorlib::error_code ec;
+    for (const auto& path : paths)
+        {
+            if (fs::exists(fs::path(path), ec))
+                {
+                    return true;
+                }
+        }
+    return false;
+}
+}  // namespace
+
+
+int main(int argc, char** argv)
+{
+    const std::string intro_help(
+        std::string("\n gnss-sdr-batch runs a list of GNSS-SDR post-processing jobs in parallel\n") +
+        "Copyright (C) 2010-2024 (see AUTHORS file for a list of contributors)\n" +
+        "This program comes with ABSOLUTELY NO WARRANTY;\n" +
+        "See COPYING file to see a copy of the General Public License.\n \n" +
+        "Usage: \n" +
+        "   gnss-sdr-batch [--jobs=N] [--output_dir=folder] <list of jobs>\n \n" +
+        "Each line of the list of jobs is: config_file [signal_file [name]]\n");
+
+    gflags::SetUsageMessage(intro_help);
+    gflags::SetVersionString("1.0");
+    gflags::ParseCommandLineFlags(&argc, &argv, true);
+
+    if (argc != 2)
+        {
+            std::cerr << "Usage:\n";
+            std::cerr << "   " << argv[0]
+                      << " [--jobs=N] [--output_dir=folder] <list of jobs>"
+                      << '\n';
+            gflags::ShutDownCommandLineFlags();
+            return 1;
+        }
+
+    std::vector<Batch_Job> jobs;
+    try
+        {
+            jobs = read_batch_jobs(argv[1]);
+        }
+    catch (const std::exception& e)
+        {
+            std::cerr << e.what() << '\n';
+            gflags::ShutDownCommandLineFlags();
+            return 1;
+        }
+
+    std::string gnss_sdr = FLAGS_gnss_sdr;
+    if (gnss_sdr.empty())
+        {
+            const fs::path sibling = fs::path(argv[0]).parent_path() / "gnss-sdr";
+            errorlib::error_code ec;
+            gnss_sdr = fs::exists(sibling, ec) ? fs::absolute(sibling).string() : "gnss-sdr";
+        }
+    std::istringstream extra_args_stream(FLAGS_extra_args);
+    const std::vector<std::string> extra_args{std::istream_iterator<std::string>(extra_args_stream), std::istream_iterator<std::string>()};
+    const int parallel_jobs = FLAGS_jobs > 0 ? FLAGS_jobs : static_cast<int>(std::thread::hardware_concurrency());
+
+    if (!volk_gnsssdr_profile_found())
+        {
+            std::cout << "Warning: no VOLK_GNSSSDR profile found, the jobs will use the generic kernels.\n"
+                      << "Run volk_gnsssdr_profile once before the batch.\n";
+        }
+    std::cout << "Running " << jobs.size() << " jobs, " << parallel_jobs << " at a time, with " << gnss_sdr << '\n';
+
+    const auto start = std::chrono::steady_clock::now();
+    const Batch_Runner runner(gnss_sdr, FLAGS_output_dir, extra_args, parallel_jobs, FLAGS_timeout_s);
+    const std::vector<Batch_Result> results = runner.run(jobs);
+    const std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start;
+
+    const std::string summary_file = (fs::path(FLAGS_output_dir) / "summary.csv").string();
+    std::ofstream summary(summary_file);
+    Batch_Runner::write_summary(results, summary);
+    Batch_Runner::write_summary(results, std::cout);
+
+    double total_job_seconds = 0.0;
+    int failed = 0;
+    for (const auto& result : results)
+        {
+            total_job_seconds += result.elapsed_s;
+            failed += result.ok() ? 0 : 1;
+        }
+    std::cout << results.size() - failed << " jobs succeeded, " << failed << " failed, in "
+              << elapsed_seconds.count() << " [seconds] (" << total_job_seconds << " [seconds] of job time).\n"
+              << "Summary written to " << summary_file << '\n';
+
+    gflags::ShutDownCommandLineFlags();
+    return failed == 0 ? 0 : 1;
+}
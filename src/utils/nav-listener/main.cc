@@ -16,6 +16,7 @@
 #include "nav_msg_udp_listener.h"
 #include <boost/lexical_cast.hpp>
 #include <iostream>
+#include <string>
 
 int main(int argc, char *argv[])
 {
@@ -32,10 +33,31 @@ int main(int argc, char *argv[])
             unsigned short port = boost::lexical_cast<unsigned short>(argv[1]);
             Nav_Msg_Udp_Listener udp_listener(port);
 
+            std::string data;
+            Fixed_Format_Reader reader;
             while (true)
                 {
+                    if (!udp_listener.receive(data))
+                        {
+                            std::cout << "Error: cannot receive data." << std::endl;
+                            continue;
+                        }
+                    // Datagrams of the fixed-layout format start with a magic
+                    // number, which is not a valid protobuf message start.
+                    if (Fixed_Format_Reader::has_magic(data.data(), data.size()))
+                        {
+                            if (reader.parse(data))
+                                {
+                                    udp_listener.print_fixed_format(reader);
+                                }
+                            else
+                                {
+                                    std::cout << "Error: the fixed-format datagram is truncated." << std::endl;
+                                }
+                            continue;
+                        }
                     gnss_sdr::navMsg message;
-                    if (udp_listener.receive_and_parse_nav_message(message))
+                    if (message.ParseFromString(data))
                         {
                             udp_listener.print_message(message);
                         }
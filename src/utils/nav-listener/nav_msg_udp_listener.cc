@@ -26,18 +26,37 @@ Nav_Msg_Udp_Listener::Nav_Msg_Udp_Listener(unsigned short port)
 }
 
 /**
- * !\brief blocking call to read nav_message from UDP port
- * \param[out] message navigation message class to contain parsed output
- * \return true if message parsed succesfully, false ow
+ * !\brief blocking call to read a datagram from UDP port
+ * \param[out] data content of the datagram
+ * \return true if a datagram was received, false ow
  */
-bool Nav_Msg_Udp_Listener::receive_and_parse_nav_message(gnss_sdr::navMsg &message)
+bool Nav_Msg_Udp_Listener::receive(std::string &data)
 {
     char buff[8192];  // Buffer for storing the received data.
 
     // This call will block until one or more bytes of data has been received.
-    int bytes = socket.receive(boost::asio::buffer(buff));
+    std::size_t bytes = socket.receive(boost::asio::buffer(buff), 0, error);
+    if (error)
+        {
+            return false;
+        }
 
-    std::string data(&buff[0], bytes);
+    data.assign(&buff[0], bytes);
+    return true;
+}
+
+/**
+ * !\brief blocking call to read nav_message from UDP port
+ * \param[out] message navigation message class to contain parsed output
+ * \return true if message parsed succesfully, false ow
+ */
+bool Nav_Msg_Udp_Listener::receive_and_parse_nav_message(gnss_sdr::navMsg &message)
+{
+    std::string data;
+    if (!receive(data))
+        {
+            return false;
+        }
     // Deserialize a stock of Nav_Msg objects from the binary string.
     return message.ParseFromString(data);
 }
@@ -62,3 +81,44 @@ void Nav_Msg_Udp_Listener::print_message(gnss_sdr::navMsg &message) const
               << tow_at_current_symbol_ms << '\n';
     std::cout << "Nav message: " << nav_message << "\n\n";
 }
+
+/*
+ * !\brief prints the records of a datagram in the fixed-layout format
+ * (Gnss_Synchro or Monitor_Pvt monitoring streams)
+ * \param[in] reader reader of a parsed datagram
+ */
+void Nav_Msg_Udp_Listener::print_fixed_format(const Fixed_Format_Reader &reader) const
+{
+    for (std::size_t i = 0; i < reader.record_count(); i++)
+        {
+            Gnss_Synchro_Record gs;
+            Monitor_Pvt_Record pvt;
+            if (reader.get(i, gs))
+                {
+                    std::cout << "Channel " << gs.Channel_ID << ": "
+                              << gs.System << ' ' << std::string(gs.Signal, 2)
+                              << " PRN " << gs.PRN
+                              << ", CN0 [dB-Hz]: " << gs.CN0_dB_hz
+                              << ", Doppler [Hz]: " << gs.Carrier_Doppler_hz
+                              << ", TOW [ms]: " << gs.TOW_at_current_symbol_ms
+                              << ", Pseudorange [m]: " << gs.Pseudorange_m << '\n';
+                }
+            else if (reader.get(i, pvt))
+                {
+                    std::cout << "\nNew PVT solution received:\n";
+                    std::cout << "Week: " << pvt.week << '\n';
+                    std::cout << "TOW [ms]: " << pvt.TOW_at_current_symbol_ms << '\n';
+                    std::cout << "Latitude [deg]: " << pvt.latitude << '\n';
+                    std::cout << "Longitude [deg]: " << pvt.longitude << '\n';
+                    std::cout << "Height [m]: " << pvt.height << '\n';
+                    std::cout << "Valid satellites: " << static_cast<int>(pvt.valid_sats) << '\n';
+                    std::cout << "Solution status: " << static_cast<int>(pvt.solution_status) << '\n';
+                    std::cout << "PDOP: " << pvt.pdop << "\n\n";
+                }
+            else
+                {
+                    std::cout << "Unknown record type " << reader.record_type() << '\n';
+                    return;
+                }
+        }
+}
@@ -16,14 +16,18 @@
 #ifndef GNSS_SDR_NAV_MSG_UDP_LISTENER_H
 #define GNSS_SDR_NAV_MSG_UDP_LISTENER_H
 
+#include "monitor_fixed_format.h"
 #include "nav_message.pb.h"
 #include <boost/asio.hpp>
+#include <string>
 
 class Nav_Msg_Udp_Listener
 {
 public:
     explicit Nav_Msg_Udp_Listener(unsigned short port);
     void print_message(gnss_sdr::navMsg &message) const;
+    void print_fixed_format(const Fixed_Format_Reader &reader) const;
+    bool receive(std::string &data);
     bool receive_and_parse_nav_message(gnss_sdr::navMsg &message);
 
 private: